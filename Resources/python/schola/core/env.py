@@ -13,7 +13,10 @@ from schola.core.spaces import DictSpace
 import logging
 import numpy as np
 import atexit
-from typing import Any, List, Dict, Optional, Tuple, Union, TypeVar
+import bisect
+import queue
+import grpc
+from typing import Any, Iterator, List, Dict, Optional, Set, Tuple, Union, TypeVar
 
 
 T = TypeVar("T")
@@ -33,6 +36,8 @@ class ScholaEnv:
         The verbosity level for the environment.
     environment_start_timeout : int, default=45
         The time to wait for the environment to start in seconds.
+    async_batch_size : int, optional
+        When Unreal steps environments asynchronously, the most environments each poll returns. Each poll waits until this many are ready, or until every environment sent actions is ready if it is None.
     
     Attributes
     ----------
@@ -40,6 +45,8 @@ class ScholaEnv:
         The connection to the Unreal Engine.
     gym_stub : gym_grpc.GymServiceStub
         The gRPC stub for the Gym Service.
+    step_stream : Iterator[gym_communication.StepStreamResponse], optional
+        The responses from the step stream, if Unreal has it enabled. Steps and resets use it in place of the unary RPCs.
     ids : List[List[int]]
         A nested list of all the environments and their active agents.
     agent_display_names : List[Dict[int,str]]
@@ -52,6 +59,12 @@ class ScholaEnv:
         The number of steps taken in the current episode of the environment.
     next_action : Dict[int,Dict[int,Any]], optional
         The next action to be taken by each agent in each environment.
+    num_pipeline_cohorts : int
+        The number of cohorts Unreal steps in turn. If more than one, each poll only returns the environments of one cohort.
+    async_stepping : bool
+        Whether Unreal steps environments asynchronously. If so, each poll only returns the environments that are ready, and actions are only sent for the environments they are given for.
+    env_steps : Dict[int,int]
+        The step of the latest state received for each environment, when stepping asynchronously. Sent back with each action so Unreal can drop actions for outdated states.
     
     Raises
     ------
@@ -66,6 +79,7 @@ class ScholaEnv:
         unreal_connection : UnrealConnection,
         verbosity:int=0,
         environment_start_timeout:int = 45,
+        async_batch_size:Optional[int] = None,
     ):
         super().__init__()
 
@@ -80,6 +94,7 @@ class ScholaEnv:
         logging.info("creating channel")
         self.unreal_connection = unreal_connection
         self.unreal_connection.start()
+        self.step_stream : Optional[Iterator[gym_communication.StepStreamResponse]] = None
         
         atexit.register(self.close)
         self.gym_stub : gym_grpc.GymServiceStub = self.unreal_connection.connect_stubs(gym_grpc.GymServiceStub)[0]
@@ -88,6 +103,8 @@ class ScholaEnv:
         start_msg = gym_communication.GymConnectorStartRequest()
         self.gym_stub.StartGymConnector(start_msg, timeout=environment_start_timeout, wait_for_ready=True)
         
+        self.async_batch_size : Optional[int] = async_batch_size
+
         logging.info("requesting environment definition")
         self.ids : List[List[int]] = []
         self.agent_display_names : List[Dict[int,str]] = []
@@ -111,14 +128,27 @@ class ScholaEnv:
 
         for env_id, env_defn in enumerate(defn_map):
             for agent_id, agent_defn in env_defn.agent_definitions.items():
-                obs_space = DictSpace.from_proto(agent_defn.obs_space)
-                if agent_defn.normalize_obs:
-                    obs_space = obs_space.to_normalized()
+                self._add_space_definitions(env_id, agent_id, agent_defn)
 
-                self.obs_defns.setdefault(env_id, {}).setdefault(agent_id, obs_space)
-                self.action_defns.setdefault(env_id, {}).setdefault(
-                    agent_id, DictSpace.from_proto(agent_defn.action_space)
-                )
+    def _add_space_definitions(self, env_id : int, agent_id : int, agent_defn : env_definitions.AgentDefinition) -> None:
+        """
+        Create the observation and action spaces of a single agent, replacing any it had before.
+
+        Parameters
+        ----------
+        env_id : int
+            The id of the environment the agent is in.
+        agent_id : int
+            The id of the agent in its environment.
+        agent_defn : env_definitions.AgentDefinition
+            The definition of the agent.
+        """
+        obs_space = DictSpace.from_proto(agent_defn.obs_space)
+        if agent_defn.normalize_obs:
+            obs_space = obs_space.to_normalized()
+
+        self.obs_defns.setdefault(env_id, {})[agent_id] = obs_space
+        self.action_defns.setdefault(env_id, {})[agent_id] = DictSpace.from_proto(agent_defn.action_space)
 
     def get_obs_space(self, env_id:int, agent_id:int) -> DictSpace:
         """
@@ -199,6 +229,171 @@ class ScholaEnv:
         ]
         
         self._create_space_definitions(training_defn.environment_definitions)
+        self._create_dense_groups(training_defn.dense_groups)
+        self.num_pipeline_cohorts : int = max(training_defn.num_pipeline_cohorts, 1)
+        # reset states that arrived before they were asked for, either in band with a step or for other cohorts when cohorts are reset together
+        self.pending_resets : Tuple[EnvAgentIdDict[Dict[str,Any]], EnvAgentIdDict[Dict[str,str]]] = ({}, {})
+        self.async_stepping : bool = training_defn.async_stepping
+        # answers to resets sent with UpdateState, which are only read for their changes in membership
+        self.unread_responses : List[grpc.Future] = []
+        # how many messages from Unreal have added or removed agents, so wrappers with a fixed set of agents can tell when it changed
+        self.membership_changes : int = 0
+        if self.async_stepping:
+            self.env_steps : Dict[int,int] = {}
+            # states received but not yet returned by poll, in the order they arrived
+            self.ready_states : Dict[int, Tuple[Dict[int,Any], Dict[int,float], Dict[int,bool], Dict[int,bool], Dict[int,Dict[str,str]]]] = {}
+            # environments sent actions whose states haven't arrived yet
+            self.in_flight : Set[int] = set()
+            # environments we have reset, whose states from before the reset are dropped until their initial state arrives
+            self.awaiting_reset : Set[int] = set()
+        if training_defn.use_step_stream:
+            self._open_step_stream()
+
+    def _open_step_stream(self) -> None:
+        """
+        Open the step stream, which stays open until the environment is closed.
+        Updates are written by putting them on a queue that feeds the stream, and the responses are read in the order Unreal sent them.
+        """
+        logging.info("opening step stream")
+        self.step_stream_requests : queue.Queue = queue.Queue()
+        # the stream ends once None is put on the queue
+        self.step_stream = self.gym_stub.StepStream(iter(self.step_stream_requests.get, None))
+        # Unreal answers every update with a state, including resets whose state we don't use
+        self.unread_states : int = 0
+
+    def _read_step_stream(self, kind : str) -> Union[state.TrainingState, state.InitialTrainingState]:
+        """
+        Read from the step stream until a message of the requested kind arrives, skipping states owed for earlier resets.
+
+        Parameters
+        ----------
+        kind : str
+            Either "state" or "initial_state".
+
+        Returns
+        -------
+        Union[state.TrainingState, state.InitialTrainingState]
+            The first message of that kind.
+        """
+        while True:
+            response : gym_communication.StepStreamResponse = next(self.step_stream)
+            received = response.WhichOneof("msg")
+            # even skipped messages can carry changes in membership
+            if received is not None:
+                self._apply_membership(getattr(response, received).membership)
+            if received == "state" and self.unread_states > 0:
+                self.unread_states -= 1
+            elif received == kind:
+                return getattr(response, received)
+            else:
+                logging.debug(f"skipping {received} while waiting for {kind}")
+
+    def _apply_unread_responses(self) -> None:
+        """
+        Wait for the answers to earlier resets, which are otherwise ignored, and apply the changes in membership they carry.
+        """
+        for response in self.unread_responses:
+            self._apply_membership(response.result().membership)
+        self.unread_responses.clear()
+
+    def _update_state(self, state_update : gym_communication.TrainingStateUpdate) -> state.TrainingState:
+        """
+        Send an update to Unreal and wait for the state that follows it.
+
+        Parameters
+        ----------
+        state_update : gym_communication.TrainingStateUpdate
+            The update to send.
+
+        Returns
+        -------
+        state.TrainingState
+            The state of the environments after the update.
+        """
+        if self.step_stream is None:
+            training_state = self.gym_stub.UpdateState(state_update)
+            self._apply_unread_responses()
+            self._apply_membership(training_state.membership)
+            return training_state
+        self.step_stream_requests.put(state_update)
+        return self._read_step_stream("state")
+
+    def _create_dense_groups(self, dense_groups : List[env_definitions.DenseGroupDefinition]) -> None:
+        """
+        Record the groups of agents whose states and actions are exchanged as dense arrays. Empty unless Unreal has the dense state format enabled.
+
+        Parameters
+        ----------
+        dense_groups : List[env_definitions.DenseGroupDefinition]
+            The dense group definitions sent by Unreal.
+        """
+        # group id -> (obs space, action space), taken from the first agent in the group since all members share them
+        self.dense_group_spaces : Dict[int, Tuple[DictSpace, DictSpace]] = {}
+        self.dense_group_ids : EnvAgentIdDict[int] = {}
+        self._update_dense_groups(dense_groups)
+
+    def _update_dense_groups(self, dense_groups : List[env_definitions.DenseGroupDefinition]) -> None:
+        """
+        Record the members of dense groups, adding any groups that are new. Agents that left the groups must already have been removed.
+
+        Parameters
+        ----------
+        dense_groups : List[env_definitions.DenseGroupDefinition]
+            The dense group definitions sent by Unreal, each with its full membership.
+        """
+        for group in dense_groups:
+            # groups are kept once their last member leaves, and only get spaces once they have a member
+            if group.group_id not in self.dense_group_spaces and len(group.env_ids) > 0:
+                env_id, agent_id = group.env_ids[0], group.agent_ids[0]
+                self.dense_group_spaces[group.group_id] = (self.get_obs_space(env_id, agent_id), self.get_action_space(env_id, agent_id))
+            for env_id, agent_id in zip(group.env_ids, group.agent_ids):
+                self.dense_group_ids.setdefault(env_id, {})[agent_id] = group.group_id
+
+    def _apply_membership(self, membership : env_definitions.MembershipUpdate) -> None:
+        """
+        Add the agents that joined environments since the last message from Unreal, and remove the ones that left. Must be applied to every message, in the order they arrive, before the states in it are read.
+
+        Parameters
+        ----------
+        membership : env_definitions.MembershipUpdate
+            The changes sent by Unreal. Removals are applied first, since a freed agent id can be handed to an agent joining in the same update.
+        """
+        if membership.environments:
+            self.membership_changes += 1
+        for env_id, env_update in membership.environments.items():
+            for agent_id in env_update.removed_agents:
+                if self.agent_display_names[env_id].pop(agent_id, None) is not None:
+                    self.ids[env_id].remove(agent_id)
+                self.obs_defns.get(env_id, {}).pop(agent_id, None)
+                self.action_defns.get(env_id, {}).pop(agent_id, None)
+                self.dense_group_ids.get(env_id, {}).pop(agent_id, None)
+
+            for agent_id, agent_defn in env_update.added_agents.items():
+                if agent_id not in self.agent_display_names[env_id]:
+                    bisect.insort(self.ids[env_id], agent_id)
+                self.agent_display_names[env_id][agent_id] = agent_defn.name
+                self._add_space_definitions(env_id, agent_id, agent_defn)
+
+            logging.debug(f"environment {env_id} gained agents {list(env_update.added_agents)} and lost agents {list(env_update.removed_agents)}")
+        self._update_dense_groups(membership.dense_groups)
+
+    def _is_member(self, env_id : int, agent_id : int) -> bool:
+        """
+        Check if an agent is still in an environment. States and actions can still be in flight for agents that have left.
+
+        Parameters
+        ----------
+        env_id : int
+            The id of the environment.
+        agent_id : int
+            The id of the agent in the environment.
+
+        Returns
+        -------
+        bool
+            True iff the agent is in the environment.
+        """
+        return agent_id in self.obs_defns.get(env_id, {})
 
     def poll(self) -> Tuple[EnvAgentIdDict[Dict[str,Any]], EnvAgentIdDict[float],  EnvAgentIdDict[bool], EnvAgentIdDict[bool], EnvAgentIdDict[Dict[str,str]]]:
         """
@@ -222,17 +417,29 @@ class ScholaEnv:
             logging.info("Starting Epoch")
         # convert action into Proto class
         state_update = gym_communication.TrainingStateUpdate()
-        for env_id in self.next_action:
-            env_update = state_update.updates[env_id].step
-            for agent_id in self.next_action[env_id]:
-                agent_update = env_update.updates[agent_id]
-                self.action_defns[env_id][agent_id].fill_proto(
-                    agent_update.actions, self.next_action[env_id][agent_id]
-                )
+        if self.dense_group_spaces:
+            self._fill_dense_actions(state_update)
+        else:
+            for env_id in self.next_action:
+                env_update = state_update.updates[env_id].step
+                for agent_id in self.next_action[env_id]:
+                    if not self._is_member(env_id, agent_id):
+                        continue
+                    agent_update = env_update.updates[agent_id]
+                    self.action_defns[env_id][agent_id].fill_proto(
+                        agent_update.actions, self.next_action[env_id][agent_id]
+                    )
         state_update.status = gym_communication.CommunicatorStatus.GOOD
         logging.debug(state_update)
+        if self.async_stepping:
+            return self._poll_async(state_update)
         # send it to Unreal
-        training_state = self.gym_stub.UpdateState(state_update)
+        training_state = self._update_state(state_update)
+        if training_state.reset_state.environment_states:
+            # environments that completed this step were already reset by Unreal, so soft_reset can use these instead of asking for them
+            reset_obs, reset_infos = self._convert_reset_state_to_tuple(training_state.reset_state)
+            self.pending_resets[0].update(reset_obs)
+            self.pending_resets[1].update(reset_infos)
         # convert proto to observations, reward, terminated, truncated and other info
         self.steps += 1
         logging.debug(training_state)
@@ -246,7 +453,93 @@ class ScholaEnv:
         
         return observations, rewards, terminateds, truncateds, infos
 
-    
+
+    def _poll_async(self, state_update : gym_communication.TrainingStateUpdate) -> Tuple[EnvAgentIdDict[Dict[str,Any]], EnvAgentIdDict[float],  EnvAgentIdDict[bool], EnvAgentIdDict[bool], EnvAgentIdDict[Dict[str,str]]]:
+        """
+        Send the next actions without waiting for their states, then return the states of the first environments to be ready.
+
+        Parameters
+        ----------
+        state_update : gym_communication.TrainingStateUpdate
+            The update holding the next actions.
+
+        Returns
+        -------
+        Tuple
+            The same tuple as `poll`, for just the environments that are ready.
+        """
+        for env_id in self.next_action:
+            state_update.env_steps[env_id] = self.env_steps.get(env_id, 0)
+        self.in_flight.update(self.next_action)
+        # each action is only sent once, since Unreal drops repeats for the same state anyway
+        self.next_action = {}
+        self.step_stream_requests.put(state_update)
+
+        batch_size = len(self.ready_states) + len(self.in_flight)
+        if self.async_batch_size is not None:
+            batch_size = min(batch_size, self.async_batch_size)
+        assert batch_size > 0, "No environments are waiting on Unreal, so there is nothing to poll. Send actions first"
+        while len(self.ready_states) < batch_size:
+            self._read_async()
+
+        self.steps += 1
+        observations, rewards, terminateds, truncateds, infos = {}, {}, {}, {}, {}
+        for env_id in list(self.ready_states)[:batch_size]:
+            observations[env_id], rewards[env_id], terminateds[env_id], truncateds[env_id], infos[env_id] = self.ready_states.pop(env_id)
+        return observations, rewards, terminateds, truncateds, infos
+
+    def _read_async(self) -> None:
+        """
+        Read the next message from the step stream when stepping asynchronously. States are added to ready_states, and initial states to pending_resets.
+        """
+        response : gym_communication.StepStreamResponse = next(self.step_stream)
+        self._apply_membership(getattr(response, response.WhichOneof("msg")).membership)
+        if response.WhichOneof("msg") == "state":
+            training_state = response.state
+            stepped = [env_id for env_id in training_state.env_steps if env_id not in self.awaiting_reset]
+            if stepped:
+                converted = self._convert_state_to_tuple(training_state)
+                for env_id in stepped:
+                    self.ready_states[env_id] = tuple(values.get(env_id, {}) for values in converted)
+                    self.env_steps[env_id] = training_state.env_steps[env_id]
+                    self.in_flight.discard(env_id)
+            reset_state = training_state.reset_state
+        else:
+            reset_state = response.initial_state
+            self.awaiting_reset.difference_update(reset_state.env_steps)
+
+        reset_ids = [env_id for env_id in reset_state.env_steps if env_id not in self.awaiting_reset]
+        if reset_ids:
+            reset_obs, reset_infos = self._convert_reset_state_to_tuple(reset_state)
+            for env_id in reset_ids:
+                self.pending_resets[0][env_id] = reset_obs.get(env_id, {})
+                self.pending_resets[1][env_id] = reset_infos.get(env_id, {})
+                self.env_steps[env_id] = reset_state.env_steps[env_id]
+
+    def _fill_dense_actions(self, state_update : gym_communication.TrainingStateUpdate) -> None:
+        """
+        Pack the next actions into one dense array per group of agents. Mutates state_update with the result.
+
+        Parameters
+        ----------
+        state_update : gym_communication.TrainingStateUpdate
+            The update message to add the dense actions to.
+        """
+        grouped_actions : Dict[int, List[Tuple[int,int,Dict[str,Any]]]] = {}
+        for env_id, env_actions in self.next_action.items():
+            for agent_id, agent_action in env_actions.items():
+                if not self._is_member(env_id, agent_id):
+                    continue
+                grouped_actions.setdefault(self.dense_group_ids[env_id][agent_id], []).append((env_id, agent_id, agent_action))
+
+        for group_id, members in grouped_actions.items():
+            env_ids, agent_ids, actions = zip(*members)
+            group_msg = state_update.dense_actions.add()
+            group_msg.group_id = group_id
+            group_msg.env_ids.extend(env_ids)
+            group_msg.agent_ids.extend(agent_ids)
+            group_msg.actions = self.dense_group_spaces[group_id][1].fill_dense(actions).astype("<f4", copy=False).tobytes()
+
     def send_actions(self, action : EnvAgentIdDict[Dict[str,Any]]) -> None:
         """
         Send Actions to all agents and environments.
@@ -334,10 +627,29 @@ class ScholaEnv:
                 for key in env_options:
                     reset_msg.options[key] = str(env_options[key])
         # send the message without caring about the response
-        self.gym_stub.UpdateState.future(state_update)
-        # reset everyone
-        
-        return self.soft_reset(target_env_ids)
+        if self.async_stepping:
+            # Unreal only answers with the initial states, and anything already on its way for these environments is out of date
+            self.step_stream_requests.put(state_update)
+            for env_id in target_env_ids:
+                self.awaiting_reset.add(env_id)
+                self.in_flight.discard(env_id)
+                self.ready_states.pop(env_id, None)
+                for pending in self.pending_resets:
+                    pending.pop(env_id, None)
+            return self.soft_reset(target_env_ids)
+        elif self.step_stream is None:
+            reset_response = self.gym_stub.UpdateState.future(state_update)
+        else:
+            self.step_stream_requests.put(state_update)
+            self.unread_states += 1
+        # reset everyone, dropping any reset states left over from before
+        for pending in self.pending_resets:
+            pending.clear()
+        reset_obs, reset_infos = self.soft_reset(target_env_ids)
+        if self.step_stream is None:
+            # Unreal answers the reset after sending the initial states, so its changes in membership come after theirs
+            self.unread_responses.append(reset_response)
+        return reset_obs, reset_infos
 
     def soft_reset(self, ids: List[str] = None) -> Tuple[EnvAgentIdDict[Dict[str,Any]], EnvAgentIdDict[Dict[str,str]]]:
         """
@@ -366,12 +678,33 @@ class ScholaEnv:
             f"Waiting for environment(s) {','.join([str(x) for x in ids])} to reset"
         )
 
-        state_request = gym_communication.InitialTrainingStateRequest()
-        env_state : state.TrainingState = self.gym_stub.RequestInitialTrainingState(state_request)
-        logging.debug(env_state)
-        logging.info("initial environment state received")
-        # Note: Removed other portions for Gym compatibility instead of gymnasium
-        return self._convert_reset_state_to_tuple(env_state)
+        pending_obs, pending_infos = self.pending_resets
+        if self.async_stepping:
+            while not all(env_id in pending_obs for env_id in ids):
+                self._read_async()
+        elif all(env_id in pending_obs for env_id in ids):
+            logging.info("initial environment state already received")
+        else:
+            if self.step_stream is None:
+                state_request = gym_communication.InitialTrainingStateRequest()
+                env_state : state.TrainingState = self.gym_stub.RequestInitialTrainingState(state_request)
+                self._apply_unread_responses()
+                self._apply_membership(env_state.membership)
+            else:
+                env_state : state.TrainingState = self._read_step_stream("initial_state")
+            logging.debug(env_state)
+            logging.info("initial environment state received")
+            # Note: Removed other portions for Gym compatibility instead of gymnasium
+            if self.num_pipeline_cohorts == 1:
+                return self._convert_reset_state_to_tuple(env_state)
+            reset_obs, reset_infos = self._convert_reset_state_to_tuple(env_state)
+            pending_obs.update(reset_obs)
+            pending_infos.update(reset_infos)
+
+        # when pipelining, one reset can cover environments from cohorts whose states we haven't seen yet, so keep those until they are asked for
+        observations = {env_id: pending_obs.pop(env_id) for env_id in ids if env_id in pending_obs}
+        infos = {env_id: pending_infos.pop(env_id) for env_id in ids if env_id in pending_infos}
+        return observations, infos
 
     @property
     def num_agents(self) -> int:
@@ -411,7 +744,12 @@ class ScholaEnv:
         if self.unreal_connection.is_active:
             state_update = gym_communication.TrainingStateUpdate()
             state_update.status = gym_communication.CommunicatorStatus.CLOSED
-            self.gym_stub.UpdateState.future(state_update)
+            if self.step_stream is None:
+                self.gym_stub.UpdateState.future(state_update)
+            else:
+                self.step_stream_requests.put(state_update)
+                self.step_stream_requests.put(None)
+                self.step_stream = None
             logging.info("Sending closed msg to Unreal")
             # this closes the event loop as well
         #this method is safe to call multiple times
@@ -438,6 +776,8 @@ class ScholaEnv:
         info = {}
         for env_id, env_state in reset_state.environment_states.items():
             for agent_id, agent_state in env_state.agent_states.items():
+                if not self._is_member(env_id, agent_id):
+                    continue
                 proc_obs = self.get_obs_space(env_id, agent_id).process_data(
                     agent_state.observations
                 )
@@ -470,6 +810,9 @@ class ScholaEnv:
             A dictionary, keyed by the environment and agent Id, containing the information dictionary for each agent.
         """
         
+        if len(training_state.dense_groups) > 0:
+            return self._convert_dense_state_to_tuple(training_state)
+
         observations = {}
         rewards = {}
         completeds = {}
@@ -477,6 +820,9 @@ class ScholaEnv:
         info = {}
         for env_id, env_state in enumerate(training_state.environment_states):
             for agent_id, agent_state in env_state.agent_states.items():
+                # states can be collected before an agent leaves, and sent after
+                if not self._is_member(env_id, agent_id):
+                    continue
                 proc_obs = self.get_obs_space(env_id, agent_id).process_data(
                     agent_state.observations
                 )
@@ -495,3 +841,49 @@ class ScholaEnv:
                 info.setdefault(env_id, {})[agent_id] = dict(agent_state.info)
 
         return observations, rewards, completeds, truncateds, info
+
+    def _convert_dense_state_to_tuple(self, training_state : state.TrainingState) -> Tuple[EnvAgentIdDict[Dict[str,Any]], EnvAgentIdDict[float],  EnvAgentIdDict[bool], EnvAgentIdDict[bool], EnvAgentIdDict[Dict[str,str]]]:
+        """
+        Convert a training state sent in the dense format, to a tuple of observations, rewards, terminateds, truncateds and infos.
+        Each group is decoded with a single np.frombuffer per array, rather than one protobuf message per agent.
+
+        Parameters
+        ----------
+        training_state : state.TrainingState 
+            The training state object, with dense_groups set.
+
+        Returns
+        -------
+        Tuple
+            The same tuple as `_convert_state_to_tuple`.
+        """
+        observations = {}
+        rewards = {}
+        completeds = {}
+        truncateds = {}
+        info = {}
+        for group in training_state.dense_groups:
+            obs_space = self.dense_group_spaces[group.group_id][0]
+            group_obs = obs_space.process_dense_data(
+                np.frombuffer(group.observations, dtype="<f4").reshape(-1, obs_space.dense_dim)
+            )
+            group_rewards = np.frombuffer(group.rewards, dtype="<f4")
+            group_statuses = np.frombuffer(group.statuses, dtype=np.uint8)
+
+            for i, (env_id, agent_id) in enumerate(zip(group.env_ids, group.agent_ids)):
+                if not self._is_member(env_id, agent_id):
+                    continue
+                observations.setdefault(env_id, {})[agent_id] = group_obs[i]
+                rewards.setdefault(env_id, {})[agent_id] = float(group_rewards[i])
+                completeds.setdefault(env_id, {})[agent_id] = bool(group_statuses[i] == state.Status.COMPLETED)
+                truncateds.setdefault(env_id, {})[agent_id] = bool(group_statuses[i] == state.Status.TRUNCATED)
+                info.setdefault(env_id, {})[agent_id] = {}
+
+        # Only agents with a non-empty info are sent in the sparse states
+        for env_id, env_state in enumerate(training_state.environment_states):
+            for agent_id, agent_state in env_state.agent_states.items():
+                if not self._is_member(env_id, agent_id):
+                    continue
+                info.setdefault(env_id, {})[agent_id] = dict(agent_state.info)
+
+        return observations, rewards, completeds, truncateds, info
@@ -0,0 +1,310 @@
+# Copyright (c) 2024 Advanced Micro Devices, Inc. All Rights Reserved.
+"""
+A transport to Unreal Engine over a named block of shared memory, for trainers running on the same machine as Unreal.
+The block is created by Unreal and holds two single producer, single consumer rings of length prefixed protobuf messages, one in each direction.
+Must match the layout in SharedMemoryTransport.h.
+"""
+
+import logging
+import os
+import time
+from collections import deque
+from multiprocessing import shared_memory
+from typing import Deque, Dict, Optional, Tuple, Type
+from google.protobuf.message import Message
+import schola.generated.GymConnector_pb2 as gym_communication
+import schola.generated.Definitions_pb2 as env_definitions
+import schola.generated.State_pb2 as state
+
+# The methods each message is tagged with. Mirrors ESharedMemoryMethod
+START_GYM_CONNECTOR = 1
+REQUEST_TRAINING_DEFINITION = 2
+UPDATE_STATE = 3
+REQUEST_INITIAL_TRAINING_STATE = 4
+
+MAGIC = 0x4D485353
+VERSION = 1
+HEADER_SIZE = 64
+CONTROL_SIZE = 128
+RECORD_HEADER_SIZE = 8
+WRAP_MARKER = 0xFFFFFFFF
+
+
+def _backoff(attempt: int) -> None:
+    """
+    Wait a little longer each time there is nothing to do. Spins first, so a message that arrives right away is picked up without giving up the core.
+
+    Parameters
+    ----------
+    attempt : int
+        How many times in a row we have waited.
+    """
+    if attempt < 1024:
+        return
+    elif attempt < 2048:
+        time.sleep(0)
+    else:
+        time.sleep(0.0001)
+
+
+def _record_size(size: int) -> int:
+    """
+    Get the bytes a record takes up in a ring, including its header and padding to 8 bytes.
+    """
+    return (RECORD_HEADER_SIZE + size + 7) & ~7
+
+
+def _open_shared_memory(name: str) -> shared_memory.SharedMemory:
+    """
+    Open an existing block of shared memory, without letting this process unlink it on exit, since Unreal owns it.
+    """
+    try:
+        return shared_memory.SharedMemory(name=name, track=False)
+    except TypeError:
+        # track was added in python 3.13
+        shm = shared_memory.SharedMemory(name=name)
+        if os.name == "posix":
+            from multiprocessing import resource_tracker
+            resource_tracker.unregister(shm._name, "shared_memory")
+        return shm
+
+
+class SharedMemoryRing:
+    """
+    One direction of the transport.
+
+    Parameters
+    ----------
+    buffer : memoryview
+        The whole block of shared memory.
+    offset : int
+        Where this ring's control block starts in the buffer.
+    capacity : int
+        The size of this ring's data area in bytes.
+    """
+
+    def __init__(self, buffer: memoryview, offset: int, capacity: int):
+        # write position at index 0, read position on the next cache line at index 8
+        self.positions = buffer[offset : offset + CONTROL_SIZE].cast("Q")
+        self.headers = buffer[offset + CONTROL_SIZE : offset + CONTROL_SIZE + capacity].cast("I")
+        self.data = buffer[offset + CONTROL_SIZE : offset + CONTROL_SIZE + capacity]
+        self.capacity = capacity
+
+    def _wait_for_space(self, pos: int, needed: int) -> None:
+        attempt = 0
+        while pos + needed - self.positions[8] > self.capacity:
+            _backoff(attempt)
+            attempt += 1
+
+    def write(self, method: int, payload: bytes) -> None:
+        """
+        Write a record, waiting for space if the ring is full.
+
+        Parameters
+        ----------
+        method : int
+            The method to tag the record with.
+        payload : bytes
+            The serialized message.
+        """
+        record_size = _record_size(len(payload))
+        if record_size > self.capacity:
+            raise ValueError(f"Message of {len(payload)} bytes doesn't fit in a shared memory ring of {self.capacity} bytes")
+
+        pos = self.positions[0]
+        offset = pos % self.capacity
+        tail = self.capacity - offset
+        if record_size > tail:
+            # skip the rest of the ring, so the record is contiguous
+            self._wait_for_space(pos, tail)
+            self.headers[offset // 4] = 0
+            self.headers[offset // 4 + 1] = WRAP_MARKER
+            pos += tail
+            self.positions[0] = pos
+            offset = 0
+
+        self._wait_for_space(pos, record_size)
+        self.headers[offset // 4] = len(payload)
+        self.headers[offset // 4 + 1] = method
+        start = offset + RECORD_HEADER_SIZE
+        self.data[start : start + len(payload)] = payload
+        self.positions[0] = pos + record_size
+
+    def try_read(self) -> Optional[Tuple[int, bytes]]:
+        """
+        Read the next record if there is one.
+
+        Returns
+        -------
+        Optional[Tuple[int, bytes]]
+            The method and payload of the record, or None if the ring is empty.
+        """
+        pos = self.positions[8]
+        while pos != self.positions[0]:
+            offset = pos % self.capacity
+            size, method = self.headers[offset // 4], self.headers[offset // 4 + 1]
+            if method == WRAP_MARKER:
+                pos += self.capacity - offset
+                self.positions[8] = pos
+                continue
+            start = offset + RECORD_HEADER_SIZE
+            payload = bytes(self.data[start : start + size])
+            self.positions[8] = pos + _record_size(size)
+            return method, payload
+        return None
+
+    def release(self) -> None:
+        """
+        Release the views into the shared memory, so the block can be closed.
+        """
+        self.positions.release()
+        self.headers.release()
+        self.data.release()
+
+
+class _UpdateStateMethod:
+    """
+    Stands in for the UpdateState method of the gRPC stub, which can be called or used as a future.
+    """
+
+    def __init__(self, stub: "SharedMemoryGymStub"):
+        self.stub = stub
+
+    def __call__(self, request: gym_communication.TrainingStateUpdate, timeout: Optional[float] = None) -> state.TrainingState:
+        self.stub._send(UPDATE_STATE, request)
+        return self.stub._receive(UPDATE_STATE, state.TrainingState, timeout)
+
+    def future(self, request: gym_communication.TrainingStateUpdate) -> None:
+        # the response still arrives, so note that it should be dropped
+        self.stub._send(UPDATE_STATE, request)
+        self.stub.unclaimed[UPDATE_STATE] = self.stub.unclaimed.get(UPDATE_STATE, 0) + 1
+
+
+class SharedMemoryGymStub:
+    """
+    A client for the Gym Service over shared memory, with the same methods as the gRPC stub that ScholaEnv uses.
+
+    Parameters
+    ----------
+    name : str
+        The name of the block of shared memory, matching the SharedMemoryName setting or -ScholaSharedMemory argument given to Unreal.
+
+    Attributes
+    ----------
+    name : str
+        The name of the block of shared memory.
+    unclaimed : Dict[int,int]
+        The number of responses to drop for each method, because they answer requests whose response was ignored.
+    """
+
+    def __init__(self, name: str):
+        self.name = name
+        self.shm: Optional[shared_memory.SharedMemory] = None
+        self.to_unreal: Optional[SharedMemoryRing] = None
+        self.from_unreal: Optional[SharedMemoryRing] = None
+        # messages that arrived while waiting on a different method
+        self.received: Dict[int, Deque[bytes]] = {}
+        self.unclaimed: Dict[int, int] = {}
+        self.UpdateState = _UpdateStateMethod(self)
+
+    def _attach(self, timeout: Optional[float]) -> None:
+        """
+        Open the block of shared memory, waiting for Unreal to create it.
+
+        Parameters
+        ----------
+        timeout : float, optional
+            How long to wait in seconds. Waits forever if None.
+
+        Raises
+        ------
+        TimeoutError
+            If the block isn't ready before the timeout.
+        """
+        deadline = None if timeout is None else time.monotonic() + timeout
+        while self.shm is None:
+            try:
+                shm = _open_shared_memory(self.name)
+                header = shm.buf[:HEADER_SIZE].cast("I")
+                magic, version, capacity = header[0], header[1], header[2]
+                header.release()
+                if magic == MAGIC:
+                    assert version == VERSION, f"Unreal uses version {version} of the shared memory transport, expected {VERSION}"
+                    self.shm = shm
+                    self.to_unreal = SharedMemoryRing(shm.buf, HEADER_SIZE, capacity)
+                    self.from_unreal = SharedMemoryRing(shm.buf, HEADER_SIZE + CONTROL_SIZE + capacity, capacity)
+                    logging.info(f"attached to shared memory {self.name}")
+                    return
+                shm.close()
+            except FileNotFoundError:
+                pass
+            if deadline is not None and time.monotonic() > deadline:
+                raise TimeoutError(f"Shared memory {self.name} was not created by Unreal within {timeout} seconds")
+            time.sleep(0.1)
+
+    def _send(self, method: int, request: Message) -> None:
+        self.to_unreal.write(method, request.SerializeToString())
+
+    def _receive(self, method: int, message_type: Type[Message], timeout: Optional[float] = None) -> Message:
+        """
+        Wait for the next message for a method, holding on to any messages for other methods that arrive first.
+
+        Parameters
+        ----------
+        method : int
+            The method to wait for.
+        message_type : Type[Message]
+            The type to parse the message as.
+        timeout : float, optional
+            How long to wait in seconds. Waits forever if None.
+
+        Returns
+        -------
+        Message
+            The parsed message.
+
+        Raises
+        ------
+        TimeoutError
+            If no message arrives before the timeout.
+        """
+        deadline = None if timeout is None else time.monotonic() + timeout
+        pending = self.received.setdefault(method, deque())
+        attempt = 0
+        while True:
+            while pending and self.unclaimed.get(method, 0) > 0:
+                pending.popleft()
+                self.unclaimed[method] -= 1
+            if pending:
+                return message_type.FromString(pending.popleft())
+
+            record = self.from_unreal.try_read()
+            if record is not None:
+                self.received.setdefault(record[0], deque()).append(record[1])
+                attempt = 0
+                continue
+            if deadline is not None and time.monotonic() > deadline:
+                raise TimeoutError(f"No response from Unreal over shared memory {self.name} within {timeout} seconds")
+            _backoff(attempt)
+            attempt += 1
+
+    def StartGymConnector(self, request: gym_communication.GymConnectorStartRequest, timeout: Optional[float] = None, wait_for_ready: bool = False) -> gym_communication.GymConnectorStartResponse:
+        self._attach(timeout)
+        self._send(START_GYM_CONNECTOR, request)
+        return self._receive(START_GYM_CONNECTOR, gym_communication.GymConnectorStartResponse, timeout)
+
+    def RequestTrainingDefinition(self, request: gym_communication.TrainingDefinitionRequest, timeout: Optional[float] = None) -> env_definitions.TrainingDefinition:
+        return self._receive(REQUEST_TRAINING_DEFINITION, env_definitions.TrainingDefinition, timeout)
+
+    def RequestInitialTrainingState(self, request: gym_communication.InitialTrainingStateRequest, timeout: Optional[float] = None) -> state.InitialTrainingState:
+        return self._receive(REQUEST_INITIAL_TRAINING_STATE, state.InitialTrainingState, timeout)
+
+    def close(self) -> None:
+        """
+        Detach from the block of shared memory. Safe to call multiple times.
+        """
+        if self.shm is not None:
+            self.to_unreal.release()
+            self.from_unreal.release()
+            self.shm.close()
+            self.shm = None
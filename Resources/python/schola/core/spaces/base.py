@@ -81,6 +81,22 @@ class UnrealSpace:
         """
         ...
 
+    def process_dense_data(self, columns : np.ndarray) -> np.ndarray:
+        """
+        Convert the columns of a dense batch corresponding to this space to a pythonic representation, with one row per point.
+
+        Parameters
+        ----------
+        columns : np.ndarray
+            A float32 array of shape [num_points, len(self)], holding one value per dimension.
+        
+        Returns
+        -------
+        np.ndarray
+            The pythonic representation of the points.
+        """
+        ...
+
     def fill_proto(self, msg : proto_points.FundamentalPoint, value: Any) -> None:
         """
         Convert a python representation of point in this space to a protobuf message. Mutates msg with the result.
@@ -92,7 +92,15 @@ class MultiBinarySpace(gymnasium.spaces.MultiBinary, UnrealSpace):
 
             
     def process_data(self, msg: proto_points.FundamentalPoint) -> np.ndarray:
-        return np.asarray(msg.binary_point.values)
+        point = msg.binary_point
+        if point.num_packed_values > 0:
+            # bit-packed points store bit i in byte i // 8 at position i % 8
+            packed = np.frombuffer(point.packed_values, dtype=np.uint8)
+            return np.unpackbits(packed, count=point.num_packed_values, bitorder="little").astype(bool)
+        return np.asarray(point.values)
+
+    def process_dense_data(self, columns: np.ndarray) -> np.ndarray:
+        return columns != 0
 
     def __len__(self) -> int:
         return self.shape[0]
\ No newline at end of file
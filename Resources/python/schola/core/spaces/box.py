@@ -133,4 +133,7 @@ class BoxSpace(gymnasium.spaces.Box, UnrealSpace):
         return self.shape[0]
 
     def process_data(self, msg : proto_points.FundamentalPoint) -> np.ndarray:
-        return np.asarray(msg.box_point.values)
\ No newline at end of file
+        return np.asarray(msg.box_point.values)
+
+    def process_dense_data(self, columns: np.ndarray) -> np.ndarray:
+        return columns
@@ -4,7 +4,7 @@ Implementation of a DictionarySpace, a space representing a string keyed diction
 """
 from collections import OrderedDict
 from functools import cached_property
-from typing import Dict, List, Union
+from typing import Any, Dict, List, Union
 import gymnasium
 import schola.generated.Spaces_pb2 as proto_spaces
 import schola.generated.Points_pb2 as proto_points
@@ -101,6 +101,67 @@ class DictSpace(gymnasium.spaces.Dict):
 
     def process_data(self, msg : proto_points.DictPoint):
         return {name: space.process_data(point_msg) for name, space, point_msg in zip(*zip(*self.spaces.items()), msg.values)}
+
+    @cached_property
+    def dense_dim(self) -> int:
+        """
+        Get the number of values in a dense row of this space, one per dimension of each subspace.
+
+        Returns
+        -------
+        int
+            The width of a dense row
+        """
+        return sum(self.shapes.values())
+
+    def process_dense_data(self, batch : np.ndarray) -> List[Dict[str, np.ndarray]]:
+        """
+        Split a dense [num_points, dense_dim] batch of points in this space into one dictionary per point.
+
+        Parameters
+        ----------
+        batch : np.ndarray
+            The dense batch, e.g. from np.frombuffer on a dense group state.
+
+        Returns
+        -------
+        List[Dict[str, np.ndarray]]
+            The points, with the entry for each subspace being a view into a converted column block of the batch
+
+        Examples
+        --------
+        >>> space = DictSpace({"a": BoxSpace([0,0],[2,2]), "b": BoxSpace([0],[1])})
+        >>> space.process_dense_data(np.array([[1.0, 2.0, 0.5]], dtype=np.float32))
+        [{'a': array([1., 2.], dtype=float32), 'b': array([0.5], dtype=float32)}]
+        """
+        columns = {}
+        offset = 0
+        for name, space in self.spaces.items():
+            width = self.shapes[name]
+            columns[name] = space.process_dense_data(batch[:, offset:offset + width])
+            offset += width
+        return [{name: column[i] for name, column in columns.items()} for i in range(batch.shape[0])]
+
+    def fill_dense(self, points : List[Dict[str, Any]]) -> np.ndarray:
+        """
+        Pack a list of points in this space into a dense [num_points, dense_dim] float32 batch.
+
+        Parameters
+        ----------
+        points : List[Dict[str, Any]]
+            The points to pack, e.g. the actions of every agent in a dense group.
+
+        Returns
+        -------
+        np.ndarray
+            The dense batch, with discrete values stored as their index and binary values as 0 or 1
+        """
+        batch = np.empty((len(points), self.dense_dim), dtype=np.float32)
+        offset = 0
+        for name, width in self.shapes.items():
+            batch[:, offset:offset + width] = np.asarray([point[name] for point in points], dtype=np.float32).reshape(len(points), width)
+            offset += width
+        return batch
     
     @property
     def has_only_one_fundamental_type(self):
@@ -121,6 +121,9 @@ class DiscreteSpace(gymnasium.spaces.Discrete, UnrealSpace):
     def process_data(self, msg: proto_points.FundamentalPoint):
         return next(iter(msg.discrete_point.values))
 
+    def process_dense_data(self, columns: np.ndarray) -> np.ndarray:
+        return columns[:, 0].astype(np.int64)
+
     def to_normalized(self):
         return self
     
@@ -200,6 +203,9 @@ class MultiDiscreteSpace(gymnasium.spaces.MultiDiscrete, UnrealSpace):
     def process_data(self, msg: proto_points.FundamentalPoint) -> np.ndarray:
         return np.asarray(msg.discrete_point.values)
 
+    def process_dense_data(self, columns: np.ndarray) -> np.ndarray:
+        return columns.astype(np.int64)
+
     def __len__(self) -> int:
         """
         Get the number of discrete values in the space.
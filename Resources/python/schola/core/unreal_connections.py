@@ -8,6 +8,7 @@ import subprocess
 from typing import List, Optional, Tuple
 import grpc
 import socket
+from schola.core.shared_memory import SharedMemoryGymStub
 
 
 class UnrealConnection:
@@ -21,6 +22,8 @@ class UnrealConnection:
 
     port : int
         The port on that URL to connect to
+    shared_memory_name : str, optional
+        If set, talk to Unreal Engine through the block of shared memory with this name instead of gRPC. Unreal must be running on the same machine.
 
     Attributes
     ----------
@@ -30,11 +33,17 @@ class UnrealConnection:
         The port on the URL to connect to
     channel: grpc.Channel
         The channel connecting to Unreal Engine on the chosen address
+    shared_memory_name: str, optional
+        The name of the block of shared memory used in place of gRPC, if any
+    shared_memory_stub: SharedMemoryGymStub, optional
+        The client for the Gym Service over shared memory. None unless the connection is using shared memory and has been started
     """
-    def __init__(self, url:str, port: int):
+    def __init__(self, url:str, port: int, shared_memory_name: Optional[str] = None):
         self.channel : Optional[grpc.Channel] = None
         self.url = url
         self.port = port
+        self.shared_memory_name = shared_memory_name
+        self.shared_memory_stub : Optional[SharedMemoryGymStub] = None
 
     def close(self) -> None:
         """
@@ -43,11 +52,17 @@ class UnrealConnection:
         if self.channel:
             self.channel.close()
             self.channel = None
+        if self.shared_memory_stub:
+            self.shared_memory_stub.close()
+            self.shared_memory_stub = None
 
     def start(self) -> None:
         """
         Open the Connection to Unreal Engine.
         """
+        if self.shared_memory_name is not None:
+            self.shared_memory_stub = SharedMemoryGymStub(self.shared_memory_name)
+            return
         self.channel = grpc.secure_channel(
             self.address, grpc.local_channel_credentials()
         ).__enter__()
@@ -66,13 +81,15 @@ class UnrealConnection:
 
     def connect_stubs(self, *stubs : List["grpc.Stub"]) -> List["grpc.Stub"]:
         """
-        Connects the gRPC stubs to the Unreal Engine channel
+        Connects the gRPC stubs to the Unreal Engine channel. When using shared memory, the Gym Service stub is the only one available and stands in for every stub.
 
         Parameters
         ----------
         *stubs : List["grpc.Stub"]
             The gRPC stubs to connect to the Unreal Engine channel
         """
+        if self.shared_memory_stub is not None:
+            return [self.shared_memory_stub for stub in stubs]
 
         assert (
             self.channel != None
@@ -89,7 +106,7 @@ class UnrealConnection:
         bool
             Whether the connection is active or not
         """
-        return self.channel != None
+        return self.channel != None or self.shared_memory_stub != None
     
     def __bool__(self) -> bool:
         """
@@ -137,17 +154,19 @@ class UnrealEditorConnection(UnrealConnection):
         The URL to connect to
     port : int
         The port on that URL to connect to
+    shared_memory_name : str, optional
+        If set, talk to Unreal Engine through the block of shared memory with this name instead of gRPC
 
     Raises
     ------
     AssertionError
-        If the port is not supplied
+        If neither the port nor a shared memory name is supplied
     """
 
-    def __init__(self, url:str, port:int):
-        super().__init__(url, port)
+    def __init__(self, url:str, port:int, shared_memory_name: Optional[str] = None):
+        super().__init__(url, port, shared_memory_name)
         assert (
-            self.port is not None
+            self.port is not None or self.shared_memory_name is not None
         ), "Port must be supplied to open a connection to an existing Unreal Process"
 
 
@@ -173,6 +192,8 @@ class StandaloneUnrealConnection(UnrealConnection):
         Use a fixed fps while running, if None, no fixed timestep is used
     disable_script : bool, default=False
         Whether to disable the autolaunch script setting in the Unreal Engine Schola Plugin
+    shared_memory_name : str, optional
+        If set, talk to Unreal Engine through the block of shared memory with this name instead of gRPC
     
     Attributes
     ----------
@@ -204,13 +225,14 @@ class StandaloneUnrealConnection(UnrealConnection):
         display_logs: bool = True,
         set_fps: Optional[int] = None,
         disable_script: bool = False,
+        shared_memory_name: Optional[str] = None,
     ):
         if port is None:
             self.tcp_socket, port = self.get_open_port(url)
         else:
             self.tcp_socket = None
             port = port
-        super().__init__(url, port)
+        super().__init__(url, port, shared_memory_name)
         self.ue_path = ue_path
         self.headless_mode = headless_mode
         self.display_logs = display_logs
@@ -243,6 +265,8 @@ class StandaloneUnrealConnection(UnrealConnection):
         args += ["-ScholaPort", str(self.port)]
         if self.disable_script:
             args += ["-ScholaDisableScript"]
+        if self.shared_memory_name is not None:
+            args += ["-ScholaSharedMemory=" + self.shared_memory_name]
         return args
 
     def start(self) -> None:
@@ -14,7 +14,7 @@ _sym_db = _symbol_database.Default()
 import schola.generated.Spaces_pb2 as Spaces__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x11\x44\x65\x66initions.proto\x12\x06Schola\x1a\x0cSpaces.proto\"\xa0\x01\n\x0f\x41gentDefinition\x12\x0c\n\x04name\x18\x01 \x01(\t\x12$\n\tobs_space\x18\x02 \x01(\x0b\x32\x11.Schola.DictSpace\x12\'\n\x0c\x61\x63tion_space\x18\x04 \x01(\x0b\x32\x11.Schola.DictSpace\x12\x15\n\rnormalize_obs\x18\x06 \x01(\x08\x12\x19\n\x11normalize_actions\x18\x07 \x01(\x08\"\xb9\x01\n\x15\x45nvironmentDefinition\x12N\n\x11\x61gent_definitions\x18\x01 \x03(\x0b\x32\x33.Schola.EnvironmentDefinition.AgentDefinitionsEntry\x1aP\n\x15\x41gentDefinitionsEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12&\n\x05value\x18\x02 \x01(\x0b\x32\x17.Schola.AgentDefinition:\x02\x38\x01\"T\n\x12TrainingDefinition\x12>\n\x17\x65nvironment_definitions\x18\x01 \x03(\x0b\x32\x1d.Schola.EnvironmentDefinitionb\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x11\x44\x65\x66initions.proto\x12\x06Schola\x1a\x0cSpaces.proto\"\xa0\x01\n\x0f\x41gentDefinition\x12\x0c\n\x04name\x18\x01 \x01(\t\x12$\n\tobs_space\x18\x02 \x01(\x0b\x32\x11.Schola.DictSpace\x12\'\n\x0c\x61\x63tion_space\x18\x04 \x01(\x0b\x32\x11.Schola.DictSpace\x12\x15\n\rnormalize_obs\x18\x06 \x01(\x08\x12\x19\n\x11normalize_actions\x18\x07 \x01(\x08\"\xb9\x01\n\x15\x45nvironmentDefinition\x12N\n\x11\x61gent_definitions\x18\x01 \x03(\x0b\x32\x33.Schola.EnvironmentDefinition.AgentDefinitionsEntry\x1aP\n\x15\x41gentDefinitionsEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12&\n\x05value\x18\x02 \x01(\x0b\x32\x17.Schola.AgentDefinition:\x02\x38\x01\"q\n\x14\x44\x65nseGroupDefinition\x12\x10\n\x08group_id\x18\x01 \x01(\x05\x12\x0f\n\x07obs_dim\x18\x02 \x01(\x05\x12\x12\n\naction_dim\x18\x03 \x01(\x05\x12\x0f\n\x07\x65nv_ids\x18\x04 \x03(\x05\x12\x11\n\tagent_ids\x18\x05 \x03(\x05\"\xd7\x01\n\x12TrainingDefinition\x12>\n\x17\x65nvironment_definitions\x18\x01 \x03(\x0b\x32\x1d.Schola.EnvironmentDefinition\x12\x32\n\x0c\x64\x65nse_groups\x18\x02 \x03(\x0b\x32\x1c.Schola.DenseGroupDefinition\x12\x17\n\x0fuse_step_stream\x18\x03 \x01(\x08\x12\x1c\n\x14num_pipeline_cohorts\x18\x04 \x01(\x05\x12\x16\n\x0e\x61sync_stepping\x18\x05 \x01(\x08\"\xce\x01\n\x1b\x45nvironmentMembershipUpdate\x12J\n\x0c\x61\x64\x64\x65\x64_agents\x18\x01 \x03(\x0b\x32\x34.Schola.EnvironmentMembershipUpdate.AddedAgentsEntry\x12\x16\n\x0eremoved_agents\x18\x02 \x03(\x05\x1aK\n\x10\x41\x64\x64\x65\x64\x41gentsEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12&\n\x05value\x18\x02 \x01(\x0b\x32\x17.Schola.AgentDefinition:\x02\x38\x01\"\xe2\x01\n\x10MembershipUpdate\x12@\n\x0c\x65nvironments\x18\x01 \x03(\x0b\x32*.Schola.MembershipUpdate.EnvironmentsEntry\x12\x32\n\x0c\x64\x65nse_groups\x18\x02 \x03(\x0b\x32\x1c.Schola.DenseGroupDefinition\x1aX\n\x11\x45nvironmentsEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12\x32\n\x05value\x18\x02 \x01(\x0b\x32#.Schola.EnvironmentMembershipUpdate:\x02\x38\x01\x62\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'Definitions_pb2', globals())
@@ -23,12 +23,26 @@ if _descriptor._USE_C_DESCRIPTORS == False:
   DESCRIPTOR._options = None
   _ENVIRONMENTDEFINITION_AGENTDEFINITIONSENTRY._options = None
   _ENVIRONMENTDEFINITION_AGENTDEFINITIONSENTRY._serialized_options = b'8\001'
+  _ENVIRONMENTMEMBERSHIPUPDATE_ADDEDAGENTSENTRY._options = None
+  _ENVIRONMENTMEMBERSHIPUPDATE_ADDEDAGENTSENTRY._serialized_options = b'8\001'
+  _MEMBERSHIPUPDATE_ENVIRONMENTSENTRY._options = None
+  _MEMBERSHIPUPDATE_ENVIRONMENTSENTRY._serialized_options = b'8\001'
   _AGENTDEFINITION._serialized_start=44
   _AGENTDEFINITION._serialized_end=204
   _ENVIRONMENTDEFINITION._serialized_start=207
   _ENVIRONMENTDEFINITION._serialized_end=392
   _ENVIRONMENTDEFINITION_AGENTDEFINITIONSENTRY._serialized_start=312
   _ENVIRONMENTDEFINITION_AGENTDEFINITIONSENTRY._serialized_end=392
-  _TRAININGDEFINITION._serialized_start=394
-  _TRAININGDEFINITION._serialized_end=478
+  _DENSEGROUPDEFINITION._serialized_start=394
+  _DENSEGROUPDEFINITION._serialized_end=507
+  _TRAININGDEFINITION._serialized_start=510
+  _TRAININGDEFINITION._serialized_end=725
+  _ENVIRONMENTMEMBERSHIPUPDATE._serialized_start=728
+  _ENVIRONMENTMEMBERSHIPUPDATE._serialized_end=934
+  _ENVIRONMENTMEMBERSHIPUPDATE_ADDEDAGENTSENTRY._serialized_start=859
+  _ENVIRONMENTMEMBERSHIPUPDATE_ADDEDAGENTSENTRY._serialized_end=934
+  _MEMBERSHIPUPDATE._serialized_start=937
+  _MEMBERSHIPUPDATE._serialized_end=1163
+  _MEMBERSHIPUPDATE_ENVIRONMENTSENTRY._serialized_start=1075
+  _MEMBERSHIPUPDATE_ENVIRONMENTSENTRY._serialized_end=1163
 # @@protoc_insertion_point(module_scope)
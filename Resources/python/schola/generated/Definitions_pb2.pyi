@@ -20,6 +20,20 @@ class AgentDefinition(_message.Message):
     obs_space: _Spaces_pb2.DictSpace
     def __init__(self, name: _Optional[str] = ..., obs_space: _Optional[_Union[_Spaces_pb2.DictSpace, _Mapping]] = ..., action_space: _Optional[_Union[_Spaces_pb2.DictSpace, _Mapping]] = ..., normalize_obs: bool = ..., normalize_actions: bool = ...) -> None: ...
 
+class DenseGroupDefinition(_message.Message):
+    __slots__ = ["action_dim", "agent_ids", "env_ids", "group_id", "obs_dim"]
+    ACTION_DIM_FIELD_NUMBER: _ClassVar[int]
+    AGENT_IDS_FIELD_NUMBER: _ClassVar[int]
+    ENV_IDS_FIELD_NUMBER: _ClassVar[int]
+    GROUP_ID_FIELD_NUMBER: _ClassVar[int]
+    OBS_DIM_FIELD_NUMBER: _ClassVar[int]
+    action_dim: int
+    agent_ids: _containers.RepeatedScalarFieldContainer[int]
+    env_ids: _containers.RepeatedScalarFieldContainer[int]
+    group_id: int
+    obs_dim: int
+    def __init__(self, group_id: _Optional[int] = ..., obs_dim: _Optional[int] = ..., action_dim: _Optional[int] = ..., env_ids: _Optional[_Iterable[int]] = ..., agent_ids: _Optional[_Iterable[int]] = ...) -> None: ...
+
 class EnvironmentDefinition(_message.Message):
     __slots__ = ["agent_definitions"]
     class AgentDefinitionsEntry(_message.Message):
@@ -33,8 +47,46 @@ class EnvironmentDefinition(_message.Message):
     agent_definitions: _containers.MessageMap[int, AgentDefinition]
     def __init__(self, agent_definitions: _Optional[_Mapping[int, AgentDefinition]] = ...) -> None: ...
 
+class EnvironmentMembershipUpdate(_message.Message):
+    __slots__ = ["added_agents", "removed_agents"]
+    class AddedAgentsEntry(_message.Message):
+        __slots__ = ["key", "value"]
+        KEY_FIELD_NUMBER: _ClassVar[int]
+        VALUE_FIELD_NUMBER: _ClassVar[int]
+        key: int
+        value: AgentDefinition
+        def __init__(self, key: _Optional[int] = ..., value: _Optional[_Union[AgentDefinition, _Mapping]] = ...) -> None: ...
+    ADDED_AGENTS_FIELD_NUMBER: _ClassVar[int]
+    REMOVED_AGENTS_FIELD_NUMBER: _ClassVar[int]
+    added_agents: _containers.MessageMap[int, AgentDefinition]
+    removed_agents: _containers.RepeatedScalarFieldContainer[int]
+    def __init__(self, added_agents: _Optional[_Mapping[int, AgentDefinition]] = ..., removed_agents: _Optional[_Iterable[int]] = ...) -> None: ...
+
+class MembershipUpdate(_message.Message):
+    __slots__ = ["dense_groups", "environments"]
+    class EnvironmentsEntry(_message.Message):
+        __slots__ = ["key", "value"]
+        KEY_FIELD_NUMBER: _ClassVar[int]
+        VALUE_FIELD_NUMBER: _ClassVar[int]
+        key: int
+        value: EnvironmentMembershipUpdate
+        def __init__(self, key: _Optional[int] = ..., value: _Optional[_Union[EnvironmentMembershipUpdate, _Mapping]] = ...) -> None: ...
+    DENSE_GROUPS_FIELD_NUMBER: _ClassVar[int]
+    ENVIRONMENTS_FIELD_NUMBER: _ClassVar[int]
+    dense_groups: _containers.RepeatedCompositeFieldContainer[DenseGroupDefinition]
+    environments: _containers.MessageMap[int, EnvironmentMembershipUpdate]
+    def __init__(self, environments: _Optional[_Mapping[int, EnvironmentMembershipUpdate]] = ..., dense_groups: _Optional[_Iterable[_Union[DenseGroupDefinition, _Mapping]]] = ...) -> None: ...
+
 class TrainingDefinition(_message.Message):
-    __slots__ = ["environment_definitions"]
+    __slots__ = ["async_stepping", "dense_groups", "environment_definitions", "num_pipeline_cohorts", "use_step_stream"]
+    ASYNC_STEPPING_FIELD_NUMBER: _ClassVar[int]
+    DENSE_GROUPS_FIELD_NUMBER: _ClassVar[int]
     ENVIRONMENT_DEFINITIONS_FIELD_NUMBER: _ClassVar[int]
+    NUM_PIPELINE_COHORTS_FIELD_NUMBER: _ClassVar[int]
+    USE_STEP_STREAM_FIELD_NUMBER: _ClassVar[int]
+    async_stepping: bool
+    dense_groups: _containers.RepeatedCompositeFieldContainer[DenseGroupDefinition]
     environment_definitions: _containers.RepeatedCompositeFieldContainer[EnvironmentDefinition]
-    def __init__(self, environment_definitions: _Optional[_Iterable[_Union[EnvironmentDefinition, _Mapping]]] = ...) -> None: ...
+    num_pipeline_cohorts: int
+    use_step_stream: bool
+    def __init__(self, environment_definitions: _Optional[_Iterable[_Union[EnvironmentDefinition, _Mapping]]] = ..., dense_groups: _Optional[_Iterable[_Union[DenseGroupDefinition, _Mapping]]] = ..., use_step_stream: bool = ..., num_pipeline_cohorts: _Optional[int] = ..., async_stepping: bool = ...) -> None: ...
@@ -16,7 +16,7 @@ import schola.generated.State_pb2 as State__pb2
 import schola.generated.StateUpdates_pb2 as StateUpdates__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x12GymConnector.proto\x12\x06Schola\x1a\x11\x44\x65\x66initions.proto\x1a\x0bState.proto\x1a\x12StateUpdates.proto\"\x9b\x01\n\x10\x45nvironmentReset\x12\x0e\n\x04seed\x18\x01 \x01(\x05H\x00\x12\x36\n\x07options\x18\x02 \x03(\x0b\x32%.Schola.EnvironmentReset.OptionsEntry\x1a.\n\x0cOptionsEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\x42\x0f\n\roptional_seed\"z\n\x16\x45nvironmentStateUpdate\x12)\n\x05reset\x18\x01 \x01(\x0b\x32\x18.Schola.EnvironmentResetH\x00\x12\'\n\x04step\x18\x02 \x01(\x0b\x32\x17.Schola.EnvironmentStepH\x00\x42\x0c\n\nupdate_msg\"\xcc\x01\n\x13TrainingStateUpdate\x12\x39\n\x07updates\x18\x01 \x03(\x0b\x32(.Schola.TrainingStateUpdate.UpdatesEntry\x12*\n\x06status\x18\x02 \x01(\x0e\x32\x1a.Schola.CommunicatorStatus\x1aN\n\x0cUpdatesEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12-\n\x05value\x18\x02 \x01(\x0b\x32\x1e.Schola.EnvironmentStateUpdate:\x02\x38\x01\"\x1b\n\x19TrainingDefinitionRequest\"\x1a\n\x18GymConnectorStartRequest\"\x1b\n\x19GymConnectorStartResponse\"!\n\x1fInititalEnvironmentStateRequest\"\xee\x01\n\x1bInitialTrainingStateRequest\x12\x65\n\x1a\x65nvironment_state_requests\x18\x01 \x03(\x0b\x32\x41.Schola.InitialTrainingStateRequest.EnvironmentStateRequestsEntry\x1ah\n\x1d\x45nvironmentStateRequestsEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12\x36\n\x05value\x18\x02 \x01(\x0b\x32\'.Schola.InititalEnvironmentStateRequest:\x02\x38\x01*5\n\x12\x43ommunicatorStatus\x12\x08\n\x04GOOD\x10\x00\x12\t\n\x05\x45RROR\x10\x01\x12\n\n\x06\x43LOSED\x10\x02\x32\xe7\x02\n\nGymService\x12\x41\n\x0bUpdateState\x12\x1b.Schola.TrainingStateUpdate\x1a\x15.Schola.TrainingState\x12`\n\x1bRequestInitialTrainingState\x12#.Schola.InitialTrainingStateRequest\x1a\x1c.Schola.InitialTrainingState\x12Z\n\x19RequestTrainingDefinition\x12!.Schola.TrainingDefinitionRequest\x1a\x1a.Schola.TrainingDefinition\x12X\n\x11StartGymConnector\x12 .Schola.GymConnectorStartRequest\x1a!.Schola.GymConnectorStartResponseb\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x12GymConnector.proto\x12\x06Schola\x1a\x11\x44\x65\x66initions.proto\x1a\x0bState.proto\x1a\x12StateUpdates.proto\"\x9b\x01\n\x10\x45nvironmentReset\x12\x0e\n\x04seed\x18\x01 \x01(\x05H\x00\x12\x36\n\x07options\x18\x02 \x03(\x0b\x32%.Schola.EnvironmentReset.OptionsEntry\x1a.\n\x0cOptionsEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\x42\x0f\n\roptional_seed\"z\n\x16\x45nvironmentStateUpdate\x12)\n\x05reset\x18\x01 \x01(\x0b\x32\x18.Schola.EnvironmentResetH\x00\x12\'\n\x04step\x18\x02 \x01(\x0b\x32\x17.Schola.EnvironmentStepH\x00\x42\x0c\n\nupdate_msg\"\xed\x02\n\x13TrainingStateUpdate\x12\x39\n\x07updates\x18\x01 \x03(\x0b\x32(.Schola.TrainingStateUpdate.UpdatesEntry\x12*\n\x06status\x18\x02 \x01(\x0e\x32\x1a.Schola.CommunicatorStatus\x12\x30\n\rdense_actions\x18\x03 \x03(\x0b\x32\x19.Schola.DenseGroupActions\x12<\n\tenv_steps\x18\x04 \x03(\x0b\x32).Schola.TrainingStateUpdate.EnvStepsEntry\x1aN\n\x0cUpdatesEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12-\n\x05value\x18\x02 \x01(\x0b\x32\x1e.Schola.EnvironmentStateUpdate:\x02\x38\x01\x1a/\n\rEnvStepsEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12\r\n\x05value\x18\x02 \x01(\x05:\x02\x38\x01\"\x1b\n\x19TrainingDefinitionRequest\"\x1a\n\x18GymConnectorStartRequest\"\x1b\n\x19GymConnectorStartResponse\"!\n\x1fInititalEnvironmentStateRequest\"\xee\x01\n\x1bInitialTrainingStateRequest\x12\x65\n\x1a\x65nvironment_state_requests\x18\x01 \x03(\x0b\x32\x41.Schola.InitialTrainingStateRequest.EnvironmentStateRequestsEntry\x1ah\n\x1d\x45nvironmentStateRequestsEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12\x36\n\x05value\x18\x02 \x01(\x0b\x32\'.Schola.InititalEnvironmentStateRequest:\x02\x38\x01\"z\n\x12StepStreamResponse\x12&\n\x05state\x18\x01 \x01(\x0b\x32\x15.Schola.TrainingStateH\x00\x12\x35\n\rinitial_state\x18\x02 \x01(\x0b\x32\x1c.Schola.InitialTrainingStateH\x00\x42\x05\n\x03msg*5\n\x12\x43ommunicatorStatus\x12\x08\n\x04GOOD\x10\x00\x12\t\n\x05\x45RROR\x10\x01\x12\n\n\x06\x43LOSED\x10\x02\x32\xb2\x03\n\nGymService\x12\x41\n\x0bUpdateState\x12\x1b.Schola.TrainingStateUpdate\x1a\x15.Schola.TrainingState\x12`\n\x1bRequestInitialTrainingState\x12#.Schola.InitialTrainingStateRequest\x1a\x1c.Schola.InitialTrainingState\x12Z\n\x19RequestTrainingDefinition\x12!.Schola.TrainingDefinitionRequest\x1a\x1a.Schola.TrainingDefinition\x12X\n\x11StartGymConnector\x12 .Schola.GymConnectorStartRequest\x1a!.Schola.GymConnectorStartResponse\x12I\n\nStepStream\x12\x1b.Schola.TrainingStateUpdate\x1a\x1a.Schola.StepStreamResponse(\x01\x30\x01\x62\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'GymConnector_pb2', globals())
@@ -27,10 +27,12 @@ if _descriptor._USE_C_DESCRIPTORS == False:
   _ENVIRONMENTRESET_OPTIONSENTRY._serialized_options = b'8\001'
   _TRAININGSTATEUPDATE_UPDATESENTRY._options = None
   _TRAININGSTATEUPDATE_UPDATESENTRY._serialized_options = b'8\001'
+  _TRAININGSTATEUPDATE_ENVSTEPSENTRY._options = None
+  _TRAININGSTATEUPDATE_ENVSTEPSENTRY._serialized_options = b'8\001'
   _INITIALTRAININGSTATEREQUEST_ENVIRONMENTSTATEREQUESTSENTRY._options = None
   _INITIALTRAININGSTATEREQUEST_ENVIRONMENTSTATEREQUESTSENTRY._serialized_options = b'8\001'
-  _COMMUNICATORSTATUS._serialized_start=933
-  _COMMUNICATORSTATUS._serialized_end=986
+  _COMMUNICATORSTATUS._serialized_start=1218
+  _COMMUNICATORSTATUS._serialized_end=1271
   _ENVIRONMENTRESET._serialized_start=83
   _ENVIRONMENTRESET._serialized_end=238
   _ENVIRONMENTRESET_OPTIONSENTRY._serialized_start=175
@@ -38,21 +40,25 @@ if _descriptor._USE_C_DESCRIPTORS == False:
   _ENVIRONMENTSTATEUPDATE._serialized_start=240
   _ENVIRONMENTSTATEUPDATE._serialized_end=362
   _TRAININGSTATEUPDATE._serialized_start=365
-  _TRAININGSTATEUPDATE._serialized_end=569
-  _TRAININGSTATEUPDATE_UPDATESENTRY._serialized_start=491
-  _TRAININGSTATEUPDATE_UPDATESENTRY._serialized_end=569
-  _TRAININGDEFINITIONREQUEST._serialized_start=571
-  _TRAININGDEFINITIONREQUEST._serialized_end=598
-  _GYMCONNECTORSTARTREQUEST._serialized_start=600
-  _GYMCONNECTORSTARTREQUEST._serialized_end=626
-  _GYMCONNECTORSTARTRESPONSE._serialized_start=628
-  _GYMCONNECTORSTARTRESPONSE._serialized_end=655
-  _INITITALENVIRONMENTSTATEREQUEST._serialized_start=657
-  _INITITALENVIRONMENTSTATEREQUEST._serialized_end=690
-  _INITIALTRAININGSTATEREQUEST._serialized_start=693
-  _INITIALTRAININGSTATEREQUEST._serialized_end=931
-  _INITIALTRAININGSTATEREQUEST_ENVIRONMENTSTATEREQUESTSENTRY._serialized_start=827
-  _INITIALTRAININGSTATEREQUEST_ENVIRONMENTSTATEREQUESTSENTRY._serialized_end=931
-  _GYMSERVICE._serialized_start=989
-  _GYMSERVICE._serialized_end=1348
+  _TRAININGSTATEUPDATE._serialized_end=730
+  _TRAININGSTATEUPDATE_UPDATESENTRY._serialized_start=603
+  _TRAININGSTATEUPDATE_UPDATESENTRY._serialized_end=681
+  _TRAININGSTATEUPDATE_ENVSTEPSENTRY._serialized_start=683
+  _TRAININGSTATEUPDATE_ENVSTEPSENTRY._serialized_end=730
+  _TRAININGDEFINITIONREQUEST._serialized_start=732
+  _TRAININGDEFINITIONREQUEST._serialized_end=759
+  _GYMCONNECTORSTARTREQUEST._serialized_start=761
+  _GYMCONNECTORSTARTREQUEST._serialized_end=787
+  _GYMCONNECTORSTARTRESPONSE._serialized_start=789
+  _GYMCONNECTORSTARTRESPONSE._serialized_end=816
+  _INITITALENVIRONMENTSTATEREQUEST._serialized_start=818
+  _INITITALENVIRONMENTSTATEREQUEST._serialized_end=851
+  _INITIALTRAININGSTATEREQUEST._serialized_start=854
+  _INITIALTRAININGSTATEREQUEST._serialized_end=1092
+  _INITIALTRAININGSTATEREQUEST_ENVIRONMENTSTATEREQUESTSENTRY._serialized_start=988
+  _INITIALTRAININGSTATEREQUEST_ENVIRONMENTSTATEREQUESTSENTRY._serialized_end=1092
+  _STEPSTREAMRESPONSE._serialized_start=1094
+  _STEPSTREAMRESPONSE._serialized_end=1216
+  _GYMSERVICE._serialized_start=1274
+  _GYMSERVICE._serialized_end=1708
 # @@protoc_insertion_point(module_scope)
@@ -5,7 +5,7 @@ from google.protobuf.internal import containers as _containers
 from google.protobuf.internal import enum_type_wrapper as _enum_type_wrapper
 from google.protobuf import descriptor as _descriptor
 from google.protobuf import message as _message
-from typing import ClassVar as _ClassVar, Mapping as _Mapping, Optional as _Optional, Union as _Union
+from typing import ClassVar as _ClassVar, Iterable as _Iterable, Mapping as _Mapping, Optional as _Optional, Union as _Union
 
 CLOSED: CommunicatorStatus
 DESCRIPTOR: _descriptor.FileDescriptor
@@ -60,12 +60,27 @@ class InititalEnvironmentStateRequest(_message.Message):
     __slots__ = []
     def __init__(self) -> None: ...
 
+class StepStreamResponse(_message.Message):
+    __slots__ = ["initial_state", "state"]
+    INITIAL_STATE_FIELD_NUMBER: _ClassVar[int]
+    STATE_FIELD_NUMBER: _ClassVar[int]
+    initial_state: _State_pb2.InitialTrainingState
+    state: _State_pb2.TrainingState
+    def __init__(self, state: _Optional[_Union[_State_pb2.TrainingState, _Mapping]] = ..., initial_state: _Optional[_Union[_State_pb2.InitialTrainingState, _Mapping]] = ...) -> None: ...
+
 class TrainingDefinitionRequest(_message.Message):
     __slots__ = []
     def __init__(self) -> None: ...
 
 class TrainingStateUpdate(_message.Message):
-    __slots__ = ["status", "updates"]
+    __slots__ = ["dense_actions", "env_steps", "status", "updates"]
+    class EnvStepsEntry(_message.Message):
+        __slots__ = ["key", "value"]
+        KEY_FIELD_NUMBER: _ClassVar[int]
+        VALUE_FIELD_NUMBER: _ClassVar[int]
+        key: int
+        value: int
+        def __init__(self, key: _Optional[int] = ..., value: _Optional[int] = ...) -> None: ...
     class UpdatesEntry(_message.Message):
         __slots__ = ["key", "value"]
         KEY_FIELD_NUMBER: _ClassVar[int]
@@ -73,11 +88,15 @@ class TrainingStateUpdate(_message.Message):
         key: int
         value: EnvironmentStateUpdate
         def __init__(self, key: _Optional[int] = ..., value: _Optional[_Union[EnvironmentStateUpdate, _Mapping]] = ...) -> None: ...
+    DENSE_ACTIONS_FIELD_NUMBER: _ClassVar[int]
+    ENV_STEPS_FIELD_NUMBER: _ClassVar[int]
     STATUS_FIELD_NUMBER: _ClassVar[int]
     UPDATES_FIELD_NUMBER: _ClassVar[int]
+    dense_actions: _containers.RepeatedCompositeFieldContainer[_StateUpdates_pb2.DenseGroupActions]
+    env_steps: _containers.ScalarMap[int, int]
     status: CommunicatorStatus
     updates: _containers.MessageMap[int, EnvironmentStateUpdate]
-    def __init__(self, updates: _Optional[_Mapping[int, EnvironmentStateUpdate]] = ..., status: _Optional[_Union[CommunicatorStatus, str]] = ...) -> None: ...
+    def __init__(self, updates: _Optional[_Mapping[int, EnvironmentStateUpdate]] = ..., status: _Optional[_Union[CommunicatorStatus, str]] = ..., dense_actions: _Optional[_Iterable[_Union[_StateUpdates_pb2.DenseGroupActions, _Mapping]]] = ..., env_steps: _Optional[_Mapping[int, int]] = ...) -> None: ...
 
 class CommunicatorStatus(int, metaclass=_enum_type_wrapper.EnumTypeWrapper):
     __slots__ = []
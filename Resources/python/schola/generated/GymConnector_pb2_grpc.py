@@ -36,6 +36,11 @@ class GymServiceStub(object):
                 request_serializer=GymConnector__pb2.GymConnectorStartRequest.SerializeToString,
                 response_deserializer=GymConnector__pb2.GymConnectorStartResponse.FromString,
                 )
+        self.StepStream = channel.stream_stream(
+                '/Schola.GymService/StepStream',
+                request_serializer=GymConnector__pb2.TrainingStateUpdate.SerializeToString,
+                response_deserializer=GymConnector__pb2.StepStreamResponse.FromString,
+                )
 
 
 class GymServiceServicer(object):
@@ -65,6 +70,13 @@ class GymServiceServicer(object):
         context.set_details('Method not implemented!')
         raise NotImplementedError('Method not implemented!')
 
+    def StepStream(self, request_iterator, context):
+        """Replaces UpdateState and RequestInitialTrainingState with one stream, open for the whole training session
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
 
 def add_GymServiceServicer_to_server(servicer, server):
     rpc_method_handlers = {
@@ -88,6 +100,11 @@ def add_GymServiceServicer_to_server(servicer, server):
                     request_deserializer=GymConnector__pb2.GymConnectorStartRequest.FromString,
                     response_serializer=GymConnector__pb2.GymConnectorStartResponse.SerializeToString,
             ),
+            'StepStream': grpc.stream_stream_rpc_method_handler(
+                    servicer.StepStream,
+                    request_deserializer=GymConnector__pb2.TrainingStateUpdate.FromString,
+                    response_serializer=GymConnector__pb2.StepStreamResponse.SerializeToString,
+            ),
     }
     generic_handler = grpc.method_handlers_generic_handler(
             'Schola.GymService', rpc_method_handlers)
@@ -165,3 +182,20 @@ class GymService(object):
             GymConnector__pb2.GymConnectorStartResponse.FromString,
             options, channel_credentials,
             insecure, call_credentials, compression, wait_for_ready, timeout, metadata)
+
+    @staticmethod
+    def StepStream(request_iterator,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.stream_stream(request_iterator, target, '/Schola.GymService/StepStream',
+            GymConnector__pb2.TrainingStateUpdate.SerializeToString,
+            GymConnector__pb2.StepStreamResponse.FromString,
+            options, channel_credentials,
+            insecure, call_credentials, compression, wait_for_ready, timeout, metadata)
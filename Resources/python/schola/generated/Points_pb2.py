@@ -13,7 +13,7 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0cPoints.proto\x12\x06Schola\"\x1a\n\x08\x42oxPoint\x12\x0e\n\x06values\x18\x01 \x03(\x02\"\x1f\n\rDiscretePoint\x12\x0e\n\x06values\x18\x01 \x03(\x05\"\x1d\n\x0b\x42inaryPoint\x12\x0e\n\x06values\x18\x01 \x03(\x08\"\xa0\x01\n\x10\x46undamentalPoint\x12%\n\tbox_point\x18\x01 \x01(\x0b\x32\x10.Schola.BoxPointH\x00\x12/\n\x0e\x64iscrete_point\x18\x02 \x01(\x0b\x32\x15.Schola.DiscretePointH\x00\x12+\n\x0c\x62inary_point\x18\x03 \x01(\x0b\x32\x13.Schola.BinaryPointH\x00\x42\x07\n\x05point\"5\n\tDictPoint\x12(\n\x06values\x18\x01 \x03(\x0b\x32\x18.Schola.FundamentalPointb\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0cPoints.proto\x12\x06Schola\"\x1a\n\x08\x42oxPoint\x12\x0e\n\x06values\x18\x01 \x03(\x02\"\x1f\n\rDiscretePoint\x12\x0e\n\x06values\x18\x01 \x03(\x05\"O\n\x0b\x42inaryPoint\x12\x0e\n\x06values\x18\x01 \x03(\x08\x12\x15\n\rpacked_values\x18\x02 \x01(\x0c\x12\x19\n\x11num_packed_values\x18\x03 \x01(\x05\"\xa0\x01\n\x10\x46undamentalPoint\x12%\n\tbox_point\x18\x01 \x01(\x0b\x32\x10.Schola.BoxPointH\x00\x12/\n\x0e\x64iscrete_point\x18\x02 \x01(\x0b\x32\x15.Schola.DiscretePointH\x00\x12+\n\x0c\x62inary_point\x18\x03 \x01(\x0b\x32\x13.Schola.BinaryPointH\x00\x42\x07\n\x05point\"5\n\tDictPoint\x12(\n\x06values\x18\x01 \x03(\x0b\x32\x18.Schola.FundamentalPointb\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'Points_pb2', globals())
@@ -25,9 +25,9 @@ if _descriptor._USE_C_DESCRIPTORS == False:
   _DISCRETEPOINT._serialized_start=52
   _DISCRETEPOINT._serialized_end=83
   _BINARYPOINT._serialized_start=85
-  _BINARYPOINT._serialized_end=114
-  _FUNDAMENTALPOINT._serialized_start=117
-  _FUNDAMENTALPOINT._serialized_end=277
-  _DICTPOINT._serialized_start=279
-  _DICTPOINT._serialized_end=332
+  _BINARYPOINT._serialized_end=164
+  _FUNDAMENTALPOINT._serialized_start=167
+  _FUNDAMENTALPOINT._serialized_end=327
+  _DICTPOINT._serialized_start=329
+  _DICTPOINT._serialized_end=382
 # @@protoc_insertion_point(module_scope)
@@ -6,10 +6,14 @@ from typing import ClassVar as _ClassVar, Iterable as _Iterable, Mapping as _Map
 DESCRIPTOR: _descriptor.FileDescriptor
 
 class BinaryPoint(_message.Message):
-    __slots__ = ["values"]
+    __slots__ = ["num_packed_values", "packed_values", "values"]
+    NUM_PACKED_VALUES_FIELD_NUMBER: _ClassVar[int]
+    PACKED_VALUES_FIELD_NUMBER: _ClassVar[int]
     VALUES_FIELD_NUMBER: _ClassVar[int]
+    num_packed_values: int
+    packed_values: bytes
     values: _containers.RepeatedScalarFieldContainer[bool]
-    def __init__(self, values: _Optional[_Iterable[bool]] = ...) -> None: ...
+    def __init__(self, values: _Optional[_Iterable[bool]] = ..., packed_values: _Optional[bytes] = ..., num_packed_values: _Optional[int] = ...) -> None: ...
 
 class BoxPoint(_message.Message):
     __slots__ = ["values"]
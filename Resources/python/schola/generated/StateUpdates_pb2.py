@@ -14,7 +14,7 @@ _sym_db = _symbol_database.Default()
 import schola.generated.Points_pb2 as Points__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x12StateUpdates.proto\x12\x06Schola\x1a\x0cPoints.proto\"6\n\x10\x41gentStateUpdate\x12\"\n\x07\x61\x63tions\x18\x01 \x01(\x0b\x32\x11.Schola.DictPoint\"\x92\x01\n\x0f\x45nvironmentStep\x12\x35\n\x07updates\x18\x01 \x03(\x0b\x32$.Schola.EnvironmentStep.UpdatesEntry\x1aH\n\x0cUpdatesEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12\'\n\x05value\x18\x02 \x01(\x0b\x32\x18.Schola.AgentStateUpdate:\x02\x38\x01\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x12StateUpdates.proto\x12\x06Schola\x1a\x0cPoints.proto\"6\n\x10\x41gentStateUpdate\x12\"\n\x07\x61\x63tions\x18\x01 \x01(\x0b\x32\x11.Schola.DictPoint\"\x92\x01\n\x0f\x45nvironmentStep\x12\x35\n\x07updates\x18\x01 \x03(\x0b\x32$.Schola.EnvironmentStep.UpdatesEntry\x1aH\n\x0cUpdatesEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12\'\n\x05value\x18\x02 \x01(\x0b\x32\x18.Schola.AgentStateUpdate:\x02\x38\x01\"Z\n\x11\x44\x65nseGroupActions\x12\x10\n\x08group_id\x18\x01 \x01(\x05\x12\x0f\n\x07\x65nv_ids\x18\x02 \x03(\x05\x12\x11\n\tagent_ids\x18\x03 \x03(\x05\x12\x0f\n\x07\x61\x63tions\x18\x04 \x01(\x0c\x62\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'StateUpdates_pb2', globals())
@@ -29,4 +29,6 @@ if _descriptor._USE_C_DESCRIPTORS == False:
   _ENVIRONMENTSTEP._serialized_end=247
   _ENVIRONMENTSTEP_UPDATESENTRY._serialized_start=175
   _ENVIRONMENTSTEP_UPDATESENTRY._serialized_end=247
+  _DENSEGROUPACTIONS._serialized_start=249
+  _DENSEGROUPACTIONS._serialized_end=339
 # @@protoc_insertion_point(module_scope)
@@ -2,7 +2,7 @@ import schola.generated.Points_pb2 as _Points_pb2
 from google.protobuf.internal import containers as _containers
 from google.protobuf import descriptor as _descriptor
 from google.protobuf import message as _message
-from typing import ClassVar as _ClassVar, Mapping as _Mapping, Optional as _Optional, Union as _Union
+from typing import ClassVar as _ClassVar, Iterable as _Iterable, Mapping as _Mapping, Optional as _Optional, Union as _Union
 
 DESCRIPTOR: _descriptor.FileDescriptor
 
@@ -12,6 +12,18 @@ class AgentStateUpdate(_message.Message):
     actions: _Points_pb2.DictPoint
     def __init__(self, actions: _Optional[_Union[_Points_pb2.DictPoint, _Mapping]] = ...) -> None: ...
 
+class DenseGroupActions(_message.Message):
+    __slots__ = ["actions", "agent_ids", "env_ids", "group_id"]
+    ACTIONS_FIELD_NUMBER: _ClassVar[int]
+    AGENT_IDS_FIELD_NUMBER: _ClassVar[int]
+    ENV_IDS_FIELD_NUMBER: _ClassVar[int]
+    GROUP_ID_FIELD_NUMBER: _ClassVar[int]
+    actions: bytes
+    agent_ids: _containers.RepeatedScalarFieldContainer[int]
+    env_ids: _containers.RepeatedScalarFieldContainer[int]
+    group_id: int
+    def __init__(self, group_id: _Optional[int] = ..., env_ids: _Optional[_Iterable[int]] = ..., agent_ids: _Optional[_Iterable[int]] = ..., actions: _Optional[bytes] = ...) -> None: ...
+
 class EnvironmentStep(_message.Message):
     __slots__ = ["updates"]
     class UpdatesEntry(_message.Message):
@@ -12,9 +12,10 @@ _sym_db = _symbol_database.Default()
 
 
 import schola.generated.Points_pb2 as Points__pb2
+import schola.generated.Definitions_pb2 as Definitions__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0bState.proto\x12\x06Schola\x1a\x0cPoints.proto\"\xbe\x01\n\nAgentState\x12\'\n\x0cobservations\x18\x01 \x01(\x0b\x32\x11.Schola.DictPoint\x12\x0e\n\x06reward\x18\x02 \x01(\x02\x12\x1e\n\x06status\x18\x03 \x01(\x0e\x32\x0e.Schola.Status\x12*\n\x04info\x18\x04 \x03(\x0b\x32\x1c.Schola.AgentState.InfoEntry\x1a+\n\tInfoEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\"\x9b\x01\n\x10\x45nvironmentState\x12?\n\x0c\x61gent_states\x18\x01 \x03(\x0b\x32).Schola.EnvironmentState.AgentStatesEntry\x1a\x46\n\x10\x41gentStatesEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12!\n\x05value\x18\x02 \x01(\x0b\x32\x12.Schola.AgentState:\x02\x38\x01\"E\n\rTrainingState\x12\x34\n\x12\x65nvironment_states\x18\x01 \x03(\x0b\x32\x18.Schola.EnvironmentState\"\x9c\x01\n\x11InitialAgentState\x12\'\n\x0cobservations\x18\x01 \x01(\x0b\x32\x11.Schola.DictPoint\x12\x31\n\x04info\x18\x04 \x03(\x0b\x32#.Schola.InitialAgentState.InfoEntry\x1a+\n\tInfoEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\"\xb0\x01\n\x17InitialEnvironmentState\x12\x46\n\x0c\x61gent_states\x18\x01 \x03(\x0b\x32\x30.Schola.InitialEnvironmentState.AgentStatesEntry\x1aM\n\x10\x41gentStatesEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12(\n\x05value\x18\x02 \x01(\x0b\x32\x19.Schola.InitialAgentState:\x02\x38\x01\"\xc2\x01\n\x14InitialTrainingState\x12O\n\x12\x65nvironment_states\x18\x01 \x03(\x0b\x32\x33.Schola.InitialTrainingState.EnvironmentStatesEntry\x1aY\n\x16\x45nvironmentStatesEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12.\n\x05value\x18\x02 \x01(\x0b\x32\x1f.Schola.InitialEnvironmentState:\x02\x38\x01*3\n\x06Status\x12\x0b\n\x07RUNNING\x10\x00\x12\r\n\tTRUNCATED\x10\x01\x12\r\n\tCOMPLETED\x10\x02\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0bState.proto\x12\x06Schola\x1a\x0cPoints.proto\x1a\x11\x44\x65\x66initions.proto\"\xbe\x01\n\nAgentState\x12\'\n\x0cobservations\x18\x01 \x01(\x0b\x32\x11.Schola.DictPoint\x12\x0e\n\x06reward\x18\x02 \x01(\x02\x12\x1e\n\x06status\x18\x03 \x01(\x0e\x32\x0e.Schola.Status\x12*\n\x04info\x18\x04 \x03(\x0b\x32\x1c.Schola.AgentState.InfoEntry\x1a+\n\tInfoEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\"\x9b\x01\n\x10\x45nvironmentState\x12?\n\x0c\x61gent_states\x18\x01 \x03(\x0b\x32).Schola.EnvironmentState.AgentStatesEntry\x1a\x46\n\x10\x41gentStatesEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12!\n\x05value\x18\x02 \x01(\x0b\x32\x12.Schola.AgentState:\x02\x38\x01\"\x80\x01\n\x0f\x44\x65nseGroupState\x12\x10\n\x08group_id\x18\x01 \x01(\x05\x12\x0f\n\x07\x65nv_ids\x18\x02 \x03(\x05\x12\x11\n\tagent_ids\x18\x03 \x03(\x05\x12\x14\n\x0cobservations\x18\x04 \x01(\x0c\x12\x0f\n\x07rewards\x18\x05 \x01(\x0c\x12\x10\n\x08statuses\x18\x06 \x01(\x0c\"\xbe\x02\n\rTrainingState\x12\x34\n\x12\x65nvironment_states\x18\x01 \x03(\x0b\x32\x18.Schola.EnvironmentState\x12-\n\x0c\x64\x65nse_groups\x18\x02 \x03(\x0b\x32\x17.Schola.DenseGroupState\x12\x31\n\x0breset_state\x18\x03 \x01(\x0b\x32\x1c.Schola.InitialTrainingState\x12\x36\n\tenv_steps\x18\x04 \x03(\x0b\x32#.Schola.TrainingState.EnvStepsEntry\x12,\n\nmembership\x18\x05 \x01(\x0b\x32\x18.Schola.MembershipUpdate\x1a/\n\rEnvStepsEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12\r\n\x05value\x18\x02 \x01(\x05:\x02\x38\x01\"\x9c\x01\n\x11InitialAgentState\x12\'\n\x0cobservations\x18\x01 \x01(\x0b\x32\x11.Schola.DictPoint\x12\x31\n\x04info\x18\x04 \x03(\x0b\x32#.Schola.InitialAgentState.InfoEntry\x1a+\n\tInfoEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\"\xb0\x01\n\x17InitialEnvironmentState\x12\x46\n\x0c\x61gent_states\x18\x01 \x03(\x0b\x32\x30.Schola.InitialEnvironmentState.AgentStatesEntry\x1aM\n\x10\x41gentStatesEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12(\n\x05value\x18\x02 \x01(\x0b\x32\x19.Schola.InitialAgentState:\x02\x38\x01\"\xe0\x02\n\x14InitialTrainingState\x12O\n\x12\x65nvironment_states\x18\x01 \x03(\x0b\x32\x33.Schola.InitialTrainingState.EnvironmentStatesEntry\x12=\n\tenv_steps\x18\x02 \x03(\x0b\x32*.Schola.InitialTrainingState.EnvStepsEntry\x12,\n\nmembership\x18\x03 \x01(\x0b\x32\x18.Schola.MembershipUpdate\x1aY\n\x16\x45nvironmentStatesEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12.\n\x05value\x18\x02 \x01(\x0b\x32\x1f.Schola.InitialEnvironmentState:\x02\x38\x01\x1a/\n\rEnvStepsEntry\x12\x0b\n\x03key\x18\x01 \x01(\x05\x12\r\n\x05value\x18\x02 \x01(\x05:\x02\x38\x01*3\n\x06Status\x12\x0b\n\x07RUNNING\x10\x00\x12\r\n\tTRUNCATED\x10\x01\x12\r\n\tCOMPLETED\x10\x02\x62\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'State_pb2', globals())
@@ -25,34 +26,44 @@ if _descriptor._USE_C_DESCRIPTORS == False:
   _AGENTSTATE_INFOENTRY._serialized_options = b'8\001'
   _ENVIRONMENTSTATE_AGENTSTATESENTRY._options = None
   _ENVIRONMENTSTATE_AGENTSTATESENTRY._serialized_options = b'8\001'
+  _TRAININGSTATE_ENVSTEPSENTRY._options = None
+  _TRAININGSTATE_ENVSTEPSENTRY._serialized_options = b'8\001'
   _INITIALAGENTSTATE_INFOENTRY._options = None
   _INITIALAGENTSTATE_INFOENTRY._serialized_options = b'8\001'
   _INITIALENVIRONMENTSTATE_AGENTSTATESENTRY._options = None
   _INITIALENVIRONMENTSTATE_AGENTSTATESENTRY._serialized_options = b'8\001'
   _INITIALTRAININGSTATE_ENVIRONMENTSTATESENTRY._options = None
   _INITIALTRAININGSTATE_ENVIRONMENTSTATESENTRY._serialized_options = b'8\001'
-  _STATUS._serialized_start=994
-  _STATUS._serialized_end=1045
-  _AGENTSTATE._serialized_start=38
-  _AGENTSTATE._serialized_end=228
-  _AGENTSTATE_INFOENTRY._serialized_start=185
-  _AGENTSTATE_INFOENTRY._serialized_end=228
-  _ENVIRONMENTSTATE._serialized_start=231
-  _ENVIRONMENTSTATE._serialized_end=386
-  _ENVIRONMENTSTATE_AGENTSTATESENTRY._serialized_start=316
-  _ENVIRONMENTSTATE_AGENTSTATESENTRY._serialized_end=386
-  _TRAININGSTATE._serialized_start=388
-  _TRAININGSTATE._serialized_end=457
-  _INITIALAGENTSTATE._serialized_start=460
-  _INITIALAGENTSTATE._serialized_end=616
-  _INITIALAGENTSTATE_INFOENTRY._serialized_start=185
-  _INITIALAGENTSTATE_INFOENTRY._serialized_end=228
-  _INITIALENVIRONMENTSTATE._serialized_start=619
-  _INITIALENVIRONMENTSTATE._serialized_end=795
-  _INITIALENVIRONMENTSTATE_AGENTSTATESENTRY._serialized_start=718
-  _INITIALENVIRONMENTSTATE_AGENTSTATESENTRY._serialized_end=795
-  _INITIALTRAININGSTATE._serialized_start=798
-  _INITIALTRAININGSTATE._serialized_end=992
-  _INITIALTRAININGSTATE_ENVIRONMENTSTATESENTRY._serialized_start=903
-  _INITIALTRAININGSTATE_ENVIRONMENTSTATESENTRY._serialized_end=992
+  _INITIALTRAININGSTATE_ENVSTEPSENTRY._options = None
+  _INITIALTRAININGSTATE_ENVSTEPSENTRY._serialized_options = b'8\001'
+  _STATUS._serialized_start=1552
+  _STATUS._serialized_end=1603
+  _AGENTSTATE._serialized_start=57
+  _AGENTSTATE._serialized_end=247
+  _AGENTSTATE_INFOENTRY._serialized_start=204
+  _AGENTSTATE_INFOENTRY._serialized_end=247
+  _ENVIRONMENTSTATE._serialized_start=250
+  _ENVIRONMENTSTATE._serialized_end=405
+  _ENVIRONMENTSTATE_AGENTSTATESENTRY._serialized_start=335
+  _ENVIRONMENTSTATE_AGENTSTATESENTRY._serialized_end=405
+  _DENSEGROUPSTATE._serialized_start=408
+  _DENSEGROUPSTATE._serialized_end=536
+  _TRAININGSTATE._serialized_start=539
+  _TRAININGSTATE._serialized_end=857
+  _TRAININGSTATE_ENVSTEPSENTRY._serialized_start=810
+  _TRAININGSTATE_ENVSTEPSENTRY._serialized_end=857
+  _INITIALAGENTSTATE._serialized_start=860
+  _INITIALAGENTSTATE._serialized_end=1016
+  _INITIALAGENTSTATE_INFOENTRY._serialized_start=204
+  _INITIALAGENTSTATE_INFOENTRY._serialized_end=247
+  _INITIALENVIRONMENTSTATE._serialized_start=1019
+  _INITIALENVIRONMENTSTATE._serialized_end=1195
+  _INITIALENVIRONMENTSTATE_AGENTSTATESENTRY._serialized_start=1118
+  _INITIALENVIRONMENTSTATE_AGENTSTATESENTRY._serialized_end=1195
+  _INITIALTRAININGSTATE._serialized_start=1198
+  _INITIALTRAININGSTATE._serialized_end=1550
+  _INITIALTRAININGSTATE_ENVIRONMENTSTATESENTRY._serialized_start=1412
+  _INITIALTRAININGSTATE_ENVIRONMENTSTATESENTRY._serialized_end=1501
+  _INITIALTRAININGSTATE_ENVSTEPSENTRY._serialized_start=810
+  _INITIALTRAININGSTATE_ENVSTEPSENTRY._serialized_end=857
 # @@protoc_insertion_point(module_scope)
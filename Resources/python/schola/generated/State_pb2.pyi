@@ -1,4 +1,5 @@
 import schola.generated.Points_pb2 as _Points_pb2
+import schola.generated.Definitions_pb2 as _Definitions_pb2
 from google.protobuf.internal import containers as _containers
 from google.protobuf.internal import enum_type_wrapper as _enum_type_wrapper
 from google.protobuf import descriptor as _descriptor
@@ -29,6 +30,22 @@ class AgentState(_message.Message):
     status: Status
     def __init__(self, observations: _Optional[_Union[_Points_pb2.DictPoint, _Mapping]] = ..., reward: _Optional[float] = ..., status: _Optional[_Union[Status, str]] = ..., info: _Optional[_Mapping[str, str]] = ...) -> None: ...
 
+class DenseGroupState(_message.Message):
+    __slots__ = ["agent_ids", "env_ids", "group_id", "observations", "rewards", "statuses"]
+    AGENT_IDS_FIELD_NUMBER: _ClassVar[int]
+    ENV_IDS_FIELD_NUMBER: _ClassVar[int]
+    GROUP_ID_FIELD_NUMBER: _ClassVar[int]
+    OBSERVATIONS_FIELD_NUMBER: _ClassVar[int]
+    REWARDS_FIELD_NUMBER: _ClassVar[int]
+    STATUSES_FIELD_NUMBER: _ClassVar[int]
+    agent_ids: _containers.RepeatedScalarFieldContainer[int]
+    env_ids: _containers.RepeatedScalarFieldContainer[int]
+    group_id: int
+    observations: bytes
+    rewards: bytes
+    statuses: bytes
+    def __init__(self, group_id: _Optional[int] = ..., env_ids: _Optional[_Iterable[int]] = ..., agent_ids: _Optional[_Iterable[int]] = ..., observations: _Optional[bytes] = ..., rewards: _Optional[bytes] = ..., statuses: _Optional[bytes] = ...) -> None: ...
+
 class EnvironmentState(_message.Message):
     __slots__ = ["agent_states"]
     class AgentStatesEntry(_message.Message):
@@ -71,7 +88,14 @@ class InitialEnvironmentState(_message.Message):
     def __init__(self, agent_states: _Optional[_Mapping[int, InitialAgentState]] = ...) -> None: ...
 
 class InitialTrainingState(_message.Message):
-    __slots__ = ["environment_states"]
+    __slots__ = ["env_steps", "environment_states", "membership"]
+    class EnvStepsEntry(_message.Message):
+        __slots__ = ["key", "value"]
+        KEY_FIELD_NUMBER: _ClassVar[int]
+        VALUE_FIELD_NUMBER: _ClassVar[int]
+        key: int
+        value: int
+        def __init__(self, key: _Optional[int] = ..., value: _Optional[int] = ...) -> None: ...
     class EnvironmentStatesEntry(_message.Message):
         __slots__ = ["key", "value"]
         KEY_FIELD_NUMBER: _ClassVar[int]
@@ -80,14 +104,33 @@ class InitialTrainingState(_message.Message):
         value: InitialEnvironmentState
         def __init__(self, key: _Optional[int] = ..., value: _Optional[_Union[InitialEnvironmentState, _Mapping]] = ...) -> None: ...
     ENVIRONMENT_STATES_FIELD_NUMBER: _ClassVar[int]
+    ENV_STEPS_FIELD_NUMBER: _ClassVar[int]
+    MEMBERSHIP_FIELD_NUMBER: _ClassVar[int]
+    env_steps: _containers.ScalarMap[int, int]
     environment_states: _containers.MessageMap[int, InitialEnvironmentState]
-    def __init__(self, environment_states: _Optional[_Mapping[int, InitialEnvironmentState]] = ...) -> None: ...
+    membership: _Definitions_pb2.MembershipUpdate
+    def __init__(self, environment_states: _Optional[_Mapping[int, InitialEnvironmentState]] = ..., env_steps: _Optional[_Mapping[int, int]] = ..., membership: _Optional[_Union[_Definitions_pb2.MembershipUpdate, _Mapping]] = ...) -> None: ...
 
 class TrainingState(_message.Message):
-    __slots__ = ["environment_states"]
+    __slots__ = ["dense_groups", "env_steps", "environment_states", "membership", "reset_state"]
+    class EnvStepsEntry(_message.Message):
+        __slots__ = ["key", "value"]
+        KEY_FIELD_NUMBER: _ClassVar[int]
+        VALUE_FIELD_NUMBER: _ClassVar[int]
+        key: int
+        value: int
+        def __init__(self, key: _Optional[int] = ..., value: _Optional[int] = ...) -> None: ...
+    DENSE_GROUPS_FIELD_NUMBER: _ClassVar[int]
     ENVIRONMENT_STATES_FIELD_NUMBER: _ClassVar[int]
+    ENV_STEPS_FIELD_NUMBER: _ClassVar[int]
+    MEMBERSHIP_FIELD_NUMBER: _ClassVar[int]
+    RESET_STATE_FIELD_NUMBER: _ClassVar[int]
+    dense_groups: _containers.RepeatedCompositeFieldContainer[DenseGroupState]
+    env_steps: _containers.ScalarMap[int, int]
     environment_states: _containers.RepeatedCompositeFieldContainer[EnvironmentState]
-    def __init__(self, environment_states: _Optional[_Iterable[_Union[EnvironmentState, _Mapping]]] = ...) -> None: ...
+    membership: _Definitions_pb2.MembershipUpdate
+    reset_state: InitialTrainingState
+    def __init__(self, environment_states: _Optional[_Iterable[_Union[EnvironmentState, _Mapping]]] = ..., dense_groups: _Optional[_Iterable[_Union[DenseGroupState, _Mapping]]] = ..., reset_state: _Optional[_Union[InitialTrainingState, _Mapping]] = ..., env_steps: _Optional[_Mapping[int, int]] = ..., membership: _Optional[_Union[_Definitions_pb2.MembershipUpdate, _Mapping]] = ...) -> None: ...
 
 class Status(int, metaclass=_enum_type_wrapper.EnumTypeWrapper):
     __slots__ = []
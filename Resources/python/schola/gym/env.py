@@ -41,6 +41,10 @@ class GymVectorEnv(gym.vector.VectorEnv):
             unreal_connection,
             verbosity,
         )
+        if self._env.num_pipeline_cohorts > 1:
+            raise EnvironmentException("Unreal is pipelining steps across cohorts of environments, which needs a trainer that accepts a subset of environments each step. Set NumPipelineCohorts to 1, or use RLlib.")
+        if self._env.async_stepping:
+            raise EnvironmentException("Unreal is stepping environments asynchronously, which needs a trainer that accepts a subset of environments each step. Use a synchronous Gym Connector, or use RLlib.")
         self.id_manager = IdManager(self._env.ids)
         # we just use the default UID to get the shared definition
         single_obs_space = self._env.get_obs_space(*self.id_manager[0])
@@ -81,6 +85,7 @@ class GymVectorEnv(gym.vector.VectorEnv):
 
     def reset_wait(self, seed:Union[None, List[int], int]=None, options: Union[List[Dict[str,str]], Dict[str,str], None]=None ) -> Tuple[Dict[str,np.ndarray], Dict[int,Dict[str,str]]]:
         obs, nested_infos = self._env.hard_reset(seeds=seed,options=options)
+        self._check_membership()
         if isinstance(seed,int):
             self._np_random = self._env.np_random
         
@@ -124,8 +129,21 @@ class GymVectorEnv(gym.vector.VectorEnv):
         actions = self.unbatch_actions(actions)
         self._env.send_actions(actions)
     
+    def _check_membership(self) -> None:
+        """
+        Raise if any agents have joined or left an environment, since each agent is a fixed slot of the vectorized environment.
+
+        Raises
+        ------
+        EnvironmentException
+            If the agents in any environment have changed since the environment was created.
+        """
+        if self._env.membership_changes > 0:
+            raise EnvironmentException("Agents joined or left an environment during training, which Gym does not support since it needs a fixed number of agents. Keep the agents in each environment fixed.")
+
     def step_wait(self) -> Tuple[Dict[str,np.ndarray], np.ndarray, np.ndarray, np.ndarray, Dict[int,Dict[str,str]]]:
         observations, rewards, terminateds, truncateds, nested_infos = self._env.poll()
+        self._check_membership()
 
         array_rewards = np.asarray(self.id_manager.flatten_id_dict(rewards))
 
@@ -53,6 +53,8 @@ class BaseEnv(RayBaseEnv):
         The connection to the Unreal Engine environment.
     verbosity : int, default=0
         The verbosity level for the environment.
+    async_batch_size : int, optional
+        When Unreal steps environments asynchronously, the most environments returned by each poll. See ScholaEnv.
     
     Attributes
     ----------
@@ -67,10 +69,11 @@ class BaseEnv(RayBaseEnv):
         self,
         unreal_connection: UnrealConnection,
         verbosity: int = 0,
+        async_batch_size: Optional[int] = None,
     ):
         self.first_poll = True
 
-        self._env = ScholaEnv(unreal_connection, verbosity)
+        self._env = ScholaEnv(unreal_connection, verbosity, async_batch_size=async_batch_size)
         self.last_reset_obs = {}
         self.last_reset_infos = {}
 
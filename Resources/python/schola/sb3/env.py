@@ -40,6 +40,10 @@ class VecEnv(Sb3VecEnv):
             unreal_connection,
             verbosity,
         )
+        if self._env.num_pipeline_cohorts > 1:
+            raise EnvironmentException("Unreal is pipelining steps across cohorts of environments, which needs a trainer that accepts a subset of environments each step. Set NumPipelineCohorts to 1, or use RLlib.")
+        if self._env.async_stepping:
+            raise EnvironmentException("Unreal is stepping environments asynchronously, which needs a trainer that accepts a subset of environments each step. Use a synchronous Gym Connector, or use RLlib.")
         self.id_manager = IdManager(self._env.ids)
         # we just use the default UID to get the shared definition
         obs_space = self._env.get_obs_space(*self.id_manager[0])
@@ -67,6 +71,7 @@ class VecEnv(Sb3VecEnv):
 
     def reset(self) -> Dict[str,np.ndarray]:
         obs, nested_infos = self._env.hard_reset(seeds=self._seed, options=self.options)
+        self._check_membership()
 
         self._seed = None
         self.options = None
@@ -122,8 +127,21 @@ class VecEnv(Sb3VecEnv):
         
         self._env.send_actions(actions)
 
+    def _check_membership(self) -> None:
+        """
+        Check that the agents haven't changed since the VecEnv was created, as SB3 maps every agent to one index of its batches.
+
+        Raises
+        ------
+        EnvironmentException
+            If an agent has joined or left any environment.
+        """
+        if self._env.membership_changes > 0:
+            raise EnvironmentException("Agents joined or left an environment during training, which SB3 does not support since it needs a fixed number of agents. Keep the agents in each environment fixed.")
+
     def step_wait(self) -> Tuple[Dict[str,np.ndarray],np.ndarray, np.ndarray, List[Dict[str,str]]]:
         observations, rewards, terminateds, truncateds, nested_infos = self._env.poll()
+        self._check_membership()
 
         array_dones = np.empty((self._env.num_agents,))
 
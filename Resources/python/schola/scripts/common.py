@@ -80,6 +80,7 @@ def add_unreal_process_args(parser : argparse.ArgumentParser) -> argparse._Argum
     unreal_process_group.add_argument("-p", "--port", type=int, default=None, help="Port to connect to the Unreal Engine process, if None an open port will be automatically selected when running standalone. Port is required if connecting to an existing Unreal Engine process.")
     unreal_process_group.add_argument("--map", type=str, default=None, help="Map to load when launching a standalone Unreal Engine process")
     unreal_process_group.add_argument("--fps", type=int, default=None, help="Fixed FPS to use when running standalone, if None no fixed timestep is used")
+    unreal_process_group.add_argument("--shared-memory", type=str, default=None, dest="shared_memory_name", help="Name of a block of shared memory to talk to the Unreal Engine process through instead of gRPC. Only works when Unreal is on the same machine.")
     unreal_process_group.add_argument("--disable-script",action="store_true", help="Flag indicating if the autolaunch script setting in the Unreal Engine Schola Plugin should be disabled. Useful for testing.")
     return unreal_process_group
 
@@ -116,6 +117,8 @@ class ScriptArgs:
         Fixed FPS to use when running standalone, if None no fixed timestep is used.
     disable_script : bool
         Flag indicating if the autolaunch script setting in the Unreal Engine Schola Plugin should be disabled. Useful for testing.
+    shared_memory_name : str, optional
+        Name of a block of shared memory to talk to the Unreal Engine process through instead of gRPC.
     """
     # Checkpoint Arguments
     enable_checkpoints: bool = False
@@ -136,6 +139,7 @@ class ScriptArgs:
     map: Optional[str] = None
     fps:Optional[int] = None
     disable_script:bool = False
+    shared_memory_name:Optional[str] = None
 
     def make_unreal_connection(self):
         """
@@ -147,9 +151,9 @@ class ScriptArgs:
             The Unreal Engine connection to use for the script.
         """
         if self.launch_unreal:
-           return StandaloneUnrealConnection("localhost", self.unreal_path, self.headless, port=self.port, map=self.map, set_fps=self.fps, disable_script=self.disable_script)
+           return StandaloneUnrealConnection("localhost", self.unreal_path, self.headless, port=self.port, map=self.map, set_fps=self.fps, disable_script=self.disable_script, shared_memory_name=self.shared_memory_name)
         else:
-            return UnrealEditorConnection("localhost", self.port)
+            return UnrealEditorConnection("localhost", self.port, shared_memory_name=self.shared_memory_name)
 
 def make_unreal_connection(args:ScriptArgs):
     """
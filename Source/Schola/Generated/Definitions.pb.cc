@@ -64,9 +64,32 @@ struct EnvironmentDefinitionDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EnvironmentDefinitionDefaultTypeInternal _EnvironmentDefinition_default_instance_;
+PROTOBUF_CONSTEXPR DenseGroupDefinition::DenseGroupDefinition(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.env_ids_)*/{}
+  , /*decltype(_impl_._env_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.agent_ids_)*/{}
+  , /*decltype(_impl_._agent_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.group_id_)*/0
+  , /*decltype(_impl_.obs_dim_)*/0
+  , /*decltype(_impl_.action_dim_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DenseGroupDefinitionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DenseGroupDefinitionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DenseGroupDefinitionDefaultTypeInternal() {}
+  union {
+    DenseGroupDefinition _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DenseGroupDefinitionDefaultTypeInternal _DenseGroupDefinition_default_instance_;
 PROTOBUF_CONSTEXPR TrainingDefinition::TrainingDefinition(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.environment_definitions_)*/{}
+  , /*decltype(_impl_.dense_groups_)*/{}
+  , /*decltype(_impl_.num_pipeline_cohorts_)*/0
+  , /*decltype(_impl_.use_step_stream_)*/false
+  , /*decltype(_impl_.async_stepping_)*/false
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct TrainingDefinitionDefaultTypeInternal {
   PROTOBUF_CONSTEXPR TrainingDefinitionDefaultTypeInternal()
@@ -77,8 +100,59 @@ struct TrainingDefinitionDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TrainingDefinitionDefaultTypeInternal _TrainingDefinition_default_instance_;
+PROTOBUF_CONSTEXPR EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse::EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUseDefaultTypeInternal _EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR EnvironmentMembershipUpdate::EnvironmentMembershipUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.added_agents_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.removed_agents_)*/{}
+  , /*decltype(_impl_._removed_agents_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EnvironmentMembershipUpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EnvironmentMembershipUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EnvironmentMembershipUpdateDefaultTypeInternal() {}
+  union {
+    EnvironmentMembershipUpdate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EnvironmentMembershipUpdateDefaultTypeInternal _EnvironmentMembershipUpdate_default_instance_;
+PROTOBUF_CONSTEXPR MembershipUpdate_EnvironmentsEntry_DoNotUse::MembershipUpdate_EnvironmentsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct MembershipUpdate_EnvironmentsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MembershipUpdate_EnvironmentsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MembershipUpdate_EnvironmentsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    MembershipUpdate_EnvironmentsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MembershipUpdate_EnvironmentsEntry_DoNotUseDefaultTypeInternal _MembershipUpdate_EnvironmentsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR MembershipUpdate::MembershipUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.environments_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.dense_groups_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MembershipUpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MembershipUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MembershipUpdateDefaultTypeInternal() {}
+  union {
+    MembershipUpdate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MembershipUpdateDefaultTypeInternal _MembershipUpdate_default_instance_;
 }  // namespace Schola
-static ::_pb::Metadata file_level_metadata_Definitions_2eproto[4];
+static ::_pb::Metadata file_level_metadata_Definitions_2eproto[9];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_Definitions_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_Definitions_2eproto = nullptr;
 
@@ -112,25 +186,86 @@ const uint32_t TableStruct_Definitions_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::Schola::EnvironmentDefinition, _impl_.agent_definitions_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupDefinition, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupDefinition, _impl_.group_id_),
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupDefinition, _impl_.obs_dim_),
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupDefinition, _impl_.action_dim_),
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupDefinition, _impl_.env_ids_),
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupDefinition, _impl_.agent_ids_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Schola::TrainingDefinition, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::Schola::TrainingDefinition, _impl_.environment_definitions_),
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingDefinition, _impl_.dense_groups_),
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingDefinition, _impl_.use_step_stream_),
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingDefinition, _impl_.num_pipeline_cohorts_),
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingDefinition, _impl_.async_stepping_),
+  PROTOBUF_FIELD_OFFSET(::Schola::EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Schola::EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Schola::EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Schola::EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Schola::EnvironmentMembershipUpdate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Schola::EnvironmentMembershipUpdate, _impl_.added_agents_),
+  PROTOBUF_FIELD_OFFSET(::Schola::EnvironmentMembershipUpdate, _impl_.removed_agents_),
+  PROTOBUF_FIELD_OFFSET(::Schola::MembershipUpdate_EnvironmentsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Schola::MembershipUpdate_EnvironmentsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Schola::MembershipUpdate_EnvironmentsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Schola::MembershipUpdate_EnvironmentsEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Schola::MembershipUpdate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Schola::MembershipUpdate, _impl_.environments_),
+  PROTOBUF_FIELD_OFFSET(::Schola::MembershipUpdate, _impl_.dense_groups_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::Schola::AgentDefinition)},
   { 11, 19, -1, sizeof(::Schola::EnvironmentDefinition_AgentDefinitionsEntry_DoNotUse)},
   { 21, -1, -1, sizeof(::Schola::EnvironmentDefinition)},
-  { 28, -1, -1, sizeof(::Schola::TrainingDefinition)},
+  { 28, -1, -1, sizeof(::Schola::DenseGroupDefinition)},
+  { 39, -1, -1, sizeof(::Schola::TrainingDefinition)},
+  { 50, 58, -1, sizeof(::Schola::EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse)},
+  { 60, -1, -1, sizeof(::Schola::EnvironmentMembershipUpdate)},
+  { 68, 76, -1, sizeof(::Schola::MembershipUpdate_EnvironmentsEntry_DoNotUse)},
+  { 78, -1, -1, sizeof(::Schola::MembershipUpdate)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
   &::Schola::_AgentDefinition_default_instance_._instance,
   &::Schola::_EnvironmentDefinition_AgentDefinitionsEntry_DoNotUse_default_instance_._instance,
   &::Schola::_EnvironmentDefinition_default_instance_._instance,
+  &::Schola::_DenseGroupDefinition_default_instance_._instance,
   &::Schola::_TrainingDefinition_default_instance_._instance,
+  &::Schola::_EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse_default_instance_._instance,
+  &::Schola::_EnvironmentMembershipUpdate_default_instance_._instance,
+  &::Schola::_MembershipUpdate_EnvironmentsEntry_DoNotUse_default_instance_._instance,
+  &::Schola::_MembershipUpdate_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_Definitions_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -143,19 +278,36 @@ const char descriptor_table_protodef_Definitions_2eproto[] PROTOBUF_SECTION_VARI
   "definitions\030\001 \003(\01323.Schola.EnvironmentDe"
   "finition.AgentDefinitionsEntry\032P\n\025AgentD"
   "efinitionsEntry\022\013\n\003key\030\001 \001(\005\022&\n\005value\030\002 "
-  "\001(\0132\027.Schola.AgentDefinition:\0028\001\"T\n\022Trai"
-  "ningDefinition\022>\n\027environment_definition"
-  "s\030\001 \003(\0132\035.Schola.EnvironmentDefinitionb\006"
-  "proto3"
+  "\001(\0132\027.Schola.AgentDefinition:\0028\001\"q\n\024Dens"
+  "eGroupDefinition\022\020\n\010group_id\030\001 \001(\005\022\017\n\007ob"
+  "s_dim\030\002 \001(\005\022\022\n\naction_dim\030\003 \001(\005\022\017\n\007env_i"
+  "ds\030\004 \003(\005\022\021\n\tagent_ids\030\005 \003(\005\"\327\001\n\022Training"
+  "Definition\022>\n\027environment_definitions\030\001 "
+  "\003(\0132\035.Schola.EnvironmentDefinition\0222\n\014de"
+  "nse_groups\030\002 \003(\0132\034.Schola.DenseGroupDefi"
+  "nition\022\027\n\017use_step_stream\030\003 \001(\010\022\034\n\024num_p"
+  "ipeline_cohorts\030\004 \001(\005\022\026\n\016async_stepping\030"
+  "\005 \001(\010\"\316\001\n\033EnvironmentMembershipUpdate\022J\n"
+  "\014added_agents\030\001 \003(\01324.Schola.Environment"
+  "MembershipUpdate.AddedAgentsEntry\022\026\n\016rem"
+  "oved_agents\030\002 \003(\005\032K\n\020AddedAgentsEntry\022\013\n"
+  "\003key\030\001 \001(\005\022&\n\005value\030\002 \001(\0132\027.Schola.Agent"
+  "Definition:\0028\001\"\342\001\n\020MembershipUpdate\022@\n\014e"
+  "nvironments\030\001 \003(\0132*.Schola.MembershipUpd"
+  "ate.EnvironmentsEntry\0222\n\014dense_groups\030\002 "
+  "\003(\0132\034.Schola.DenseGroupDefinition\032X\n\021Env"
+  "ironmentsEntry\022\013\n\003key\030\001 \001(\005\0222\n\005value\030\002 \001"
+  "(\0132#.Schola.EnvironmentMembershipUpdate:"
+  "\0028\001b\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_Definitions_2eproto_deps[1] = {
   &::descriptor_table_Spaces_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_Definitions_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_Definitions_2eproto = {
-    false, false, 486, descriptor_table_protodef_Definitions_2eproto,
+    false, false, 1171, descriptor_table_protodef_Definitions_2eproto,
     "Definitions.proto",
-    &descriptor_table_Definitions_2eproto_once, descriptor_table_Definitions_2eproto_deps, 1, 4,
+    &descriptor_table_Definitions_2eproto_once, descriptor_table_Definitions_2eproto_deps, 1, 9,
     schemas, file_default_instances, TableStruct_Definitions_2eproto::offsets,
     file_level_metadata_Definitions_2eproto, file_level_enum_descriptors_Definitions_2eproto,
     file_level_service_descriptors_Definitions_2eproto,
@@ -747,39 +899,54 @@ void EnvironmentDefinition::InternalSwap(EnvironmentDefinition* other) {
 
 // ===================================================================
 
-class TrainingDefinition::_Internal {
+class DenseGroupDefinition::_Internal {
  public:
 };
 
-TrainingDefinition::TrainingDefinition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+DenseGroupDefinition::DenseGroupDefinition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:Schola.TrainingDefinition)
+  // @@protoc_insertion_point(arena_constructor:Schola.DenseGroupDefinition)
 }
-TrainingDefinition::TrainingDefinition(const TrainingDefinition& from)
+DenseGroupDefinition::DenseGroupDefinition(const DenseGroupDefinition& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  TrainingDefinition* const _this = this; (void)_this;
+  DenseGroupDefinition* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.environment_definitions_){from._impl_.environment_definitions_}
+      decltype(_impl_.env_ids_){from._impl_.env_ids_}
+    , /*decltype(_impl_._env_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.agent_ids_){from._impl_.agent_ids_}
+    , /*decltype(_impl_._agent_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.group_id_){}
+    , decltype(_impl_.obs_dim_){}
+    , decltype(_impl_.action_dim_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:Schola.TrainingDefinition)
+  ::memcpy(&_impl_.group_id_, &from._impl_.group_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.action_dim_) -
+    reinterpret_cast<char*>(&_impl_.group_id_)) + sizeof(_impl_.action_dim_));
+  // @@protoc_insertion_point(copy_constructor:Schola.DenseGroupDefinition)
 }
 
-inline void TrainingDefinition::SharedCtor(
+inline void DenseGroupDefinition::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.environment_definitions_){arena}
+      decltype(_impl_.env_ids_){arena}
+    , /*decltype(_impl_._env_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.agent_ids_){arena}
+    , /*decltype(_impl_._agent_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.group_id_){0}
+    , decltype(_impl_.obs_dim_){0}
+    , decltype(_impl_.action_dim_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-TrainingDefinition::~TrainingDefinition() {
-  // @@protoc_insertion_point(destructor:Schola.TrainingDefinition)
+DenseGroupDefinition::~DenseGroupDefinition() {
+  // @@protoc_insertion_point(destructor:Schola.DenseGroupDefinition)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -787,41 +954,79 @@ TrainingDefinition::~TrainingDefinition() {
   SharedDtor();
 }
 
-inline void TrainingDefinition::SharedDtor() {
+inline void DenseGroupDefinition::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.environment_definitions_.~RepeatedPtrField();
+  _impl_.env_ids_.~RepeatedField();
+  _impl_.agent_ids_.~RepeatedField();
 }
 
-void TrainingDefinition::SetCachedSize(int size) const {
+void DenseGroupDefinition::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void TrainingDefinition::Clear() {
-// @@protoc_insertion_point(message_clear_start:Schola.TrainingDefinition)
+void DenseGroupDefinition::Clear() {
+// @@protoc_insertion_point(message_clear_start:Schola.DenseGroupDefinition)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.environment_definitions_.Clear();
+  _impl_.env_ids_.Clear();
+  _impl_.agent_ids_.Clear();
+  ::memset(&_impl_.group_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.action_dim_) -
+      reinterpret_cast<char*>(&_impl_.group_id_)) + sizeof(_impl_.action_dim_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainingDefinition::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* DenseGroupDefinition::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .Schola.EnvironmentDefinition environment_definitions = 1;
+      // int32 group_id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_environment_definitions(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.group_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 obs_dim = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.obs_dim_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 action_dim = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.action_dim_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 env_ids = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_env_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_env_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 agent_ids = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_agent_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_agent_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -848,106 +1053,1026 @@ failure:
 #undef CHK_
 }
 
-uint8_t* TrainingDefinition::_InternalSerialize(
+uint8_t* DenseGroupDefinition::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:Schola.TrainingDefinition)
+  // @@protoc_insertion_point(serialize_to_array_start:Schola.DenseGroupDefinition)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .Schola.EnvironmentDefinition environment_definitions = 1;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_environment_definitions_size()); i < n; i++) {
-    const auto& repfield = this->_internal_environment_definitions(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  // int32 group_id = 1;
+  if (this->_internal_group_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_group_id(), target);
+  }
+
+  // int32 obs_dim = 2;
+  if (this->_internal_obs_dim() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_obs_dim(), target);
+  }
+
+  // int32 action_dim = 3;
+  if (this->_internal_action_dim() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_action_dim(), target);
+  }
+
+  // repeated int32 env_ids = 4;
+  {
+    int byte_size = _impl_._env_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          4, _internal_env_ids(), byte_size, target);
+    }
+  }
+
+  // repeated int32 agent_ids = 5;
+  {
+    int byte_size = _impl_._agent_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          5, _internal_agent_ids(), byte_size, target);
+    }
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:Schola.TrainingDefinition)
+  // @@protoc_insertion_point(serialize_to_array_end:Schola.DenseGroupDefinition)
   return target;
 }
 
-size_t TrainingDefinition::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:Schola.TrainingDefinition)
+size_t DenseGroupDefinition::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Schola.DenseGroupDefinition)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .Schola.EnvironmentDefinition environment_definitions = 1;
-  total_size += 1UL * this->_internal_environment_definitions_size();
-  for (const auto& msg : this->_impl_.environment_definitions_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // repeated int32 env_ids = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.env_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._env_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 agent_ids = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.agent_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._agent_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // int32 group_id = 1;
+  if (this->_internal_group_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_group_id());
+  }
+
+  // int32 obs_dim = 2;
+  if (this->_internal_obs_dim() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_obs_dim());
+  }
+
+  // int32 action_dim = 3;
+  if (this->_internal_action_dim() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_action_dim());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TrainingDefinition::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DenseGroupDefinition::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    TrainingDefinition::MergeImpl
+    DenseGroupDefinition::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TrainingDefinition::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DenseGroupDefinition::GetClassData() const { return &_class_data_; }
 
 
-void TrainingDefinition::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<TrainingDefinition*>(&to_msg);
-  auto& from = static_cast<const TrainingDefinition&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:Schola.TrainingDefinition)
+void DenseGroupDefinition::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DenseGroupDefinition*>(&to_msg);
+  auto& from = static_cast<const DenseGroupDefinition&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Schola.DenseGroupDefinition)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.environment_definitions_.MergeFrom(from._impl_.environment_definitions_);
+  _this->_impl_.env_ids_.MergeFrom(from._impl_.env_ids_);
+  _this->_impl_.agent_ids_.MergeFrom(from._impl_.agent_ids_);
+  if (from._internal_group_id() != 0) {
+    _this->_internal_set_group_id(from._internal_group_id());
+  }
+  if (from._internal_obs_dim() != 0) {
+    _this->_internal_set_obs_dim(from._internal_obs_dim());
+  }
+  if (from._internal_action_dim() != 0) {
+    _this->_internal_set_action_dim(from._internal_action_dim());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void TrainingDefinition::CopyFrom(const TrainingDefinition& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Schola.TrainingDefinition)
+void DenseGroupDefinition::CopyFrom(const DenseGroupDefinition& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Schola.DenseGroupDefinition)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainingDefinition::IsInitialized() const {
+bool DenseGroupDefinition::IsInitialized() const {
   return true;
 }
 
-void TrainingDefinition::InternalSwap(TrainingDefinition* other) {
+void DenseGroupDefinition::InternalSwap(DenseGroupDefinition* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.environment_definitions_.InternalSwap(&other->_impl_.environment_definitions_);
+  _impl_.env_ids_.InternalSwap(&other->_impl_.env_ids_);
+  _impl_.agent_ids_.InternalSwap(&other->_impl_.agent_ids_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DenseGroupDefinition, _impl_.action_dim_)
+      + sizeof(DenseGroupDefinition::_impl_.action_dim_)
+      - PROTOBUF_FIELD_OFFSET(DenseGroupDefinition, _impl_.group_id_)>(
+          reinterpret_cast<char*>(&_impl_.group_id_),
+          reinterpret_cast<char*>(&other->_impl_.group_id_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainingDefinition::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata DenseGroupDefinition::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_Definitions_2eproto_getter, &descriptor_table_Definitions_2eproto_once,
       file_level_metadata_Definitions_2eproto[3]);
 }
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace Schola
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::Schola::AgentDefinition*
-Arena::CreateMaybeMessage< ::Schola::AgentDefinition >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::Schola::AgentDefinition >(arena);
+// ===================================================================
+
+class TrainingDefinition::_Internal {
+ public:
+};
+
+TrainingDefinition::TrainingDefinition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Schola.TrainingDefinition)
 }
-template<> PROTOBUF_NOINLINE ::Schola::EnvironmentDefinition_AgentDefinitionsEntry_DoNotUse*
-Arena::CreateMaybeMessage< ::Schola::EnvironmentDefinition_AgentDefinitionsEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::Schola::EnvironmentDefinition_AgentDefinitionsEntry_DoNotUse >(arena);
+TrainingDefinition::TrainingDefinition(const TrainingDefinition& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TrainingDefinition* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.environment_definitions_){from._impl_.environment_definitions_}
+    , decltype(_impl_.dense_groups_){from._impl_.dense_groups_}
+    , decltype(_impl_.num_pipeline_cohorts_){}
+    , decltype(_impl_.use_step_stream_){}
+    , decltype(_impl_.async_stepping_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.num_pipeline_cohorts_, &from._impl_.num_pipeline_cohorts_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.async_stepping_) -
+    reinterpret_cast<char*>(&_impl_.num_pipeline_cohorts_)) + sizeof(_impl_.async_stepping_));
+  // @@protoc_insertion_point(copy_constructor:Schola.TrainingDefinition)
 }
-template<> PROTOBUF_NOINLINE ::Schola::EnvironmentDefinition*
-Arena::CreateMaybeMessage< ::Schola::EnvironmentDefinition >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::Schola::EnvironmentDefinition >(arena);
+
+inline void TrainingDefinition::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.environment_definitions_){arena}
+    , decltype(_impl_.dense_groups_){arena}
+    , decltype(_impl_.num_pipeline_cohorts_){0}
+    , decltype(_impl_.use_step_stream_){false}
+    , decltype(_impl_.async_stepping_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
-template<> PROTOBUF_NOINLINE ::Schola::TrainingDefinition*
-Arena::CreateMaybeMessage< ::Schola::TrainingDefinition >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::Schola::TrainingDefinition >(arena);
+
+TrainingDefinition::~TrainingDefinition() {
+  // @@protoc_insertion_point(destructor:Schola.TrainingDefinition)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TrainingDefinition::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.environment_definitions_.~RepeatedPtrField();
+  _impl_.dense_groups_.~RepeatedPtrField();
+}
+
+void TrainingDefinition::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TrainingDefinition::Clear() {
+// @@protoc_insertion_point(message_clear_start:Schola.TrainingDefinition)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.environment_definitions_.Clear();
+  _impl_.dense_groups_.Clear();
+  ::memset(&_impl_.num_pipeline_cohorts_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.async_stepping_) -
+      reinterpret_cast<char*>(&_impl_.num_pipeline_cohorts_)) + sizeof(_impl_.async_stepping_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TrainingDefinition::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .Schola.EnvironmentDefinition environment_definitions = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_environment_definitions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .Schola.DenseGroupDefinition dense_groups = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_dense_groups(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool use_step_stream = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.use_step_stream_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 num_pipeline_cohorts = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.num_pipeline_cohorts_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool async_stepping = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.async_stepping_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TrainingDefinition::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Schola.TrainingDefinition)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .Schola.EnvironmentDefinition environment_definitions = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_environment_definitions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_environment_definitions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .Schola.DenseGroupDefinition dense_groups = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_dense_groups_size()); i < n; i++) {
+    const auto& repfield = this->_internal_dense_groups(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bool use_step_stream = 3;
+  if (this->_internal_use_step_stream() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_use_step_stream(), target);
+  }
+
+  // int32 num_pipeline_cohorts = 4;
+  if (this->_internal_num_pipeline_cohorts() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_num_pipeline_cohorts(), target);
+  }
+
+  // bool async_stepping = 5;
+  if (this->_internal_async_stepping() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_async_stepping(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Schola.TrainingDefinition)
+  return target;
+}
+
+size_t TrainingDefinition::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Schola.TrainingDefinition)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .Schola.EnvironmentDefinition environment_definitions = 1;
+  total_size += 1UL * this->_internal_environment_definitions_size();
+  for (const auto& msg : this->_impl_.environment_definitions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .Schola.DenseGroupDefinition dense_groups = 2;
+  total_size += 1UL * this->_internal_dense_groups_size();
+  for (const auto& msg : this->_impl_.dense_groups_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // int32 num_pipeline_cohorts = 4;
+  if (this->_internal_num_pipeline_cohorts() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_pipeline_cohorts());
+  }
+
+  // bool use_step_stream = 3;
+  if (this->_internal_use_step_stream() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool async_stepping = 5;
+  if (this->_internal_async_stepping() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TrainingDefinition::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TrainingDefinition::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TrainingDefinition::GetClassData() const { return &_class_data_; }
+
+
+void TrainingDefinition::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TrainingDefinition*>(&to_msg);
+  auto& from = static_cast<const TrainingDefinition&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Schola.TrainingDefinition)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.environment_definitions_.MergeFrom(from._impl_.environment_definitions_);
+  _this->_impl_.dense_groups_.MergeFrom(from._impl_.dense_groups_);
+  if (from._internal_num_pipeline_cohorts() != 0) {
+    _this->_internal_set_num_pipeline_cohorts(from._internal_num_pipeline_cohorts());
+  }
+  if (from._internal_use_step_stream() != 0) {
+    _this->_internal_set_use_step_stream(from._internal_use_step_stream());
+  }
+  if (from._internal_async_stepping() != 0) {
+    _this->_internal_set_async_stepping(from._internal_async_stepping());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TrainingDefinition::CopyFrom(const TrainingDefinition& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Schola.TrainingDefinition)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TrainingDefinition::IsInitialized() const {
+  return true;
+}
+
+void TrainingDefinition::InternalSwap(TrainingDefinition* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.environment_definitions_.InternalSwap(&other->_impl_.environment_definitions_);
+  _impl_.dense_groups_.InternalSwap(&other->_impl_.dense_groups_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TrainingDefinition, _impl_.async_stepping_)
+      + sizeof(TrainingDefinition::_impl_.async_stepping_)
+      - PROTOBUF_FIELD_OFFSET(TrainingDefinition, _impl_.num_pipeline_cohorts_)>(
+          reinterpret_cast<char*>(&_impl_.num_pipeline_cohorts_),
+          reinterpret_cast<char*>(&other->_impl_.num_pipeline_cohorts_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TrainingDefinition::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Definitions_2eproto_getter, &descriptor_table_Definitions_2eproto_once,
+      file_level_metadata_Definitions_2eproto[4]);
+}
+
+// ===================================================================
+
+EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse::EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse() {}
+EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse::EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse::MergeFrom(const EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Definitions_2eproto_getter, &descriptor_table_Definitions_2eproto_once,
+      file_level_metadata_Definitions_2eproto[5]);
+}
+
+// ===================================================================
+
+class EnvironmentMembershipUpdate::_Internal {
+ public:
+};
+
+EnvironmentMembershipUpdate::EnvironmentMembershipUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &EnvironmentMembershipUpdate::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:Schola.EnvironmentMembershipUpdate)
+}
+EnvironmentMembershipUpdate::EnvironmentMembershipUpdate(const EnvironmentMembershipUpdate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EnvironmentMembershipUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.added_agents_)*/{}
+    , decltype(_impl_.removed_agents_){from._impl_.removed_agents_}
+    , /*decltype(_impl_._removed_agents_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.added_agents_.MergeFrom(from._impl_.added_agents_);
+  // @@protoc_insertion_point(copy_constructor:Schola.EnvironmentMembershipUpdate)
+}
+
+inline void EnvironmentMembershipUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.added_agents_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.removed_agents_){arena}
+    , /*decltype(_impl_._removed_agents_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+EnvironmentMembershipUpdate::~EnvironmentMembershipUpdate() {
+  // @@protoc_insertion_point(destructor:Schola.EnvironmentMembershipUpdate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EnvironmentMembershipUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.added_agents_.Destruct();
+  _impl_.added_agents_.~MapField();
+  _impl_.removed_agents_.~RepeatedField();
+}
+
+void EnvironmentMembershipUpdate::ArenaDtor(void* object) {
+  EnvironmentMembershipUpdate* _this = reinterpret_cast< EnvironmentMembershipUpdate* >(object);
+  _this->_impl_.added_agents_.Destruct();
+}
+void EnvironmentMembershipUpdate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EnvironmentMembershipUpdate::Clear() {
+// @@protoc_insertion_point(message_clear_start:Schola.EnvironmentMembershipUpdate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.added_agents_.Clear();
+  _impl_.removed_agents_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EnvironmentMembershipUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // map<int32, .Schola.AgentDefinition> added_agents = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.added_agents_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 removed_agents = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_removed_agents(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_removed_agents(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EnvironmentMembershipUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Schola.EnvironmentMembershipUpdate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<int32, .Schola.AgentDefinition> added_agents = 1;
+  if (!this->_internal_added_agents().empty()) {
+    using MapType = ::_pb::Map<int32_t, ::Schola::AgentDefinition>;
+    using WireHelper = EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_added_agents();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // repeated int32 removed_agents = 2;
+  {
+    int byte_size = _impl_._removed_agents_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          2, _internal_removed_agents(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Schola.EnvironmentMembershipUpdate)
+  return target;
+}
+
+size_t EnvironmentMembershipUpdate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Schola.EnvironmentMembershipUpdate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, .Schola.AgentDefinition> added_agents = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_added_agents_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::AgentDefinition >::const_iterator
+      it = this->_internal_added_agents().begin();
+      it != this->_internal_added_agents().end(); ++it) {
+    total_size += EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // repeated int32 removed_agents = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.removed_agents_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._removed_agents_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EnvironmentMembershipUpdate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EnvironmentMembershipUpdate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EnvironmentMembershipUpdate::GetClassData() const { return &_class_data_; }
+
+
+void EnvironmentMembershipUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EnvironmentMembershipUpdate*>(&to_msg);
+  auto& from = static_cast<const EnvironmentMembershipUpdate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Schola.EnvironmentMembershipUpdate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.added_agents_.MergeFrom(from._impl_.added_agents_);
+  _this->_impl_.removed_agents_.MergeFrom(from._impl_.removed_agents_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EnvironmentMembershipUpdate::CopyFrom(const EnvironmentMembershipUpdate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Schola.EnvironmentMembershipUpdate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EnvironmentMembershipUpdate::IsInitialized() const {
+  return true;
+}
+
+void EnvironmentMembershipUpdate::InternalSwap(EnvironmentMembershipUpdate* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.added_agents_.InternalSwap(&other->_impl_.added_agents_);
+  _impl_.removed_agents_.InternalSwap(&other->_impl_.removed_agents_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EnvironmentMembershipUpdate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Definitions_2eproto_getter, &descriptor_table_Definitions_2eproto_once,
+      file_level_metadata_Definitions_2eproto[6]);
+}
+
+// ===================================================================
+
+MembershipUpdate_EnvironmentsEntry_DoNotUse::MembershipUpdate_EnvironmentsEntry_DoNotUse() {}
+MembershipUpdate_EnvironmentsEntry_DoNotUse::MembershipUpdate_EnvironmentsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void MembershipUpdate_EnvironmentsEntry_DoNotUse::MergeFrom(const MembershipUpdate_EnvironmentsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata MembershipUpdate_EnvironmentsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Definitions_2eproto_getter, &descriptor_table_Definitions_2eproto_once,
+      file_level_metadata_Definitions_2eproto[7]);
+}
+
+// ===================================================================
+
+class MembershipUpdate::_Internal {
+ public:
+};
+
+MembershipUpdate::MembershipUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &MembershipUpdate::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:Schola.MembershipUpdate)
+}
+MembershipUpdate::MembershipUpdate(const MembershipUpdate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MembershipUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.environments_)*/{}
+    , decltype(_impl_.dense_groups_){from._impl_.dense_groups_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.environments_.MergeFrom(from._impl_.environments_);
+  // @@protoc_insertion_point(copy_constructor:Schola.MembershipUpdate)
+}
+
+inline void MembershipUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.environments_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.dense_groups_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MembershipUpdate::~MembershipUpdate() {
+  // @@protoc_insertion_point(destructor:Schola.MembershipUpdate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MembershipUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.environments_.Destruct();
+  _impl_.environments_.~MapField();
+  _impl_.dense_groups_.~RepeatedPtrField();
+}
+
+void MembershipUpdate::ArenaDtor(void* object) {
+  MembershipUpdate* _this = reinterpret_cast< MembershipUpdate* >(object);
+  _this->_impl_.environments_.Destruct();
+}
+void MembershipUpdate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MembershipUpdate::Clear() {
+// @@protoc_insertion_point(message_clear_start:Schola.MembershipUpdate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.environments_.Clear();
+  _impl_.dense_groups_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MembershipUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // map<int32, .Schola.EnvironmentMembershipUpdate> environments = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.environments_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .Schola.DenseGroupDefinition dense_groups = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_dense_groups(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MembershipUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Schola.MembershipUpdate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // map<int32, .Schola.EnvironmentMembershipUpdate> environments = 1;
+  if (!this->_internal_environments().empty()) {
+    using MapType = ::_pb::Map<int32_t, ::Schola::EnvironmentMembershipUpdate>;
+    using WireHelper = MembershipUpdate_EnvironmentsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_environments();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // repeated .Schola.DenseGroupDefinition dense_groups = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_dense_groups_size()); i < n; i++) {
+    const auto& repfield = this->_internal_dense_groups(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Schola.MembershipUpdate)
+  return target;
+}
+
+size_t MembershipUpdate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Schola.MembershipUpdate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<int32, .Schola.EnvironmentMembershipUpdate> environments = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_environments_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::EnvironmentMembershipUpdate >::const_iterator
+      it = this->_internal_environments().begin();
+      it != this->_internal_environments().end(); ++it) {
+    total_size += MembershipUpdate_EnvironmentsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // repeated .Schola.DenseGroupDefinition dense_groups = 2;
+  total_size += 1UL * this->_internal_dense_groups_size();
+  for (const auto& msg : this->_impl_.dense_groups_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MembershipUpdate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MembershipUpdate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MembershipUpdate::GetClassData() const { return &_class_data_; }
+
+
+void MembershipUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MembershipUpdate*>(&to_msg);
+  auto& from = static_cast<const MembershipUpdate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Schola.MembershipUpdate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.environments_.MergeFrom(from._impl_.environments_);
+  _this->_impl_.dense_groups_.MergeFrom(from._impl_.dense_groups_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MembershipUpdate::CopyFrom(const MembershipUpdate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Schola.MembershipUpdate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MembershipUpdate::IsInitialized() const {
+  return true;
+}
+
+void MembershipUpdate::InternalSwap(MembershipUpdate* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.environments_.InternalSwap(&other->_impl_.environments_);
+  _impl_.dense_groups_.InternalSwap(&other->_impl_.dense_groups_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MembershipUpdate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Definitions_2eproto_getter, &descriptor_table_Definitions_2eproto_once,
+      file_level_metadata_Definitions_2eproto[8]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace Schola
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::Schola::AgentDefinition*
+Arena::CreateMaybeMessage< ::Schola::AgentDefinition >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Schola::AgentDefinition >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Schola::EnvironmentDefinition_AgentDefinitionsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Schola::EnvironmentDefinition_AgentDefinitionsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Schola::EnvironmentDefinition_AgentDefinitionsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Schola::EnvironmentDefinition*
+Arena::CreateMaybeMessage< ::Schola::EnvironmentDefinition >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Schola::EnvironmentDefinition >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Schola::DenseGroupDefinition*
+Arena::CreateMaybeMessage< ::Schola::DenseGroupDefinition >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Schola::DenseGroupDefinition >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Schola::TrainingDefinition*
+Arena::CreateMaybeMessage< ::Schola::TrainingDefinition >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Schola::TrainingDefinition >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Schola::EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Schola::EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Schola::EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Schola::EnvironmentMembershipUpdate*
+Arena::CreateMaybeMessage< ::Schola::EnvironmentMembershipUpdate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Schola::EnvironmentMembershipUpdate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Schola::MembershipUpdate_EnvironmentsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Schola::MembershipUpdate_EnvironmentsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Schola::MembershipUpdate_EnvironmentsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Schola::MembershipUpdate*
+Arena::CreateMaybeMessage< ::Schola::MembershipUpdate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Schola::MembershipUpdate >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
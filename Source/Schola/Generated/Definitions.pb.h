@@ -52,20 +52,40 @@ namespace Schola {
 class AgentDefinition;
 struct AgentDefinitionDefaultTypeInternal;
 extern AgentDefinitionDefaultTypeInternal _AgentDefinition_default_instance_;
+class DenseGroupDefinition;
+struct DenseGroupDefinitionDefaultTypeInternal;
+extern DenseGroupDefinitionDefaultTypeInternal _DenseGroupDefinition_default_instance_;
 class EnvironmentDefinition;
 struct EnvironmentDefinitionDefaultTypeInternal;
 extern EnvironmentDefinitionDefaultTypeInternal _EnvironmentDefinition_default_instance_;
 class EnvironmentDefinition_AgentDefinitionsEntry_DoNotUse;
 struct EnvironmentDefinition_AgentDefinitionsEntry_DoNotUseDefaultTypeInternal;
 extern EnvironmentDefinition_AgentDefinitionsEntry_DoNotUseDefaultTypeInternal _EnvironmentDefinition_AgentDefinitionsEntry_DoNotUse_default_instance_;
+class EnvironmentMembershipUpdate;
+struct EnvironmentMembershipUpdateDefaultTypeInternal;
+extern EnvironmentMembershipUpdateDefaultTypeInternal _EnvironmentMembershipUpdate_default_instance_;
+class EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse;
+struct EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUseDefaultTypeInternal;
+extern EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUseDefaultTypeInternal _EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse_default_instance_;
+class MembershipUpdate;
+struct MembershipUpdateDefaultTypeInternal;
+extern MembershipUpdateDefaultTypeInternal _MembershipUpdate_default_instance_;
+class MembershipUpdate_EnvironmentsEntry_DoNotUse;
+struct MembershipUpdate_EnvironmentsEntry_DoNotUseDefaultTypeInternal;
+extern MembershipUpdate_EnvironmentsEntry_DoNotUseDefaultTypeInternal _MembershipUpdate_EnvironmentsEntry_DoNotUse_default_instance_;
 class TrainingDefinition;
 struct TrainingDefinitionDefaultTypeInternal;
 extern TrainingDefinitionDefaultTypeInternal _TrainingDefinition_default_instance_;
 }  // namespace Schola
 PROTOBUF_NAMESPACE_OPEN
 template<> ::Schola::AgentDefinition* Arena::CreateMaybeMessage<::Schola::AgentDefinition>(Arena*);
+template<> ::Schola::DenseGroupDefinition* Arena::CreateMaybeMessage<::Schola::DenseGroupDefinition>(Arena*);
 template<> ::Schola::EnvironmentDefinition* Arena::CreateMaybeMessage<::Schola::EnvironmentDefinition>(Arena*);
 template<> ::Schola::EnvironmentDefinition_AgentDefinitionsEntry_DoNotUse* Arena::CreateMaybeMessage<::Schola::EnvironmentDefinition_AgentDefinitionsEntry_DoNotUse>(Arena*);
+template<> ::Schola::EnvironmentMembershipUpdate* Arena::CreateMaybeMessage<::Schola::EnvironmentMembershipUpdate>(Arena*);
+template<> ::Schola::EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse* Arena::CreateMaybeMessage<::Schola::EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse>(Arena*);
+template<> ::Schola::MembershipUpdate* Arena::CreateMaybeMessage<::Schola::MembershipUpdate>(Arena*);
+template<> ::Schola::MembershipUpdate_EnvironmentsEntry_DoNotUse* Arena::CreateMaybeMessage<::Schola::MembershipUpdate_EnvironmentsEntry_DoNotUse>(Arena*);
 template<> ::Schola::TrainingDefinition* Arena::CreateMaybeMessage<::Schola::TrainingDefinition>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace Schola {
@@ -474,24 +494,690 @@ class EnvironmentDefinition final :
 };
 // -------------------------------------------------------------------
 
+class DenseGroupDefinition final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Schola.DenseGroupDefinition) */ {
+ public:
+  inline DenseGroupDefinition() : DenseGroupDefinition(nullptr) {}
+  ~DenseGroupDefinition() override;
+  explicit PROTOBUF_CONSTEXPR DenseGroupDefinition(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DenseGroupDefinition(const DenseGroupDefinition& from);
+  DenseGroupDefinition(DenseGroupDefinition&& from) noexcept
+    : DenseGroupDefinition() {
+    *this = ::std::move(from);
+  }
+
+  inline DenseGroupDefinition& operator=(const DenseGroupDefinition& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DenseGroupDefinition& operator=(DenseGroupDefinition&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DenseGroupDefinition& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DenseGroupDefinition* internal_default_instance() {
+    return reinterpret_cast<const DenseGroupDefinition*>(
+               &_DenseGroupDefinition_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(DenseGroupDefinition& a, DenseGroupDefinition& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DenseGroupDefinition* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DenseGroupDefinition* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DenseGroupDefinition* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DenseGroupDefinition>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DenseGroupDefinition& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DenseGroupDefinition& from) {
+    DenseGroupDefinition::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DenseGroupDefinition* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Schola.DenseGroupDefinition";
+  }
+  protected:
+  explicit DenseGroupDefinition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEnvIdsFieldNumber = 4,
+    kAgentIdsFieldNumber = 5,
+    kGroupIdFieldNumber = 1,
+    kObsDimFieldNumber = 2,
+    kActionDimFieldNumber = 3,
+  };
+  // repeated int32 env_ids = 4;
+  int env_ids_size() const;
+  private:
+  int _internal_env_ids_size() const;
+  public:
+  void clear_env_ids();
+  private:
+  int32_t _internal_env_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_env_ids() const;
+  void _internal_add_env_ids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_env_ids();
+  public:
+  int32_t env_ids(int index) const;
+  void set_env_ids(int index, int32_t value);
+  void add_env_ids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      env_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_env_ids();
+
+  // repeated int32 agent_ids = 5;
+  int agent_ids_size() const;
+  private:
+  int _internal_agent_ids_size() const;
+  public:
+  void clear_agent_ids();
+  private:
+  int32_t _internal_agent_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_agent_ids() const;
+  void _internal_add_agent_ids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_agent_ids();
+  public:
+  int32_t agent_ids(int index) const;
+  void set_agent_ids(int index, int32_t value);
+  void add_agent_ids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      agent_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_agent_ids();
+
+  // int32 group_id = 1;
+  void clear_group_id();
+  int32_t group_id() const;
+  void set_group_id(int32_t value);
+  private:
+  int32_t _internal_group_id() const;
+  void _internal_set_group_id(int32_t value);
+  public:
+
+  // int32 obs_dim = 2;
+  void clear_obs_dim();
+  int32_t obs_dim() const;
+  void set_obs_dim(int32_t value);
+  private:
+  int32_t _internal_obs_dim() const;
+  void _internal_set_obs_dim(int32_t value);
+  public:
+
+  // int32 action_dim = 3;
+  void clear_action_dim();
+  int32_t action_dim() const;
+  void set_action_dim(int32_t value);
+  private:
+  int32_t _internal_action_dim() const;
+  void _internal_set_action_dim(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Schola.DenseGroupDefinition)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > env_ids_;
+    mutable std::atomic<int> _env_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > agent_ids_;
+    mutable std::atomic<int> _agent_ids_cached_byte_size_;
+    int32_t group_id_;
+    int32_t obs_dim_;
+    int32_t action_dim_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Definitions_2eproto;
+};
+// -------------------------------------------------------------------
+
 class TrainingDefinition final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Schola.TrainingDefinition) */ {
  public:
-  inline TrainingDefinition() : TrainingDefinition(nullptr) {}
-  ~TrainingDefinition() override;
-  explicit PROTOBUF_CONSTEXPR TrainingDefinition(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline TrainingDefinition() : TrainingDefinition(nullptr) {}
+  ~TrainingDefinition() override;
+  explicit PROTOBUF_CONSTEXPR TrainingDefinition(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TrainingDefinition(const TrainingDefinition& from);
+  TrainingDefinition(TrainingDefinition&& from) noexcept
+    : TrainingDefinition() {
+    *this = ::std::move(from);
+  }
+
+  inline TrainingDefinition& operator=(const TrainingDefinition& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TrainingDefinition& operator=(TrainingDefinition&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainingDefinition& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainingDefinition* internal_default_instance() {
+    return reinterpret_cast<const TrainingDefinition*>(
+               &_TrainingDefinition_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(TrainingDefinition& a, TrainingDefinition& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainingDefinition* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainingDefinition* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TrainingDefinition* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainingDefinition>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TrainingDefinition& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainingDefinition& from) {
+    TrainingDefinition::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TrainingDefinition* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Schola.TrainingDefinition";
+  }
+  protected:
+  explicit TrainingDefinition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEnvironmentDefinitionsFieldNumber = 1,
+    kDenseGroupsFieldNumber = 2,
+    kNumPipelineCohortsFieldNumber = 4,
+    kUseStepStreamFieldNumber = 3,
+    kAsyncSteppingFieldNumber = 5,
+  };
+  // repeated .Schola.EnvironmentDefinition environment_definitions = 1;
+  int environment_definitions_size() const;
+  private:
+  int _internal_environment_definitions_size() const;
+  public:
+  void clear_environment_definitions();
+  ::Schola::EnvironmentDefinition* mutable_environment_definitions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::EnvironmentDefinition >*
+      mutable_environment_definitions();
+  private:
+  const ::Schola::EnvironmentDefinition& _internal_environment_definitions(int index) const;
+  ::Schola::EnvironmentDefinition* _internal_add_environment_definitions();
+  public:
+  const ::Schola::EnvironmentDefinition& environment_definitions(int index) const;
+  ::Schola::EnvironmentDefinition* add_environment_definitions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::EnvironmentDefinition >&
+      environment_definitions() const;
+
+  // repeated .Schola.DenseGroupDefinition dense_groups = 2;
+  int dense_groups_size() const;
+  private:
+  int _internal_dense_groups_size() const;
+  public:
+  void clear_dense_groups();
+  ::Schola::DenseGroupDefinition* mutable_dense_groups(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupDefinition >*
+      mutable_dense_groups();
+  private:
+  const ::Schola::DenseGroupDefinition& _internal_dense_groups(int index) const;
+  ::Schola::DenseGroupDefinition* _internal_add_dense_groups();
+  public:
+  const ::Schola::DenseGroupDefinition& dense_groups(int index) const;
+  ::Schola::DenseGroupDefinition* add_dense_groups();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupDefinition >&
+      dense_groups() const;
+
+  // int32 num_pipeline_cohorts = 4;
+  void clear_num_pipeline_cohorts();
+  int32_t num_pipeline_cohorts() const;
+  void set_num_pipeline_cohorts(int32_t value);
+  private:
+  int32_t _internal_num_pipeline_cohorts() const;
+  void _internal_set_num_pipeline_cohorts(int32_t value);
+  public:
+
+  // bool use_step_stream = 3;
+  void clear_use_step_stream();
+  bool use_step_stream() const;
+  void set_use_step_stream(bool value);
+  private:
+  bool _internal_use_step_stream() const;
+  void _internal_set_use_step_stream(bool value);
+  public:
+
+  // bool async_stepping = 5;
+  void clear_async_stepping();
+  bool async_stepping() const;
+  void set_async_stepping(bool value);
+  private:
+  bool _internal_async_stepping() const;
+  void _internal_set_async_stepping(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Schola.TrainingDefinition)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::EnvironmentDefinition > environment_definitions_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupDefinition > dense_groups_;
+    int32_t num_pipeline_cohorts_;
+    bool use_step_stream_;
+    bool async_stepping_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Definitions_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse, 
+    int32_t, ::Schola::AgentDefinition,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse, 
+    int32_t, ::Schola::AgentDefinition,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> SuperType;
+  EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse& other);
+  static const EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse*>(&_EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_Definitions_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class EnvironmentMembershipUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Schola.EnvironmentMembershipUpdate) */ {
+ public:
+  inline EnvironmentMembershipUpdate() : EnvironmentMembershipUpdate(nullptr) {}
+  ~EnvironmentMembershipUpdate() override;
+  explicit PROTOBUF_CONSTEXPR EnvironmentMembershipUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EnvironmentMembershipUpdate(const EnvironmentMembershipUpdate& from);
+  EnvironmentMembershipUpdate(EnvironmentMembershipUpdate&& from) noexcept
+    : EnvironmentMembershipUpdate() {
+    *this = ::std::move(from);
+  }
+
+  inline EnvironmentMembershipUpdate& operator=(const EnvironmentMembershipUpdate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EnvironmentMembershipUpdate& operator=(EnvironmentMembershipUpdate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EnvironmentMembershipUpdate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EnvironmentMembershipUpdate* internal_default_instance() {
+    return reinterpret_cast<const EnvironmentMembershipUpdate*>(
+               &_EnvironmentMembershipUpdate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(EnvironmentMembershipUpdate& a, EnvironmentMembershipUpdate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EnvironmentMembershipUpdate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EnvironmentMembershipUpdate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EnvironmentMembershipUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EnvironmentMembershipUpdate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EnvironmentMembershipUpdate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EnvironmentMembershipUpdate& from) {
+    EnvironmentMembershipUpdate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EnvironmentMembershipUpdate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Schola.EnvironmentMembershipUpdate";
+  }
+  protected:
+  explicit EnvironmentMembershipUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAddedAgentsFieldNumber = 1,
+    kRemovedAgentsFieldNumber = 2,
+  };
+  // map<int32, .Schola.AgentDefinition> added_agents = 1;
+  int added_agents_size() const;
+  private:
+  int _internal_added_agents_size() const;
+  public:
+  void clear_added_agents();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::AgentDefinition >&
+      _internal_added_agents() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::AgentDefinition >*
+      _internal_mutable_added_agents();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::AgentDefinition >&
+      added_agents() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::AgentDefinition >*
+      mutable_added_agents();
+
+  // repeated int32 removed_agents = 2;
+  int removed_agents_size() const;
+  private:
+  int _internal_removed_agents_size() const;
+  public:
+  void clear_removed_agents();
+  private:
+  int32_t _internal_removed_agents(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_removed_agents() const;
+  void _internal_add_removed_agents(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_removed_agents();
+  public:
+  int32_t removed_agents(int index) const;
+  void set_removed_agents(int index, int32_t value);
+  void add_removed_agents(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      removed_agents() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_removed_agents();
+
+  // @@protoc_insertion_point(class_scope:Schola.EnvironmentMembershipUpdate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        EnvironmentMembershipUpdate_AddedAgentsEntry_DoNotUse,
+        int32_t, ::Schola::AgentDefinition,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> added_agents_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > removed_agents_;
+    mutable std::atomic<int> _removed_agents_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Definitions_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MembershipUpdate_EnvironmentsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MembershipUpdate_EnvironmentsEntry_DoNotUse, 
+    int32_t, ::Schola::EnvironmentMembershipUpdate,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<MembershipUpdate_EnvironmentsEntry_DoNotUse, 
+    int32_t, ::Schola::EnvironmentMembershipUpdate,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> SuperType;
+  MembershipUpdate_EnvironmentsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR MembershipUpdate_EnvironmentsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit MembershipUpdate_EnvironmentsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const MembershipUpdate_EnvironmentsEntry_DoNotUse& other);
+  static const MembershipUpdate_EnvironmentsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const MembershipUpdate_EnvironmentsEntry_DoNotUse*>(&_MembershipUpdate_EnvironmentsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_Definitions_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class MembershipUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Schola.MembershipUpdate) */ {
+ public:
+  inline MembershipUpdate() : MembershipUpdate(nullptr) {}
+  ~MembershipUpdate() override;
+  explicit PROTOBUF_CONSTEXPR MembershipUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  TrainingDefinition(const TrainingDefinition& from);
-  TrainingDefinition(TrainingDefinition&& from) noexcept
-    : TrainingDefinition() {
+  MembershipUpdate(const MembershipUpdate& from);
+  MembershipUpdate(MembershipUpdate&& from) noexcept
+    : MembershipUpdate() {
     *this = ::std::move(from);
   }
 
-  inline TrainingDefinition& operator=(const TrainingDefinition& from) {
+  inline MembershipUpdate& operator=(const MembershipUpdate& from) {
     CopyFrom(from);
     return *this;
   }
-  inline TrainingDefinition& operator=(TrainingDefinition&& from) noexcept {
+  inline MembershipUpdate& operator=(MembershipUpdate&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -514,20 +1200,20 @@ class TrainingDefinition final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const TrainingDefinition& default_instance() {
+  static const MembershipUpdate& default_instance() {
     return *internal_default_instance();
   }
-  static inline const TrainingDefinition* internal_default_instance() {
-    return reinterpret_cast<const TrainingDefinition*>(
-               &_TrainingDefinition_default_instance_);
+  static inline const MembershipUpdate* internal_default_instance() {
+    return reinterpret_cast<const MembershipUpdate*>(
+               &_MembershipUpdate_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    8;
 
-  friend void swap(TrainingDefinition& a, TrainingDefinition& b) {
+  friend void swap(MembershipUpdate& a, MembershipUpdate& b) {
     a.Swap(&b);
   }
-  inline void Swap(TrainingDefinition* other) {
+  inline void Swap(MembershipUpdate* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -540,7 +1226,7 @@ class TrainingDefinition final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(TrainingDefinition* other) {
+  void UnsafeArenaSwap(MembershipUpdate* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -548,14 +1234,14 @@ class TrainingDefinition final :
 
   // implements Message ----------------------------------------------
 
-  TrainingDefinition* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<TrainingDefinition>(arena);
+  MembershipUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MembershipUpdate>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const TrainingDefinition& from);
+  void CopyFrom(const MembershipUpdate& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const TrainingDefinition& from) {
-    TrainingDefinition::MergeImpl(*this, from);
+  void MergeFrom( const MembershipUpdate& from) {
+    MembershipUpdate::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -573,16 +1259,18 @@ class TrainingDefinition final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(TrainingDefinition* other);
+  void InternalSwap(MembershipUpdate* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "Schola.TrainingDefinition";
+    return "Schola.MembershipUpdate";
   }
   protected:
-  explicit TrainingDefinition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit MembershipUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
   public:
 
   static const ClassData _class_data_;
@@ -592,30 +1280,49 @@ class TrainingDefinition final :
 
   // nested types ----------------------------------------------------
 
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kEnvironmentDefinitionsFieldNumber = 1,
+    kEnvironmentsFieldNumber = 1,
+    kDenseGroupsFieldNumber = 2,
   };
-  // repeated .Schola.EnvironmentDefinition environment_definitions = 1;
-  int environment_definitions_size() const;
+  // map<int32, .Schola.EnvironmentMembershipUpdate> environments = 1;
+  int environments_size() const;
   private:
-  int _internal_environment_definitions_size() const;
+  int _internal_environments_size() const;
   public:
-  void clear_environment_definitions();
-  ::Schola::EnvironmentDefinition* mutable_environment_definitions(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::EnvironmentDefinition >*
-      mutable_environment_definitions();
+  void clear_environments();
   private:
-  const ::Schola::EnvironmentDefinition& _internal_environment_definitions(int index) const;
-  ::Schola::EnvironmentDefinition* _internal_add_environment_definitions();
+  const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::EnvironmentMembershipUpdate >&
+      _internal_environments() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::EnvironmentMembershipUpdate >*
+      _internal_mutable_environments();
   public:
-  const ::Schola::EnvironmentDefinition& environment_definitions(int index) const;
-  ::Schola::EnvironmentDefinition* add_environment_definitions();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::EnvironmentDefinition >&
-      environment_definitions() const;
+  const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::EnvironmentMembershipUpdate >&
+      environments() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::EnvironmentMembershipUpdate >*
+      mutable_environments();
 
-  // @@protoc_insertion_point(class_scope:Schola.TrainingDefinition)
+  // repeated .Schola.DenseGroupDefinition dense_groups = 2;
+  int dense_groups_size() const;
+  private:
+  int _internal_dense_groups_size() const;
+  public:
+  void clear_dense_groups();
+  ::Schola::DenseGroupDefinition* mutable_dense_groups(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupDefinition >*
+      mutable_dense_groups();
+  private:
+  const ::Schola::DenseGroupDefinition& _internal_dense_groups(int index) const;
+  ::Schola::DenseGroupDefinition* _internal_add_dense_groups();
+  public:
+  const ::Schola::DenseGroupDefinition& dense_groups(int index) const;
+  ::Schola::DenseGroupDefinition* add_dense_groups();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupDefinition >&
+      dense_groups() const;
+
+  // @@protoc_insertion_point(class_scope:Schola.MembershipUpdate)
  private:
   class _Internal;
 
@@ -623,7 +1330,12 @@ class TrainingDefinition final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::EnvironmentDefinition > environment_definitions_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        MembershipUpdate_EnvironmentsEntry_DoNotUse,
+        int32_t, ::Schola::EnvironmentMembershipUpdate,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> environments_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupDefinition > dense_groups_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -937,6 +1649,164 @@ EnvironmentDefinition::mutable_agent_definitions() {
 
 // -------------------------------------------------------------------
 
+// DenseGroupDefinition
+
+// int32 group_id = 1;
+inline void DenseGroupDefinition::clear_group_id() {
+  _impl_.group_id_ = 0;
+}
+inline int32_t DenseGroupDefinition::_internal_group_id() const {
+  return _impl_.group_id_;
+}
+inline int32_t DenseGroupDefinition::group_id() const {
+  // @@protoc_insertion_point(field_get:Schola.DenseGroupDefinition.group_id)
+  return _internal_group_id();
+}
+inline void DenseGroupDefinition::_internal_set_group_id(int32_t value) {
+  
+  _impl_.group_id_ = value;
+}
+inline void DenseGroupDefinition::set_group_id(int32_t value) {
+  _internal_set_group_id(value);
+  // @@protoc_insertion_point(field_set:Schola.DenseGroupDefinition.group_id)
+}
+
+// int32 obs_dim = 2;
+inline void DenseGroupDefinition::clear_obs_dim() {
+  _impl_.obs_dim_ = 0;
+}
+inline int32_t DenseGroupDefinition::_internal_obs_dim() const {
+  return _impl_.obs_dim_;
+}
+inline int32_t DenseGroupDefinition::obs_dim() const {
+  // @@protoc_insertion_point(field_get:Schola.DenseGroupDefinition.obs_dim)
+  return _internal_obs_dim();
+}
+inline void DenseGroupDefinition::_internal_set_obs_dim(int32_t value) {
+  
+  _impl_.obs_dim_ = value;
+}
+inline void DenseGroupDefinition::set_obs_dim(int32_t value) {
+  _internal_set_obs_dim(value);
+  // @@protoc_insertion_point(field_set:Schola.DenseGroupDefinition.obs_dim)
+}
+
+// int32 action_dim = 3;
+inline void DenseGroupDefinition::clear_action_dim() {
+  _impl_.action_dim_ = 0;
+}
+inline int32_t DenseGroupDefinition::_internal_action_dim() const {
+  return _impl_.action_dim_;
+}
+inline int32_t DenseGroupDefinition::action_dim() const {
+  // @@protoc_insertion_point(field_get:Schola.DenseGroupDefinition.action_dim)
+  return _internal_action_dim();
+}
+inline void DenseGroupDefinition::_internal_set_action_dim(int32_t value) {
+  
+  _impl_.action_dim_ = value;
+}
+inline void DenseGroupDefinition::set_action_dim(int32_t value) {
+  _internal_set_action_dim(value);
+  // @@protoc_insertion_point(field_set:Schola.DenseGroupDefinition.action_dim)
+}
+
+// repeated int32 env_ids = 4;
+inline int DenseGroupDefinition::_internal_env_ids_size() const {
+  return _impl_.env_ids_.size();
+}
+inline int DenseGroupDefinition::env_ids_size() const {
+  return _internal_env_ids_size();
+}
+inline void DenseGroupDefinition::clear_env_ids() {
+  _impl_.env_ids_.Clear();
+}
+inline int32_t DenseGroupDefinition::_internal_env_ids(int index) const {
+  return _impl_.env_ids_.Get(index);
+}
+inline int32_t DenseGroupDefinition::env_ids(int index) const {
+  // @@protoc_insertion_point(field_get:Schola.DenseGroupDefinition.env_ids)
+  return _internal_env_ids(index);
+}
+inline void DenseGroupDefinition::set_env_ids(int index, int32_t value) {
+  _impl_.env_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Schola.DenseGroupDefinition.env_ids)
+}
+inline void DenseGroupDefinition::_internal_add_env_ids(int32_t value) {
+  _impl_.env_ids_.Add(value);
+}
+inline void DenseGroupDefinition::add_env_ids(int32_t value) {
+  _internal_add_env_ids(value);
+  // @@protoc_insertion_point(field_add:Schola.DenseGroupDefinition.env_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+DenseGroupDefinition::_internal_env_ids() const {
+  return _impl_.env_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+DenseGroupDefinition::env_ids() const {
+  // @@protoc_insertion_point(field_list:Schola.DenseGroupDefinition.env_ids)
+  return _internal_env_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+DenseGroupDefinition::_internal_mutable_env_ids() {
+  return &_impl_.env_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+DenseGroupDefinition::mutable_env_ids() {
+  // @@protoc_insertion_point(field_mutable_list:Schola.DenseGroupDefinition.env_ids)
+  return _internal_mutable_env_ids();
+}
+
+// repeated int32 agent_ids = 5;
+inline int DenseGroupDefinition::_internal_agent_ids_size() const {
+  return _impl_.agent_ids_.size();
+}
+inline int DenseGroupDefinition::agent_ids_size() const {
+  return _internal_agent_ids_size();
+}
+inline void DenseGroupDefinition::clear_agent_ids() {
+  _impl_.agent_ids_.Clear();
+}
+inline int32_t DenseGroupDefinition::_internal_agent_ids(int index) const {
+  return _impl_.agent_ids_.Get(index);
+}
+inline int32_t DenseGroupDefinition::agent_ids(int index) const {
+  // @@protoc_insertion_point(field_get:Schola.DenseGroupDefinition.agent_ids)
+  return _internal_agent_ids(index);
+}
+inline void DenseGroupDefinition::set_agent_ids(int index, int32_t value) {
+  _impl_.agent_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Schola.DenseGroupDefinition.agent_ids)
+}
+inline void DenseGroupDefinition::_internal_add_agent_ids(int32_t value) {
+  _impl_.agent_ids_.Add(value);
+}
+inline void DenseGroupDefinition::add_agent_ids(int32_t value) {
+  _internal_add_agent_ids(value);
+  // @@protoc_insertion_point(field_add:Schola.DenseGroupDefinition.agent_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+DenseGroupDefinition::_internal_agent_ids() const {
+  return _impl_.agent_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+DenseGroupDefinition::agent_ids() const {
+  // @@protoc_insertion_point(field_list:Schola.DenseGroupDefinition.agent_ids)
+  return _internal_agent_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+DenseGroupDefinition::_internal_mutable_agent_ids() {
+  return &_impl_.agent_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+DenseGroupDefinition::mutable_agent_ids() {
+  // @@protoc_insertion_point(field_mutable_list:Schola.DenseGroupDefinition.agent_ids)
+  return _internal_mutable_agent_ids();
+}
+
+// -------------------------------------------------------------------
+
 // TrainingDefinition
 
 // repeated .Schola.EnvironmentDefinition environment_definitions = 1;
@@ -979,6 +1849,263 @@ TrainingDefinition::environment_definitions() const {
   return _impl_.environment_definitions_;
 }
 
+// repeated .Schola.DenseGroupDefinition dense_groups = 2;
+inline int TrainingDefinition::_internal_dense_groups_size() const {
+  return _impl_.dense_groups_.size();
+}
+inline int TrainingDefinition::dense_groups_size() const {
+  return _internal_dense_groups_size();
+}
+inline void TrainingDefinition::clear_dense_groups() {
+  _impl_.dense_groups_.Clear();
+}
+inline ::Schola::DenseGroupDefinition* TrainingDefinition::mutable_dense_groups(int index) {
+  // @@protoc_insertion_point(field_mutable:Schola.TrainingDefinition.dense_groups)
+  return _impl_.dense_groups_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupDefinition >*
+TrainingDefinition::mutable_dense_groups() {
+  // @@protoc_insertion_point(field_mutable_list:Schola.TrainingDefinition.dense_groups)
+  return &_impl_.dense_groups_;
+}
+inline const ::Schola::DenseGroupDefinition& TrainingDefinition::_internal_dense_groups(int index) const {
+  return _impl_.dense_groups_.Get(index);
+}
+inline const ::Schola::DenseGroupDefinition& TrainingDefinition::dense_groups(int index) const {
+  // @@protoc_insertion_point(field_get:Schola.TrainingDefinition.dense_groups)
+  return _internal_dense_groups(index);
+}
+inline ::Schola::DenseGroupDefinition* TrainingDefinition::_internal_add_dense_groups() {
+  return _impl_.dense_groups_.Add();
+}
+inline ::Schola::DenseGroupDefinition* TrainingDefinition::add_dense_groups() {
+  ::Schola::DenseGroupDefinition* _add = _internal_add_dense_groups();
+  // @@protoc_insertion_point(field_add:Schola.TrainingDefinition.dense_groups)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupDefinition >&
+TrainingDefinition::dense_groups() const {
+  // @@protoc_insertion_point(field_list:Schola.TrainingDefinition.dense_groups)
+  return _impl_.dense_groups_;
+}
+
+// bool use_step_stream = 3;
+inline void TrainingDefinition::clear_use_step_stream() {
+  _impl_.use_step_stream_ = false;
+}
+inline bool TrainingDefinition::_internal_use_step_stream() const {
+  return _impl_.use_step_stream_;
+}
+inline bool TrainingDefinition::use_step_stream() const {
+  // @@protoc_insertion_point(field_get:Schola.TrainingDefinition.use_step_stream)
+  return _internal_use_step_stream();
+}
+inline void TrainingDefinition::_internal_set_use_step_stream(bool value) {
+  
+  _impl_.use_step_stream_ = value;
+}
+inline void TrainingDefinition::set_use_step_stream(bool value) {
+  _internal_set_use_step_stream(value);
+  // @@protoc_insertion_point(field_set:Schola.TrainingDefinition.use_step_stream)
+}
+
+// int32 num_pipeline_cohorts = 4;
+inline void TrainingDefinition::clear_num_pipeline_cohorts() {
+  _impl_.num_pipeline_cohorts_ = 0;
+}
+inline int32_t TrainingDefinition::_internal_num_pipeline_cohorts() const {
+  return _impl_.num_pipeline_cohorts_;
+}
+inline int32_t TrainingDefinition::num_pipeline_cohorts() const {
+  // @@protoc_insertion_point(field_get:Schola.TrainingDefinition.num_pipeline_cohorts)
+  return _internal_num_pipeline_cohorts();
+}
+inline void TrainingDefinition::_internal_set_num_pipeline_cohorts(int32_t value) {
+  
+  _impl_.num_pipeline_cohorts_ = value;
+}
+inline void TrainingDefinition::set_num_pipeline_cohorts(int32_t value) {
+  _internal_set_num_pipeline_cohorts(value);
+  // @@protoc_insertion_point(field_set:Schola.TrainingDefinition.num_pipeline_cohorts)
+}
+
+// bool async_stepping = 5;
+inline void TrainingDefinition::clear_async_stepping() {
+  _impl_.async_stepping_ = false;
+}
+inline bool TrainingDefinition::_internal_async_stepping() const {
+  return _impl_.async_stepping_;
+}
+inline bool TrainingDefinition::async_stepping() const {
+  // @@protoc_insertion_point(field_get:Schola.TrainingDefinition.async_stepping)
+  return _internal_async_stepping();
+}
+inline void TrainingDefinition::_internal_set_async_stepping(bool value) {
+  
+  _impl_.async_stepping_ = value;
+}
+inline void TrainingDefinition::set_async_stepping(bool value) {
+  _internal_set_async_stepping(value);
+  // @@protoc_insertion_point(field_set:Schola.TrainingDefinition.async_stepping)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// EnvironmentMembershipUpdate
+
+// map<int32, .Schola.AgentDefinition> added_agents = 1;
+inline int EnvironmentMembershipUpdate::_internal_added_agents_size() const {
+  return _impl_.added_agents_.size();
+}
+inline int EnvironmentMembershipUpdate::added_agents_size() const {
+  return _internal_added_agents_size();
+}
+inline void EnvironmentMembershipUpdate::clear_added_agents() {
+  _impl_.added_agents_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::AgentDefinition >&
+EnvironmentMembershipUpdate::_internal_added_agents() const {
+  return _impl_.added_agents_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::AgentDefinition >&
+EnvironmentMembershipUpdate::added_agents() const {
+  // @@protoc_insertion_point(field_map:Schola.EnvironmentMembershipUpdate.added_agents)
+  return _internal_added_agents();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::AgentDefinition >*
+EnvironmentMembershipUpdate::_internal_mutable_added_agents() {
+  return _impl_.added_agents_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::AgentDefinition >*
+EnvironmentMembershipUpdate::mutable_added_agents() {
+  // @@protoc_insertion_point(field_mutable_map:Schola.EnvironmentMembershipUpdate.added_agents)
+  return _internal_mutable_added_agents();
+}
+
+// repeated int32 removed_agents = 2;
+inline int EnvironmentMembershipUpdate::_internal_removed_agents_size() const {
+  return _impl_.removed_agents_.size();
+}
+inline int EnvironmentMembershipUpdate::removed_agents_size() const {
+  return _internal_removed_agents_size();
+}
+inline void EnvironmentMembershipUpdate::clear_removed_agents() {
+  _impl_.removed_agents_.Clear();
+}
+inline int32_t EnvironmentMembershipUpdate::_internal_removed_agents(int index) const {
+  return _impl_.removed_agents_.Get(index);
+}
+inline int32_t EnvironmentMembershipUpdate::removed_agents(int index) const {
+  // @@protoc_insertion_point(field_get:Schola.EnvironmentMembershipUpdate.removed_agents)
+  return _internal_removed_agents(index);
+}
+inline void EnvironmentMembershipUpdate::set_removed_agents(int index, int32_t value) {
+  _impl_.removed_agents_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Schola.EnvironmentMembershipUpdate.removed_agents)
+}
+inline void EnvironmentMembershipUpdate::_internal_add_removed_agents(int32_t value) {
+  _impl_.removed_agents_.Add(value);
+}
+inline void EnvironmentMembershipUpdate::add_removed_agents(int32_t value) {
+  _internal_add_removed_agents(value);
+  // @@protoc_insertion_point(field_add:Schola.EnvironmentMembershipUpdate.removed_agents)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+EnvironmentMembershipUpdate::_internal_removed_agents() const {
+  return _impl_.removed_agents_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+EnvironmentMembershipUpdate::removed_agents() const {
+  // @@protoc_insertion_point(field_list:Schola.EnvironmentMembershipUpdate.removed_agents)
+  return _internal_removed_agents();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+EnvironmentMembershipUpdate::_internal_mutable_removed_agents() {
+  return &_impl_.removed_agents_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+EnvironmentMembershipUpdate::mutable_removed_agents() {
+  // @@protoc_insertion_point(field_mutable_list:Schola.EnvironmentMembershipUpdate.removed_agents)
+  return _internal_mutable_removed_agents();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// MembershipUpdate
+
+// map<int32, .Schola.EnvironmentMembershipUpdate> environments = 1;
+inline int MembershipUpdate::_internal_environments_size() const {
+  return _impl_.environments_.size();
+}
+inline int MembershipUpdate::environments_size() const {
+  return _internal_environments_size();
+}
+inline void MembershipUpdate::clear_environments() {
+  _impl_.environments_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::EnvironmentMembershipUpdate >&
+MembershipUpdate::_internal_environments() const {
+  return _impl_.environments_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::EnvironmentMembershipUpdate >&
+MembershipUpdate::environments() const {
+  // @@protoc_insertion_point(field_map:Schola.MembershipUpdate.environments)
+  return _internal_environments();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::EnvironmentMembershipUpdate >*
+MembershipUpdate::_internal_mutable_environments() {
+  return _impl_.environments_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::EnvironmentMembershipUpdate >*
+MembershipUpdate::mutable_environments() {
+  // @@protoc_insertion_point(field_mutable_map:Schola.MembershipUpdate.environments)
+  return _internal_mutable_environments();
+}
+
+// repeated .Schola.DenseGroupDefinition dense_groups = 2;
+inline int MembershipUpdate::_internal_dense_groups_size() const {
+  return _impl_.dense_groups_.size();
+}
+inline int MembershipUpdate::dense_groups_size() const {
+  return _internal_dense_groups_size();
+}
+inline void MembershipUpdate::clear_dense_groups() {
+  _impl_.dense_groups_.Clear();
+}
+inline ::Schola::DenseGroupDefinition* MembershipUpdate::mutable_dense_groups(int index) {
+  // @@protoc_insertion_point(field_mutable:Schola.MembershipUpdate.dense_groups)
+  return _impl_.dense_groups_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupDefinition >*
+MembershipUpdate::mutable_dense_groups() {
+  // @@protoc_insertion_point(field_mutable_list:Schola.MembershipUpdate.dense_groups)
+  return &_impl_.dense_groups_;
+}
+inline const ::Schola::DenseGroupDefinition& MembershipUpdate::_internal_dense_groups(int index) const {
+  return _impl_.dense_groups_.Get(index);
+}
+inline const ::Schola::DenseGroupDefinition& MembershipUpdate::dense_groups(int index) const {
+  // @@protoc_insertion_point(field_get:Schola.MembershipUpdate.dense_groups)
+  return _internal_dense_groups(index);
+}
+inline ::Schola::DenseGroupDefinition* MembershipUpdate::_internal_add_dense_groups() {
+  return _impl_.dense_groups_.Add();
+}
+inline ::Schola::DenseGroupDefinition* MembershipUpdate::add_dense_groups() {
+  ::Schola::DenseGroupDefinition* _add = _internal_add_dense_groups();
+  // @@protoc_insertion_point(field_add:Schola.MembershipUpdate.dense_groups)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupDefinition >&
+MembershipUpdate::dense_groups() const {
+  // @@protoc_insertion_point(field_list:Schola.MembershipUpdate.dense_groups)
+  return _impl_.dense_groups_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -988,6 +2115,16 @@ TrainingDefinition::environment_definitions() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -26,6 +26,7 @@ static const char* GymService_method_names[] = {
   "/Schola.GymService/RequestInitialTrainingState",
   "/Schola.GymService/RequestTrainingDefinition",
   "/Schola.GymService/StartGymConnector",
+  "/Schola.GymService/StepStream",
 };
 
 std::unique_ptr< GymService::Stub> GymService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -39,6 +40,7 @@ GymService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel
   , rpcmethod_RequestInitialTrainingState_(GymService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_RequestTrainingDefinition_(GymService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_StartGymConnector_(GymService_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_StepStream_(GymService_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
   {}
 
 ::grpc::Status GymService::Stub::UpdateState(::grpc::ClientContext* context, const ::Schola::TrainingStateUpdate& request, ::Schola::TrainingState* response) {
@@ -133,6 +135,22 @@ void GymService::Stub::async::StartGymConnector(::grpc::ClientContext* context,
   return result;
 }
 
+::grpc::ClientReaderWriter< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>* GymService::Stub::StepStreamRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>::Create(channel_.get(), rpcmethod_StepStream_, context);
+}
+
+void GymService::Stub::async::StepStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::Schola::TrainingStateUpdate,::Schola::StepStreamResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::Schola::TrainingStateUpdate,::Schola::StepStreamResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_StepStream_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>* GymService::Stub::AsyncStepStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>::Create(channel_.get(), cq, rpcmethod_StepStream_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>* GymService::Stub::PrepareAsyncStepStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>::Create(channel_.get(), cq, rpcmethod_StepStream_, context, false, nullptr);
+}
+
 GymService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       GymService_method_names[0],
@@ -174,6 +192,16 @@ GymService::Service::Service() {
              ::Schola::GymConnectorStartResponse* resp) {
                return service->StartGymConnector(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GymService_method_names[4],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< GymService::Service, ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>(
+          [](GymService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::Schola::StepStreamResponse,
+             ::Schola::TrainingStateUpdate>* stream) {
+               return service->StepStream(ctx, stream);
+             }, this)));
 }
 
 GymService::Service::~Service() {
@@ -207,6 +235,12 @@ GymService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status GymService::Service::StepStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::Schola::StepStreamResponse, ::Schola::TrainingStateUpdate>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace Schola
 
@@ -63,6 +63,15 @@ class GymService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::Schola::GymConnectorStartResponse>> PrepareAsyncStartGymConnector(::grpc::ClientContext* context, const ::Schola::GymConnectorStartRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::Schola::GymConnectorStartResponse>>(PrepareAsyncStartGymConnectorRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>> StepStream(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>>(StepStreamRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>> AsyncStepStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>>(AsyncStepStreamRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>> PrepareAsyncStepStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>>(PrepareAsyncStepStreamRaw(context, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -74,6 +83,7 @@ class GymService final {
       virtual void RequestTrainingDefinition(::grpc::ClientContext* context, const ::Schola::TrainingDefinitionRequest* request, ::Schola::TrainingDefinition* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void StartGymConnector(::grpc::ClientContext* context, const ::Schola::GymConnectorStartRequest* request, ::Schola::GymConnectorStartResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void StartGymConnector(::grpc::ClientContext* context, const ::Schola::GymConnectorStartRequest* request, ::Schola::GymConnectorStartResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void StepStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::Schola::TrainingStateUpdate,::Schola::StepStreamResponse>* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -87,6 +97,9 @@ class GymService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::Schola::TrainingDefinition>* PrepareAsyncRequestTrainingDefinitionRaw(::grpc::ClientContext* context, const ::Schola::TrainingDefinitionRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::Schola::GymConnectorStartResponse>* AsyncStartGymConnectorRaw(::grpc::ClientContext* context, const ::Schola::GymConnectorStartRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::Schola::GymConnectorStartResponse>* PrepareAsyncStartGymConnectorRaw(::grpc::ClientContext* context, const ::Schola::GymConnectorStartRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>* StepStreamRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>* AsyncStepStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>* PrepareAsyncStepStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -119,6 +132,15 @@ class GymService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::Schola::GymConnectorStartResponse>> PrepareAsyncStartGymConnector(::grpc::ClientContext* context, const ::Schola::GymConnectorStartRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::Schola::GymConnectorStartResponse>>(PrepareAsyncStartGymConnectorRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>> StepStream(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>>(StepStreamRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>> AsyncStepStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>>(AsyncStepStreamRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>> PrepareAsyncStepStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>>(PrepareAsyncStepStreamRaw(context, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -130,6 +152,7 @@ class GymService final {
       void RequestTrainingDefinition(::grpc::ClientContext* context, const ::Schola::TrainingDefinitionRequest* request, ::Schola::TrainingDefinition* response, ::grpc::ClientUnaryReactor* reactor) override;
       void StartGymConnector(::grpc::ClientContext* context, const ::Schola::GymConnectorStartRequest* request, ::Schola::GymConnectorStartResponse* response, std::function<void(::grpc::Status)>) override;
       void StartGymConnector(::grpc::ClientContext* context, const ::Schola::GymConnectorStartRequest* request, ::Schola::GymConnectorStartResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void StepStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::Schola::TrainingStateUpdate,::Schola::StepStreamResponse>* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -149,10 +172,14 @@ class GymService final {
     ::grpc::ClientAsyncResponseReader< ::Schola::TrainingDefinition>* PrepareAsyncRequestTrainingDefinitionRaw(::grpc::ClientContext* context, const ::Schola::TrainingDefinitionRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::Schola::GymConnectorStartResponse>* AsyncStartGymConnectorRaw(::grpc::ClientContext* context, const ::Schola::GymConnectorStartRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::Schola::GymConnectorStartResponse>* PrepareAsyncStartGymConnectorRaw(::grpc::ClientContext* context, const ::Schola::GymConnectorStartRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>* StepStreamRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>* AsyncStepStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>* PrepareAsyncStepStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_UpdateState_;
     const ::grpc::internal::RpcMethod rpcmethod_RequestInitialTrainingState_;
     const ::grpc::internal::RpcMethod rpcmethod_RequestTrainingDefinition_;
     const ::grpc::internal::RpcMethod rpcmethod_StartGymConnector_;
+    const ::grpc::internal::RpcMethod rpcmethod_StepStream_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -164,6 +191,7 @@ class GymService final {
     virtual ::grpc::Status RequestInitialTrainingState(::grpc::ServerContext* context, const ::Schola::InitialTrainingStateRequest* request, ::Schola::InitialTrainingState* response);
     virtual ::grpc::Status RequestTrainingDefinition(::grpc::ServerContext* context, const ::Schola::TrainingDefinitionRequest* request, ::Schola::TrainingDefinition* response);
     virtual ::grpc::Status StartGymConnector(::grpc::ServerContext* context, const ::Schola::GymConnectorStartRequest* request, ::Schola::GymConnectorStartResponse* response);
+    virtual ::grpc::Status StepStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::Schola::StepStreamResponse, ::Schola::TrainingStateUpdate>* stream);
   };
   template <class BaseClass>
   class WithAsyncMethod_UpdateState : public BaseClass {
@@ -245,7 +273,27 @@ class GymService final {
       ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_UpdateState<WithAsyncMethod_RequestInitialTrainingState<WithAsyncMethod_RequestTrainingDefinition<WithAsyncMethod_StartGymConnector<Service > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_StepStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_StepStream() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_StepStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StepStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::Schola::StepStreamResponse, ::Schola::TrainingStateUpdate>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStepStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::Schola::StepStreamResponse, ::Schola::TrainingStateUpdate>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(4, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_UpdateState<WithAsyncMethod_RequestInitialTrainingState<WithAsyncMethod_RequestTrainingDefinition<WithAsyncMethod_StartGymConnector<WithAsyncMethod_StepStream<Service > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_UpdateState : public BaseClass {
    private:
@@ -354,7 +402,30 @@ class GymService final {
     virtual ::grpc::ServerUnaryReactor* StartGymConnector(
       ::grpc::CallbackServerContext* /*context*/, const ::Schola::GymConnectorStartRequest* /*request*/, ::Schola::GymConnectorStartResponse* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_UpdateState<WithCallbackMethod_RequestInitialTrainingState<WithCallbackMethod_RequestTrainingDefinition<WithCallbackMethod_StartGymConnector<Service > > > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_StepStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_StepStream() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackBidiHandler< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->StepStream(context); }));
+    }
+    ~WithCallbackMethod_StepStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StepStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::Schola::StepStreamResponse, ::Schola::TrainingStateUpdate>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::Schola::TrainingStateUpdate, ::Schola::StepStreamResponse>* StepStream(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  typedef WithCallbackMethod_UpdateState<WithCallbackMethod_RequestInitialTrainingState<WithCallbackMethod_RequestTrainingDefinition<WithCallbackMethod_StartGymConnector<WithCallbackMethod_StepStream<Service > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_UpdateState : public BaseClass {
@@ -425,6 +496,23 @@ class GymService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_StepStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_StepStream() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_StepStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StepStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::Schola::StepStreamResponse, ::Schola::TrainingStateUpdate>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_UpdateState : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -505,6 +593,26 @@ class GymService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_StepStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_StepStream() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_StepStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StepStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::Schola::StepStreamResponse, ::Schola::TrainingStateUpdate>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStepStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(4, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_UpdateState : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -593,6 +701,29 @@ class GymService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_StepStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_StepStream() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->StepStream(context); }));
+    }
+    ~WithRawCallbackMethod_StepStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StepStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::Schola::StepStreamResponse, ::Schola::TrainingStateUpdate>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* StepStream(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_UpdateState : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
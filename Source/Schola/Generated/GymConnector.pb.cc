@@ -74,9 +74,22 @@ struct TrainingStateUpdate_UpdatesEntry_DoNotUseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TrainingStateUpdate_UpdatesEntry_DoNotUseDefaultTypeInternal _TrainingStateUpdate_UpdatesEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR TrainingStateUpdate_EnvStepsEntry_DoNotUse::TrainingStateUpdate_EnvStepsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct TrainingStateUpdate_EnvStepsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TrainingStateUpdate_EnvStepsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TrainingStateUpdate_EnvStepsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TrainingStateUpdate_EnvStepsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TrainingStateUpdate_EnvStepsEntry_DoNotUseDefaultTypeInternal _TrainingStateUpdate_EnvStepsEntry_DoNotUse_default_instance_;
 PROTOBUF_CONSTEXPR TrainingStateUpdate::TrainingStateUpdate(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.updates_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.dense_actions_)*/{}
+  , /*decltype(_impl_.env_steps_)*/{::_pbi::ConstantInitialized()}
   , /*decltype(_impl_.status_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct TrainingStateUpdateDefaultTypeInternal {
@@ -156,8 +169,22 @@ struct InitialTrainingStateRequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InitialTrainingStateRequestDefaultTypeInternal _InitialTrainingStateRequest_default_instance_;
+PROTOBUF_CONSTEXPR StepStreamResponse::StepStreamResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.msg_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct StepStreamResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StepStreamResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StepStreamResponseDefaultTypeInternal() {}
+  union {
+    StepStreamResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StepStreamResponseDefaultTypeInternal _StepStreamResponse_default_instance_;
 }  // namespace Schola
-static ::_pb::Metadata file_level_metadata_GymConnector_2eproto[11];
+static ::_pb::Metadata file_level_metadata_GymConnector_2eproto[13];
 static const ::_pb::EnumDescriptor* file_level_enum_descriptors_GymConnector_2eproto[1];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_GymConnector_2eproto = nullptr;
 
@@ -200,6 +227,16 @@ const uint32_t TableStruct_GymConnector_2eproto::offsets[] PROTOBUF_SECTION_VARI
   PROTOBUF_FIELD_OFFSET(::Schola::TrainingStateUpdate_UpdatesEntry_DoNotUse, value_),
   0,
   1,
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingStateUpdate_EnvStepsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingStateUpdate_EnvStepsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingStateUpdate_EnvStepsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingStateUpdate_EnvStepsEntry_DoNotUse, value_),
+  0,
+  1,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Schola::TrainingStateUpdate, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -208,6 +245,8 @@ const uint32_t TableStruct_GymConnector_2eproto::offsets[] PROTOBUF_SECTION_VARI
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::Schola::TrainingStateUpdate, _impl_.updates_),
   PROTOBUF_FIELD_OFFSET(::Schola::TrainingStateUpdate, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingStateUpdate, _impl_.dense_actions_),
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingStateUpdate, _impl_.env_steps_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Schola::TrainingDefinitionRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -249,19 +288,30 @@ const uint32_t TableStruct_GymConnector_2eproto::offsets[] PROTOBUF_SECTION_VARI
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::Schola::InitialTrainingStateRequest, _impl_.environment_state_requests_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Schola::StepStreamResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::Schola::StepStreamResponse, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::Schola::StepStreamResponse, _impl_.msg_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, 8, -1, sizeof(::Schola::EnvironmentReset_OptionsEntry_DoNotUse)},
   { 10, -1, -1, sizeof(::Schola::EnvironmentReset)},
   { 19, -1, -1, sizeof(::Schola::EnvironmentStateUpdate)},
   { 28, 36, -1, sizeof(::Schola::TrainingStateUpdate_UpdatesEntry_DoNotUse)},
-  { 38, -1, -1, sizeof(::Schola::TrainingStateUpdate)},
-  { 46, -1, -1, sizeof(::Schola::TrainingDefinitionRequest)},
-  { 52, -1, -1, sizeof(::Schola::GymConnectorStartRequest)},
-  { 58, -1, -1, sizeof(::Schola::GymConnectorStartResponse)},
-  { 64, -1, -1, sizeof(::Schola::InititalEnvironmentStateRequest)},
-  { 70, 78, -1, sizeof(::Schola::InitialTrainingStateRequest_EnvironmentStateRequestsEntry_DoNotUse)},
-  { 80, -1, -1, sizeof(::Schola::InitialTrainingStateRequest)},
+  { 38, 46, -1, sizeof(::Schola::TrainingStateUpdate_EnvStepsEntry_DoNotUse)},
+  { 48, -1, -1, sizeof(::Schola::TrainingStateUpdate)},
+  { 58, -1, -1, sizeof(::Schola::TrainingDefinitionRequest)},
+  { 64, -1, -1, sizeof(::Schola::GymConnectorStartRequest)},
+  { 70, -1, -1, sizeof(::Schola::GymConnectorStartResponse)},
+  { 76, -1, -1, sizeof(::Schola::InititalEnvironmentStateRequest)},
+  { 82, 90, -1, sizeof(::Schola::InitialTrainingStateRequest_EnvironmentStateRequestsEntry_DoNotUse)},
+  { 92, -1, -1, sizeof(::Schola::InitialTrainingStateRequest)},
+  { 99, -1, -1, sizeof(::Schola::StepStreamResponse)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -269,6 +319,7 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::Schola::_EnvironmentReset_default_instance_._instance,
   &::Schola::_EnvironmentStateUpdate_default_instance_._instance,
   &::Schola::_TrainingStateUpdate_UpdatesEntry_DoNotUse_default_instance_._instance,
+  &::Schola::_TrainingStateUpdate_EnvStepsEntry_DoNotUse_default_instance_._instance,
   &::Schola::_TrainingStateUpdate_default_instance_._instance,
   &::Schola::_TrainingDefinitionRequest_default_instance_._instance,
   &::Schola::_GymConnectorStartRequest_default_instance_._instance,
@@ -276,6 +327,7 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::Schola::_InititalEnvironmentStateRequest_default_instance_._instance,
   &::Schola::_InitialTrainingStateRequest_EnvironmentStateRequestsEntry_DoNotUse_default_instance_._instance,
   &::Schola::_InitialTrainingStateRequest_default_instance_._instance,
+  &::Schola::_StepStreamResponse_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_GymConnector_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -288,31 +340,40 @@ const char descriptor_table_protodef_GymConnector_2eproto[] PROTOBUF_SECTION_VAR
   "\n\026EnvironmentStateUpdate\022)\n\005reset\030\001 \001(\0132"
   "\030.Schola.EnvironmentResetH\000\022\'\n\004step\030\002 \001("
   "\0132\027.Schola.EnvironmentStepH\000B\014\n\nupdate_m"
-  "sg\"\314\001\n\023TrainingStateUpdate\0229\n\007updates\030\001 "
+  "sg\"\355\002\n\023TrainingStateUpdate\0229\n\007updates\030\001 "
   "\003(\0132(.Schola.TrainingStateUpdate.Updates"
   "Entry\022*\n\006status\030\002 \001(\0162\032.Schola.Communica"
-  "torStatus\032N\n\014UpdatesEntry\022\013\n\003key\030\001 \001(\005\022-"
-  "\n\005value\030\002 \001(\0132\036.Schola.EnvironmentStateU"
-  "pdate:\0028\001\"\033\n\031TrainingDefinitionRequest\"\032"
-  "\n\030GymConnectorStartRequest\"\033\n\031GymConnect"
-  "orStartResponse\"!\n\037InititalEnvironmentSt"
-  "ateRequest\"\356\001\n\033InitialTrainingStateReque"
-  "st\022e\n\032environment_state_requests\030\001 \003(\0132A"
-  ".Schola.InitialTrainingStateRequest.Envi"
-  "ronmentStateRequestsEntry\032h\n\035Environment"
-  "StateRequestsEntry\022\013\n\003key\030\001 \001(\005\0226\n\005value"
-  "\030\002 \001(\0132\'.Schola.InititalEnvironmentState"
-  "Request:\0028\001*5\n\022CommunicatorStatus\022\010\n\004GOO"
-  "D\020\000\022\t\n\005ERROR\020\001\022\n\n\006CLOSED\020\0022\347\002\n\nGymServic"
-  "e\022A\n\013UpdateState\022\033.Schola.TrainingStateU"
-  "pdate\032\025.Schola.TrainingState\022`\n\033RequestI"
-  "nitialTrainingState\022#.Schola.InitialTrai"
-  "ningStateRequest\032\034.Schola.InitialTrainin"
-  "gState\022Z\n\031RequestTrainingDefinition\022!.Sc"
-  "hola.TrainingDefinitionRequest\032\032.Schola."
-  "TrainingDefinition\022X\n\021StartGymConnector\022"
-  " .Schola.GymConnectorStartRequest\032!.Scho"
-  "la.GymConnectorStartResponseb\006proto3"
+  "torStatus\0220\n\rdense_actions\030\003 \003(\0132\031.Schol"
+  "a.DenseGroupActions\022<\n\tenv_steps\030\004 \003(\0132)"
+  ".Schola.TrainingStateUpdate.EnvStepsEntr"
+  "y\032N\n\014UpdatesEntry\022\013\n\003key\030\001 \001(\005\022-\n\005value\030"
+  "\002 \001(\0132\036.Schola.EnvironmentStateUpdate:\0028"
+  "\001\032/\n\rEnvStepsEntry\022\013\n\003key\030\001 \001(\005\022\r\n\005value"
+  "\030\002 \001(\005:\0028\001\"\033\n\031TrainingDefinitionRequest\""
+  "\032\n\030GymConnectorStartRequest\"\033\n\031GymConnec"
+  "torStartResponse\"!\n\037InititalEnvironmentS"
+  "tateRequest\"\356\001\n\033InitialTrainingStateRequ"
+  "est\022e\n\032environment_state_requests\030\001 \003(\0132"
+  "A.Schola.InitialTrainingStateRequest.Env"
+  "ironmentStateRequestsEntry\032h\n\035Environmen"
+  "tStateRequestsEntry\022\013\n\003key\030\001 \001(\005\0226\n\005valu"
+  "e\030\002 \001(\0132\'.Schola.InititalEnvironmentStat"
+  "eRequest:\0028\001\"z\n\022StepStreamResponse\022&\n\005st"
+  "ate\030\001 \001(\0132\025.Schola.TrainingStateH\000\0225\n\rin"
+  "itial_state\030\002 \001(\0132\034.Schola.InitialTraini"
+  "ngStateH\000B\005\n\003msg*5\n\022CommunicatorStatus\022\010"
+  "\n\004GOOD\020\000\022\t\n\005ERROR\020\001\022\n\n\006CLOSED\020\0022\262\003\n\nGymS"
+  "ervice\022A\n\013UpdateState\022\033.Schola.TrainingS"
+  "tateUpdate\032\025.Schola.TrainingState\022`\n\033Req"
+  "uestInitialTrainingState\022#.Schola.Initia"
+  "lTrainingStateRequest\032\034.Schola.InitialTr"
+  "ainingState\022Z\n\031RequestTrainingDefinition"
+  "\022!.Schola.TrainingDefinitionRequest\032\032.Sc"
+  "hola.TrainingDefinition\022X\n\021StartGymConne"
+  "ctor\022 .Schola.GymConnectorStartRequest\032!"
+  ".Schola.GymConnectorStartResponse\022I\n\nSte"
+  "pStream\022\033.Schola.TrainingStateUpdate\032\032.S"
+  "chola.StepStreamResponse(\0010\001b\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_GymConnector_2eproto_deps[3] = {
   &::descriptor_table_Definitions_2eproto,
@@ -321,9 +382,9 @@ static const ::_pbi::DescriptorTable* const descriptor_table_GymConnector_2eprot
 };
 static ::_pbi::once_flag descriptor_table_GymConnector_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_GymConnector_2eproto = {
-    false, false, 1356, descriptor_table_protodef_GymConnector_2eproto,
+    false, false, 1716, descriptor_table_protodef_GymConnector_2eproto,
     "GymConnector.proto",
-    &descriptor_table_GymConnector_2eproto_once, descriptor_table_GymConnector_2eproto_deps, 3, 11,
+    &descriptor_table_GymConnector_2eproto_once, descriptor_table_GymConnector_2eproto_deps, 3, 13,
     schemas, file_default_instances, TableStruct_GymConnector_2eproto::offsets,
     file_level_metadata_GymConnector_2eproto, file_level_enum_descriptors_GymConnector_2eproto,
     file_level_service_descriptors_GymConnector_2eproto,
@@ -983,10 +1044,27 @@ void TrainingStateUpdate_UpdatesEntry_DoNotUse::MergeFrom(const TrainingStateUpd
 
 // ===================================================================
 
+TrainingStateUpdate_EnvStepsEntry_DoNotUse::TrainingStateUpdate_EnvStepsEntry_DoNotUse() {}
+TrainingStateUpdate_EnvStepsEntry_DoNotUse::TrainingStateUpdate_EnvStepsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TrainingStateUpdate_EnvStepsEntry_DoNotUse::MergeFrom(const TrainingStateUpdate_EnvStepsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TrainingStateUpdate_EnvStepsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_GymConnector_2eproto_getter, &descriptor_table_GymConnector_2eproto_once,
+      file_level_metadata_GymConnector_2eproto[4]);
+}
+
+// ===================================================================
+
 class TrainingStateUpdate::_Internal {
  public:
 };
 
+void TrainingStateUpdate::clear_dense_actions() {
+  _impl_.dense_actions_.Clear();
+}
 TrainingStateUpdate::TrainingStateUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -1001,11 +1079,14 @@ TrainingStateUpdate::TrainingStateUpdate(const TrainingStateUpdate& from)
   TrainingStateUpdate* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       /*decltype(_impl_.updates_)*/{}
+    , decltype(_impl_.dense_actions_){from._impl_.dense_actions_}
+    , /*decltype(_impl_.env_steps_)*/{}
     , decltype(_impl_.status_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _this->_impl_.updates_.MergeFrom(from._impl_.updates_);
+  _this->_impl_.env_steps_.MergeFrom(from._impl_.env_steps_);
   _this->_impl_.status_ = from._impl_.status_;
   // @@protoc_insertion_point(copy_constructor:Schola.TrainingStateUpdate)
 }
@@ -1016,6 +1097,8 @@ inline void TrainingStateUpdate::SharedCtor(
   (void)is_message_owned;
   new (&_impl_) Impl_{
       /*decltype(_impl_.updates_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.dense_actions_){arena}
+    , /*decltype(_impl_.env_steps_)*/{::_pbi::ArenaInitialized(), arena}
     , decltype(_impl_.status_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
@@ -1035,11 +1118,15 @@ inline void TrainingStateUpdate::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.updates_.Destruct();
   _impl_.updates_.~MapField();
+  _impl_.dense_actions_.~RepeatedPtrField();
+  _impl_.env_steps_.Destruct();
+  _impl_.env_steps_.~MapField();
 }
 
 void TrainingStateUpdate::ArenaDtor(void* object) {
   TrainingStateUpdate* _this = reinterpret_cast< TrainingStateUpdate* >(object);
   _this->_impl_.updates_.Destruct();
+  _this->_impl_.env_steps_.Destruct();
 }
 void TrainingStateUpdate::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
@@ -1052,6 +1139,8 @@ void TrainingStateUpdate::Clear() {
   (void) cached_has_bits;
 
   _impl_.updates_.Clear();
+  _impl_.dense_actions_.Clear();
+  _impl_.env_steps_.Clear();
   _impl_.status_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -1084,6 +1173,32 @@ const char* TrainingStateUpdate::_InternalParse(const char* ptr, ::_pbi::ParseCo
         } else
           goto handle_unusual;
         continue;
+      // repeated .Schola.DenseGroupActions dense_actions = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_dense_actions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<int32, int32> env_steps = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.env_steps_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1137,6 +1252,31 @@ uint8_t* TrainingStateUpdate::_InternalSerialize(
       2, this->_internal_status(), target);
   }
 
+  // repeated .Schola.DenseGroupActions dense_actions = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_dense_actions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_dense_actions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // map<int32, int32> env_steps = 4;
+  if (!this->_internal_env_steps().empty()) {
+    using MapType = ::_pb::Map<int32_t, int32_t>;
+    using WireHelper = TrainingStateUpdate_EnvStepsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_env_steps();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(4, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(4, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1162,6 +1302,22 @@ size_t TrainingStateUpdate::ByteSizeLong() const {
     total_size += TrainingStateUpdate_UpdatesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
   }
 
+  // repeated .Schola.DenseGroupActions dense_actions = 3;
+  total_size += 1UL * this->_internal_dense_actions_size();
+  for (const auto& msg : this->_impl_.dense_actions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // map<int32, int32> env_steps = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_env_steps_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >::const_iterator
+      it = this->_internal_env_steps().begin();
+      it != this->_internal_env_steps().end(); ++it) {
+    total_size += TrainingStateUpdate_EnvStepsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
   // .Schola.CommunicatorStatus status = 2;
   if (this->_internal_status() != 0) {
     total_size += 1 +
@@ -1187,6 +1343,8 @@ void TrainingStateUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, co
   (void) cached_has_bits;
 
   _this->_impl_.updates_.MergeFrom(from._impl_.updates_);
+  _this->_impl_.dense_actions_.MergeFrom(from._impl_.dense_actions_);
+  _this->_impl_.env_steps_.MergeFrom(from._impl_.env_steps_);
   if (from._internal_status() != 0) {
     _this->_internal_set_status(from._internal_status());
   }
@@ -1208,13 +1366,15 @@ void TrainingStateUpdate::InternalSwap(TrainingStateUpdate* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.updates_.InternalSwap(&other->_impl_.updates_);
+  _impl_.dense_actions_.InternalSwap(&other->_impl_.dense_actions_);
+  _impl_.env_steps_.InternalSwap(&other->_impl_.env_steps_);
   swap(_impl_.status_, other->_impl_.status_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata TrainingStateUpdate::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_GymConnector_2eproto_getter, &descriptor_table_GymConnector_2eproto_once,
-      file_level_metadata_GymConnector_2eproto[4]);
+      file_level_metadata_GymConnector_2eproto[5]);
 }
 
 // ===================================================================
@@ -1254,7 +1414,7 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TrainingDefinitionRequest::Get
 ::PROTOBUF_NAMESPACE_ID::Metadata TrainingDefinitionRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_GymConnector_2eproto_getter, &descriptor_table_GymConnector_2eproto_once,
-      file_level_metadata_GymConnector_2eproto[5]);
+      file_level_metadata_GymConnector_2eproto[6]);
 }
 
 // ===================================================================
@@ -1294,7 +1454,7 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GymConnectorStartRequest::GetC
 ::PROTOBUF_NAMESPACE_ID::Metadata GymConnectorStartRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_GymConnector_2eproto_getter, &descriptor_table_GymConnector_2eproto_once,
-      file_level_metadata_GymConnector_2eproto[6]);
+      file_level_metadata_GymConnector_2eproto[7]);
 }
 
 // ===================================================================
@@ -1334,7 +1494,7 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GymConnectorStartResponse::Get
 ::PROTOBUF_NAMESPACE_ID::Metadata GymConnectorStartResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_GymConnector_2eproto_getter, &descriptor_table_GymConnector_2eproto_once,
-      file_level_metadata_GymConnector_2eproto[7]);
+      file_level_metadata_GymConnector_2eproto[8]);
 }
 
 // ===================================================================
@@ -1374,7 +1534,7 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InititalEnvironmentStateReques
 ::PROTOBUF_NAMESPACE_ID::Metadata InititalEnvironmentStateRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_GymConnector_2eproto_getter, &descriptor_table_GymConnector_2eproto_once,
-      file_level_metadata_GymConnector_2eproto[8]);
+      file_level_metadata_GymConnector_2eproto[9]);
 }
 
 // ===================================================================
@@ -1388,7 +1548,7 @@ void InitialTrainingStateRequest_EnvironmentStateRequestsEntry_DoNotUse::MergeFr
 ::PROTOBUF_NAMESPACE_ID::Metadata InitialTrainingStateRequest_EnvironmentStateRequestsEntry_DoNotUse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_GymConnector_2eproto_getter, &descriptor_table_GymConnector_2eproto_once,
-      file_level_metadata_GymConnector_2eproto[9]);
+      file_level_metadata_GymConnector_2eproto[10]);
 }
 
 // ===================================================================
@@ -1594,7 +1754,330 @@ void InitialTrainingStateRequest::InternalSwap(InitialTrainingStateRequest* othe
 ::PROTOBUF_NAMESPACE_ID::Metadata InitialTrainingStateRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_GymConnector_2eproto_getter, &descriptor_table_GymConnector_2eproto_once,
-      file_level_metadata_GymConnector_2eproto[10]);
+      file_level_metadata_GymConnector_2eproto[11]);
+}
+
+// ===================================================================
+
+class StepStreamResponse::_Internal {
+ public:
+  static const ::Schola::TrainingState& state(const StepStreamResponse* msg);
+  static const ::Schola::InitialTrainingState& initial_state(const StepStreamResponse* msg);
+};
+
+const ::Schola::TrainingState&
+StepStreamResponse::_Internal::state(const StepStreamResponse* msg) {
+  return *msg->_impl_.msg_.state_;
+}
+const ::Schola::InitialTrainingState&
+StepStreamResponse::_Internal::initial_state(const StepStreamResponse* msg) {
+  return *msg->_impl_.msg_.initial_state_;
+}
+void StepStreamResponse::set_allocated_state(::Schola::TrainingState* state) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (state) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(state));
+    if (message_arena != submessage_arena) {
+      state = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state, submessage_arena);
+    }
+    set_has_state();
+    _impl_.msg_.state_ = state;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Schola.StepStreamResponse.state)
+}
+void StepStreamResponse::clear_state() {
+  if (_internal_has_state()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.state_;
+    }
+    clear_has_msg();
+  }
+}
+void StepStreamResponse::set_allocated_initial_state(::Schola::InitialTrainingState* initial_state) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_msg();
+  if (initial_state) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(initial_state));
+    if (message_arena != submessage_arena) {
+      initial_state = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, initial_state, submessage_arena);
+    }
+    set_has_initial_state();
+    _impl_.msg_.initial_state_ = initial_state;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Schola.StepStreamResponse.initial_state)
+}
+void StepStreamResponse::clear_initial_state() {
+  if (_internal_has_initial_state()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.msg_.initial_state_;
+    }
+    clear_has_msg();
+  }
+}
+StepStreamResponse::StepStreamResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Schola.StepStreamResponse)
+}
+StepStreamResponse::StepStreamResponse(const StepStreamResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StepStreamResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_msg();
+  switch (from.msg_case()) {
+    case kState: {
+      _this->_internal_mutable_state()->::Schola::TrainingState::MergeFrom(
+          from._internal_state());
+      break;
+    }
+    case kInitialState: {
+      _this->_internal_mutable_initial_state()->::Schola::InitialTrainingState::MergeFrom(
+          from._internal_initial_state());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:Schola.StepStreamResponse)
+}
+
+inline void StepStreamResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.msg_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_msg();
+}
+
+StepStreamResponse::~StepStreamResponse() {
+  // @@protoc_insertion_point(destructor:Schola.StepStreamResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StepStreamResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_msg()) {
+    clear_msg();
+  }
+}
+
+void StepStreamResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StepStreamResponse::clear_msg() {
+// @@protoc_insertion_point(one_of_clear_start:Schola.StepStreamResponse)
+  switch (msg_case()) {
+    case kState: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.state_;
+      }
+      break;
+    }
+    case kInitialState: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.msg_.initial_state_;
+      }
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+
+
+void StepStreamResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:Schola.StepStreamResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_msg();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StepStreamResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .Schola.TrainingState state = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .Schola.InitialTrainingState initial_state = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_initial_state(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StepStreamResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Schola.StepStreamResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .Schola.TrainingState state = 1;
+  if (_internal_has_state()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::state(this),
+        _Internal::state(this).GetCachedSize(), target, stream);
+  }
+
+  // .Schola.InitialTrainingState initial_state = 2;
+  if (_internal_has_initial_state()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::initial_state(this),
+        _Internal::initial_state(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Schola.StepStreamResponse)
+  return target;
+}
+
+size_t StepStreamResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Schola.StepStreamResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (msg_case()) {
+    // .Schola.TrainingState state = 1;
+    case kState: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.state_);
+      break;
+    }
+    // .Schola.InitialTrainingState initial_state = 2;
+    case kInitialState: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.msg_.initial_state_);
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StepStreamResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StepStreamResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StepStreamResponse::GetClassData() const { return &_class_data_; }
+
+
+void StepStreamResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StepStreamResponse*>(&to_msg);
+  auto& from = static_cast<const StepStreamResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Schola.StepStreamResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.msg_case()) {
+    case kState: {
+      _this->_internal_mutable_state()->::Schola::TrainingState::MergeFrom(
+          from._internal_state());
+      break;
+    }
+    case kInitialState: {
+      _this->_internal_mutable_initial_state()->::Schola::InitialTrainingState::MergeFrom(
+          from._internal_initial_state());
+      break;
+    }
+    case MSG_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StepStreamResponse::CopyFrom(const StepStreamResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Schola.StepStreamResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StepStreamResponse::IsInitialized() const {
+  return true;
+}
+
+void StepStreamResponse::InternalSwap(StepStreamResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.msg_, other->_impl_.msg_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StepStreamResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_GymConnector_2eproto_getter, &descriptor_table_GymConnector_2eproto_once,
+      file_level_metadata_GymConnector_2eproto[12]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -1616,6 +2099,10 @@ template<> PROTOBUF_NOINLINE ::Schola::TrainingStateUpdate_UpdatesEntry_DoNotUse
 Arena::CreateMaybeMessage< ::Schola::TrainingStateUpdate_UpdatesEntry_DoNotUse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::Schola::TrainingStateUpdate_UpdatesEntry_DoNotUse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::Schola::TrainingStateUpdate_EnvStepsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Schola::TrainingStateUpdate_EnvStepsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Schola::TrainingStateUpdate_EnvStepsEntry_DoNotUse >(arena);
+}
 template<> PROTOBUF_NOINLINE ::Schola::TrainingStateUpdate*
 Arena::CreateMaybeMessage< ::Schola::TrainingStateUpdate >(Arena* arena) {
   return Arena::CreateMessageInternal< ::Schola::TrainingStateUpdate >(arena);
@@ -1644,6 +2131,10 @@ template<> PROTOBUF_NOINLINE ::Schola::InitialTrainingStateRequest*
 Arena::CreateMaybeMessage< ::Schola::InitialTrainingStateRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::Schola::InitialTrainingStateRequest >(arena);
 }
+template<> PROTOBUF_NOINLINE ::Schola::StepStreamResponse*
+Arena::CreateMaybeMessage< ::Schola::StepStreamResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Schola::StepStreamResponse >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
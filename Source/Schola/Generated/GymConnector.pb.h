@@ -77,12 +77,18 @@ extern InitialTrainingStateRequest_EnvironmentStateRequestsEntry_DoNotUseDefault
 class InititalEnvironmentStateRequest;
 struct InititalEnvironmentStateRequestDefaultTypeInternal;
 extern InititalEnvironmentStateRequestDefaultTypeInternal _InititalEnvironmentStateRequest_default_instance_;
+class StepStreamResponse;
+struct StepStreamResponseDefaultTypeInternal;
+extern StepStreamResponseDefaultTypeInternal _StepStreamResponse_default_instance_;
 class TrainingDefinitionRequest;
 struct TrainingDefinitionRequestDefaultTypeInternal;
 extern TrainingDefinitionRequestDefaultTypeInternal _TrainingDefinitionRequest_default_instance_;
 class TrainingStateUpdate;
 struct TrainingStateUpdateDefaultTypeInternal;
 extern TrainingStateUpdateDefaultTypeInternal _TrainingStateUpdate_default_instance_;
+class TrainingStateUpdate_EnvStepsEntry_DoNotUse;
+struct TrainingStateUpdate_EnvStepsEntry_DoNotUseDefaultTypeInternal;
+extern TrainingStateUpdate_EnvStepsEntry_DoNotUseDefaultTypeInternal _TrainingStateUpdate_EnvStepsEntry_DoNotUse_default_instance_;
 class TrainingStateUpdate_UpdatesEntry_DoNotUse;
 struct TrainingStateUpdate_UpdatesEntry_DoNotUseDefaultTypeInternal;
 extern TrainingStateUpdate_UpdatesEntry_DoNotUseDefaultTypeInternal _TrainingStateUpdate_UpdatesEntry_DoNotUse_default_instance_;
@@ -96,8 +102,10 @@ template<> ::Schola::GymConnectorStartResponse* Arena::CreateMaybeMessage<::Scho
 template<> ::Schola::InitialTrainingStateRequest* Arena::CreateMaybeMessage<::Schola::InitialTrainingStateRequest>(Arena*);
 template<> ::Schola::InitialTrainingStateRequest_EnvironmentStateRequestsEntry_DoNotUse* Arena::CreateMaybeMessage<::Schola::InitialTrainingStateRequest_EnvironmentStateRequestsEntry_DoNotUse>(Arena*);
 template<> ::Schola::InititalEnvironmentStateRequest* Arena::CreateMaybeMessage<::Schola::InititalEnvironmentStateRequest>(Arena*);
+template<> ::Schola::StepStreamResponse* Arena::CreateMaybeMessage<::Schola::StepStreamResponse>(Arena*);
 template<> ::Schola::TrainingDefinitionRequest* Arena::CreateMaybeMessage<::Schola::TrainingDefinitionRequest>(Arena*);
 template<> ::Schola::TrainingStateUpdate* Arena::CreateMaybeMessage<::Schola::TrainingStateUpdate>(Arena*);
+template<> ::Schola::TrainingStateUpdate_EnvStepsEntry_DoNotUse* Arena::CreateMaybeMessage<::Schola::TrainingStateUpdate_EnvStepsEntry_DoNotUse>(Arena*);
 template<> ::Schola::TrainingStateUpdate_UpdatesEntry_DoNotUse* Arena::CreateMaybeMessage<::Schola::TrainingStateUpdate_UpdatesEntry_DoNotUse>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace Schola {
@@ -573,6 +581,30 @@ public:
 
 // -------------------------------------------------------------------
 
+class TrainingStateUpdate_EnvStepsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TrainingStateUpdate_EnvStepsEntry_DoNotUse, 
+    int32_t, int32_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TrainingStateUpdate_EnvStepsEntry_DoNotUse, 
+    int32_t, int32_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> SuperType;
+  TrainingStateUpdate_EnvStepsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR TrainingStateUpdate_EnvStepsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit TrainingStateUpdate_EnvStepsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TrainingStateUpdate_EnvStepsEntry_DoNotUse& other);
+  static const TrainingStateUpdate_EnvStepsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TrainingStateUpdate_EnvStepsEntry_DoNotUse*>(&_TrainingStateUpdate_EnvStepsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_GymConnector_2eproto;
+};
+
+// -------------------------------------------------------------------
+
 class TrainingStateUpdate final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Schola.TrainingStateUpdate) */ {
  public:
@@ -621,7 +653,7 @@ class TrainingStateUpdate final :
                &_TrainingStateUpdate_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
   friend void swap(TrainingStateUpdate& a, TrainingStateUpdate& b) {
     a.Swap(&b);
@@ -698,6 +730,8 @@ class TrainingStateUpdate final :
 
   enum : int {
     kUpdatesFieldNumber = 1,
+    kDenseActionsFieldNumber = 3,
+    kEnvStepsFieldNumber = 4,
     kStatusFieldNumber = 2,
   };
   // map<int32, .Schola.EnvironmentStateUpdate> updates = 1;
@@ -717,6 +751,41 @@ class TrainingStateUpdate final :
   ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::EnvironmentStateUpdate >*
       mutable_updates();
 
+  // repeated .Schola.DenseGroupActions dense_actions = 3;
+  int dense_actions_size() const;
+  private:
+  int _internal_dense_actions_size() const;
+  public:
+  void clear_dense_actions();
+  ::Schola::DenseGroupActions* mutable_dense_actions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupActions >*
+      mutable_dense_actions();
+  private:
+  const ::Schola::DenseGroupActions& _internal_dense_actions(int index) const;
+  ::Schola::DenseGroupActions* _internal_add_dense_actions();
+  public:
+  const ::Schola::DenseGroupActions& dense_actions(int index) const;
+  ::Schola::DenseGroupActions* add_dense_actions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupActions >&
+      dense_actions() const;
+
+  // map<int32, int32> env_steps = 4;
+  int env_steps_size() const;
+  private:
+  int _internal_env_steps_size() const;
+  public:
+  void clear_env_steps();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >&
+      _internal_env_steps() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >*
+      _internal_mutable_env_steps();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >&
+      env_steps() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >*
+      mutable_env_steps();
+
   // .Schola.CommunicatorStatus status = 2;
   void clear_status();
   ::Schola::CommunicatorStatus status() const;
@@ -739,6 +808,12 @@ class TrainingStateUpdate final :
         int32_t, ::Schola::EnvironmentStateUpdate,
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> updates_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupActions > dense_actions_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        TrainingStateUpdate_EnvStepsEntry_DoNotUse,
+        int32_t, int32_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> env_steps_;
     int status_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
@@ -794,7 +869,7 @@ class TrainingDefinitionRequest final :
                &_TrainingDefinitionRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    6;
 
   friend void swap(TrainingDefinitionRequest& a, TrainingDefinitionRequest& b) {
     a.Swap(&b);
@@ -912,7 +987,7 @@ class GymConnectorStartRequest final :
                &_GymConnectorStartRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    7;
 
   friend void swap(GymConnectorStartRequest& a, GymConnectorStartRequest& b) {
     a.Swap(&b);
@@ -1030,7 +1105,7 @@ class GymConnectorStartResponse final :
                &_GymConnectorStartResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    8;
 
   friend void swap(GymConnectorStartResponse& a, GymConnectorStartResponse& b) {
     a.Swap(&b);
@@ -1148,7 +1223,7 @@ class InititalEnvironmentStateRequest final :
                &_InititalEnvironmentStateRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    9;
 
   friend void swap(InititalEnvironmentStateRequest& a, InititalEnvironmentStateRequest& b) {
     a.Swap(&b);
@@ -1291,7 +1366,7 @@ class InitialTrainingStateRequest final :
                &_InitialTrainingStateRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    11;
 
   friend void swap(InitialTrainingStateRequest& a, InitialTrainingStateRequest& b) {
     a.Swap(&b);
@@ -1404,6 +1479,202 @@ class InitialTrainingStateRequest final :
   union { Impl_ _impl_; };
   friend struct ::TableStruct_GymConnector_2eproto;
 };
+// -------------------------------------------------------------------
+
+class StepStreamResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Schola.StepStreamResponse) */ {
+ public:
+  inline StepStreamResponse() : StepStreamResponse(nullptr) {}
+  ~StepStreamResponse() override;
+  explicit PROTOBUF_CONSTEXPR StepStreamResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StepStreamResponse(const StepStreamResponse& from);
+  StepStreamResponse(StepStreamResponse&& from) noexcept
+    : StepStreamResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline StepStreamResponse& operator=(const StepStreamResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StepStreamResponse& operator=(StepStreamResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StepStreamResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  enum MsgCase {
+    kState = 1,
+    kInitialState = 2,
+    MSG_NOT_SET = 0,
+  };
+
+  static inline const StepStreamResponse* internal_default_instance() {
+    return reinterpret_cast<const StepStreamResponse*>(
+               &_StepStreamResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(StepStreamResponse& a, StepStreamResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StepStreamResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StepStreamResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StepStreamResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StepStreamResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StepStreamResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StepStreamResponse& from) {
+    StepStreamResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StepStreamResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Schola.StepStreamResponse";
+  }
+  protected:
+  explicit StepStreamResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStateFieldNumber = 1,
+    kInitialStateFieldNumber = 2,
+  };
+  // .Schola.TrainingState state = 1;
+  bool has_state() const;
+  private:
+  bool _internal_has_state() const;
+  public:
+  void clear_state();
+  const ::Schola::TrainingState& state() const;
+  PROTOBUF_NODISCARD ::Schola::TrainingState* release_state();
+  ::Schola::TrainingState* mutable_state();
+  void set_allocated_state(::Schola::TrainingState* state);
+  private:
+  const ::Schola::TrainingState& _internal_state() const;
+  ::Schola::TrainingState* _internal_mutable_state();
+  public:
+  void unsafe_arena_set_allocated_state(
+      ::Schola::TrainingState* state);
+  ::Schola::TrainingState* unsafe_arena_release_state();
+
+  // .Schola.InitialTrainingState initial_state = 2;
+  bool has_initial_state() const;
+  private:
+  bool _internal_has_initial_state() const;
+  public:
+  void clear_initial_state();
+  const ::Schola::InitialTrainingState& initial_state() const;
+  PROTOBUF_NODISCARD ::Schola::InitialTrainingState* release_initial_state();
+  ::Schola::InitialTrainingState* mutable_initial_state();
+  void set_allocated_initial_state(::Schola::InitialTrainingState* initial_state);
+  private:
+  const ::Schola::InitialTrainingState& _internal_initial_state() const;
+  ::Schola::InitialTrainingState* _internal_mutable_initial_state();
+  public:
+  void unsafe_arena_set_allocated_initial_state(
+      ::Schola::InitialTrainingState* initial_state);
+  ::Schola::InitialTrainingState* unsafe_arena_release_initial_state();
+
+  void clear_msg();
+  MsgCase msg_case() const;
+  // @@protoc_insertion_point(class_scope:Schola.StepStreamResponse)
+ private:
+  class _Internal;
+  void set_has_state();
+  void set_has_initial_state();
+
+  inline bool has_msg() const;
+  inline void clear_has_msg();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union MsgUnion {
+      constexpr MsgUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::Schola::TrainingState* state_;
+      ::Schola::InitialTrainingState* initial_state_;
+    } msg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_GymConnector_2eproto;
+};
 // ===================================================================
 
 
@@ -1650,6 +1921,8 @@ inline EnvironmentStateUpdate::UpdateMsgCase EnvironmentStateUpdate::update_msg_
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 // TrainingStateUpdate
 
 // map<int32, .Schola.EnvironmentStateUpdate> updates = 1;
@@ -1701,6 +1974,72 @@ inline void TrainingStateUpdate::set_status(::Schola::CommunicatorStatus value)
   // @@protoc_insertion_point(field_set:Schola.TrainingStateUpdate.status)
 }
 
+// repeated .Schola.DenseGroupActions dense_actions = 3;
+inline int TrainingStateUpdate::_internal_dense_actions_size() const {
+  return _impl_.dense_actions_.size();
+}
+inline int TrainingStateUpdate::dense_actions_size() const {
+  return _internal_dense_actions_size();
+}
+inline ::Schola::DenseGroupActions* TrainingStateUpdate::mutable_dense_actions(int index) {
+  // @@protoc_insertion_point(field_mutable:Schola.TrainingStateUpdate.dense_actions)
+  return _impl_.dense_actions_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupActions >*
+TrainingStateUpdate::mutable_dense_actions() {
+  // @@protoc_insertion_point(field_mutable_list:Schola.TrainingStateUpdate.dense_actions)
+  return &_impl_.dense_actions_;
+}
+inline const ::Schola::DenseGroupActions& TrainingStateUpdate::_internal_dense_actions(int index) const {
+  return _impl_.dense_actions_.Get(index);
+}
+inline const ::Schola::DenseGroupActions& TrainingStateUpdate::dense_actions(int index) const {
+  // @@protoc_insertion_point(field_get:Schola.TrainingStateUpdate.dense_actions)
+  return _internal_dense_actions(index);
+}
+inline ::Schola::DenseGroupActions* TrainingStateUpdate::_internal_add_dense_actions() {
+  return _impl_.dense_actions_.Add();
+}
+inline ::Schola::DenseGroupActions* TrainingStateUpdate::add_dense_actions() {
+  ::Schola::DenseGroupActions* _add = _internal_add_dense_actions();
+  // @@protoc_insertion_point(field_add:Schola.TrainingStateUpdate.dense_actions)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupActions >&
+TrainingStateUpdate::dense_actions() const {
+  // @@protoc_insertion_point(field_list:Schola.TrainingStateUpdate.dense_actions)
+  return _impl_.dense_actions_;
+}
+
+// map<int32, int32> env_steps = 4;
+inline int TrainingStateUpdate::_internal_env_steps_size() const {
+  return _impl_.env_steps_.size();
+}
+inline int TrainingStateUpdate::env_steps_size() const {
+  return _internal_env_steps_size();
+}
+inline void TrainingStateUpdate::clear_env_steps() {
+  _impl_.env_steps_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >&
+TrainingStateUpdate::_internal_env_steps() const {
+  return _impl_.env_steps_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >&
+TrainingStateUpdate::env_steps() const {
+  // @@protoc_insertion_point(field_map:Schola.TrainingStateUpdate.env_steps)
+  return _internal_env_steps();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >*
+TrainingStateUpdate::_internal_mutable_env_steps() {
+  return _impl_.env_steps_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >*
+TrainingStateUpdate::mutable_env_steps() {
+  // @@protoc_insertion_point(field_mutable_map:Schola.TrainingStateUpdate.env_steps)
+  return _internal_mutable_env_steps();
+}
+
 // -------------------------------------------------------------------
 
 // TrainingDefinitionRequest
@@ -1752,6 +2091,151 @@ InitialTrainingStateRequest::mutable_environment_state_requests() {
   return _internal_mutable_environment_state_requests();
 }
 
+// -------------------------------------------------------------------
+
+// StepStreamResponse
+
+// .Schola.TrainingState state = 1;
+inline bool StepStreamResponse::_internal_has_state() const {
+  return msg_case() == kState;
+}
+inline bool StepStreamResponse::has_state() const {
+  return _internal_has_state();
+}
+inline void StepStreamResponse::set_has_state() {
+  _impl_._oneof_case_[0] = kState;
+}
+inline ::Schola::TrainingState* StepStreamResponse::release_state() {
+  // @@protoc_insertion_point(field_release:Schola.StepStreamResponse.state)
+  if (_internal_has_state()) {
+    clear_has_msg();
+    ::Schola::TrainingState* temp = _impl_.msg_.state_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.state_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::Schola::TrainingState& StepStreamResponse::_internal_state() const {
+  return _internal_has_state()
+      ? *_impl_.msg_.state_
+      : reinterpret_cast< ::Schola::TrainingState&>(::Schola::_TrainingState_default_instance_);
+}
+inline const ::Schola::TrainingState& StepStreamResponse::state() const {
+  // @@protoc_insertion_point(field_get:Schola.StepStreamResponse.state)
+  return _internal_state();
+}
+inline ::Schola::TrainingState* StepStreamResponse::unsafe_arena_release_state() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Schola.StepStreamResponse.state)
+  if (_internal_has_state()) {
+    clear_has_msg();
+    ::Schola::TrainingState* temp = _impl_.msg_.state_;
+    _impl_.msg_.state_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void StepStreamResponse::unsafe_arena_set_allocated_state(::Schola::TrainingState* state) {
+  clear_msg();
+  if (state) {
+    set_has_state();
+    _impl_.msg_.state_ = state;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Schola.StepStreamResponse.state)
+}
+inline ::Schola::TrainingState* StepStreamResponse::_internal_mutable_state() {
+  if (!_internal_has_state()) {
+    clear_msg();
+    set_has_state();
+    _impl_.msg_.state_ = CreateMaybeMessage< ::Schola::TrainingState >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.state_;
+}
+inline ::Schola::TrainingState* StepStreamResponse::mutable_state() {
+  ::Schola::TrainingState* _msg = _internal_mutable_state();
+  // @@protoc_insertion_point(field_mutable:Schola.StepStreamResponse.state)
+  return _msg;
+}
+
+// .Schola.InitialTrainingState initial_state = 2;
+inline bool StepStreamResponse::_internal_has_initial_state() const {
+  return msg_case() == kInitialState;
+}
+inline bool StepStreamResponse::has_initial_state() const {
+  return _internal_has_initial_state();
+}
+inline void StepStreamResponse::set_has_initial_state() {
+  _impl_._oneof_case_[0] = kInitialState;
+}
+inline ::Schola::InitialTrainingState* StepStreamResponse::release_initial_state() {
+  // @@protoc_insertion_point(field_release:Schola.StepStreamResponse.initial_state)
+  if (_internal_has_initial_state()) {
+    clear_has_msg();
+    ::Schola::InitialTrainingState* temp = _impl_.msg_.initial_state_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.msg_.initial_state_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::Schola::InitialTrainingState& StepStreamResponse::_internal_initial_state() const {
+  return _internal_has_initial_state()
+      ? *_impl_.msg_.initial_state_
+      : reinterpret_cast< ::Schola::InitialTrainingState&>(::Schola::_InitialTrainingState_default_instance_);
+}
+inline const ::Schola::InitialTrainingState& StepStreamResponse::initial_state() const {
+  // @@protoc_insertion_point(field_get:Schola.StepStreamResponse.initial_state)
+  return _internal_initial_state();
+}
+inline ::Schola::InitialTrainingState* StepStreamResponse::unsafe_arena_release_initial_state() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Schola.StepStreamResponse.initial_state)
+  if (_internal_has_initial_state()) {
+    clear_has_msg();
+    ::Schola::InitialTrainingState* temp = _impl_.msg_.initial_state_;
+    _impl_.msg_.initial_state_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void StepStreamResponse::unsafe_arena_set_allocated_initial_state(::Schola::InitialTrainingState* initial_state) {
+  clear_msg();
+  if (initial_state) {
+    set_has_initial_state();
+    _impl_.msg_.initial_state_ = initial_state;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Schola.StepStreamResponse.initial_state)
+}
+inline ::Schola::InitialTrainingState* StepStreamResponse::_internal_mutable_initial_state() {
+  if (!_internal_has_initial_state()) {
+    clear_msg();
+    set_has_initial_state();
+    _impl_.msg_.initial_state_ = CreateMaybeMessage< ::Schola::InitialTrainingState >(GetArenaForAllocation());
+  }
+  return _impl_.msg_.initial_state_;
+}
+inline ::Schola::InitialTrainingState* StepStreamResponse::mutable_initial_state() {
+  ::Schola::InitialTrainingState* _msg = _internal_mutable_initial_state();
+  // @@protoc_insertion_point(field_mutable:Schola.StepStreamResponse.initial_state)
+  return _msg;
+}
+
+inline bool StepStreamResponse::has_msg() const {
+  return msg_case() != MSG_NOT_SET;
+}
+inline void StepStreamResponse::clear_has_msg() {
+  _impl_._oneof_case_[0] = MSG_NOT_SET;
+}
+inline StepStreamResponse::MsgCase StepStreamResponse::msg_case() const {
+  return StepStreamResponse::MsgCase(_impl_._oneof_case_[0]);
+}
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -1775,6 +2259,10 @@ InitialTrainingStateRequest::mutable_environment_state_requests() {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
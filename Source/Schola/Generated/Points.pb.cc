@@ -53,6 +53,8 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 PROTOBUF_CONSTEXPR BinaryPoint::BinaryPoint(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.values_)*/{}
+  , /*decltype(_impl_.packed_values_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.num_packed_values_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct BinaryPointDefaultTypeInternal {
   PROTOBUF_CONSTEXPR BinaryPointDefaultTypeInternal()
@@ -117,6 +119,8 @@ const uint32_t TableStruct_Points_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::Schola::BinaryPoint, _impl_.values_),
+  PROTOBUF_FIELD_OFFSET(::Schola::BinaryPoint, _impl_.packed_values_),
+  PROTOBUF_FIELD_OFFSET(::Schola::BinaryPoint, _impl_.num_packed_values_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Schola::FundamentalPoint, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -139,8 +143,8 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 0, -1, -1, sizeof(::Schola::BoxPoint)},
   { 7, -1, -1, sizeof(::Schola::DiscretePoint)},
   { 14, -1, -1, sizeof(::Schola::BinaryPoint)},
-  { 21, -1, -1, sizeof(::Schola::FundamentalPoint)},
-  { 31, -1, -1, sizeof(::Schola::DictPoint)},
+  { 23, -1, -1, sizeof(::Schola::FundamentalPoint)},
+  { 33, -1, -1, sizeof(::Schola::DictPoint)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -154,17 +158,18 @@ static const ::_pb::Message* const file_default_instances[] = {
 const char descriptor_table_protodef_Points_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\014Points.proto\022\006Schola\"\032\n\010BoxPoint\022\016\n\006va"
   "lues\030\001 \003(\002\"\037\n\rDiscretePoint\022\016\n\006values\030\001 "
-  "\003(\005\"\035\n\013BinaryPoint\022\016\n\006values\030\001 \003(\010\"\240\001\n\020F"
-  "undamentalPoint\022%\n\tbox_point\030\001 \001(\0132\020.Sch"
-  "ola.BoxPointH\000\022/\n\016discrete_point\030\002 \001(\0132\025"
-  ".Schola.DiscretePointH\000\022+\n\014binary_point\030"
-  "\003 \001(\0132\023.Schola.BinaryPointH\000B\007\n\005point\"5\n"
-  "\tDictPoint\022(\n\006values\030\001 \003(\0132\030.Schola.Fund"
-  "amentalPointb\006proto3"
+  "\003(\005\"O\n\013BinaryPoint\022\016\n\006values\030\001 \003(\010\022\025\n\rpa"
+  "cked_values\030\002 \001(\014\022\031\n\021num_packed_values\030\003"
+  " \001(\005\"\240\001\n\020FundamentalPoint\022%\n\tbox_point\030\001"
+  " \001(\0132\020.Schola.BoxPointH\000\022/\n\016discrete_poi"
+  "nt\030\002 \001(\0132\025.Schola.DiscretePointH\000\022+\n\014bin"
+  "ary_point\030\003 \001(\0132\023.Schola.BinaryPointH\000B\007"
+  "\n\005point\"5\n\tDictPoint\022(\n\006values\030\001 \003(\0132\030.S"
+  "chola.FundamentalPointb\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_Points_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_Points_2eproto = {
-    false, false, 340, descriptor_table_protodef_Points_2eproto,
+    false, false, 390, descriptor_table_protodef_Points_2eproto,
     "Points.proto",
     &descriptor_table_Points_2eproto_once, nullptr, 0, 5,
     schemas, file_default_instances, TableStruct_Points_2eproto::offsets,
@@ -573,9 +578,20 @@ BinaryPoint::BinaryPoint(const BinaryPoint& from)
   BinaryPoint* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.values_){from._impl_.values_}
+    , decltype(_impl_.packed_values_){}
+    , decltype(_impl_.num_packed_values_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.packed_values_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.packed_values_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_packed_values().empty()) {
+    _this->_impl_.packed_values_.Set(from._internal_packed_values(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.num_packed_values_ = from._impl_.num_packed_values_;
   // @@protoc_insertion_point(copy_constructor:Schola.BinaryPoint)
 }
 
@@ -585,8 +601,14 @@ inline void BinaryPoint::SharedCtor(
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.values_){arena}
+    , decltype(_impl_.packed_values_){}
+    , decltype(_impl_.num_packed_values_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.packed_values_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.packed_values_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 BinaryPoint::~BinaryPoint() {
@@ -601,6 +623,7 @@ BinaryPoint::~BinaryPoint() {
 inline void BinaryPoint::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.values_.~RepeatedField();
+  _impl_.packed_values_.Destroy();
 }
 
 void BinaryPoint::SetCachedSize(int size) const {
@@ -614,6 +637,8 @@ void BinaryPoint::Clear() {
   (void) cached_has_bits;
 
   _impl_.values_.Clear();
+  _impl_.packed_values_.ClearToEmpty();
+  _impl_.num_packed_values_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -634,6 +659,23 @@ const char* BinaryPoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* c
         } else
           goto handle_unusual;
         continue;
+      // bytes packed_values = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_packed_values();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 num_packed_values = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.num_packed_values_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -668,6 +710,18 @@ uint8_t* BinaryPoint::_InternalSerialize(
     target = stream->WriteFixedPacked(1, _internal_values(), target);
   }
 
+  // bytes packed_values = 2;
+  if (!this->_internal_packed_values().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_packed_values(), target);
+  }
+
+  // int32 num_packed_values = 3;
+  if (this->_internal_num_packed_values() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_num_packed_values(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -695,6 +749,18 @@ size_t BinaryPoint::ByteSizeLong() const {
     total_size += data_size;
   }
 
+  // bytes packed_values = 2;
+  if (!this->_internal_packed_values().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_packed_values());
+  }
+
+  // int32 num_packed_values = 3;
+  if (this->_internal_num_packed_values() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_num_packed_values());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -714,6 +780,12 @@ void BinaryPoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PR
   (void) cached_has_bits;
 
   _this->_impl_.values_.MergeFrom(from._impl_.values_);
+  if (!from._internal_packed_values().empty()) {
+    _this->_internal_set_packed_values(from._internal_packed_values());
+  }
+  if (from._internal_num_packed_values() != 0) {
+    _this->_internal_set_num_packed_values(from._internal_num_packed_values());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -730,8 +802,15 @@ bool BinaryPoint::IsInitialized() const {
 
 void BinaryPoint::InternalSwap(BinaryPoint* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.values_.InternalSwap(&other->_impl_.values_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.packed_values_, lhs_arena,
+      &other->_impl_.packed_values_, rhs_arena
+  );
+  swap(_impl_.num_packed_values_, other->_impl_.num_packed_values_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata BinaryPoint::GetMetadata() const {
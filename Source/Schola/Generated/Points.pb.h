@@ -517,6 +517,8 @@ class BinaryPoint final :
 
   enum : int {
     kValuesFieldNumber = 1,
+    kPackedValuesFieldNumber = 2,
+    kNumPackedValuesFieldNumber = 3,
   };
   // repeated bool values = 1;
   int values_size() const;
@@ -540,6 +542,29 @@ class BinaryPoint final :
   ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
       mutable_values();
 
+  // bytes packed_values = 2;
+  void clear_packed_values();
+  const std::string& packed_values() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_packed_values(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_packed_values();
+  PROTOBUF_NODISCARD std::string* release_packed_values();
+  void set_allocated_packed_values(std::string* packed_values);
+  private:
+  const std::string& _internal_packed_values() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_packed_values(const std::string& value);
+  std::string* _internal_mutable_packed_values();
+  public:
+
+  // int32 num_packed_values = 3;
+  void clear_num_packed_values();
+  int32_t num_packed_values() const;
+  void set_num_packed_values(int32_t value);
+  private:
+  int32_t _internal_num_packed_values() const;
+  void _internal_set_num_packed_values(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:Schola.BinaryPoint)
  private:
   class _Internal;
@@ -549,6 +574,8 @@ class BinaryPoint final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > values_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr packed_values_;
+    int32_t num_packed_values_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1089,6 +1116,76 @@ BinaryPoint::mutable_values() {
   return _internal_mutable_values();
 }
 
+// bytes packed_values = 2;
+inline void BinaryPoint::clear_packed_values() {
+  _impl_.packed_values_.ClearToEmpty();
+}
+inline const std::string& BinaryPoint::packed_values() const {
+  // @@protoc_insertion_point(field_get:Schola.BinaryPoint.packed_values)
+  return _internal_packed_values();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BinaryPoint::set_packed_values(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.packed_values_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Schola.BinaryPoint.packed_values)
+}
+inline std::string* BinaryPoint::mutable_packed_values() {
+  std::string* _s = _internal_mutable_packed_values();
+  // @@protoc_insertion_point(field_mutable:Schola.BinaryPoint.packed_values)
+  return _s;
+}
+inline const std::string& BinaryPoint::_internal_packed_values() const {
+  return _impl_.packed_values_.Get();
+}
+inline void BinaryPoint::_internal_set_packed_values(const std::string& value) {
+  
+  _impl_.packed_values_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BinaryPoint::_internal_mutable_packed_values() {
+  
+  return _impl_.packed_values_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BinaryPoint::release_packed_values() {
+  // @@protoc_insertion_point(field_release:Schola.BinaryPoint.packed_values)
+  return _impl_.packed_values_.Release();
+}
+inline void BinaryPoint::set_allocated_packed_values(std::string* packed_values) {
+  if (packed_values != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.packed_values_.SetAllocated(packed_values, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.packed_values_.IsDefault()) {
+    _impl_.packed_values_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Schola.BinaryPoint.packed_values)
+}
+
+// int32 num_packed_values = 3;
+inline void BinaryPoint::clear_num_packed_values() {
+  _impl_.num_packed_values_ = 0;
+}
+inline int32_t BinaryPoint::_internal_num_packed_values() const {
+  return _impl_.num_packed_values_;
+}
+inline int32_t BinaryPoint::num_packed_values() const {
+  // @@protoc_insertion_point(field_get:Schola.BinaryPoint.num_packed_values)
+  return _internal_num_packed_values();
+}
+inline void BinaryPoint::_internal_set_num_packed_values(int32_t value) {
+  
+  _impl_.num_packed_values_ = value;
+}
+inline void BinaryPoint::set_num_packed_values(int32_t value) {
+  _internal_set_num_packed_values(value);
+  // @@protoc_insertion_point(field_set:Schola.BinaryPoint.num_packed_values)
+}
+
 // -------------------------------------------------------------------
 
 // FundamentalPoint
@@ -74,9 +74,44 @@ struct EnvironmentStateDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EnvironmentStateDefaultTypeInternal _EnvironmentState_default_instance_;
+PROTOBUF_CONSTEXPR DenseGroupState::DenseGroupState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.env_ids_)*/{}
+  , /*decltype(_impl_._env_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.agent_ids_)*/{}
+  , /*decltype(_impl_._agent_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.observations_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.rewards_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.statuses_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.group_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DenseGroupStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DenseGroupStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DenseGroupStateDefaultTypeInternal() {}
+  union {
+    DenseGroupState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DenseGroupStateDefaultTypeInternal _DenseGroupState_default_instance_;
+PROTOBUF_CONSTEXPR TrainingState_EnvStepsEntry_DoNotUse::TrainingState_EnvStepsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct TrainingState_EnvStepsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TrainingState_EnvStepsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TrainingState_EnvStepsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    TrainingState_EnvStepsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TrainingState_EnvStepsEntry_DoNotUseDefaultTypeInternal _TrainingState_EnvStepsEntry_DoNotUse_default_instance_;
 PROTOBUF_CONSTEXPR TrainingState::TrainingState(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.environment_states_)*/{}
+  , /*decltype(_impl_.dense_groups_)*/{}
+  , /*decltype(_impl_.env_steps_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.reset_state_)*/nullptr
+  , /*decltype(_impl_.membership_)*/nullptr
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct TrainingStateDefaultTypeInternal {
   PROTOBUF_CONSTEXPR TrainingStateDefaultTypeInternal()
@@ -147,9 +182,22 @@ struct InitialTrainingState_EnvironmentStatesEntry_DoNotUseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InitialTrainingState_EnvironmentStatesEntry_DoNotUseDefaultTypeInternal _InitialTrainingState_EnvironmentStatesEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR InitialTrainingState_EnvStepsEntry_DoNotUse::InitialTrainingState_EnvStepsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct InitialTrainingState_EnvStepsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InitialTrainingState_EnvStepsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InitialTrainingState_EnvStepsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    InitialTrainingState_EnvStepsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InitialTrainingState_EnvStepsEntry_DoNotUseDefaultTypeInternal _InitialTrainingState_EnvStepsEntry_DoNotUse_default_instance_;
 PROTOBUF_CONSTEXPR InitialTrainingState::InitialTrainingState(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.environment_states_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.env_steps_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.membership_)*/nullptr
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct InitialTrainingStateDefaultTypeInternal {
   PROTOBUF_CONSTEXPR InitialTrainingStateDefaultTypeInternal()
@@ -161,7 +209,7 @@ struct InitialTrainingStateDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InitialTrainingStateDefaultTypeInternal _InitialTrainingState_default_instance_;
 }  // namespace Schola
-static ::_pb::Metadata file_level_metadata_State_2eproto[11];
+static ::_pb::Metadata file_level_metadata_State_2eproto[14];
 static const ::_pb::EnumDescriptor* file_level_enum_descriptors_State_2eproto[1];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_State_2eproto = nullptr;
 
@@ -204,12 +252,38 @@ const uint32_t TableStruct_State_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pr
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::Schola::EnvironmentState, _impl_.agent_states_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupState, _impl_.group_id_),
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupState, _impl_.env_ids_),
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupState, _impl_.agent_ids_),
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupState, _impl_.observations_),
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupState, _impl_.rewards_),
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupState, _impl_.statuses_),
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingState_EnvStepsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingState_EnvStepsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingState_EnvStepsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingState_EnvStepsEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Schola::TrainingState, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::Schola::TrainingState, _impl_.environment_states_),
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingState, _impl_.dense_groups_),
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingState, _impl_.reset_state_),
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingState, _impl_.env_steps_),
+  PROTOBUF_FIELD_OFFSET(::Schola::TrainingState, _impl_.membership_),
   PROTOBUF_FIELD_OFFSET(::Schola::InitialAgentState_InfoEntry_DoNotUse, _has_bits_),
   PROTOBUF_FIELD_OFFSET(::Schola::InitialAgentState_InfoEntry_DoNotUse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -255,6 +329,16 @@ const uint32_t TableStruct_State_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pr
   PROTOBUF_FIELD_OFFSET(::Schola::InitialTrainingState_EnvironmentStatesEntry_DoNotUse, value_),
   0,
   1,
+  PROTOBUF_FIELD_OFFSET(::Schola::InitialTrainingState_EnvStepsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Schola::InitialTrainingState_EnvStepsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Schola::InitialTrainingState_EnvStepsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Schola::InitialTrainingState_EnvStepsEntry_DoNotUse, value_),
+  0,
+  1,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::Schola::InitialTrainingState, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -262,19 +346,24 @@ const uint32_t TableStruct_State_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pr
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::Schola::InitialTrainingState, _impl_.environment_states_),
+  PROTOBUF_FIELD_OFFSET(::Schola::InitialTrainingState, _impl_.env_steps_),
+  PROTOBUF_FIELD_OFFSET(::Schola::InitialTrainingState, _impl_.membership_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, 8, -1, sizeof(::Schola::AgentState_InfoEntry_DoNotUse)},
   { 10, -1, -1, sizeof(::Schola::AgentState)},
   { 20, 28, -1, sizeof(::Schola::EnvironmentState_AgentStatesEntry_DoNotUse)},
   { 30, -1, -1, sizeof(::Schola::EnvironmentState)},
-  { 37, -1, -1, sizeof(::Schola::TrainingState)},
-  { 44, 52, -1, sizeof(::Schola::InitialAgentState_InfoEntry_DoNotUse)},
-  { 54, -1, -1, sizeof(::Schola::InitialAgentState)},
-  { 62, 70, -1, sizeof(::Schola::InitialEnvironmentState_AgentStatesEntry_DoNotUse)},
-  { 72, -1, -1, sizeof(::Schola::InitialEnvironmentState)},
-  { 79, 87, -1, sizeof(::Schola::InitialTrainingState_EnvironmentStatesEntry_DoNotUse)},
-  { 89, -1, -1, sizeof(::Schola::InitialTrainingState)},
+  { 37, -1, -1, sizeof(::Schola::DenseGroupState)},
+  { 49, 57, -1, sizeof(::Schola::TrainingState_EnvStepsEntry_DoNotUse)},
+  { 59, -1, -1, sizeof(::Schola::TrainingState)},
+  { 70, 78, -1, sizeof(::Schola::InitialAgentState_InfoEntry_DoNotUse)},
+  { 80, -1, -1, sizeof(::Schola::InitialAgentState)},
+  { 88, 96, -1, sizeof(::Schola::InitialEnvironmentState_AgentStatesEntry_DoNotUse)},
+  { 98, -1, -1, sizeof(::Schola::InitialEnvironmentState)},
+  { 105, 113, -1, sizeof(::Schola::InitialTrainingState_EnvironmentStatesEntry_DoNotUse)},
+  { 115, 123, -1, sizeof(::Schola::InitialTrainingState_EnvStepsEntry_DoNotUse)},
+  { 125, -1, -1, sizeof(::Schola::InitialTrainingState)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -282,28 +371,41 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::Schola::_AgentState_default_instance_._instance,
   &::Schola::_EnvironmentState_AgentStatesEntry_DoNotUse_default_instance_._instance,
   &::Schola::_EnvironmentState_default_instance_._instance,
+  &::Schola::_DenseGroupState_default_instance_._instance,
+  &::Schola::_TrainingState_EnvStepsEntry_DoNotUse_default_instance_._instance,
   &::Schola::_TrainingState_default_instance_._instance,
   &::Schola::_InitialAgentState_InfoEntry_DoNotUse_default_instance_._instance,
   &::Schola::_InitialAgentState_default_instance_._instance,
   &::Schola::_InitialEnvironmentState_AgentStatesEntry_DoNotUse_default_instance_._instance,
   &::Schola::_InitialEnvironmentState_default_instance_._instance,
   &::Schola::_InitialTrainingState_EnvironmentStatesEntry_DoNotUse_default_instance_._instance,
+  &::Schola::_InitialTrainingState_EnvStepsEntry_DoNotUse_default_instance_._instance,
   &::Schola::_InitialTrainingState_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_State_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\013State.proto\022\006Schola\032\014Points.proto\"\276\001\n\n"
-  "AgentState\022\'\n\014observations\030\001 \001(\0132\021.Schol"
-  "a.DictPoint\022\016\n\006reward\030\002 \001(\002\022\036\n\006status\030\003 "
-  "\001(\0162\016.Schola.Status\022*\n\004info\030\004 \003(\0132\034.Scho"
-  "la.AgentState.InfoEntry\032+\n\tInfoEntry\022\013\n\003"
-  "key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"\233\001\n\020Environ"
-  "mentState\022\?\n\014agent_states\030\001 \003(\0132).Schola"
-  ".EnvironmentState.AgentStatesEntry\032F\n\020Ag"
-  "entStatesEntry\022\013\n\003key\030\001 \001(\005\022!\n\005value\030\002 \001"
-  "(\0132\022.Schola.AgentState:\0028\001\"E\n\rTrainingSt"
-  "ate\0224\n\022environment_states\030\001 \003(\0132\030.Schola"
-  ".EnvironmentState\"\234\001\n\021InitialAgentState\022"
+  "\n\013State.proto\022\006Schola\032\014Points.proto\032\021Def"
+  "initions.proto\"\276\001\n\nAgentState\022\'\n\014observa"
+  "tions\030\001 \001(\0132\021.Schola.DictPoint\022\016\n\006reward"
+  "\030\002 \001(\002\022\036\n\006status\030\003 \001(\0162\016.Schola.Status\022*"
+  "\n\004info\030\004 \003(\0132\034.Schola.AgentState.InfoEnt"
+  "ry\032+\n\tInfoEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 "
+  "\001(\t:\0028\001\"\233\001\n\020EnvironmentState\022\?\n\014agent_st"
+  "ates\030\001 \003(\0132).Schola.EnvironmentState.Age"
+  "ntStatesEntry\032F\n\020AgentStatesEntry\022\013\n\003key"
+  "\030\001 \001(\005\022!\n\005value\030\002 \001(\0132\022.Schola.AgentStat"
+  "e:\0028\001\"\200\001\n\017DenseGroupState\022\020\n\010group_id\030\001 "
+  "\001(\005\022\017\n\007env_ids\030\002 \003(\005\022\021\n\tagent_ids\030\003 \003(\005\022"
+  "\024\n\014observations\030\004 \001(\014\022\017\n\007rewards\030\005 \001(\014\022\020"
+  "\n\010statuses\030\006 \001(\014\"\276\002\n\rTrainingState\0224\n\022en"
+  "vironment_states\030\001 \003(\0132\030.Schola.Environm"
+  "entState\022-\n\014dense_groups\030\002 \003(\0132\027.Schola."
+  "DenseGroupState\0221\n\013reset_state\030\003 \001(\0132\034.S"
+  "chola.InitialTrainingState\0226\n\tenv_steps\030"
+  "\004 \003(\0132#.Schola.TrainingState.EnvStepsEnt"
+  "ry\022,\n\nmembership\030\005 \001(\0132\030.Schola.Membersh"
+  "ipUpdate\032/\n\rEnvStepsEntry\022\013\n\003key\030\001 \001(\005\022\r"
+  "\n\005value\030\002 \001(\005:\0028\001\"\234\001\n\021InitialAgentState\022"
   "\'\n\014observations\030\001 \001(\0132\021.Schola.DictPoint"
   "\0221\n\004info\030\004 \003(\0132#.Schola.InitialAgentStat"
   "e.InfoEntry\032+\n\tInfoEntry\022\013\n\003key\030\001 \001(\t\022\r\n"
@@ -311,23 +413,28 @@ const char descriptor_table_protodef_State_2eproto[] PROTOBUF_SECTION_VARIABLE(p
   "tate\022F\n\014agent_states\030\001 \003(\01320.Schola.Init"
   "ialEnvironmentState.AgentStatesEntry\032M\n\020"
   "AgentStatesEntry\022\013\n\003key\030\001 \001(\005\022(\n\005value\030\002"
-  " \001(\0132\031.Schola.InitialAgentState:\0028\001\"\302\001\n\024"
+  " \001(\0132\031.Schola.InitialAgentState:\0028\001\"\340\002\n\024"
   "InitialTrainingState\022O\n\022environment_stat"
   "es\030\001 \003(\01323.Schola.InitialTrainingState.E"
-  "nvironmentStatesEntry\032Y\n\026EnvironmentStat"
-  "esEntry\022\013\n\003key\030\001 \001(\005\022.\n\005value\030\002 \001(\0132\037.Sc"
-  "hola.InitialEnvironmentState:\0028\001*3\n\006Stat"
-  "us\022\013\n\007RUNNING\020\000\022\r\n\tTRUNCATED\020\001\022\r\n\tCOMPLE"
-  "TED\020\002b\006proto3"
+  "nvironmentStatesEntry\022=\n\tenv_steps\030\002 \003(\013"
+  "2*.Schola.InitialTrainingState.EnvStepsE"
+  "ntry\022,\n\nmembership\030\003 \001(\0132\030.Schola.Member"
+  "shipUpdate\032Y\n\026EnvironmentStatesEntry\022\013\n\003"
+  "key\030\001 \001(\005\022.\n\005value\030\002 \001(\0132\037.Schola.Initia"
+  "lEnvironmentState:\0028\001\032/\n\rEnvStepsEntry\022\013"
+  "\n\003key\030\001 \001(\005\022\r\n\005value\030\002 \001(\005:\0028\001*3\n\006Status"
+  "\022\013\n\007RUNNING\020\000\022\r\n\tTRUNCATED\020\001\022\r\n\tCOMPLETE"
+  "D\020\002b\006proto3"
   ;
-static const ::_pbi::DescriptorTable* const descriptor_table_State_2eproto_deps[1] = {
+static const ::_pbi::DescriptorTable* const descriptor_table_State_2eproto_deps[2] = {
+  &::descriptor_table_Definitions_2eproto,
   &::descriptor_table_Points_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_State_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_State_2eproto = {
-    false, false, 1053, descriptor_table_protodef_State_2eproto,
+    false, false, 1611, descriptor_table_protodef_State_2eproto,
     "State.proto",
-    &descriptor_table_State_2eproto_once, descriptor_table_State_2eproto_deps, 1, 11,
+    &descriptor_table_State_2eproto_once, descriptor_table_State_2eproto_deps, 2, 14,
     schemas, file_default_instances, TableStruct_State_2eproto::offsets,
     file_level_metadata_State_2eproto, file_level_enum_descriptors_State_2eproto,
     file_level_service_descriptors_State_2eproto,
@@ -932,14 +1039,446 @@ void EnvironmentState::InternalSwap(EnvironmentState* other) {
 
 // ===================================================================
 
+class DenseGroupState::_Internal {
+ public:
+};
+
+DenseGroupState::DenseGroupState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Schola.DenseGroupState)
+}
+DenseGroupState::DenseGroupState(const DenseGroupState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DenseGroupState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.env_ids_){from._impl_.env_ids_}
+    , /*decltype(_impl_._env_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.agent_ids_){from._impl_.agent_ids_}
+    , /*decltype(_impl_._agent_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.observations_){}
+    , decltype(_impl_.rewards_){}
+    , decltype(_impl_.statuses_){}
+    , decltype(_impl_.group_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.observations_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.observations_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_observations().empty()) {
+    _this->_impl_.observations_.Set(from._internal_observations(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.rewards_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rewards_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rewards().empty()) {
+    _this->_impl_.rewards_.Set(from._internal_rewards(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.statuses_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.statuses_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_statuses().empty()) {
+    _this->_impl_.statuses_.Set(from._internal_statuses(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.group_id_ = from._impl_.group_id_;
+  // @@protoc_insertion_point(copy_constructor:Schola.DenseGroupState)
+}
+
+inline void DenseGroupState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.env_ids_){arena}
+    , /*decltype(_impl_._env_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.agent_ids_){arena}
+    , /*decltype(_impl_._agent_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.observations_){}
+    , decltype(_impl_.rewards_){}
+    , decltype(_impl_.statuses_){}
+    , decltype(_impl_.group_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.observations_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.observations_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.rewards_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rewards_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.statuses_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.statuses_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DenseGroupState::~DenseGroupState() {
+  // @@protoc_insertion_point(destructor:Schola.DenseGroupState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DenseGroupState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.env_ids_.~RepeatedField();
+  _impl_.agent_ids_.~RepeatedField();
+  _impl_.observations_.Destroy();
+  _impl_.rewards_.Destroy();
+  _impl_.statuses_.Destroy();
+}
+
+void DenseGroupState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DenseGroupState::Clear() {
+// @@protoc_insertion_point(message_clear_start:Schola.DenseGroupState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.env_ids_.Clear();
+  _impl_.agent_ids_.Clear();
+  _impl_.observations_.ClearToEmpty();
+  _impl_.rewards_.ClearToEmpty();
+  _impl_.statuses_.ClearToEmpty();
+  _impl_.group_id_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DenseGroupState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 group_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.group_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 env_ids = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_env_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_env_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 agent_ids = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_agent_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_agent_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes observations = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_observations();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes rewards = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_rewards();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes statuses = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_statuses();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DenseGroupState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Schola.DenseGroupState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 group_id = 1;
+  if (this->_internal_group_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_group_id(), target);
+  }
+
+  // repeated int32 env_ids = 2;
+  {
+    int byte_size = _impl_._env_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          2, _internal_env_ids(), byte_size, target);
+    }
+  }
+
+  // repeated int32 agent_ids = 3;
+  {
+    int byte_size = _impl_._agent_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          3, _internal_agent_ids(), byte_size, target);
+    }
+  }
+
+  // bytes observations = 4;
+  if (!this->_internal_observations().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_observations(), target);
+  }
+
+  // bytes rewards = 5;
+  if (!this->_internal_rewards().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_rewards(), target);
+  }
+
+  // bytes statuses = 6;
+  if (!this->_internal_statuses().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_statuses(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Schola.DenseGroupState)
+  return target;
+}
+
+size_t DenseGroupState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Schola.DenseGroupState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 env_ids = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.env_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._env_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 agent_ids = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.agent_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._agent_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // bytes observations = 4;
+  if (!this->_internal_observations().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_observations());
+  }
+
+  // bytes rewards = 5;
+  if (!this->_internal_rewards().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_rewards());
+  }
+
+  // bytes statuses = 6;
+  if (!this->_internal_statuses().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_statuses());
+  }
+
+  // int32 group_id = 1;
+  if (this->_internal_group_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_group_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DenseGroupState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DenseGroupState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DenseGroupState::GetClassData() const { return &_class_data_; }
+
+
+void DenseGroupState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DenseGroupState*>(&to_msg);
+  auto& from = static_cast<const DenseGroupState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Schola.DenseGroupState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.env_ids_.MergeFrom(from._impl_.env_ids_);
+  _this->_impl_.agent_ids_.MergeFrom(from._impl_.agent_ids_);
+  if (!from._internal_observations().empty()) {
+    _this->_internal_set_observations(from._internal_observations());
+  }
+  if (!from._internal_rewards().empty()) {
+    _this->_internal_set_rewards(from._internal_rewards());
+  }
+  if (!from._internal_statuses().empty()) {
+    _this->_internal_set_statuses(from._internal_statuses());
+  }
+  if (from._internal_group_id() != 0) {
+    _this->_internal_set_group_id(from._internal_group_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DenseGroupState::CopyFrom(const DenseGroupState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Schola.DenseGroupState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DenseGroupState::IsInitialized() const {
+  return true;
+}
+
+void DenseGroupState::InternalSwap(DenseGroupState* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.env_ids_.InternalSwap(&other->_impl_.env_ids_);
+  _impl_.agent_ids_.InternalSwap(&other->_impl_.agent_ids_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.observations_, lhs_arena,
+      &other->_impl_.observations_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rewards_, lhs_arena,
+      &other->_impl_.rewards_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.statuses_, lhs_arena,
+      &other->_impl_.statuses_, rhs_arena
+  );
+  swap(_impl_.group_id_, other->_impl_.group_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DenseGroupState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_State_2eproto_getter, &descriptor_table_State_2eproto_once,
+      file_level_metadata_State_2eproto[4]);
+}
+
+// ===================================================================
+
+TrainingState_EnvStepsEntry_DoNotUse::TrainingState_EnvStepsEntry_DoNotUse() {}
+TrainingState_EnvStepsEntry_DoNotUse::TrainingState_EnvStepsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void TrainingState_EnvStepsEntry_DoNotUse::MergeFrom(const TrainingState_EnvStepsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata TrainingState_EnvStepsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_State_2eproto_getter, &descriptor_table_State_2eproto_once,
+      file_level_metadata_State_2eproto[5]);
+}
+
+// ===================================================================
+
 class TrainingState::_Internal {
  public:
+  static const ::Schola::InitialTrainingState& reset_state(const TrainingState* msg);
+  static const ::Schola::MembershipUpdate& membership(const TrainingState* msg);
 };
 
+const ::Schola::InitialTrainingState&
+TrainingState::_Internal::reset_state(const TrainingState* msg) {
+  return *msg->_impl_.reset_state_;
+}
+const ::Schola::MembershipUpdate&
+TrainingState::_Internal::membership(const TrainingState* msg) {
+  return *msg->_impl_.membership_;
+}
+void TrainingState::clear_membership() {
+  if (GetArenaForAllocation() == nullptr && _impl_.membership_ != nullptr) {
+    delete _impl_.membership_;
+  }
+  _impl_.membership_ = nullptr;
+}
 TrainingState::TrainingState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &TrainingState::ArenaDtor);
+  }
   // @@protoc_insertion_point(arena_constructor:Schola.TrainingState)
 }
 TrainingState::TrainingState(const TrainingState& from)
@@ -947,9 +1486,20 @@ TrainingState::TrainingState(const TrainingState& from)
   TrainingState* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.environment_states_){from._impl_.environment_states_}
+    , decltype(_impl_.dense_groups_){from._impl_.dense_groups_}
+    , /*decltype(_impl_.env_steps_)*/{}
+    , decltype(_impl_.reset_state_){nullptr}
+    , decltype(_impl_.membership_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.env_steps_.MergeFrom(from._impl_.env_steps_);
+  if (from._internal_has_reset_state()) {
+    _this->_impl_.reset_state_ = new ::Schola::InitialTrainingState(*from._impl_.reset_state_);
+  }
+  if (from._internal_has_membership()) {
+    _this->_impl_.membership_ = new ::Schola::MembershipUpdate(*from._impl_.membership_);
+  }
   // @@protoc_insertion_point(copy_constructor:Schola.TrainingState)
 }
 
@@ -959,6 +1509,10 @@ inline void TrainingState::SharedCtor(
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.environment_states_){arena}
+    , decltype(_impl_.dense_groups_){arena}
+    , /*decltype(_impl_.env_steps_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.reset_state_){nullptr}
+    , decltype(_impl_.membership_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -967,6 +1521,7 @@ TrainingState::~TrainingState() {
   // @@protoc_insertion_point(destructor:Schola.TrainingState)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
+    ArenaDtor(this);
     return;
   }
   SharedDtor();
@@ -975,8 +1530,17 @@ TrainingState::~TrainingState() {
 inline void TrainingState::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.environment_states_.~RepeatedPtrField();
+  _impl_.dense_groups_.~RepeatedPtrField();
+  _impl_.env_steps_.Destruct();
+  _impl_.env_steps_.~MapField();
+  if (this != internal_default_instance()) delete _impl_.reset_state_;
+  if (this != internal_default_instance()) delete _impl_.membership_;
 }
 
+void TrainingState::ArenaDtor(void* object) {
+  TrainingState* _this = reinterpret_cast< TrainingState* >(object);
+  _this->_impl_.env_steps_.Destruct();
+}
 void TrainingState::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
@@ -988,6 +1552,16 @@ void TrainingState::Clear() {
   (void) cached_has_bits;
 
   _impl_.environment_states_.Clear();
+  _impl_.dense_groups_.Clear();
+  _impl_.env_steps_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.reset_state_ != nullptr) {
+    delete _impl_.reset_state_;
+  }
+  _impl_.reset_state_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.membership_ != nullptr) {
+    delete _impl_.membership_;
+  }
+  _impl_.membership_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1010,6 +1584,48 @@ const char* TrainingState::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
+      // repeated .Schola.DenseGroupState dense_groups = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_dense_groups(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .Schola.InitialTrainingState reset_state = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reset_state(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // map<int32, int32> env_steps = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.env_steps_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .Schola.MembershipUpdate membership = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_membership(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1047,6 +1663,45 @@ uint8_t* TrainingState::_InternalSerialize(
         InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  // repeated .Schola.DenseGroupState dense_groups = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_dense_groups_size()); i < n; i++) {
+    const auto& repfield = this->_internal_dense_groups(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .Schola.InitialTrainingState reset_state = 3;
+  if (this->_internal_has_reset_state()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::reset_state(this),
+        _Internal::reset_state(this).GetCachedSize(), target, stream);
+  }
+
+  // map<int32, int32> env_steps = 4;
+  if (!this->_internal_env_steps().empty()) {
+    using MapType = ::_pb::Map<int32_t, int32_t>;
+    using WireHelper = TrainingState_EnvStepsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_env_steps();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(4, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(4, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // .Schola.MembershipUpdate membership = 5;
+  if (this->_internal_has_membership()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::membership(this),
+        _Internal::membership(this).GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1070,6 +1725,36 @@ size_t TrainingState::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // repeated .Schola.DenseGroupState dense_groups = 2;
+  total_size += 1UL * this->_internal_dense_groups_size();
+  for (const auto& msg : this->_impl_.dense_groups_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // map<int32, int32> env_steps = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_env_steps_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >::const_iterator
+      it = this->_internal_env_steps().begin();
+      it != this->_internal_env_steps().end(); ++it) {
+    total_size += TrainingState_EnvStepsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // .Schola.InitialTrainingState reset_state = 3;
+  if (this->_internal_has_reset_state()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.reset_state_);
+  }
+
+  // .Schola.MembershipUpdate membership = 5;
+  if (this->_internal_has_membership()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.membership_);
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1089,6 +1774,16 @@ void TrainingState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::
   (void) cached_has_bits;
 
   _this->_impl_.environment_states_.MergeFrom(from._impl_.environment_states_);
+  _this->_impl_.dense_groups_.MergeFrom(from._impl_.dense_groups_);
+  _this->_impl_.env_steps_.MergeFrom(from._impl_.env_steps_);
+  if (from._internal_has_reset_state()) {
+    _this->_internal_mutable_reset_state()->::Schola::InitialTrainingState::MergeFrom(
+        from._internal_reset_state());
+  }
+  if (from._internal_has_membership()) {
+    _this->_internal_mutable_membership()->::Schola::MembershipUpdate::MergeFrom(
+        from._internal_membership());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1107,12 +1802,20 @@ void TrainingState::InternalSwap(TrainingState* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.environment_states_.InternalSwap(&other->_impl_.environment_states_);
+  _impl_.dense_groups_.InternalSwap(&other->_impl_.dense_groups_);
+  _impl_.env_steps_.InternalSwap(&other->_impl_.env_steps_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TrainingState, _impl_.membership_)
+      + sizeof(TrainingState::_impl_.membership_)
+      - PROTOBUF_FIELD_OFFSET(TrainingState, _impl_.reset_state_)>(
+          reinterpret_cast<char*>(&_impl_.reset_state_),
+          reinterpret_cast<char*>(&other->_impl_.reset_state_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata TrainingState::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_State_2eproto_getter, &descriptor_table_State_2eproto_once,
-      file_level_metadata_State_2eproto[4]);
+      file_level_metadata_State_2eproto[6]);
 }
 
 // ===================================================================
@@ -1126,7 +1829,7 @@ void InitialAgentState_InfoEntry_DoNotUse::MergeFrom(const InitialAgentState_Inf
 ::PROTOBUF_NAMESPACE_ID::Metadata InitialAgentState_InfoEntry_DoNotUse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_State_2eproto_getter, &descriptor_table_State_2eproto_once,
-      file_level_metadata_State_2eproto[5]);
+      file_level_metadata_State_2eproto[7]);
 }
 
 // ===================================================================
@@ -1393,7 +2096,7 @@ void InitialAgentState::InternalSwap(InitialAgentState* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata InitialAgentState::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_State_2eproto_getter, &descriptor_table_State_2eproto_once,
-      file_level_metadata_State_2eproto[6]);
+      file_level_metadata_State_2eproto[8]);
 }
 
 // ===================================================================
@@ -1407,7 +2110,7 @@ void InitialEnvironmentState_AgentStatesEntry_DoNotUse::MergeFrom(const InitialE
 ::PROTOBUF_NAMESPACE_ID::Metadata InitialEnvironmentState_AgentStatesEntry_DoNotUse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_State_2eproto_getter, &descriptor_table_State_2eproto_once,
-      file_level_metadata_State_2eproto[7]);
+      file_level_metadata_State_2eproto[9]);
 }
 
 // ===================================================================
@@ -1613,7 +2316,7 @@ void InitialEnvironmentState::InternalSwap(InitialEnvironmentState* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata InitialEnvironmentState::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_State_2eproto_getter, &descriptor_table_State_2eproto_once,
-      file_level_metadata_State_2eproto[8]);
+      file_level_metadata_State_2eproto[10]);
 }
 
 // ===================================================================
@@ -1627,15 +2330,40 @@ void InitialTrainingState_EnvironmentStatesEntry_DoNotUse::MergeFrom(const Initi
 ::PROTOBUF_NAMESPACE_ID::Metadata InitialTrainingState_EnvironmentStatesEntry_DoNotUse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_State_2eproto_getter, &descriptor_table_State_2eproto_once,
-      file_level_metadata_State_2eproto[9]);
+      file_level_metadata_State_2eproto[11]);
+}
+
+// ===================================================================
+
+InitialTrainingState_EnvStepsEntry_DoNotUse::InitialTrainingState_EnvStepsEntry_DoNotUse() {}
+InitialTrainingState_EnvStepsEntry_DoNotUse::InitialTrainingState_EnvStepsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void InitialTrainingState_EnvStepsEntry_DoNotUse::MergeFrom(const InitialTrainingState_EnvStepsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata InitialTrainingState_EnvStepsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_State_2eproto_getter, &descriptor_table_State_2eproto_once,
+      file_level_metadata_State_2eproto[12]);
 }
 
 // ===================================================================
 
 class InitialTrainingState::_Internal {
  public:
+  static const ::Schola::MembershipUpdate& membership(const InitialTrainingState* msg);
 };
 
+const ::Schola::MembershipUpdate&
+InitialTrainingState::_Internal::membership(const InitialTrainingState* msg) {
+  return *msg->_impl_.membership_;
+}
+void InitialTrainingState::clear_membership() {
+  if (GetArenaForAllocation() == nullptr && _impl_.membership_ != nullptr) {
+    delete _impl_.membership_;
+  }
+  _impl_.membership_ = nullptr;
+}
 InitialTrainingState::InitialTrainingState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -1650,10 +2378,16 @@ InitialTrainingState::InitialTrainingState(const InitialTrainingState& from)
   InitialTrainingState* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       /*decltype(_impl_.environment_states_)*/{}
+    , /*decltype(_impl_.env_steps_)*/{}
+    , decltype(_impl_.membership_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _this->_impl_.environment_states_.MergeFrom(from._impl_.environment_states_);
+  _this->_impl_.env_steps_.MergeFrom(from._impl_.env_steps_);
+  if (from._internal_has_membership()) {
+    _this->_impl_.membership_ = new ::Schola::MembershipUpdate(*from._impl_.membership_);
+  }
   // @@protoc_insertion_point(copy_constructor:Schola.InitialTrainingState)
 }
 
@@ -1663,6 +2397,8 @@ inline void InitialTrainingState::SharedCtor(
   (void)is_message_owned;
   new (&_impl_) Impl_{
       /*decltype(_impl_.environment_states_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.env_steps_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.membership_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -1681,11 +2417,15 @@ inline void InitialTrainingState::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.environment_states_.Destruct();
   _impl_.environment_states_.~MapField();
+  _impl_.env_steps_.Destruct();
+  _impl_.env_steps_.~MapField();
+  if (this != internal_default_instance()) delete _impl_.membership_;
 }
 
 void InitialTrainingState::ArenaDtor(void* object) {
   InitialTrainingState* _this = reinterpret_cast< InitialTrainingState* >(object);
   _this->_impl_.environment_states_.Destruct();
+  _this->_impl_.env_steps_.Destruct();
 }
 void InitialTrainingState::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
@@ -1698,6 +2438,11 @@ void InitialTrainingState::Clear() {
   (void) cached_has_bits;
 
   _impl_.environment_states_.Clear();
+  _impl_.env_steps_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.membership_ != nullptr) {
+    delete _impl_.membership_;
+  }
+  _impl_.membership_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1720,6 +2465,27 @@ const char* InitialTrainingState::_InternalParse(const char* ptr, ::_pbi::ParseC
         } else
           goto handle_unusual;
         continue;
+      // map<int32, int32> env_steps = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.env_steps_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .Schola.MembershipUpdate membership = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_membership(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1766,6 +2532,30 @@ uint8_t* InitialTrainingState::_InternalSerialize(
     }
   }
 
+  // map<int32, int32> env_steps = 2;
+  if (!this->_internal_env_steps().empty()) {
+    using MapType = ::_pb::Map<int32_t, int32_t>;
+    using WireHelper = InitialTrainingState_EnvStepsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_env_steps();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+      }
+    }
+  }
+
+  // .Schola.MembershipUpdate membership = 3;
+  if (this->_internal_has_membership()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::membership(this),
+        _Internal::membership(this).GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1791,6 +2581,22 @@ size_t InitialTrainingState::ByteSizeLong() const {
     total_size += InitialTrainingState_EnvironmentStatesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
   }
 
+  // map<int32, int32> env_steps = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_env_steps_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >::const_iterator
+      it = this->_internal_env_steps().begin();
+      it != this->_internal_env_steps().end(); ++it) {
+    total_size += InitialTrainingState_EnvStepsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // .Schola.MembershipUpdate membership = 3;
+  if (this->_internal_has_membership()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.membership_);
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1810,6 +2616,11 @@ void InitialTrainingState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, c
   (void) cached_has_bits;
 
   _this->_impl_.environment_states_.MergeFrom(from._impl_.environment_states_);
+  _this->_impl_.env_steps_.MergeFrom(from._impl_.env_steps_);
+  if (from._internal_has_membership()) {
+    _this->_internal_mutable_membership()->::Schola::MembershipUpdate::MergeFrom(
+        from._internal_membership());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1828,12 +2639,14 @@ void InitialTrainingState::InternalSwap(InitialTrainingState* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.environment_states_.InternalSwap(&other->_impl_.environment_states_);
+  _impl_.env_steps_.InternalSwap(&other->_impl_.env_steps_);
+  swap(_impl_.membership_, other->_impl_.membership_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata InitialTrainingState::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_State_2eproto_getter, &descriptor_table_State_2eproto_once,
-      file_level_metadata_State_2eproto[10]);
+      file_level_metadata_State_2eproto[13]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -1855,6 +2668,14 @@ template<> PROTOBUF_NOINLINE ::Schola::EnvironmentState*
 Arena::CreateMaybeMessage< ::Schola::EnvironmentState >(Arena* arena) {
   return Arena::CreateMessageInternal< ::Schola::EnvironmentState >(arena);
 }
+template<> PROTOBUF_NOINLINE ::Schola::DenseGroupState*
+Arena::CreateMaybeMessage< ::Schola::DenseGroupState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Schola::DenseGroupState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Schola::TrainingState_EnvStepsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Schola::TrainingState_EnvStepsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Schola::TrainingState_EnvStepsEntry_DoNotUse >(arena);
+}
 template<> PROTOBUF_NOINLINE ::Schola::TrainingState*
 Arena::CreateMaybeMessage< ::Schola::TrainingState >(Arena* arena) {
   return Arena::CreateMessageInternal< ::Schola::TrainingState >(arena);
@@ -1879,6 +2700,10 @@ template<> PROTOBUF_NOINLINE ::Schola::InitialTrainingState_EnvironmentStatesEnt
 Arena::CreateMaybeMessage< ::Schola::InitialTrainingState_EnvironmentStatesEntry_DoNotUse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::Schola::InitialTrainingState_EnvironmentStatesEntry_DoNotUse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::Schola::InitialTrainingState_EnvStepsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Schola::InitialTrainingState_EnvStepsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Schola::InitialTrainingState_EnvStepsEntry_DoNotUse >(arena);
+}
 template<> PROTOBUF_NOINLINE ::Schola::InitialTrainingState*
 Arena::CreateMaybeMessage< ::Schola::InitialTrainingState >(Arena* arena) {
   return Arena::CreateMessageInternal< ::Schola::InitialTrainingState >(arena);
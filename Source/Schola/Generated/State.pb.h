@@ -35,6 +35,7 @@
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 #include "Points.pb.h"
+#include "Definitions.pb.h"
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
 #define PROTOBUF_INTERNAL_EXPORT_State_2eproto
@@ -56,6 +57,9 @@ extern AgentStateDefaultTypeInternal _AgentState_default_instance_;
 class AgentState_InfoEntry_DoNotUse;
 struct AgentState_InfoEntry_DoNotUseDefaultTypeInternal;
 extern AgentState_InfoEntry_DoNotUseDefaultTypeInternal _AgentState_InfoEntry_DoNotUse_default_instance_;
+class DenseGroupState;
+struct DenseGroupStateDefaultTypeInternal;
+extern DenseGroupStateDefaultTypeInternal _DenseGroupState_default_instance_;
 class EnvironmentState;
 struct EnvironmentStateDefaultTypeInternal;
 extern EnvironmentStateDefaultTypeInternal _EnvironmentState_default_instance_;
@@ -77,16 +81,23 @@ extern InitialEnvironmentState_AgentStatesEntry_DoNotUseDefaultTypeInternal _Ini
 class InitialTrainingState;
 struct InitialTrainingStateDefaultTypeInternal;
 extern InitialTrainingStateDefaultTypeInternal _InitialTrainingState_default_instance_;
+class InitialTrainingState_EnvStepsEntry_DoNotUse;
+struct InitialTrainingState_EnvStepsEntry_DoNotUseDefaultTypeInternal;
+extern InitialTrainingState_EnvStepsEntry_DoNotUseDefaultTypeInternal _InitialTrainingState_EnvStepsEntry_DoNotUse_default_instance_;
 class InitialTrainingState_EnvironmentStatesEntry_DoNotUse;
 struct InitialTrainingState_EnvironmentStatesEntry_DoNotUseDefaultTypeInternal;
 extern InitialTrainingState_EnvironmentStatesEntry_DoNotUseDefaultTypeInternal _InitialTrainingState_EnvironmentStatesEntry_DoNotUse_default_instance_;
 class TrainingState;
 struct TrainingStateDefaultTypeInternal;
 extern TrainingStateDefaultTypeInternal _TrainingState_default_instance_;
+class TrainingState_EnvStepsEntry_DoNotUse;
+struct TrainingState_EnvStepsEntry_DoNotUseDefaultTypeInternal;
+extern TrainingState_EnvStepsEntry_DoNotUseDefaultTypeInternal _TrainingState_EnvStepsEntry_DoNotUse_default_instance_;
 }  // namespace Schola
 PROTOBUF_NAMESPACE_OPEN
 template<> ::Schola::AgentState* Arena::CreateMaybeMessage<::Schola::AgentState>(Arena*);
 template<> ::Schola::AgentState_InfoEntry_DoNotUse* Arena::CreateMaybeMessage<::Schola::AgentState_InfoEntry_DoNotUse>(Arena*);
+template<> ::Schola::DenseGroupState* Arena::CreateMaybeMessage<::Schola::DenseGroupState>(Arena*);
 template<> ::Schola::EnvironmentState* Arena::CreateMaybeMessage<::Schola::EnvironmentState>(Arena*);
 template<> ::Schola::EnvironmentState_AgentStatesEntry_DoNotUse* Arena::CreateMaybeMessage<::Schola::EnvironmentState_AgentStatesEntry_DoNotUse>(Arena*);
 template<> ::Schola::InitialAgentState* Arena::CreateMaybeMessage<::Schola::InitialAgentState>(Arena*);
@@ -94,8 +105,10 @@ template<> ::Schola::InitialAgentState_InfoEntry_DoNotUse* Arena::CreateMaybeMes
 template<> ::Schola::InitialEnvironmentState* Arena::CreateMaybeMessage<::Schola::InitialEnvironmentState>(Arena*);
 template<> ::Schola::InitialEnvironmentState_AgentStatesEntry_DoNotUse* Arena::CreateMaybeMessage<::Schola::InitialEnvironmentState_AgentStatesEntry_DoNotUse>(Arena*);
 template<> ::Schola::InitialTrainingState* Arena::CreateMaybeMessage<::Schola::InitialTrainingState>(Arena*);
+template<> ::Schola::InitialTrainingState_EnvStepsEntry_DoNotUse* Arena::CreateMaybeMessage<::Schola::InitialTrainingState_EnvStepsEntry_DoNotUse>(Arena*);
 template<> ::Schola::InitialTrainingState_EnvironmentStatesEntry_DoNotUse* Arena::CreateMaybeMessage<::Schola::InitialTrainingState_EnvironmentStatesEntry_DoNotUse>(Arena*);
 template<> ::Schola::TrainingState* Arena::CreateMaybeMessage<::Schola::TrainingState>(Arena*);
+template<> ::Schola::TrainingState_EnvStepsEntry_DoNotUse* Arena::CreateMaybeMessage<::Schola::TrainingState_EnvStepsEntry_DoNotUse>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace Schola {
 
@@ -547,6 +560,276 @@ class EnvironmentState final :
 };
 // -------------------------------------------------------------------
 
+class DenseGroupState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Schola.DenseGroupState) */ {
+ public:
+  inline DenseGroupState() : DenseGroupState(nullptr) {}
+  ~DenseGroupState() override;
+  explicit PROTOBUF_CONSTEXPR DenseGroupState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DenseGroupState(const DenseGroupState& from);
+  DenseGroupState(DenseGroupState&& from) noexcept
+    : DenseGroupState() {
+    *this = ::std::move(from);
+  }
+
+  inline DenseGroupState& operator=(const DenseGroupState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DenseGroupState& operator=(DenseGroupState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DenseGroupState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DenseGroupState* internal_default_instance() {
+    return reinterpret_cast<const DenseGroupState*>(
+               &_DenseGroupState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(DenseGroupState& a, DenseGroupState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DenseGroupState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DenseGroupState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DenseGroupState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DenseGroupState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DenseGroupState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DenseGroupState& from) {
+    DenseGroupState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DenseGroupState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Schola.DenseGroupState";
+  }
+  protected:
+  explicit DenseGroupState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEnvIdsFieldNumber = 2,
+    kAgentIdsFieldNumber = 3,
+    kObservationsFieldNumber = 4,
+    kRewardsFieldNumber = 5,
+    kStatusesFieldNumber = 6,
+    kGroupIdFieldNumber = 1,
+  };
+  // repeated int32 env_ids = 2;
+  int env_ids_size() const;
+  private:
+  int _internal_env_ids_size() const;
+  public:
+  void clear_env_ids();
+  private:
+  int32_t _internal_env_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_env_ids() const;
+  void _internal_add_env_ids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_env_ids();
+  public:
+  int32_t env_ids(int index) const;
+  void set_env_ids(int index, int32_t value);
+  void add_env_ids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      env_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_env_ids();
+
+  // repeated int32 agent_ids = 3;
+  int agent_ids_size() const;
+  private:
+  int _internal_agent_ids_size() const;
+  public:
+  void clear_agent_ids();
+  private:
+  int32_t _internal_agent_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_agent_ids() const;
+  void _internal_add_agent_ids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_agent_ids();
+  public:
+  int32_t agent_ids(int index) const;
+  void set_agent_ids(int index, int32_t value);
+  void add_agent_ids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      agent_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_agent_ids();
+
+  // bytes observations = 4;
+  void clear_observations();
+  const std::string& observations() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_observations(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_observations();
+  PROTOBUF_NODISCARD std::string* release_observations();
+  void set_allocated_observations(std::string* observations);
+  private:
+  const std::string& _internal_observations() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_observations(const std::string& value);
+  std::string* _internal_mutable_observations();
+  public:
+
+  // bytes rewards = 5;
+  void clear_rewards();
+  const std::string& rewards() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rewards(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rewards();
+  PROTOBUF_NODISCARD std::string* release_rewards();
+  void set_allocated_rewards(std::string* rewards);
+  private:
+  const std::string& _internal_rewards() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rewards(const std::string& value);
+  std::string* _internal_mutable_rewards();
+  public:
+
+  // bytes statuses = 6;
+  void clear_statuses();
+  const std::string& statuses() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_statuses(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_statuses();
+  PROTOBUF_NODISCARD std::string* release_statuses();
+  void set_allocated_statuses(std::string* statuses);
+  private:
+  const std::string& _internal_statuses() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_statuses(const std::string& value);
+  std::string* _internal_mutable_statuses();
+  public:
+
+  // int32 group_id = 1;
+  void clear_group_id();
+  int32_t group_id() const;
+  void set_group_id(int32_t value);
+  private:
+  int32_t _internal_group_id() const;
+  void _internal_set_group_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Schola.DenseGroupState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > env_ids_;
+    mutable std::atomic<int> _env_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > agent_ids_;
+    mutable std::atomic<int> _agent_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr observations_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rewards_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr statuses_;
+    int32_t group_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_State_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TrainingState_EnvStepsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TrainingState_EnvStepsEntry_DoNotUse, 
+    int32_t, int32_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<TrainingState_EnvStepsEntry_DoNotUse, 
+    int32_t, int32_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> SuperType;
+  TrainingState_EnvStepsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR TrainingState_EnvStepsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit TrainingState_EnvStepsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const TrainingState_EnvStepsEntry_DoNotUse& other);
+  static const TrainingState_EnvStepsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const TrainingState_EnvStepsEntry_DoNotUse*>(&_TrainingState_EnvStepsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_State_2eproto;
+};
+
+// -------------------------------------------------------------------
+
 class TrainingState final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Schola.TrainingState) */ {
  public:
@@ -595,7 +878,7 @@ class TrainingState final :
                &_TrainingState_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    6;
 
   friend void swap(TrainingState& a, TrainingState& b) {
     a.Swap(&b);
@@ -656,6 +939,8 @@ class TrainingState final :
   protected:
   explicit TrainingState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
   public:
 
   static const ClassData _class_data_;
@@ -665,10 +950,15 @@ class TrainingState final :
 
   // nested types ----------------------------------------------------
 
+
   // accessors -------------------------------------------------------
 
   enum : int {
     kEnvironmentStatesFieldNumber = 1,
+    kDenseGroupsFieldNumber = 2,
+    kEnvStepsFieldNumber = 4,
+    kResetStateFieldNumber = 3,
+    kMembershipFieldNumber = 5,
   };
   // repeated .Schola.EnvironmentState environment_states = 1;
   int environment_states_size() const;
@@ -688,6 +978,77 @@ class TrainingState final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::EnvironmentState >&
       environment_states() const;
 
+  // repeated .Schola.DenseGroupState dense_groups = 2;
+  int dense_groups_size() const;
+  private:
+  int _internal_dense_groups_size() const;
+  public:
+  void clear_dense_groups();
+  ::Schola::DenseGroupState* mutable_dense_groups(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupState >*
+      mutable_dense_groups();
+  private:
+  const ::Schola::DenseGroupState& _internal_dense_groups(int index) const;
+  ::Schola::DenseGroupState* _internal_add_dense_groups();
+  public:
+  const ::Schola::DenseGroupState& dense_groups(int index) const;
+  ::Schola::DenseGroupState* add_dense_groups();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupState >&
+      dense_groups() const;
+
+  // map<int32, int32> env_steps = 4;
+  int env_steps_size() const;
+  private:
+  int _internal_env_steps_size() const;
+  public:
+  void clear_env_steps();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >&
+      _internal_env_steps() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >*
+      _internal_mutable_env_steps();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >&
+      env_steps() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >*
+      mutable_env_steps();
+
+  // .Schola.InitialTrainingState reset_state = 3;
+  bool has_reset_state() const;
+  private:
+  bool _internal_has_reset_state() const;
+  public:
+  void clear_reset_state();
+  const ::Schola::InitialTrainingState& reset_state() const;
+  PROTOBUF_NODISCARD ::Schola::InitialTrainingState* release_reset_state();
+  ::Schola::InitialTrainingState* mutable_reset_state();
+  void set_allocated_reset_state(::Schola::InitialTrainingState* reset_state);
+  private:
+  const ::Schola::InitialTrainingState& _internal_reset_state() const;
+  ::Schola::InitialTrainingState* _internal_mutable_reset_state();
+  public:
+  void unsafe_arena_set_allocated_reset_state(
+      ::Schola::InitialTrainingState* reset_state);
+  ::Schola::InitialTrainingState* unsafe_arena_release_reset_state();
+
+  // .Schola.MembershipUpdate membership = 5;
+  bool has_membership() const;
+  private:
+  bool _internal_has_membership() const;
+  public:
+  void clear_membership();
+  const ::Schola::MembershipUpdate& membership() const;
+  PROTOBUF_NODISCARD ::Schola::MembershipUpdate* release_membership();
+  ::Schola::MembershipUpdate* mutable_membership();
+  void set_allocated_membership(::Schola::MembershipUpdate* membership);
+  private:
+  const ::Schola::MembershipUpdate& _internal_membership() const;
+  ::Schola::MembershipUpdate* _internal_mutable_membership();
+  public:
+  void unsafe_arena_set_allocated_membership(
+      ::Schola::MembershipUpdate* membership);
+  ::Schola::MembershipUpdate* unsafe_arena_release_membership();
+
   // @@protoc_insertion_point(class_scope:Schola.TrainingState)
  private:
   class _Internal;
@@ -697,6 +1058,14 @@ class TrainingState final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::EnvironmentState > environment_states_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupState > dense_groups_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        TrainingState_EnvStepsEntry_DoNotUse,
+        int32_t, int32_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> env_steps_;
+    ::Schola::InitialTrainingState* reset_state_;
+    ::Schola::MembershipUpdate* membership_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -780,7 +1149,7 @@ class InitialAgentState final :
                &_InitialAgentState_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    8;
 
   friend void swap(InitialAgentState& a, InitialAgentState& b) {
     a.Swap(&b);
@@ -987,7 +1356,7 @@ class InitialEnvironmentState final :
                &_InitialEnvironmentState_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    10;
 
   friend void swap(InitialEnvironmentState& a, InitialEnvironmentState& b) {
     a.Swap(&b);
@@ -1126,6 +1495,30 @@ public:
 
 // -------------------------------------------------------------------
 
+class InitialTrainingState_EnvStepsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<InitialTrainingState_EnvStepsEntry_DoNotUse, 
+    int32_t, int32_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<InitialTrainingState_EnvStepsEntry_DoNotUse, 
+    int32_t, int32_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> SuperType;
+  InitialTrainingState_EnvStepsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR InitialTrainingState_EnvStepsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit InitialTrainingState_EnvStepsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const InitialTrainingState_EnvStepsEntry_DoNotUse& other);
+  static const InitialTrainingState_EnvStepsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const InitialTrainingState_EnvStepsEntry_DoNotUse*>(&_InitialTrainingState_EnvStepsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_State_2eproto;
+};
+
+// -------------------------------------------------------------------
+
 class InitialTrainingState final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Schola.InitialTrainingState) */ {
  public:
@@ -1174,7 +1567,7 @@ class InitialTrainingState final :
                &_InitialTrainingState_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    13;
 
   friend void swap(InitialTrainingState& a, InitialTrainingState& b) {
     a.Swap(&b);
@@ -1251,6 +1644,8 @@ class InitialTrainingState final :
 
   enum : int {
     kEnvironmentStatesFieldNumber = 1,
+    kEnvStepsFieldNumber = 2,
+    kMembershipFieldNumber = 3,
   };
   // map<int32, .Schola.InitialEnvironmentState> environment_states = 1;
   int environment_states_size() const;
@@ -1269,6 +1664,41 @@ class InitialTrainingState final :
   ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::Schola::InitialEnvironmentState >*
       mutable_environment_states();
 
+  // map<int32, int32> env_steps = 2;
+  int env_steps_size() const;
+  private:
+  int _internal_env_steps_size() const;
+  public:
+  void clear_env_steps();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >&
+      _internal_env_steps() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >*
+      _internal_mutable_env_steps();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >&
+      env_steps() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >*
+      mutable_env_steps();
+
+  // .Schola.MembershipUpdate membership = 3;
+  bool has_membership() const;
+  private:
+  bool _internal_has_membership() const;
+  public:
+  void clear_membership();
+  const ::Schola::MembershipUpdate& membership() const;
+  PROTOBUF_NODISCARD ::Schola::MembershipUpdate* release_membership();
+  ::Schola::MembershipUpdate* mutable_membership();
+  void set_allocated_membership(::Schola::MembershipUpdate* membership);
+  private:
+  const ::Schola::MembershipUpdate& _internal_membership() const;
+  ::Schola::MembershipUpdate* _internal_mutable_membership();
+  public:
+  void unsafe_arena_set_allocated_membership(
+      ::Schola::MembershipUpdate* membership);
+  ::Schola::MembershipUpdate* unsafe_arena_release_membership();
+
   // @@protoc_insertion_point(class_scope:Schola.InitialTrainingState)
  private:
   class _Internal;
@@ -1282,6 +1712,12 @@ class InitialTrainingState final :
         int32_t, ::Schola::InitialEnvironmentState,
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> environment_states_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        InitialTrainingState_EnvStepsEntry_DoNotUse,
+        int32_t, int32_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32> env_steps_;
+    ::Schola::MembershipUpdate* membership_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1491,6 +1927,276 @@ EnvironmentState::mutable_agent_states() {
 
 // -------------------------------------------------------------------
 
+// DenseGroupState
+
+// int32 group_id = 1;
+inline void DenseGroupState::clear_group_id() {
+  _impl_.group_id_ = 0;
+}
+inline int32_t DenseGroupState::_internal_group_id() const {
+  return _impl_.group_id_;
+}
+inline int32_t DenseGroupState::group_id() const {
+  // @@protoc_insertion_point(field_get:Schola.DenseGroupState.group_id)
+  return _internal_group_id();
+}
+inline void DenseGroupState::_internal_set_group_id(int32_t value) {
+  
+  _impl_.group_id_ = value;
+}
+inline void DenseGroupState::set_group_id(int32_t value) {
+  _internal_set_group_id(value);
+  // @@protoc_insertion_point(field_set:Schola.DenseGroupState.group_id)
+}
+
+// repeated int32 env_ids = 2;
+inline int DenseGroupState::_internal_env_ids_size() const {
+  return _impl_.env_ids_.size();
+}
+inline int DenseGroupState::env_ids_size() const {
+  return _internal_env_ids_size();
+}
+inline void DenseGroupState::clear_env_ids() {
+  _impl_.env_ids_.Clear();
+}
+inline int32_t DenseGroupState::_internal_env_ids(int index) const {
+  return _impl_.env_ids_.Get(index);
+}
+inline int32_t DenseGroupState::env_ids(int index) const {
+  // @@protoc_insertion_point(field_get:Schola.DenseGroupState.env_ids)
+  return _internal_env_ids(index);
+}
+inline void DenseGroupState::set_env_ids(int index, int32_t value) {
+  _impl_.env_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Schola.DenseGroupState.env_ids)
+}
+inline void DenseGroupState::_internal_add_env_ids(int32_t value) {
+  _impl_.env_ids_.Add(value);
+}
+inline void DenseGroupState::add_env_ids(int32_t value) {
+  _internal_add_env_ids(value);
+  // @@protoc_insertion_point(field_add:Schola.DenseGroupState.env_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+DenseGroupState::_internal_env_ids() const {
+  return _impl_.env_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+DenseGroupState::env_ids() const {
+  // @@protoc_insertion_point(field_list:Schola.DenseGroupState.env_ids)
+  return _internal_env_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+DenseGroupState::_internal_mutable_env_ids() {
+  return &_impl_.env_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+DenseGroupState::mutable_env_ids() {
+  // @@protoc_insertion_point(field_mutable_list:Schola.DenseGroupState.env_ids)
+  return _internal_mutable_env_ids();
+}
+
+// repeated int32 agent_ids = 3;
+inline int DenseGroupState::_internal_agent_ids_size() const {
+  return _impl_.agent_ids_.size();
+}
+inline int DenseGroupState::agent_ids_size() const {
+  return _internal_agent_ids_size();
+}
+inline void DenseGroupState::clear_agent_ids() {
+  _impl_.agent_ids_.Clear();
+}
+inline int32_t DenseGroupState::_internal_agent_ids(int index) const {
+  return _impl_.agent_ids_.Get(index);
+}
+inline int32_t DenseGroupState::agent_ids(int index) const {
+  // @@protoc_insertion_point(field_get:Schola.DenseGroupState.agent_ids)
+  return _internal_agent_ids(index);
+}
+inline void DenseGroupState::set_agent_ids(int index, int32_t value) {
+  _impl_.agent_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Schola.DenseGroupState.agent_ids)
+}
+inline void DenseGroupState::_internal_add_agent_ids(int32_t value) {
+  _impl_.agent_ids_.Add(value);
+}
+inline void DenseGroupState::add_agent_ids(int32_t value) {
+  _internal_add_agent_ids(value);
+  // @@protoc_insertion_point(field_add:Schola.DenseGroupState.agent_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+DenseGroupState::_internal_agent_ids() const {
+  return _impl_.agent_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+DenseGroupState::agent_ids() const {
+  // @@protoc_insertion_point(field_list:Schola.DenseGroupState.agent_ids)
+  return _internal_agent_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+DenseGroupState::_internal_mutable_agent_ids() {
+  return &_impl_.agent_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+DenseGroupState::mutable_agent_ids() {
+  // @@protoc_insertion_point(field_mutable_list:Schola.DenseGroupState.agent_ids)
+  return _internal_mutable_agent_ids();
+}
+
+// bytes observations = 4;
+inline void DenseGroupState::clear_observations() {
+  _impl_.observations_.ClearToEmpty();
+}
+inline const std::string& DenseGroupState::observations() const {
+  // @@protoc_insertion_point(field_get:Schola.DenseGroupState.observations)
+  return _internal_observations();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DenseGroupState::set_observations(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.observations_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Schola.DenseGroupState.observations)
+}
+inline std::string* DenseGroupState::mutable_observations() {
+  std::string* _s = _internal_mutable_observations();
+  // @@protoc_insertion_point(field_mutable:Schola.DenseGroupState.observations)
+  return _s;
+}
+inline const std::string& DenseGroupState::_internal_observations() const {
+  return _impl_.observations_.Get();
+}
+inline void DenseGroupState::_internal_set_observations(const std::string& value) {
+  
+  _impl_.observations_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DenseGroupState::_internal_mutable_observations() {
+  
+  return _impl_.observations_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DenseGroupState::release_observations() {
+  // @@protoc_insertion_point(field_release:Schola.DenseGroupState.observations)
+  return _impl_.observations_.Release();
+}
+inline void DenseGroupState::set_allocated_observations(std::string* observations) {
+  if (observations != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.observations_.SetAllocated(observations, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.observations_.IsDefault()) {
+    _impl_.observations_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Schola.DenseGroupState.observations)
+}
+
+// bytes rewards = 5;
+inline void DenseGroupState::clear_rewards() {
+  _impl_.rewards_.ClearToEmpty();
+}
+inline const std::string& DenseGroupState::rewards() const {
+  // @@protoc_insertion_point(field_get:Schola.DenseGroupState.rewards)
+  return _internal_rewards();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DenseGroupState::set_rewards(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rewards_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Schola.DenseGroupState.rewards)
+}
+inline std::string* DenseGroupState::mutable_rewards() {
+  std::string* _s = _internal_mutable_rewards();
+  // @@protoc_insertion_point(field_mutable:Schola.DenseGroupState.rewards)
+  return _s;
+}
+inline const std::string& DenseGroupState::_internal_rewards() const {
+  return _impl_.rewards_.Get();
+}
+inline void DenseGroupState::_internal_set_rewards(const std::string& value) {
+  
+  _impl_.rewards_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DenseGroupState::_internal_mutable_rewards() {
+  
+  return _impl_.rewards_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DenseGroupState::release_rewards() {
+  // @@protoc_insertion_point(field_release:Schola.DenseGroupState.rewards)
+  return _impl_.rewards_.Release();
+}
+inline void DenseGroupState::set_allocated_rewards(std::string* rewards) {
+  if (rewards != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rewards_.SetAllocated(rewards, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rewards_.IsDefault()) {
+    _impl_.rewards_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Schola.DenseGroupState.rewards)
+}
+
+// bytes statuses = 6;
+inline void DenseGroupState::clear_statuses() {
+  _impl_.statuses_.ClearToEmpty();
+}
+inline const std::string& DenseGroupState::statuses() const {
+  // @@protoc_insertion_point(field_get:Schola.DenseGroupState.statuses)
+  return _internal_statuses();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DenseGroupState::set_statuses(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.statuses_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Schola.DenseGroupState.statuses)
+}
+inline std::string* DenseGroupState::mutable_statuses() {
+  std::string* _s = _internal_mutable_statuses();
+  // @@protoc_insertion_point(field_mutable:Schola.DenseGroupState.statuses)
+  return _s;
+}
+inline const std::string& DenseGroupState::_internal_statuses() const {
+  return _impl_.statuses_.Get();
+}
+inline void DenseGroupState::_internal_set_statuses(const std::string& value) {
+  
+  _impl_.statuses_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DenseGroupState::_internal_mutable_statuses() {
+  
+  return _impl_.statuses_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DenseGroupState::release_statuses() {
+  // @@protoc_insertion_point(field_release:Schola.DenseGroupState.statuses)
+  return _impl_.statuses_.Release();
+}
+inline void DenseGroupState::set_allocated_statuses(std::string* statuses) {
+  if (statuses != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.statuses_.SetAllocated(statuses, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.statuses_.IsDefault()) {
+    _impl_.statuses_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Schola.DenseGroupState.statuses)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 // TrainingState
 
 // repeated .Schola.EnvironmentState environment_states = 1;
@@ -1533,6 +2239,250 @@ TrainingState::environment_states() const {
   return _impl_.environment_states_;
 }
 
+// repeated .Schola.DenseGroupState dense_groups = 2;
+inline int TrainingState::_internal_dense_groups_size() const {
+  return _impl_.dense_groups_.size();
+}
+inline int TrainingState::dense_groups_size() const {
+  return _internal_dense_groups_size();
+}
+inline void TrainingState::clear_dense_groups() {
+  _impl_.dense_groups_.Clear();
+}
+inline ::Schola::DenseGroupState* TrainingState::mutable_dense_groups(int index) {
+  // @@protoc_insertion_point(field_mutable:Schola.TrainingState.dense_groups)
+  return _impl_.dense_groups_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupState >*
+TrainingState::mutable_dense_groups() {
+  // @@protoc_insertion_point(field_mutable_list:Schola.TrainingState.dense_groups)
+  return &_impl_.dense_groups_;
+}
+inline const ::Schola::DenseGroupState& TrainingState::_internal_dense_groups(int index) const {
+  return _impl_.dense_groups_.Get(index);
+}
+inline const ::Schola::DenseGroupState& TrainingState::dense_groups(int index) const {
+  // @@protoc_insertion_point(field_get:Schola.TrainingState.dense_groups)
+  return _internal_dense_groups(index);
+}
+inline ::Schola::DenseGroupState* TrainingState::_internal_add_dense_groups() {
+  return _impl_.dense_groups_.Add();
+}
+inline ::Schola::DenseGroupState* TrainingState::add_dense_groups() {
+  ::Schola::DenseGroupState* _add = _internal_add_dense_groups();
+  // @@protoc_insertion_point(field_add:Schola.TrainingState.dense_groups)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Schola::DenseGroupState >&
+TrainingState::dense_groups() const {
+  // @@protoc_insertion_point(field_list:Schola.TrainingState.dense_groups)
+  return _impl_.dense_groups_;
+}
+
+// .Schola.InitialTrainingState reset_state = 3;
+inline bool TrainingState::_internal_has_reset_state() const {
+  return this != internal_default_instance() && _impl_.reset_state_ != nullptr;
+}
+inline bool TrainingState::has_reset_state() const {
+  return _internal_has_reset_state();
+}
+inline void TrainingState::clear_reset_state() {
+  if (GetArenaForAllocation() == nullptr && _impl_.reset_state_ != nullptr) {
+    delete _impl_.reset_state_;
+  }
+  _impl_.reset_state_ = nullptr;
+}
+inline const ::Schola::InitialTrainingState& TrainingState::_internal_reset_state() const {
+  const ::Schola::InitialTrainingState* p = _impl_.reset_state_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Schola::InitialTrainingState&>(
+      ::Schola::_InitialTrainingState_default_instance_);
+}
+inline const ::Schola::InitialTrainingState& TrainingState::reset_state() const {
+  // @@protoc_insertion_point(field_get:Schola.TrainingState.reset_state)
+  return _internal_reset_state();
+}
+inline void TrainingState::unsafe_arena_set_allocated_reset_state(
+    ::Schola::InitialTrainingState* reset_state) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.reset_state_);
+  }
+  _impl_.reset_state_ = reset_state;
+  if (reset_state) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Schola.TrainingState.reset_state)
+}
+inline ::Schola::InitialTrainingState* TrainingState::release_reset_state() {
+  
+  ::Schola::InitialTrainingState* temp = _impl_.reset_state_;
+  _impl_.reset_state_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Schola::InitialTrainingState* TrainingState::unsafe_arena_release_reset_state() {
+  // @@protoc_insertion_point(field_release:Schola.TrainingState.reset_state)
+  
+  ::Schola::InitialTrainingState* temp = _impl_.reset_state_;
+  _impl_.reset_state_ = nullptr;
+  return temp;
+}
+inline ::Schola::InitialTrainingState* TrainingState::_internal_mutable_reset_state() {
+  
+  if (_impl_.reset_state_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Schola::InitialTrainingState>(GetArenaForAllocation());
+    _impl_.reset_state_ = p;
+  }
+  return _impl_.reset_state_;
+}
+inline ::Schola::InitialTrainingState* TrainingState::mutable_reset_state() {
+  ::Schola::InitialTrainingState* _msg = _internal_mutable_reset_state();
+  // @@protoc_insertion_point(field_mutable:Schola.TrainingState.reset_state)
+  return _msg;
+}
+inline void TrainingState::set_allocated_reset_state(::Schola::InitialTrainingState* reset_state) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.reset_state_;
+  }
+  if (reset_state) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reset_state);
+    if (message_arena != submessage_arena) {
+      reset_state = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reset_state, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.reset_state_ = reset_state;
+  // @@protoc_insertion_point(field_set_allocated:Schola.TrainingState.reset_state)
+}
+
+// map<int32, int32> env_steps = 4;
+inline int TrainingState::_internal_env_steps_size() const {
+  return _impl_.env_steps_.size();
+}
+inline int TrainingState::env_steps_size() const {
+  return _internal_env_steps_size();
+}
+inline void TrainingState::clear_env_steps() {
+  _impl_.env_steps_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >&
+TrainingState::_internal_env_steps() const {
+  return _impl_.env_steps_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >&
+TrainingState::env_steps() const {
+  // @@protoc_insertion_point(field_map:Schola.TrainingState.env_steps)
+  return _internal_env_steps();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >*
+TrainingState::_internal_mutable_env_steps() {
+  return _impl_.env_steps_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >*
+TrainingState::mutable_env_steps() {
+  // @@protoc_insertion_point(field_mutable_map:Schola.TrainingState.env_steps)
+  return _internal_mutable_env_steps();
+}
+
+// .Schola.MembershipUpdate membership = 5;
+inline bool TrainingState::_internal_has_membership() const {
+  return this != internal_default_instance() && _impl_.membership_ != nullptr;
+}
+inline bool TrainingState::has_membership() const {
+  return _internal_has_membership();
+}
+inline const ::Schola::MembershipUpdate& TrainingState::_internal_membership() const {
+  const ::Schola::MembershipUpdate* p = _impl_.membership_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Schola::MembershipUpdate&>(
+      ::Schola::_MembershipUpdate_default_instance_);
+}
+inline const ::Schola::MembershipUpdate& TrainingState::membership() const {
+  // @@protoc_insertion_point(field_get:Schola.TrainingState.membership)
+  return _internal_membership();
+}
+inline void TrainingState::unsafe_arena_set_allocated_membership(
+    ::Schola::MembershipUpdate* membership) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.membership_);
+  }
+  _impl_.membership_ = membership;
+  if (membership) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Schola.TrainingState.membership)
+}
+inline ::Schola::MembershipUpdate* TrainingState::release_membership() {
+  
+  ::Schola::MembershipUpdate* temp = _impl_.membership_;
+  _impl_.membership_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Schola::MembershipUpdate* TrainingState::unsafe_arena_release_membership() {
+  // @@protoc_insertion_point(field_release:Schola.TrainingState.membership)
+  
+  ::Schola::MembershipUpdate* temp = _impl_.membership_;
+  _impl_.membership_ = nullptr;
+  return temp;
+}
+inline ::Schola::MembershipUpdate* TrainingState::_internal_mutable_membership() {
+  
+  if (_impl_.membership_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Schola::MembershipUpdate>(GetArenaForAllocation());
+    _impl_.membership_ = p;
+  }
+  return _impl_.membership_;
+}
+inline ::Schola::MembershipUpdate* TrainingState::mutable_membership() {
+  ::Schola::MembershipUpdate* _msg = _internal_mutable_membership();
+  // @@protoc_insertion_point(field_mutable:Schola.TrainingState.membership)
+  return _msg;
+}
+inline void TrainingState::set_allocated_membership(::Schola::MembershipUpdate* membership) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.membership_);
+  }
+  if (membership) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(membership));
+    if (message_arena != submessage_arena) {
+      membership = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, membership, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.membership_ = membership;
+  // @@protoc_insertion_point(field_set_allocated:Schola.TrainingState.membership)
+}
+
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
@@ -1692,6 +2642,8 @@ InitialEnvironmentState::mutable_agent_states() {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 // InitialTrainingState
 
 // map<int32, .Schola.InitialEnvironmentState> environment_states = 1;
@@ -1723,6 +2675,120 @@ InitialTrainingState::mutable_environment_states() {
   return _internal_mutable_environment_states();
 }
 
+// map<int32, int32> env_steps = 2;
+inline int InitialTrainingState::_internal_env_steps_size() const {
+  return _impl_.env_steps_.size();
+}
+inline int InitialTrainingState::env_steps_size() const {
+  return _internal_env_steps_size();
+}
+inline void InitialTrainingState::clear_env_steps() {
+  _impl_.env_steps_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >&
+InitialTrainingState::_internal_env_steps() const {
+  return _impl_.env_steps_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >&
+InitialTrainingState::env_steps() const {
+  // @@protoc_insertion_point(field_map:Schola.InitialTrainingState.env_steps)
+  return _internal_env_steps();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >*
+InitialTrainingState::_internal_mutable_env_steps() {
+  return _impl_.env_steps_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< int32_t, int32_t >*
+InitialTrainingState::mutable_env_steps() {
+  // @@protoc_insertion_point(field_mutable_map:Schola.InitialTrainingState.env_steps)
+  return _internal_mutable_env_steps();
+}
+
+// .Schola.MembershipUpdate membership = 3;
+inline bool InitialTrainingState::_internal_has_membership() const {
+  return this != internal_default_instance() && _impl_.membership_ != nullptr;
+}
+inline bool InitialTrainingState::has_membership() const {
+  return _internal_has_membership();
+}
+inline const ::Schola::MembershipUpdate& InitialTrainingState::_internal_membership() const {
+  const ::Schola::MembershipUpdate* p = _impl_.membership_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Schola::MembershipUpdate&>(
+      ::Schola::_MembershipUpdate_default_instance_);
+}
+inline const ::Schola::MembershipUpdate& InitialTrainingState::membership() const {
+  // @@protoc_insertion_point(field_get:Schola.InitialTrainingState.membership)
+  return _internal_membership();
+}
+inline void InitialTrainingState::unsafe_arena_set_allocated_membership(
+    ::Schola::MembershipUpdate* membership) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.membership_);
+  }
+  _impl_.membership_ = membership;
+  if (membership) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Schola.InitialTrainingState.membership)
+}
+inline ::Schola::MembershipUpdate* InitialTrainingState::release_membership() {
+  
+  ::Schola::MembershipUpdate* temp = _impl_.membership_;
+  _impl_.membership_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Schola::MembershipUpdate* InitialTrainingState::unsafe_arena_release_membership() {
+  // @@protoc_insertion_point(field_release:Schola.InitialTrainingState.membership)
+  
+  ::Schola::MembershipUpdate* temp = _impl_.membership_;
+  _impl_.membership_ = nullptr;
+  return temp;
+}
+inline ::Schola::MembershipUpdate* InitialTrainingState::_internal_mutable_membership() {
+  
+  if (_impl_.membership_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Schola::MembershipUpdate>(GetArenaForAllocation());
+    _impl_.membership_ = p;
+  }
+  return _impl_.membership_;
+}
+inline ::Schola::MembershipUpdate* InitialTrainingState::mutable_membership() {
+  ::Schola::MembershipUpdate* _msg = _internal_mutable_membership();
+  // @@protoc_insertion_point(field_mutable:Schola.InitialTrainingState.membership)
+  return _msg;
+}
+inline void InitialTrainingState::set_allocated_membership(::Schola::MembershipUpdate* membership) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.membership_);
+  }
+  if (membership) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(membership));
+    if (message_arena != submessage_arena) {
+      membership = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, membership, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.membership_ = membership;
+  // @@protoc_insertion_point(field_set_allocated:Schola.InitialTrainingState.membership)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -1746,6 +2812,12 @@ InitialTrainingState::mutable_environment_states() {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
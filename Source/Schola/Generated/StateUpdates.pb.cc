@@ -60,8 +60,26 @@ struct EnvironmentStepDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EnvironmentStepDefaultTypeInternal _EnvironmentStep_default_instance_;
+PROTOBUF_CONSTEXPR DenseGroupActions::DenseGroupActions(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.env_ids_)*/{}
+  , /*decltype(_impl_._env_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.agent_ids_)*/{}
+  , /*decltype(_impl_._agent_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.actions_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.group_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DenseGroupActionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DenseGroupActionsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DenseGroupActionsDefaultTypeInternal() {}
+  union {
+    DenseGroupActions _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DenseGroupActionsDefaultTypeInternal _DenseGroupActions_default_instance_;
 }  // namespace Schola
-static ::_pb::Metadata file_level_metadata_StateUpdates_2eproto[3];
+static ::_pb::Metadata file_level_metadata_StateUpdates_2eproto[4];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_StateUpdates_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_StateUpdates_2eproto = nullptr;
 
@@ -90,17 +108,29 @@ const uint32_t TableStruct_StateUpdates_2eproto::offsets[] PROTOBUF_SECTION_VARI
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::Schola::EnvironmentStep, _impl_.updates_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupActions, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupActions, _impl_.group_id_),
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupActions, _impl_.env_ids_),
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupActions, _impl_.agent_ids_),
+  PROTOBUF_FIELD_OFFSET(::Schola::DenseGroupActions, _impl_.actions_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::Schola::AgentStateUpdate)},
   { 7, 15, -1, sizeof(::Schola::EnvironmentStep_UpdatesEntry_DoNotUse)},
   { 17, -1, -1, sizeof(::Schola::EnvironmentStep)},
+  { 24, -1, -1, sizeof(::Schola::DenseGroupActions)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
   &::Schola::_AgentStateUpdate_default_instance_._instance,
   &::Schola::_EnvironmentStep_UpdatesEntry_DoNotUse_default_instance_._instance,
   &::Schola::_EnvironmentStep_default_instance_._instance,
+  &::Schola::_DenseGroupActions_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_StateUpdates_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -110,16 +140,18 @@ const char descriptor_table_protodef_StateUpdates_2eproto[] PROTOBUF_SECTION_VAR
   "\n\007updates\030\001 \003(\0132$.Schola.EnvironmentStep"
   ".UpdatesEntry\032H\n\014UpdatesEntry\022\013\n\003key\030\001 \001"
   "(\005\022\'\n\005value\030\002 \001(\0132\030.Schola.AgentStateUpd"
-  "ate:\0028\001b\006proto3"
+  "ate:\0028\001\"Z\n\021DenseGroupActions\022\020\n\010group_id"
+  "\030\001 \001(\005\022\017\n\007env_ids\030\002 \003(\005\022\021\n\tagent_ids\030\003 \003"
+  "(\005\022\017\n\007actions\030\004 \001(\014b\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_StateUpdates_2eproto_deps[1] = {
   &::descriptor_table_Points_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_StateUpdates_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_StateUpdates_2eproto = {
-    false, false, 255, descriptor_table_protodef_StateUpdates_2eproto,
+    false, false, 347, descriptor_table_protodef_StateUpdates_2eproto,
     "StateUpdates.proto",
-    &descriptor_table_StateUpdates_2eproto_once, descriptor_table_StateUpdates_2eproto_deps, 1, 3,
+    &descriptor_table_StateUpdates_2eproto_once, descriptor_table_StateUpdates_2eproto_deps, 1, 4,
     schemas, file_default_instances, TableStruct_StateUpdates_2eproto::offsets,
     file_level_metadata_StateUpdates_2eproto, file_level_enum_descriptors_StateUpdates_2eproto,
     file_level_service_descriptors_StateUpdates_2eproto,
@@ -551,6 +583,315 @@ void EnvironmentStep::InternalSwap(EnvironmentStep* other) {
       file_level_metadata_StateUpdates_2eproto[2]);
 }
 
+// ===================================================================
+
+class DenseGroupActions::_Internal {
+ public:
+};
+
+DenseGroupActions::DenseGroupActions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Schola.DenseGroupActions)
+}
+DenseGroupActions::DenseGroupActions(const DenseGroupActions& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DenseGroupActions* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.env_ids_){from._impl_.env_ids_}
+    , /*decltype(_impl_._env_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.agent_ids_){from._impl_.agent_ids_}
+    , /*decltype(_impl_._agent_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.actions_){}
+    , decltype(_impl_.group_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.actions_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.actions_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_actions().empty()) {
+    _this->_impl_.actions_.Set(from._internal_actions(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.group_id_ = from._impl_.group_id_;
+  // @@protoc_insertion_point(copy_constructor:Schola.DenseGroupActions)
+}
+
+inline void DenseGroupActions::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.env_ids_){arena}
+    , /*decltype(_impl_._env_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.agent_ids_){arena}
+    , /*decltype(_impl_._agent_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.actions_){}
+    , decltype(_impl_.group_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.actions_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.actions_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DenseGroupActions::~DenseGroupActions() {
+  // @@protoc_insertion_point(destructor:Schola.DenseGroupActions)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DenseGroupActions::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.env_ids_.~RepeatedField();
+  _impl_.agent_ids_.~RepeatedField();
+  _impl_.actions_.Destroy();
+}
+
+void DenseGroupActions::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DenseGroupActions::Clear() {
+// @@protoc_insertion_point(message_clear_start:Schola.DenseGroupActions)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.env_ids_.Clear();
+  _impl_.agent_ids_.Clear();
+  _impl_.actions_.ClearToEmpty();
+  _impl_.group_id_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DenseGroupActions::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 group_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.group_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 env_ids = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_env_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_env_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 agent_ids = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_agent_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_agent_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes actions = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_actions();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DenseGroupActions::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Schola.DenseGroupActions)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 group_id = 1;
+  if (this->_internal_group_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_group_id(), target);
+  }
+
+  // repeated int32 env_ids = 2;
+  {
+    int byte_size = _impl_._env_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          2, _internal_env_ids(), byte_size, target);
+    }
+  }
+
+  // repeated int32 agent_ids = 3;
+  {
+    int byte_size = _impl_._agent_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          3, _internal_agent_ids(), byte_size, target);
+    }
+  }
+
+  // bytes actions = 4;
+  if (!this->_internal_actions().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_actions(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:Schola.DenseGroupActions)
+  return target;
+}
+
+size_t DenseGroupActions::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Schola.DenseGroupActions)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 env_ids = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.env_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._env_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 agent_ids = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.agent_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._agent_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // bytes actions = 4;
+  if (!this->_internal_actions().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_actions());
+  }
+
+  // int32 group_id = 1;
+  if (this->_internal_group_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_group_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DenseGroupActions::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DenseGroupActions::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DenseGroupActions::GetClassData() const { return &_class_data_; }
+
+
+void DenseGroupActions::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DenseGroupActions*>(&to_msg);
+  auto& from = static_cast<const DenseGroupActions&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Schola.DenseGroupActions)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.env_ids_.MergeFrom(from._impl_.env_ids_);
+  _this->_impl_.agent_ids_.MergeFrom(from._impl_.agent_ids_);
+  if (!from._internal_actions().empty()) {
+    _this->_internal_set_actions(from._internal_actions());
+  }
+  if (from._internal_group_id() != 0) {
+    _this->_internal_set_group_id(from._internal_group_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DenseGroupActions::CopyFrom(const DenseGroupActions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Schola.DenseGroupActions)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DenseGroupActions::IsInitialized() const {
+  return true;
+}
+
+void DenseGroupActions::InternalSwap(DenseGroupActions* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.env_ids_.InternalSwap(&other->_impl_.env_ids_);
+  _impl_.agent_ids_.InternalSwap(&other->_impl_.agent_ids_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.actions_, lhs_arena,
+      &other->_impl_.actions_, rhs_arena
+  );
+  swap(_impl_.group_id_, other->_impl_.group_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DenseGroupActions::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_StateUpdates_2eproto_getter, &descriptor_table_StateUpdates_2eproto_once,
+      file_level_metadata_StateUpdates_2eproto[3]);
+}
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace Schola
 PROTOBUF_NAMESPACE_OPEN
@@ -566,6 +907,10 @@ template<> PROTOBUF_NOINLINE ::Schola::EnvironmentStep*
 Arena::CreateMaybeMessage< ::Schola::EnvironmentStep >(Arena* arena) {
   return Arena::CreateMessageInternal< ::Schola::EnvironmentStep >(arena);
 }
+template<> PROTOBUF_NOINLINE ::Schola::DenseGroupActions*
+Arena::CreateMaybeMessage< ::Schola::DenseGroupActions >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Schola::DenseGroupActions >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
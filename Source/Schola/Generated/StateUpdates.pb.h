@@ -52,6 +52,9 @@ namespace Schola {
 class AgentStateUpdate;
 struct AgentStateUpdateDefaultTypeInternal;
 extern AgentStateUpdateDefaultTypeInternal _AgentStateUpdate_default_instance_;
+class DenseGroupActions;
+struct DenseGroupActionsDefaultTypeInternal;
+extern DenseGroupActionsDefaultTypeInternal _DenseGroupActions_default_instance_;
 class EnvironmentStep;
 struct EnvironmentStepDefaultTypeInternal;
 extern EnvironmentStepDefaultTypeInternal _EnvironmentStep_default_instance_;
@@ -61,6 +64,7 @@ extern EnvironmentStep_UpdatesEntry_DoNotUseDefaultTypeInternal _EnvironmentStep
 }  // namespace Schola
 PROTOBUF_NAMESPACE_OPEN
 template<> ::Schola::AgentStateUpdate* Arena::CreateMaybeMessage<::Schola::AgentStateUpdate>(Arena*);
+template<> ::Schola::DenseGroupActions* Arena::CreateMaybeMessage<::Schola::DenseGroupActions>(Arena*);
 template<> ::Schola::EnvironmentStep* Arena::CreateMaybeMessage<::Schola::EnvironmentStep>(Arena*);
 template<> ::Schola::EnvironmentStep_UpdatesEntry_DoNotUse* Arena::CreateMaybeMessage<::Schola::EnvironmentStep_UpdatesEntry_DoNotUse>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
@@ -410,6 +414,220 @@ class EnvironmentStep final :
   union { Impl_ _impl_; };
   friend struct ::TableStruct_StateUpdates_2eproto;
 };
+// -------------------------------------------------------------------
+
+class DenseGroupActions final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Schola.DenseGroupActions) */ {
+ public:
+  inline DenseGroupActions() : DenseGroupActions(nullptr) {}
+  ~DenseGroupActions() override;
+  explicit PROTOBUF_CONSTEXPR DenseGroupActions(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DenseGroupActions(const DenseGroupActions& from);
+  DenseGroupActions(DenseGroupActions&& from) noexcept
+    : DenseGroupActions() {
+    *this = ::std::move(from);
+  }
+
+  inline DenseGroupActions& operator=(const DenseGroupActions& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DenseGroupActions& operator=(DenseGroupActions&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DenseGroupActions& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DenseGroupActions* internal_default_instance() {
+    return reinterpret_cast<const DenseGroupActions*>(
+               &_DenseGroupActions_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(DenseGroupActions& a, DenseGroupActions& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DenseGroupActions* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DenseGroupActions* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DenseGroupActions* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DenseGroupActions>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DenseGroupActions& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DenseGroupActions& from) {
+    DenseGroupActions::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DenseGroupActions* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Schola.DenseGroupActions";
+  }
+  protected:
+  explicit DenseGroupActions(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEnvIdsFieldNumber = 2,
+    kAgentIdsFieldNumber = 3,
+    kActionsFieldNumber = 4,
+    kGroupIdFieldNumber = 1,
+  };
+  // repeated int32 env_ids = 2;
+  int env_ids_size() const;
+  private:
+  int _internal_env_ids_size() const;
+  public:
+  void clear_env_ids();
+  private:
+  int32_t _internal_env_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_env_ids() const;
+  void _internal_add_env_ids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_env_ids();
+  public:
+  int32_t env_ids(int index) const;
+  void set_env_ids(int index, int32_t value);
+  void add_env_ids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      env_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_env_ids();
+
+  // repeated int32 agent_ids = 3;
+  int agent_ids_size() const;
+  private:
+  int _internal_agent_ids_size() const;
+  public:
+  void clear_agent_ids();
+  private:
+  int32_t _internal_agent_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_agent_ids() const;
+  void _internal_add_agent_ids(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_agent_ids();
+  public:
+  int32_t agent_ids(int index) const;
+  void set_agent_ids(int index, int32_t value);
+  void add_agent_ids(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      agent_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_agent_ids();
+
+  // bytes actions = 4;
+  void clear_actions();
+  const std::string& actions() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_actions(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_actions();
+  PROTOBUF_NODISCARD std::string* release_actions();
+  void set_allocated_actions(std::string* actions);
+  private:
+  const std::string& _internal_actions() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_actions(const std::string& value);
+  std::string* _internal_mutable_actions();
+  public:
+
+  // int32 group_id = 1;
+  void clear_group_id();
+  int32_t group_id() const;
+  void set_group_id(int32_t value);
+  private:
+  int32_t _internal_group_id() const;
+  void _internal_set_group_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Schola.DenseGroupActions)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > env_ids_;
+    mutable std::atomic<int> _env_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > agent_ids_;
+    mutable std::atomic<int> _agent_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr actions_;
+    int32_t group_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_StateUpdates_2eproto;
+};
 // ===================================================================
 
 
@@ -541,6 +759,174 @@ EnvironmentStep::mutable_updates() {
   return _internal_mutable_updates();
 }
 
+// -------------------------------------------------------------------
+
+// DenseGroupActions
+
+// int32 group_id = 1;
+inline void DenseGroupActions::clear_group_id() {
+  _impl_.group_id_ = 0;
+}
+inline int32_t DenseGroupActions::_internal_group_id() const {
+  return _impl_.group_id_;
+}
+inline int32_t DenseGroupActions::group_id() const {
+  // @@protoc_insertion_point(field_get:Schola.DenseGroupActions.group_id)
+  return _internal_group_id();
+}
+inline void DenseGroupActions::_internal_set_group_id(int32_t value) {
+  
+  _impl_.group_id_ = value;
+}
+inline void DenseGroupActions::set_group_id(int32_t value) {
+  _internal_set_group_id(value);
+  // @@protoc_insertion_point(field_set:Schola.DenseGroupActions.group_id)
+}
+
+// repeated int32 env_ids = 2;
+inline int DenseGroupActions::_internal_env_ids_size() const {
+  return _impl_.env_ids_.size();
+}
+inline int DenseGroupActions::env_ids_size() const {
+  return _internal_env_ids_size();
+}
+inline void DenseGroupActions::clear_env_ids() {
+  _impl_.env_ids_.Clear();
+}
+inline int32_t DenseGroupActions::_internal_env_ids(int index) const {
+  return _impl_.env_ids_.Get(index);
+}
+inline int32_t DenseGroupActions::env_ids(int index) const {
+  // @@protoc_insertion_point(field_get:Schola.DenseGroupActions.env_ids)
+  return _internal_env_ids(index);
+}
+inline void DenseGroupActions::set_env_ids(int index, int32_t value) {
+  _impl_.env_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Schola.DenseGroupActions.env_ids)
+}
+inline void DenseGroupActions::_internal_add_env_ids(int32_t value) {
+  _impl_.env_ids_.Add(value);
+}
+inline void DenseGroupActions::add_env_ids(int32_t value) {
+  _internal_add_env_ids(value);
+  // @@protoc_insertion_point(field_add:Schola.DenseGroupActions.env_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+DenseGroupActions::_internal_env_ids() const {
+  return _impl_.env_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+DenseGroupActions::env_ids() const {
+  // @@protoc_insertion_point(field_list:Schola.DenseGroupActions.env_ids)
+  return _internal_env_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+DenseGroupActions::_internal_mutable_env_ids() {
+  return &_impl_.env_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+DenseGroupActions::mutable_env_ids() {
+  // @@protoc_insertion_point(field_mutable_list:Schola.DenseGroupActions.env_ids)
+  return _internal_mutable_env_ids();
+}
+
+// repeated int32 agent_ids = 3;
+inline int DenseGroupActions::_internal_agent_ids_size() const {
+  return _impl_.agent_ids_.size();
+}
+inline int DenseGroupActions::agent_ids_size() const {
+  return _internal_agent_ids_size();
+}
+inline void DenseGroupActions::clear_agent_ids() {
+  _impl_.agent_ids_.Clear();
+}
+inline int32_t DenseGroupActions::_internal_agent_ids(int index) const {
+  return _impl_.agent_ids_.Get(index);
+}
+inline int32_t DenseGroupActions::agent_ids(int index) const {
+  // @@protoc_insertion_point(field_get:Schola.DenseGroupActions.agent_ids)
+  return _internal_agent_ids(index);
+}
+inline void DenseGroupActions::set_agent_ids(int index, int32_t value) {
+  _impl_.agent_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:Schola.DenseGroupActions.agent_ids)
+}
+inline void DenseGroupActions::_internal_add_agent_ids(int32_t value) {
+  _impl_.agent_ids_.Add(value);
+}
+inline void DenseGroupActions::add_agent_ids(int32_t value) {
+  _internal_add_agent_ids(value);
+  // @@protoc_insertion_point(field_add:Schola.DenseGroupActions.agent_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+DenseGroupActions::_internal_agent_ids() const {
+  return _impl_.agent_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+DenseGroupActions::agent_ids() const {
+  // @@protoc_insertion_point(field_list:Schola.DenseGroupActions.agent_ids)
+  return _internal_agent_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+DenseGroupActions::_internal_mutable_agent_ids() {
+  return &_impl_.agent_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+DenseGroupActions::mutable_agent_ids() {
+  // @@protoc_insertion_point(field_mutable_list:Schola.DenseGroupActions.agent_ids)
+  return _internal_mutable_agent_ids();
+}
+
+// bytes actions = 4;
+inline void DenseGroupActions::clear_actions() {
+  _impl_.actions_.ClearToEmpty();
+}
+inline const std::string& DenseGroupActions::actions() const {
+  // @@protoc_insertion_point(field_get:Schola.DenseGroupActions.actions)
+  return _internal_actions();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DenseGroupActions::set_actions(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.actions_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Schola.DenseGroupActions.actions)
+}
+inline std::string* DenseGroupActions::mutable_actions() {
+  std::string* _s = _internal_mutable_actions();
+  // @@protoc_insertion_point(field_mutable:Schola.DenseGroupActions.actions)
+  return _s;
+}
+inline const std::string& DenseGroupActions::_internal_actions() const {
+  return _impl_.actions_.Get();
+}
+inline void DenseGroupActions::_internal_set_actions(const std::string& value) {
+  
+  _impl_.actions_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DenseGroupActions::_internal_mutable_actions() {
+  
+  return _impl_.actions_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DenseGroupActions::release_actions() {
+  // @@protoc_insertion_point(field_release:Schola.DenseGroupActions.actions)
+  return _impl_.actions_.Release();
+}
+inline void DenseGroupActions::set_allocated_actions(std::string* actions) {
+  if (actions != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.actions_.SetAllocated(actions, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.actions_.IsDefault()) {
+    _impl_.actions_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Schola.DenseGroupActions.actions)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -548,6 +934,8 @@ EnvironmentStep::mutable_updates() {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -1,6 +1,7 @@
 // Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
 
 #include "Actuators/MovementInputActuator.h"
+#include "Common/BoxKernels.h"
 
 FBoxSpace UMovementInputActuator::GetActionSpace()
 {
@@ -24,43 +25,37 @@ FBoxSpace UMovementInputActuator::GetActionSpace()
 
 FVector UMovementInputActuator::ConvertActionToFVector(const FBoxPoint& Action)
 {
-	FVector OutVector;
+	// The values of each enabled dimension, in the same order as the action
+	float Values[3] = { 0, 0, 0 };
+	int	  NumValues = FMath::Min(int(bHasXDimension) + int(bHasYDimension) + int(bHasZDimension), Action.Num());
+	FMemory::Memcpy(Values, Action.GetData(), NumValues * sizeof(float));
+
+	if(this->bClipMovementInputs)
+	{
+		const float Low[3] = { float(MinSpeed), float(MinSpeed), float(MinSpeed) };
+		const float High[3] = { float(MaxSpeed), float(MaxSpeed), float(MaxSpeed) };
+		BoxKernels::Clamp(Values, Low, High, NumValues);
+	}
+
+	FVector OutVector = FVector::ZeroVector;
 	int		Offset = 0;
 	if (bHasXDimension)
 	{
-		OutVector.X = Action[Offset];
+		OutVector.X = Values[Offset];
 		Offset++;
 	}
 
 	if (bHasYDimension)
 	{
-		OutVector.Y = Action[Offset];
+		OutVector.Y = Values[Offset];
 		Offset++;
 	}
 
 	if (bHasZDimension)
 	{
-		OutVector.Z = Action[Offset];
+		OutVector.Z = Values[Offset];
 		Offset++;
 	}
-	
-	if(this->bClipMovementInputs)
-	{
-		if (bHasXDimension)
-		{
-			OutVector.X = FMath::Clamp(OutVector.X, MinSpeed, MaxSpeed);
-		}
-
-		if (bHasYDimension)
-		{
-			OutVector.Y = FMath::Clamp(OutVector.Y, MinSpeed, MaxSpeed);
-		}
-
-		if (bHasZDimension)
-		{
-			OutVector.Z = FMath::Clamp(OutVector.Z, MinSpeed, MaxSpeed);
-		}
-	}
 	return OutVector;
 }
 
@@ -1,6 +1,7 @@
 // Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
 
 #include "Actuators/RotationActuator.h"
+#include "Common/BoxKernels.h"
 
 
 FBoxSpace URotationActuator::GetActionSpace()
@@ -50,38 +51,32 @@ FBoxSpace URotationActuator::GetActionSpace()
 
 FRotator URotationActuator::ConvertActionToFRotator(const FBoxPoint& Action)
 {
-	float Pitch = 0;
-	float Yaw = 0;
-	float Roll = 0;
-
-	int Offset = 0;
-	if (bHasPitch)
+	// The values and bounds of each enabled axis, in the same order as the action
+	float Values[3] = { 0, 0, 0 };
+	float Low[3];
+	float High[3];
+	int	  NumValues = 0;
+	for (const FBoxSpaceDimension* Bounds : { bHasPitch ? &PitchBounds : nullptr, bHasRoll ? &RollBounds : nullptr, bHasYaw ? &YawBounds : nullptr })
 	{
-		Pitch = Action[Offset++];
-		if (bNormalizeAndRescale)
-		{
-			Pitch = PitchBounds.RescaleValue(Pitch);
-		}
-	}
-
-	if (bHasRoll)
-	{	
-		Roll = Action[Offset++];
-		if (bNormalizeAndRescale)
+		if (Bounds && NumValues < Action.Num())
 		{
-			Roll = RollBounds.RescaleValue(Roll);
+			Values[NumValues] = Action[NumValues];
+			Low[NumValues] = Bounds->Low;
+			High[NumValues] = Bounds->High;
+			NumValues++;
 		}
 	}
 
-	if (bHasYaw)
+	if (bNormalizeAndRescale)
 	{
-		Yaw = Action[Offset++];
-		if (bNormalizeAndRescale)
-		{
-			Yaw = YawBounds.RescaleValue(Yaw);
-		}
+		BoxKernels::Rescale(Values, Low, High, NumValues);
 	}
 
+	int	  Offset = 0;
+	float Pitch = bHasPitch ? Values[Offset++] : 0;
+	float Roll = bHasRoll ? Values[Offset++] : 0;
+	float Yaw = bHasYaw ? Values[Offset++] : 0;
+
 	return FRotator(Pitch, Yaw, Roll);
 }
 
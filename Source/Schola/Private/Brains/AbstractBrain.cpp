@@ -21,6 +21,18 @@ void UAbstractBrain::ResetStep()
 	this->SetStep(0);
 }
 
+void UAbstractBrain::SetDecisionPhase(int NewPhase)
+{
+	const int Frequency = FMath::Max(this->DecisionRequestFrequency, 1);
+	this->DecisionPhase = ((NewPhase % Frequency) + Frequency) % Frequency;
+}
+
+void UAbstractBrain::DeferDecision()
+{
+	// The step after this one becomes the decision step
+	this->SetDecisionPhase(this->DecisionPhase - 1);
+}
+
 bool UAbstractBrain::IsActive()
 {
 	return this->GetStatus() != EBrainStatus::Error;
@@ -28,7 +40,7 @@ bool UAbstractBrain::IsActive()
 
 bool UAbstractBrain::IsDecisionStep(int StepToCheck)
 {
-	return (StepToCheck % this->DecisionRequestFrequency) == 0;
+	return ((StepToCheck + this->DecisionPhase) % this->DecisionRequestFrequency) == 0;
 }
 
 bool UAbstractBrain::IsDecisionStep()
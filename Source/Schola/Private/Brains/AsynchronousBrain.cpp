@@ -0,0 +1,122 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#include "Brains/AsynchronousBrain.h"
+
+UAsynchronousBrain::UAsynchronousBrain()
+{
+}
+
+UAsynchronousBrain::~UAsynchronousBrain()
+{
+	delete this->Decision;
+}
+
+void UAsynchronousBrain::BeginDestroy()
+{
+	// The policy still fulfils a decision in progress after we're gone, so hand it off to be freed when it arrives
+	if (this->bHasInProgressAction)
+	{
+		this->InProgressActionRequest.Next([](FPolicyDecision* AbandonedDecision) { delete AbandonedDecision; });
+		this->bHasInProgressAction = false;
+	}
+	delete this->Decision;
+	this->Decision = nullptr;
+	Super::BeginDestroy();
+}
+
+void UAsynchronousBrain::IncrementStep()
+{
+	Super::IncrementStep();
+	this->NumSteps++;
+}
+
+bool UAsynchronousBrain::RequestDecision(const FDictPoint& Observations)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR("Schola:Decision Request");
+
+	// Still waiting on the last decision, so keep acting on the current one rather than queueing up more work
+	if (this->bHasInProgressAction)
+	{
+		return true;
+	}
+
+	this->InProgressActionRequest = this->Policy->RequestDecision(Observations);
+	this->InProgressRequestStep = this->NumSteps;
+	this->bHasInProgressAction = true;
+	return true;
+}
+
+void UAsynchronousBrain::Reset()
+{
+	this->ResetStep();
+}
+
+FAction* UAsynchronousBrain::GetAction()
+{
+	return &(this->Decision->Action);
+}
+
+bool UAsynchronousBrain::HasAction()
+{
+	return this->bHasInProgressAction || this->Decision != nullptr;
+}
+
+void UAsynchronousBrain::ResolveDecision()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR("Schola: Retrieving Action");
+
+	if (this->bHasInProgressAction && this->InProgressActionRequest.IsReady())
+	{
+		FPolicyDecision* NewDecision = this->InProgressActionRequest.Get();
+		this->InProgressActionRequest.Reset();
+		this->bHasInProgressAction = false;
+
+		this->UpdateStatusFromDecision(*NewDecision);
+		if (NewDecision->IsAction())
+		{
+			// Nothing holds onto the previous action once it's been distributed, so it can go
+			delete this->Decision;
+			this->Decision = NewDecision;
+			this->DecisionRequestStep = this->InProgressRequestStep;
+		}
+		else
+		{
+			delete NewDecision;
+		}
+	}
+	else if (this->bHasInProgressAction)
+	{
+		this->NumStaleActions++;
+		const uint64 OldestStep = this->Decision ? this->DecisionRequestStep : this->InProgressRequestStep;
+		if (this->bUseMaxStaleness && this->NumSteps - OldestStep > (uint64)this->MaxStaleness)
+		{
+			UE_LOG(LogSchola, Warning, TEXT("Asynchronous Brain gave up after acting on %llu Step old Observations while waiting for a Decision"), this->NumSteps - OldestStep);
+			this->UpdateStatusFromDecision(FPolicyDecision(EDecisionType::ERRORED));
+			this->InProgressActionRequest.Reset();
+			this->bHasInProgressAction = false;
+			return;
+		}
+	}
+
+	if (this->Decision != nullptr && this->GetStatus() == EBrainStatus::ActionReady)
+	{
+		this->UpdateStalenessStats();
+	}
+}
+
+void UAsynchronousBrain::UpdateStalenessStats()
+{
+	this->CurrentStaleness = (int)(this->NumSteps - this->DecisionRequestStep);
+	this->MaxObservedStaleness = FMath::Max(this->MaxObservedStaleness, this->CurrentStaleness);
+	this->NumStalenessSamples++;
+	this->AverageStaleness += (this->CurrentStaleness - this->AverageStaleness) / this->NumStalenessSamples;
+}
+
+void UAsynchronousBrain::ResetStalenessStats()
+{
+	this->CurrentStaleness = 0;
+	this->MaxObservedStaleness = 0;
+	this->AverageStaleness = 0.0f;
+	this->NumStaleActions = 0;
+	this->NumStalenessSamples = 0;
+}
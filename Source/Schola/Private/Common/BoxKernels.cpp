@@ -0,0 +1,109 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#include "Common/BoxKernels.h"
+#include "Math/VectorRegister.h"
+
+// Number of floats processed per vector register
+static constexpr int BoxKernelWidth = 4;
+
+void BoxKernels::Normalize(float* Values, const float* Low, const float* Scale, int Num)
+{
+	int i = 0;
+	for (; i + BoxKernelWidth <= Num; i += BoxKernelWidth)
+	{
+		VectorRegister4Float Value = VectorLoad(Values + i);
+		Value = VectorMultiply(VectorSubtract(Value, VectorLoad(Low + i)), VectorLoad(Scale + i));
+		VectorStore(Value, Values + i);
+	}
+	for (; i < Num; i++)
+	{
+		Values[i] = (Values[i] - Low[i]) * Scale[i];
+	}
+}
+
+void BoxKernels::Rescale(float* Values, const float* Low, const float* High, int Num)
+{
+	int i = 0;
+	for (; i + BoxKernelWidth <= Num; i += BoxKernelWidth)
+	{
+		VectorRegister4Float LowVec = VectorLoad(Low + i);
+		VectorRegister4Float Range = VectorSubtract(VectorLoad(High + i), LowVec);
+		VectorStore(VectorMultiplyAdd(VectorLoad(Values + i), Range, LowVec), Values + i);
+	}
+	for (; i < Num; i++)
+	{
+		Values[i] = Values[i] * (High[i] - Low[i]) + Low[i];
+	}
+}
+
+void BoxKernels::Clamp(float* Values, const float* Low, const float* High, int Num)
+{
+	int i = 0;
+	for (; i + BoxKernelWidth <= Num; i += BoxKernelWidth)
+	{
+		VectorRegister4Float Value = VectorLoad(Values + i);
+		Value = VectorMin(VectorMax(Value, VectorLoad(Low + i)), VectorLoad(High + i));
+		VectorStore(Value, Values + i);
+	}
+	for (; i < Num; i++)
+	{
+		Values[i] = FMath::Min(FMath::Max(Values[i], Low[i]), High[i]);
+	}
+}
+
+bool BoxKernels::AllInBounds(const float* Values, const float* Low, const float* High, int Num)
+{
+	int i = 0;
+	for (; i + BoxKernelWidth <= Num; i += BoxKernelWidth)
+	{
+		VectorRegister4Float Value = VectorLoad(Values + i);
+		if (VectorAnyGreaterThan(Value, VectorLoad(High + i)) || VectorAnyGreaterThan(VectorLoad(Low + i), Value))
+		{
+			return false;
+		}
+	}
+	for (; i < Num; i++)
+	{
+		if (Values[i] > High[i] || Values[i] < Low[i])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void BoxKernels::NormalizeBatch(float* Values, int NumRows, int RowStride, const float* Low, const float* Scale, int Num)
+{
+	for (int Row = 0; Row < NumRows; Row++)
+	{
+		Normalize(Values + Row * RowStride, Low, Scale, Num);
+	}
+}
+
+void BoxKernels::RescaleBatch(float* Values, int NumRows, int RowStride, const float* Low, const float* High, int Num)
+{
+	for (int Row = 0; Row < NumRows; Row++)
+	{
+		Rescale(Values + Row * RowStride, Low, High, Num);
+	}
+}
+
+void BoxKernels::ClampBatch(float* Values, int NumRows, int RowStride, const float* Low, const float* High, int Num)
+{
+	for (int Row = 0; Row < NumRows; Row++)
+	{
+		Clamp(Values + Row * RowStride, Low, High, Num);
+	}
+}
+
+bool BoxKernels::AllInBoundsBatch(const float* Values, int NumRows, int RowStride, const float* Low, const float* High, int Num)
+{
+	for (int Row = 0; Row < NumRows; Row++)
+	{
+		if (!AllInBounds(Values + Row * RowStride, Low, High, Num))
+		{
+			return false;
+		}
+	}
+	return true;
+}
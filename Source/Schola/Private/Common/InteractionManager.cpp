@@ -13,10 +13,16 @@ void UInteractionManager::SetupObservers(const TArray<UAbstractObserver*>& InObs
 
 void UInteractionManager::CollectObservationsFromObservers(const TArray<UAbstractObserver*>& InObservers, FDictPoint& OutObservationsMap)
 {
+	// An inference request may still be reading the last observations out of the arena
+	OutObservationsMap.UnshareBuffer();
+
+	int Id = 0;
 	for (UAbstractObserver* Observer : InObservers)
 	{
-		TPoint& ObservationRef = OutObservationsMap.Add();
+		// Points laid out by InitializeEmptyDictPoint are reused in place, so nothing is reallocated between steps
+		TPoint& ObservationRef = Id < OutObservationsMap.Points.Num() ? OutObservationsMap[Id] : OutObservationsMap.Add();
 		Observer->CollectObservations(ObservationRef);
+		Id++;
 	}
 };
 
@@ -65,16 +71,24 @@ void UInteractionManager::CollectActionSpaceFromActuators(const TArray<UActuator
 
 void UInteractionManager::Initialize(TArray<UAbstractObserver*>& InObservers, TArray<UActuator*>& InActuators)
 {
+	// Start from scratch, in case the agent is being initialized again
+	this->Observers.Reset();
+	this->Actuators.Reset();
+	this->InteractionDefn.ObsSpaceDefn.Reset();
+	this->InteractionDefn.ActionSpaceDefn.Reset();
+
 	// Collect all the attached sensors
 
 	SetupObservers(InObservers, this->Observers);
 	CollectObservationSpaceFromObservers(this->Observers, this->InteractionDefn.ObsSpaceDefn);
 
-	this->InteractionDefn.ObsSpaceDefn.InitializeEmptyDictPoint(this->Observations);
 	// Collect all the attached Actuators
 	SetupActuators(InActuators, this->Actuators);
 	CollectActionSpaceFromActuators(this->Actuators, this->InteractionDefn.ActionSpaceDefn);
 
+	this->InteractionDefn.Finalize();
+	this->InteractionDefn.ObsSpaceDefn.InitializeEmptyDictPoint(this->Observations);
+
 }
 
 void UInteractionManager::DistributeActions(const FDictPoint& ActionMap)
@@ -82,20 +96,20 @@ void UInteractionManager::DistributeActions(const FDictPoint& ActionMap)
 	SendActionsToActuators(this->Actuators, ActionMap);
 }
 
-FDictPoint& UInteractionManager::AggregateObservations()
+FDictPoint& UInteractionManager::AggregateObservations(bool bNormalize)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR("Schola:Observation Collection");
 
-	// Clear the observations
-	Observations.Reset();
 	// Collect observaions from the sensors
 	CollectObservationsFromObservers(Observers, this->Observations);
 
-	// TODO make this more efficient
-	if (this->InteractionDefn.bNormalizeObservations)
+	if (bNormalize && this->InteractionDefn.bNormalizeObservations)
 	{
 		this->InteractionDefn.ObsSpaceDefn.NormalizeObservation(this->Observations);
 	}
 
+	// Box observations were written straight into the arena, so this only fills in the rest
+	this->InteractionDefn.ObsSpaceDefn.FlattenDictPoint(this->Observations);
+
 	return this->Observations;
 }
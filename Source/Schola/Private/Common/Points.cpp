@@ -6,9 +6,160 @@
 
 void FDictPoint::Reset()
 {
+	if (this->HasBuffer())
+	{
+		for (TPoint& Point : this->Points)
+		{
+			Visit([](auto& TypedPoint) { TypedPoint.Reset(); }, Point);
+		}
+		return;
+	}
 	this->Points.Reset(this->Points.Num());
 }
 
+FDictPoint& FDictPoint::operator=(const FDictPoint& Other)
+{
+	if (this != &Other)
+	{
+		this->Points = Other.Points;
+		this->Buffer = Other.Buffer.IsValid() ? MakeShared<TArray<float>>(*Other.Buffer) : nullptr;
+		this->Offsets = Other.Offsets;
+		this->Sizes = Other.Sizes;
+		this->BindPoints();
+	}
+	return *this;
+}
+
+void FDictPoint::InitializeBuffer(const TArray<int>& InSizes)
+{
+	this->Sizes = InSizes;
+	this->Offsets.Reset(InSizes.Num());
+	int Total = 0;
+	for (const int& Size : InSizes)
+	{
+		this->Offsets.Add(Total);
+		Total += Size;
+	}
+	// Views are handed out into the Buffer, so it must never be resized after this
+	this->Buffer = MakeShared<TArray<float>>();
+	this->Buffer->SetNumZeroed(Total);
+}
+
+void FDictPoint::UnshareBuffer()
+{
+	if (this->Buffer.IsValid() && !this->Buffer.IsUnique())
+	{
+		// Whoever holds the old Buffer keeps reading it unchanged, while the points move over to the copy
+		this->Buffer = MakeShared<TArray<float>>(*this->Buffer);
+		this->BindPoints();
+	}
+}
+
+void FDictPoint::BindPoints()
+{
+	if (!this->HasBuffer())
+	{
+		return;
+	}
+	for (int i = 0; i < this->Points.Num() && i < this->Offsets.Num(); i++)
+	{
+		if (FBoxPoint* BoxPoint = this->Points[i].TryGet<FBoxPoint>())
+		{
+			BoxPoint->Bind(this->GetView(i));
+		}
+	}
+}
+
+FBoxPoint& FBoxPoint::operator=(const FBoxPoint& Other)
+{
+	if (this != &Other)
+	{
+		this->Values = TArray<float>(Other.GetData(), Other.Num());
+		this->Storage = TArrayView<float>();
+		this->NumStored = 0;
+		this->bBound = false;
+	}
+	return *this;
+}
+
+FBoxPoint& FBoxPoint::operator=(FBoxPoint&& Other)
+{
+	if (this != &Other)
+	{
+		if (Other.bBound)
+		{
+			this->Values = TArray<float>(Other.GetData(), Other.Num());
+		}
+		else
+		{
+			this->Values = MoveTemp(Other.Values);
+		}
+		this->Storage = TArrayView<float>();
+		this->NumStored = 0;
+		this->bBound = false;
+	}
+	return *this;
+}
+
+void FBoxPoint::Append(const float* Data, int Count)
+{
+	if (this->bBound)
+	{
+		if (this->NumStored + Count <= this->Storage.Num())
+		{
+			FMemory::Memcpy(this->Storage.GetData() + this->NumStored, Data, Count * sizeof(float));
+			this->NumStored += Count;
+			return;
+		}
+		this->Unbind();
+	}
+	this->Values.Append(Data, Count);
+}
+
+void FBoxPoint::Bind(TArrayView<float> InStorage)
+{
+	const int Count = this->Num();
+	if (Count <= InStorage.Num())
+	{
+		FMemory::Memmove(InStorage.GetData(), this->GetData(), Count * sizeof(float));
+		this->Values.Reset();
+		this->NumStored = Count;
+		this->bBound = true;
+	}
+	else if (this->bBound)
+	{
+		this->Unbind();
+	}
+	this->Storage = InStorage;
+}
+
+void FBoxPoint::MoveValuesToStorage()
+{
+	if (!this->bBound || this->Values.Num() == 0)
+	{
+		return;
+	}
+	if (this->NumStored + this->Values.Num() <= this->Storage.Num())
+	{
+		FMemory::Memcpy(this->Storage.GetData() + this->NumStored, this->Values.GetData(), this->Values.Num() * sizeof(float));
+		this->NumStored += this->Values.Num();
+		this->Values.Reset();
+		return;
+	}
+	// Too many to fit, so keep everything in Values with the stored values first
+	this->Values.Insert(this->Storage.GetData(), this->NumStored, 0);
+	this->NumStored = 0;
+	this->bBound = false;
+}
+
+void FBoxPoint::Unbind()
+{
+	this->Values.Reset();
+	this->Values.Append(this->Storage.GetData(), this->NumStored);
+	this->NumStored = 0;
+	this->bBound = false;
+}
+
 void FBoxPoint::Accept(ConstPointVisitor& Visitor) const
 {
 	Visitor.Visit(*this);
@@ -38,4 +189,80 @@ void FBinaryPoint::Accept(ConstPointVisitor& Visitor) const
 void FBinaryPoint::Accept(PointVisitor& Visitor)
 {
 	Visitor.Visit(*this);
-}
\ No newline at end of file
+}
+
+FBinaryPoint::FBinaryPoint(const uint8* Bytes, int64 NumBytes, int NumBits)
+{
+	checkf(NumBits >= 0 && NumBytes >= (int64(NumBits) + 7) / 8, TEXT("%d packed bits don't fit in %lld bytes"), NumBits, NumBytes);
+	this->InitPacked(NumBits);
+	// Words are little endian, so the byte order on the wire matches the in memory layout
+	FMemory::Memcpy(this->PackedWords.GetData(), Bytes, (NumBits + 7) / 8);
+}
+
+void FBinaryPoint::InitPacked(int NumBits)
+{
+	this->bPacked = true;
+	this->NumPackedBits = NumBits;
+	this->Values.Empty();
+	this->PackedWords.SetNumZeroed((NumBits + 63) / 64);
+}
+
+int FBinaryPoint::CountSetBits() const
+{
+	if (!this->bPacked)
+	{
+		int Count = 0;
+		for (const bool& Value : this->Values)
+		{
+			Count += Value;
+		}
+		return Count;
+	}
+
+	int Count = 0;
+	for (const uint64& Word : this->PackedWords)
+	{
+		Count += FMath::CountBits(Word);
+	}
+	return Count;
+}
+
+bool FBinaryPoint::HasCleanPadding() const
+{
+	const int UsedBits = this->NumPackedBits & 63;
+	if (!this->bPacked || UsedBits == 0 || this->PackedWords.Num() == 0)
+	{
+		return true;
+	}
+	const uint64 PaddingMask = ~((uint64(1) << UsedBits) - 1);
+	return FMath::CountBits(this->PackedWords.Last() & PaddingMask) == 0;
+}
+
+void FBinaryPoint::FlattenTo(float* Out) const
+{
+	if (!this->bPacked)
+	{
+		for (int i = 0; i < this->Values.Num(); i++)
+		{
+			Out[i] = this->Values[i];
+		}
+		return;
+	}
+
+	for (int WordIndex = 0; WordIndex < this->PackedWords.Num(); WordIndex++)
+	{
+		const uint64 Word = this->PackedWords[WordIndex];
+		const int	 Start = WordIndex * 64;
+		const int	 Count = FMath::Min(64, this->NumPackedBits - Start);
+		if (Word == 0)
+		{
+			// Sparse masks are mostly empty words, so skip the per bit work entirely
+			FMemory::Memzero(Out + Start, Count * sizeof(float));
+			continue;
+		}
+		for (int Bit = 0; Bit < Count; Bit++)
+		{
+			Out[Start + Bit] = static_cast<float>((Word >> Bit) & 1);
+		}
+	}
+}
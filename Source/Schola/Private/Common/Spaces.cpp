@@ -1,6 +1,8 @@
 // Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
 
 #include "Common/Spaces.h"
+#include "Common/BoxKernels.h"
+#include "Math/VectorRegister.h"
 
 FundamentalSpace* FSpace::ToProtobuf() const
 {
@@ -32,8 +34,9 @@ float FBoxSpaceDimension::RescaleValue(float NormalizedValue) const
 
 float FBoxSpaceDimension::NormalizeValue(float Value) const
 {
-	// Convert a value from the range of this dimension to [0,1]
-	return (Value - this->Low) / (this->High - this->Low);
+	// Convert a value from the range of this dimension to [0,1]. A dimension with no range would divide by zero, so it's always 0
+	const float Range = this->High - this->Low;
+	return Range != 0 ? (Value - this->Low) / Range : 0.0f;
 }
 
 float FBoxSpaceDimension::RescaleValue(float Value, float OldHigh, float OldLow) const
@@ -84,7 +87,7 @@ ESpaceValidationResult FBoxSpace::Validate(TPoint& Observation) const
 	FBoxPoint& TypedObservation = Observation.Get<FBoxPoint>();
 
 	// Is the shape right?
-	if (Dimensions.Num() != TypedObservation.Values.Num())
+	if (Dimensions.Num() != TypedObservation.Num())
 	{
 		return ESpaceValidationResult::WrongDimensions;
 	}
@@ -93,7 +96,7 @@ ESpaceValidationResult FBoxSpace::Validate(TPoint& Observation) const
 	// Are all our values in our bounding box?
 	for (int i = 0; i < Dimensions.Num(); i++)
 	{
-		if (TypedObservation.Values[i] > Dimensions[i].High || TypedObservation.Values[i] < Dimensions[i].Low)
+		if (TypedObservation[i] > Dimensions[i].High || TypedObservation[i] < Dimensions[i].Low)
 		{
 			return ESpaceValidationResult::OutOfBounds;
 		}
@@ -104,11 +107,11 @@ ESpaceValidationResult FBoxSpace::Validate(TPoint& Observation) const
 
 void FBoxSpace::NormalizeObservation(TPoint& Observation) const
 {
-	FBoxPoint& TypedObservation = Observation.Get<FBoxPoint>();
+	float* Values = Observation.Get<FBoxPoint>().GetData();
 	// Use bounding box to normalize the observations, we can safely do so because it has already been validated
 	for (int i = 0; i < Dimensions.Num(); i++)
 	{
-		TypedObservation.Values[i] = Dimensions[i].NormalizeValue(TypedObservation.Values[i]);
+		Values[i] = Dimensions[i].NormalizeValue(Values[i]);
 	}
 }
 
@@ -162,10 +165,10 @@ TPoint FBoxSpace::UnflattenAction(const TArray<float>& Data, int Offset) const
 void FBoxSpace::FlattenPoint(TArrayView<float> Buffer, const TPoint& Point) const
 {
 	assert(Buffer.Num() == this->GetFlattenedSize());
-	TArray<float> Arr = Point.Get<FBoxPoint>().Values;
-	for (int i = 0; i < Arr.Num();i++)
+	const FBoxPoint& TypedPoint = Point.Get<FBoxPoint>();
+	for (int i = 0; i < TypedPoint.Num();i++)
 	{
-		Buffer[i] = Arr[i];
+		Buffer[i] = TypedPoint[i];
 	}
 }
 
@@ -235,10 +238,14 @@ ESpaceValidationResult FBinarySpace::Validate(TPoint& Observation) const
 	FBinaryPoint& TypedObservation = Observation.Get<FBinaryPoint>();
 
 
-	if (Shape != TypedObservation.Values.Num())
+	if (Shape != TypedObservation.Num())
 	{
 		return ESpaceValidationResult::WrongDimensions;
 	}
+	else if (!TypedObservation.HasCleanPadding())
+	{
+		return ESpaceValidationResult::OutOfBounds;
+	}
 	else
 	{
 		return ESpaceValidationResult::Success;
@@ -273,11 +280,7 @@ TPoint FBinarySpace::UnflattenAction(const TArray<float>& Data, int Offset) cons
 void FBinarySpace::FlattenPoint(TArrayView<float> Buffer, const TPoint& Point) const
 {
 	assert(Buffer.Num() == this->GetFlattenedSize());
-	TArray<bool> Arr = Point.Get<FBinaryPoint>().Values;
-	for (int i = 0; i < Arr.Num(); i++)
-	{
-		Buffer[i] = Arr[i];
-	}
+	Point.Get<FBinaryPoint>().FlattenTo(Buffer.GetData());
 }
 
 int FBinarySpace::GetFlattenedSize() const
@@ -375,41 +378,55 @@ void FDiscreteSpace::FillProtobuf(DiscreteSpace& Msg) const
 
 int FDiscreteSpace::GetMaxValue(const TArray<float>& Vector) const
 {
-	float CurrMax = Vector[0];
-	int	  Index = 0;
-	int	  CurrIndex = 0;
-	for (const float& Value : Vector)
+	return FDiscreteSpace::GetMaxIndex(Vector.GetData(), Vector.Num());
+}
+
+int FDiscreteSpace::GetMaxIndex(const float* Values, int Num)
+{
+	if (Num <= 0)
+	{
+		return 0;
+	}
+
+	float CurrMax = Values[0];
+	int	  i = 0;
+	if (Num >= 4)
+	{
+		VectorRegister4Float MaxVec = VectorLoad(Values);
+		for (i = 4; i + 4 <= Num; i += 4)
+		{
+			MaxVec = VectorMax(MaxVec, VectorLoad(Values + i));
+		}
+		float Lanes[4];
+		VectorStore(MaxVec, Lanes);
+		CurrMax = FMath::Max(FMath::Max(Lanes[0], Lanes[1]), FMath::Max(Lanes[2], Lanes[3]));
+	}
+	for (; i < Num; i++)
 	{
-		if (Value > CurrMax)
+		CurrMax = FMath::Max(CurrMax, Values[i]);
+	}
+
+	// Return the first index holding the maximum, so ties break the same way as a sequential scan
+	for (int Index = 0; Index < Num; Index++)
+	{
+		if (Values[Index] == CurrMax)
 		{
-			CurrMax = Value;
-			Index = CurrIndex;
+			return Index;
 		}
-		CurrIndex += 1;
 	}
-	return Index;
+	return 0;
 }
 
 TPoint FDiscreteSpace::UnflattenAction(const TArray<float>& Data, int Offset) const
 {
-	
 	TPoint Point = this->MakeTPoint();
 	FDiscretePoint& TypedPoint = Point.Get<FDiscretePoint>();
-	int			   OutputValue = 0;
-	int			   CurrIndex = 0;
-	int			   dim = GetNumDimensions();
-	//TODO remove the copy from this function
-	for (int i = 0; i < dim; i++)
-	{
-		TArray<float> BranchArray = {};
-		int			  BranchHigh = High[i];
-		for (int j = CurrIndex; j < BranchHigh + CurrIndex; j++)
-		{
-			BranchArray.Add(Data[j + Offset]);
-		}
-		OutputValue = GetMaxValue(BranchArray);
-		TypedPoint.Values.Add(OutputValue);
-		CurrIndex += High[i];
+	TypedPoint.Values.Reserve(this->High.Num());
+	const float* BranchStart = Data.GetData() + Offset;
+	for (const int& BranchHigh : this->High)
+	{
+		TypedPoint.Values.Add(FDiscreteSpace::GetMaxIndex(BranchStart, BranchHigh));
+		BranchStart += BranchHigh;
 	}
 
 	return Point;
@@ -419,7 +436,7 @@ void FDiscreteSpace::FlattenPoint(TArrayView<float> Buffer, const TPoint& Point)
 {
 	//WE assume that the buffer is zeroed out
 	assert(Buffer.Num() == this->GetFlattenedSize());
-	TArray<int> Arr = Point.Get<FDiscretePoint>().Values;
+	const TArray<int>& Arr = Point.Get<FDiscretePoint>().Values;
 	int			BranchStart = 0;
 	for (int i = 0; i < this->High.Num(); i++)
 	{
@@ -455,30 +472,113 @@ FDictSpace::FDictSpace()
 
 int FDictSpace::Num()
 {
-	return 0;
+	return this->Spaces.Num();
 }
 
 
 int FDictSpace::GetFlattenedSize() const
 {	
+	if (this->Layout.IsValid())
+	{
+		return this->Layout->FlattenedSize;
+	}
+
 	int Size = 0;
 	for (const TSpace& Space : this->Spaces)
 	{
-		Size += Visit([](auto _Space) { return _Space.GetFlattenedSize(); }, Space);
+		Size += Visit([](const auto& TypedSpace) { return TypedSpace.GetFlattenedSize(); }, Space);
 	}
 
 	return Size;
 }
 
+void FDictSpace::BuildLayout()
+{
+	TSharedRef<FDictSpaceLayout> NewLayout = MakeShared<FDictSpaceLayout>();
+
+	NewLayout->Types.Reserve(this->Spaces.Num());
+	NewLayout->Offsets.Reserve(this->Spaces.Num());
+	NewLayout->Sizes.Reserve(this->Spaces.Num());
+	NewLayout->NumDimensions.Reserve(this->Spaces.Num());
+	NewLayout->DimensionOffsets.Reserve(this->Spaces.Num());
+
+	for (int i = 0; i < this->Spaces.Num(); i++)
+	{
+		const TSpace& Space = this->Spaces[i];
+		int			  Size = Visit([](const auto& TypedSpace) { return TypedSpace.GetFlattenedSize(); }, Space);
+		int			  NumDims = Visit([](const auto& TypedSpace) { return TypedSpace.GetNumDimensions(); }, Space);
+
+		NewLayout->Offsets.Add(NewLayout->FlattenedSize);
+		NewLayout->Sizes.Add(Size);
+		NewLayout->NumDimensions.Add(NumDims);
+		NewLayout->DimensionOffsets.Add(NewLayout->TotalDimensions);
+
+		if (const FBoxSpace* BoxSpace = Space.TryGet<FBoxSpace>())
+		{
+			NewLayout->Types.Add(ESpaceType::Box);
+			for (const FBoxSpaceDimension& Dimension : BoxSpace->Dimensions)
+			{
+				float Range = Dimension.High - Dimension.Low;
+				NewLayout->Low.Add(Dimension.Low);
+				NewLayout->High.Add(Dimension.High);
+				// Same as FBoxSpaceDimension::NormalizeValue, which maps a dimension with no range to 0
+				NewLayout->Scale.Add(Range != 0 ? 1.0f / Range : 0.0f);
+				NewLayout->BranchSizes.Add(0);
+			}
+		}
+		else if (const FDiscreteSpace* DiscreteSpace = Space.TryGet<FDiscreteSpace>())
+		{
+			NewLayout->Types.Add(ESpaceType::Discrete);
+			for (const int& BranchSize : DiscreteSpace->High)
+			{
+				NewLayout->Low.Add(0);
+				NewLayout->High.Add(BranchSize);
+				NewLayout->Scale.Add(1);
+				NewLayout->BranchSizes.Add(BranchSize);
+			}
+		}
+		else
+		{
+			NewLayout->Types.Add(ESpaceType::Binary);
+			for (int j = 0; j < NumDims; j++)
+			{
+				NewLayout->Low.Add(0);
+				NewLayout->High.Add(1);
+				NewLayout->Scale.Add(1);
+				NewLayout->BranchSizes.Add(0);
+			}
+		}
+
+		// Match IndexOfByKey, which returns the first matching label
+		if (!NewLayout->LabelIndex.Contains(this->Labels[i]))
+		{
+			NewLayout->LabelIndex.Add(this->Labels[i], i);
+		}
+
+		NewLayout->FlattenedSize += Size;
+		NewLayout->TotalDimensions += NumDims;
+	}
+
+	this->Layout = NewLayout;
+}
+
 ESpaceValidationResult FDictSpace::Validate(FDictPoint& PointMap) const
 {
 	ESpaceValidationResult Result = ESpaceValidationResult::NoResults;
 
 	for (int i =0; i < this->Spaces.Num(); i++)
 	{
-		const TSpace& Space = this->Spaces[i];
 		TPoint& Point = PointMap[i];
-		ESpaceValidationResult CurrentResult = Visit([&Point](auto& TypedSpace) { return TypedSpace.Validate(Point); }, Space);
+		ESpaceValidationResult CurrentResult;
+		if (this->Layout.IsValid())
+		{
+			CurrentResult = this->ValidateFromLayout(i, Point);
+		}
+		else
+		{
+			CurrentResult = Visit([&Point](auto& TypedSpace) { return TypedSpace.Validate(Point); }, this->Spaces[i]);
+		}
+
 		switch (CurrentResult)
 		{
 			case ESpaceValidationResult::NoResults:
@@ -496,12 +596,123 @@ ESpaceValidationResult FDictSpace::Validate(FDictPoint& PointMap) const
 	return Result;
 }
 
+ESpaceValidationResult FDictSpace::ValidateFromLayout(int Index, const TPoint& Point) const
+{
+	const FDictSpaceLayout& Plan = *this->Layout;
+	const int				NumDims = Plan.NumDimensions[Index];
+	const int				DimOffset = Plan.DimensionOffsets[Index];
+
+	switch (Plan.Types[Index])
+	{
+		case ESpaceType::Box:
+		{
+			const FBoxPoint* TypedPoint = Point.TryGet<FBoxPoint>();
+			if (!TypedPoint)
+			{
+				return ESpaceValidationResult::WrongDataType;
+			}
+			if (TypedPoint->Num() != NumDims)
+			{
+				return ESpaceValidationResult::WrongDimensions;
+			}
+			bool bInBounds = BoxKernels::AllInBounds(TypedPoint->GetData(), Plan.Low.GetData() + DimOffset, Plan.High.GetData() + DimOffset, NumDims);
+			return bInBounds ? ESpaceValidationResult::Success : ESpaceValidationResult::OutOfBounds;
+		}
+		case ESpaceType::Discrete:
+		{
+			const FDiscretePoint* TypedPoint = Point.TryGet<FDiscretePoint>();
+			if (!TypedPoint)
+			{
+				return ESpaceValidationResult::WrongDataType;
+			}
+			if (TypedPoint->Values.Num() != NumDims)
+			{
+				return ESpaceValidationResult::WrongDimensions;
+			}
+			const int* BranchSizes = Plan.BranchSizes.GetData() + DimOffset;
+			for (int j = 0; j < NumDims; j++)
+			{
+				if (TypedPoint->Values[j] > BranchSizes[j] || TypedPoint->Values[j] < 0)
+				{
+					return ESpaceValidationResult::OutOfBounds;
+				}
+			}
+			return ESpaceValidationResult::Success;
+		}
+		default:
+		{
+			const FBinaryPoint* TypedPoint = Point.TryGet<FBinaryPoint>();
+			if (!TypedPoint)
+			{
+				return ESpaceValidationResult::WrongDataType;
+			}
+			if (TypedPoint->Num() != NumDims)
+			{
+				return ESpaceValidationResult::WrongDimensions;
+			}
+			return TypedPoint->HasCleanPadding() ? ESpaceValidationResult::Success : ESpaceValidationResult::OutOfBounds;
+		}
+	}
+}
+
 void FDictSpace::NormalizeObservation(FDictPoint& Observations) const
 {
-	for (int i = 0; i < this->Spaces.Num(); i++)
+	if (!this->Layout.IsValid())
+	{
+		for (int i = 0; i < this->Spaces.Num(); i++)
+		{
+			TPoint& CurrentObs = Observations[i];
+			Visit([&CurrentObs](auto& TypedSpace) {TypedSpace.NormalizeObservation(CurrentObs); }, this->Spaces[i]);
+		}
+		return;
+	}
+
+	const FDictSpaceLayout& Plan = *this->Layout;
+	for (int i = 0; i < Plan.Types.Num(); i++)
+	{
+		// Only continuous observations need normalizing
+		if (Plan.Types[i] == ESpaceType::Box)
+		{
+			FBoxPoint& BoxPoint = Observations[i].Get<FBoxPoint>();
+			int		   Num = FMath::Min(BoxPoint.Num(), Plan.NumDimensions[i]);
+			BoxKernels::Normalize(BoxPoint.GetData(), Plan.Low.GetData() + Plan.DimensionOffsets[i], Plan.Scale.GetData() + Plan.DimensionOffsets[i], Num);
+		}
+	}
+}
+
+void FDictSpace::NormalizeFlattenedBatch(float* Batch, int NumRows) const
+{
+	if (!this->Layout.IsValid())
 	{
-		TPoint& CurrentObs = Observations[i];
-		Visit([&CurrentObs](auto& TypedSpace) {TypedSpace.NormalizeObservation(CurrentObs); }, this->Spaces[i]);
+		return;
+	}
+
+	const FDictSpaceLayout& Plan = *this->Layout;
+	for (int i = 0; i < Plan.Types.Num(); i++)
+	{
+		if (Plan.Types[i] == ESpaceType::Box)
+		{
+			const int DimOffset = Plan.DimensionOffsets[i];
+			BoxKernels::NormalizeBatch(Batch + Plan.Offsets[i], NumRows, Plan.FlattenedSize, Plan.Low.GetData() + DimOffset, Plan.Scale.GetData() + DimOffset, Plan.NumDimensions[i]);
+		}
+	}
+}
+
+void FDictSpace::ClampFlattenedBatch(float* Batch, int NumRows) const
+{
+	if (!this->Layout.IsValid())
+	{
+		return;
+	}
+
+	const FDictSpaceLayout& Plan = *this->Layout;
+	for (int i = 0; i < Plan.Types.Num(); i++)
+	{
+		if (Plan.Types[i] == ESpaceType::Box)
+		{
+			const int DimOffset = Plan.DimensionOffsets[i];
+			BoxKernels::ClampBatch(Batch + Plan.Offsets[i], NumRows, Plan.FlattenedSize, Plan.Low.GetData() + DimOffset, Plan.High.GetData() + DimOffset, Plan.NumDimensions[i]);
+		}
 	}
 }
 
@@ -509,6 +720,7 @@ void FDictSpace::Reset()
 {
 	this->Labels.Empty();
 	this->Spaces.Empty();
+	this->Layout.Reset();
 }
 
 DictSpace* FDictSpace::ToProtobuf() const
@@ -530,27 +742,313 @@ void FDictSpace::FillProtobuf(DictSpace* Msg) const
 
 void FDictSpace::InitializeEmptyDictPoint(FDictPoint& EmptyPoint)
 {	
+	if (!this->Layout.IsValid())
+	{
+		this->BuildLayout();
+	}
+
 	EmptyPoint.Points.Empty();
 	for (TSpace& Space : this->Spaces)
 	{
 		EmptyPoint.Points.Add((Visit([](auto& TypedSpace) { return TypedSpace.MakeTPoint(); }, Space)));
 	}
+	EmptyPoint.InitializeBuffer(this->Layout->Sizes);
+	EmptyPoint.BindPoints();
+}
+
+void FDictSpace::FlattenDictPoint(FDictPoint& Point) const
+{
+	if (!ensureMsgf(this->Layout.IsValid() && Point.GetBufferSize() == this->Layout->FlattenedSize, TEXT("FlattenDictPoint requires a point from InitializeEmptyDictPoint")))
+	{
+		return;
+	}
+
+	for (int i = 0; i < this->Layout->Types.Num(); i++)
+	{
+		this->FlattenEntryInto(i, Point[i], Point.Buffer->GetData() + this->Layout->Offsets[i]);
+	}
+}
+
+void FDictSpace::FlattenInto(TArrayView<float> Buffer, const FDictPoint& DictPoint) const
+{
+	if (!this->Layout.IsValid())
+	{
+		int Offset = 0;
+		for (int i = 0; i < this->Spaces.Num(); i++)
+		{
+			const TSpace&	  Space = this->Spaces[i];
+			const TPoint&	  Point = DictPoint[i];
+			int				  Count = Visit([](const auto& TypedSpace) { return TypedSpace.GetFlattenedSize(); }, Space);
+			TArrayView<float> View = Buffer.Slice(Offset, Count);
+			// Discrete points are written one-hot, so the segment has to start zeroed
+			FMemory::Memzero(View.GetData(), Count * sizeof(float));
+			Visit([&Point, &View](auto& TypedSpace) { TypedSpace.FlattenPoint(View, Point); }, Space);
+			Offset += Count;
+		}
+		return;
+	}
+
+	if (DictPoint.GetBufferSize() == this->Layout->FlattenedSize)
+	{
+		FMemory::Memcpy(Buffer.GetData(), DictPoint.Buffer->GetData(), this->Layout->FlattenedSize * sizeof(float));
+		return;
+	}
+
+	for (int i = 0; i < this->Layout->Types.Num(); i++)
+	{
+		this->FlattenEntryInto(i, DictPoint[i], Buffer.GetData() + this->Layout->Offsets[i]);
+	}
+}
+
+void FDictSpace::FlattenEntryInto(int Index, const TPoint& Point, float* Out) const
+{
+	const FDictSpaceLayout& Plan = *this->Layout;
+	switch (Plan.Types[Index])
+	{
+		case ESpaceType::Box:
+		{
+			const FBoxPoint& BoxPoint = Point.Get<FBoxPoint>();
+			const int		 NumValues = FMath::Min(BoxPoint.Num(), Plan.Sizes[Index]);
+			// A point bound to this segment is already in place
+			if (BoxPoint.GetData() != Out)
+			{
+				FMemory::Memcpy(Out, BoxPoint.GetData(), NumValues * sizeof(float));
+			}
+			// A point with too few values is padded with zeros, rather than leaving whatever was last written to a reused buffer
+			FMemory::Memzero(Out + NumValues, (Plan.Sizes[Index] - NumValues) * sizeof(float));
+			break;
+		}
+		case ESpaceType::Binary:
+		{
+			Point.Get<FBinaryPoint>().FlattenTo(Out);
+			break;
+		}
+		case ESpaceType::Discrete:
+		{
+			const TArray<int>& Values = Point.Get<FDiscretePoint>().Values;
+			const int*		   BranchSizes = Plan.BranchSizes.GetData() + Plan.DimensionOffsets[Index];
+			FMemory::Memzero(Out, Plan.Sizes[Index] * sizeof(float));
+			int BranchStart = 0;
+			for (int j = 0; j < Values.Num(); j++)
+			{
+				Out[BranchStart + Values[j]] = 1;
+				BranchStart += BranchSizes[j];
+			}
+			break;
+		}
+	}
 }
 
 FDictPoint FDictSpace::UnflattenPoint(TArray<float>& FlattenedPoint)
 {
-	int StartIndex = 0;
-	FDictPoint Output = FDictPoint();
-	for (const TSpace& Space : this->Spaces)
+	if (!this->Layout.IsValid())
 	{
-		int Size = Visit([](auto& TypedSpace) { return TypedSpace.GetFlattenedSize(); }, Space);
-		TPoint Point = Visit([&FlattenedPoint, StartIndex](auto& TypedSpace) { return TypedSpace.UnflattenAction(FlattenedPoint, StartIndex); }, Space);
-		Output.Points.Add(Point);
-		StartIndex += Size;
+		this->BuildLayout();
 	}
+
+	FDictPoint Output = FDictPoint();
+	this->UnflattenInto(FlattenedPoint.GetData(), Output);
 	return Output;
 }
 
+void FDictSpace::UnflattenInto(const float* FlattenedPoint, FDictPoint& OutPoint) const
+{
+	if (!ensureMsgf(this->Layout.IsValid(), TEXT("UnflattenInto requires BuildLayout to have been called")))
+	{
+		return;
+	}
+
+	const FDictSpaceLayout& Plan = *this->Layout;
+	if (OutPoint.Points.Num() != Plan.Types.Num())
+	{
+		OutPoint.Points.SetNum(Plan.Types.Num());
+	}
+
+	for (int i = 0; i < Plan.Types.Num(); i++)
+	{
+		const float* In = FlattenedPoint + Plan.Offsets[i];
+		const int	 NumDims = Plan.NumDimensions[i];
+		TPoint&		 Point = OutPoint.Points[i];
+		// The existing typed points are reset rather than replaced, so their storage is reused across calls
+		switch (Plan.Types[i])
+		{
+			case ESpaceType::Box:
+			{
+				if (!Point.IsType<FBoxPoint>())
+				{
+					Point.Emplace<FBoxPoint>();
+				}
+				FBoxPoint& BoxPoint = Point.Get<FBoxPoint>();
+				BoxPoint.Reset();
+				BoxPoint.Append(In, NumDims);
+				break;
+			}
+			case ESpaceType::Binary:
+			{
+				// A packed point would keep reading from it's words, so replace it with an unpacked one
+				if (!Point.IsType<FBinaryPoint>() || Point.Get<FBinaryPoint>().bPacked)
+				{
+					Point.Emplace<FBinaryPoint>();
+				}
+				TArray<bool>& Values = Point.Get<FBinaryPoint>().Values;
+				Values.Reset();
+				for (int j = 0; j < NumDims; j++)
+				{
+					Values.Add(static_cast<bool>(In[j]));
+				}
+				break;
+			}
+			case ESpaceType::Discrete:
+			{
+				if (!Point.IsType<FDiscretePoint>())
+				{
+					Point.Emplace<FDiscretePoint>();
+				}
+				TArray<int>& Values = Point.Get<FDiscretePoint>().Values;
+				const int*	 BranchSizes = Plan.BranchSizes.GetData() + Plan.DimensionOffsets[i];
+				Values.Reset();
+				for (int j = 0; j < NumDims; j++)
+				{
+					Values.Add(FDiscreteSpace::GetMaxIndex(In, BranchSizes[j]));
+					In += BranchSizes[j];
+				}
+				break;
+			}
+		}
+	}
+}
+
+void FDictSpace::PackDimensions(const FDictPoint& Point, float* OutRow) const
+{
+	if (!ensureMsgf(this->Layout.IsValid(), TEXT("PackDimensions requires BuildLayout to have been called")))
+	{
+		return;
+	}
+
+	const FDictSpaceLayout& Plan = *this->Layout;
+	for (int i = 0; i < Plan.Types.Num(); i++)
+	{
+		float*	  Out = OutRow + Plan.DimensionOffsets[i];
+		const int NumDims = Plan.NumDimensions[i];
+		// Missing points, or points with too few values, are padded with zeros like FlattenInto does, rather than read past their end
+		int NumValues = 0;
+		if (i < Point.Points.Num())
+		{
+			Visit([Out, NumDims, &NumValues](auto& TypedPoint) {
+				NumValues = FMath::Min(TypedPoint.Num(), NumDims);
+				for (int j = 0; j < NumValues; j++)
+				{
+					Out[j] = static_cast<float>(TypedPoint[j]);
+				}
+			}, Point.Points[i]);
+		}
+		FMemory::Memzero(Out + NumValues, (NumDims - NumValues) * sizeof(float));
+	}
+}
+
+void FDictSpace::UnpackDimensions(const float* Row, FDictPoint& OutPoint) const
+{
+	if (!ensureMsgf(this->Layout.IsValid(), TEXT("UnpackDimensions requires BuildLayout to have been called")))
+	{
+		return;
+	}
+
+	const FDictSpaceLayout& Plan = *this->Layout;
+	if (OutPoint.Points.Num() != Plan.Types.Num())
+	{
+		OutPoint.Points.SetNum(Plan.Types.Num());
+	}
+
+	for (int i = 0; i < Plan.Types.Num(); i++)
+	{
+		const float* In = Row + Plan.DimensionOffsets[i];
+		const int	 NumDims = Plan.NumDimensions[i];
+		TPoint&		 Point = OutPoint.Points[i];
+		switch (Plan.Types[i])
+		{
+			case ESpaceType::Box:
+			{
+				if (!Point.IsType<FBoxPoint>())
+				{
+					Point.Emplace<FBoxPoint>();
+				}
+				FBoxPoint& BoxPoint = Point.Get<FBoxPoint>();
+				BoxPoint.Reset();
+				BoxPoint.Append(In, NumDims);
+				break;
+			}
+			case ESpaceType::Binary:
+			{
+				if (!Point.IsType<FBinaryPoint>() || Point.Get<FBinaryPoint>().bPacked)
+				{
+					Point.Emplace<FBinaryPoint>();
+				}
+				TArray<bool>& Values = Point.Get<FBinaryPoint>().Values;
+				Values.Reset();
+				for (int j = 0; j < NumDims; j++)
+				{
+					Values.Add(In[j] != 0.0f);
+				}
+				break;
+			}
+			case ESpaceType::Discrete:
+			{
+				if (!Point.IsType<FDiscretePoint>())
+				{
+					Point.Emplace<FDiscretePoint>();
+				}
+				TArray<int>& Values = Point.Get<FDiscretePoint>().Values;
+				Values.Reset();
+				for (int j = 0; j < NumDims; j++)
+				{
+					Values.Add(FMath::RoundToInt(In[j]));
+				}
+				break;
+			}
+		}
+	}
+}
+
+void FDictSpace::FlattenBatch(TArrayView<const FDictPoint> Points, TArrayView<float> OutBatch) const
+{
+	const int RowSize = this->GetFlattenedSize();
+	check(OutBatch.Num() >= Points.Num() * RowSize);
+
+	for (int Row = 0; Row < Points.Num(); Row++)
+	{
+		this->FlattenInto(OutBatch.Slice(Row * RowSize, RowSize), Points[Row]);
+	}
+}
+
+void FDictSpace::UnflattenBatch(TArrayView<const float> Batch, TArrayView<FDictPoint* const> OutPoints) const
+{
+	if (!ensureMsgf(this->Layout.IsValid(), TEXT("UnflattenBatch requires BuildLayout to have been called")))
+	{
+		return;
+	}
+
+	const int RowSize = this->Layout->FlattenedSize;
+	check(Batch.Num() >= OutPoints.Num() * RowSize);
+
+	for (int Row = 0; Row < OutPoints.Num(); Row++)
+	{
+		this->UnflattenInto(Batch.GetData() + Row * RowSize, *OutPoints[Row]);
+	}
+}
+
+bool FDictSpace::HasSameLayout(const FDictSpace& Other) const
+{
+	if (this == &Other || this->Layout == Other.Layout)
+	{
+		return this->Layout.IsValid();
+	}
+	if (!this->Layout.IsValid() || !Other.Layout.IsValid())
+	{
+		return false;
+	}
+	return this->Layout->Types == Other.Layout->Types && this->Layout->Sizes == Other.Layout->Sizes && this->Layout->BranchSizes == Other.Layout->BranchSizes;
+}
+
 FGenericTensorBinding FDictSpace::CreateTensorBinding(TArray<float>& EmptyBuffer) const
 {
 	int Size = this->GetFlattenedSize();
@@ -560,21 +1058,17 @@ FGenericTensorBinding FDictSpace::CreateTensorBinding(TArray<float>& EmptyBuffer
 FGenericTensorBinding FDictSpace::CreateTensorBinding(TArray<float>& Buffer, const FDictPoint& DictPoint) const
 {
 	int Size = this->GetFlattenedSize();
-	int Offset = 0;
-
-	for (int i = 0; i < this->Spaces.Num(); i++)
+	if (DictPoint.GetBufferSize() == Size)
 	{
-		const TSpace& Space = this->Spaces[i];
-		const TPoint&		  Point = DictPoint[i];
-		int			  Count = Visit([](auto& TypedSpace) { return TypedSpace.GetFlattenedSize(); }, Space);
-		Visit([&Point, &Buffer, Offset, Count](auto& TypedSpace) { TypedSpace.FlattenPoint(MakeArrayView(Buffer.GetData() + Offset, Count), Point); }, Space);
-		Offset += Count;
+		return { DictPoint.Buffer->GetData(), Size * sizeof(float) };
 	}
+	this->FlattenInto(MakeArrayView(Buffer.GetData(), Size), DictPoint);
 	return {Buffer.GetData(), Size * sizeof(float) };
 }
 
 TSpace& FDictSpace::Add(const FString& Label)
 {
+	this->Layout.Reset();
 	this->Labels.Add(Label);
 	return this->Spaces.Emplace_GetRef();
 }
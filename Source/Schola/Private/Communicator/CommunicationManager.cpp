@@ -90,7 +90,7 @@ bool UCommunicationManager::StartBackends()
 	}
 }
 
-void UCommunicationManager::Initialize()
+void UCommunicationManager::Initialize(int PortOffset)
 {
 	// Load settings from our corresponding developer settings object
 	const UScholaManagerSubsystemSettings* Settings = GetDefault<UScholaManagerSubsystemSettings>();
@@ -100,6 +100,7 @@ void UCommunicationManager::Initialize()
 		// Parse failed so we fall back to the default
 		Port = Settings->CommunicatorSettings.Port;
 	}
+	Port += PortOffset;
 	this->ServerURL = Settings->CommunicatorSettings.Address + FString(":") + FString::FromInt(Port);
 	Builder = new grpc::ServerBuilder();
 	Builder->AddListeningPort(TCHAR_TO_UTF8(*ServerURL), grpc::InsecureServerCredentials());
@@ -1,52 +1,126 @@
 // Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
 
 #include "Communicator/ProtobufDeserializer.h"
+#include "Common/LogSchola.h"
 
 using namespace ProtobufDeserializer;
 
+/**
+ * @brief Copy the values of a repeated field into a point, reusing the point's storage if it already holds the right type
+ * @tparam PointType The concrete point type to deserialize into
+ * @param[in] ProtoValues The repeated field to copy from
+ * @param[in,out] OutPoint The point to copy into
+ */
+template <typename PointType, typename ProtoValuesType>
+static void CopyIntoPoint(const ProtoValuesType& ProtoValues, TPoint& OutPoint)
+{
+	if (!OutPoint.IsType<PointType>())
+	{
+		OutPoint.Emplace<PointType>();
+	}
+	auto& Values = OutPoint.Get<PointType>().Values;
+	static_assert(sizeof(*Values.GetData()) == sizeof(*ProtoValues.data()), "Point and protobuf value types must have the same size");
+	// Reset keeps the allocation, and Append of a trivially copyable type is a single memcpy
+	Values.Reset();
+	Values.Append(ProtoValues.data(), ProtoValues.size());
+}
+
+/**
+ * @brief Remove any entries from a map whose keys don't appear in a protobuf map
+ * @param[in] ProtoMap The protobuf map containing the keys to keep
+ * @param[in,out] OutMap The map to remove stale entries from
+ */
+template <typename ProtoMapType, typename MapType>
+static void RemoveStaleEntries(const ProtoMapType& ProtoMap, MapType& OutMap)
+{
+	if (OutMap.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<int> StaleKeys;
+	for (const auto& Entry : OutMap)
+	{
+		if (!ProtoMap.contains(Entry.Key))
+		{
+			StaleKeys.Add(Entry.Key);
+		}
+	}
+	for (int Key : StaleKeys)
+	{
+		OutMap.Remove(Key);
+	}
+}
+
+/**
+ * @brief Copy the step each environment's update answers, which is only sent when stepping asynchronously
+ * @param[in] ProtoMsg The update to copy the steps from
+ * @param[in,out] OutTrainingStateUpdate The update to copy the steps into
+ */
+static void DeserializeEnvSteps(const Schola::TrainingStateUpdate& ProtoMsg, FTrainingStateUpdate& OutTrainingStateUpdate)
+{
+	OutTrainingStateUpdate.EnvSteps.Reset();
+	for (const auto& Entry : ProtoMsg.env_steps())
+	{
+		OutTrainingStateUpdate.EnvSteps.Add(Entry.first, Entry.second);
+	}
+}
+
 void ProtobufDeserializer::Deserialize(const Schola::FundamentalPoint& ProtoMsg, TPoint& OutPoint)
 {
 	switch (ProtoMsg.point_case())
 	{
-		//If we make local variables here then it complains about local variables inside switch statement
 		case Schola::FundamentalPoint::kBinaryPoint:
-			OutPoint.Emplace<FBinaryPoint>(ProtoMsg.binary_point().values().data(), ProtoMsg.binary_point().values_size());
+		{
+			const Schola::BinaryPoint& BinaryMsg = ProtoMsg.binary_point();
+			const int				   NumPacked = BinaryMsg.num_packed_values();
+			const int64				   NumBytes = BinaryMsg.packed_values().size();
+			if (NumPacked < 0 || NumBytes < (int64(NumPacked) + 7) / 8)
+			{
+				// Reading the bits would run off the end of the message, so leave the point as it was
+				UE_LOG(LogSchola, Warning, TEXT("Skipping a binary point with %d packed values in %lld bytes"), NumPacked, NumBytes);
+			}
+			else if (NumPacked > 0)
+			{
+				OutPoint.Emplace<FBinaryPoint>(reinterpret_cast<const uint8*>(BinaryMsg.packed_values().data()), NumBytes, NumPacked);
+			}
+			else
+			{
+				if (OutPoint.IsType<FBinaryPoint>() && OutPoint.Get<FBinaryPoint>().bPacked)
+				{
+					OutPoint.Emplace<FBinaryPoint>();
+				}
+				CopyIntoPoint<FBinaryPoint>(BinaryMsg.values(), OutPoint);
+			}
 			break;
+		}
 		case Schola::FundamentalPoint::kBoxPoint:
-			OutPoint.Emplace<FBoxPoint>(ProtoMsg.box_point().values().data(), ProtoMsg.box_point().values_size());
+			CopyIntoPoint<FBoxPoint>(ProtoMsg.box_point().values(), OutPoint);
 			break;
 		case Schola::FundamentalPoint::kDiscretePoint:
-			OutPoint.Emplace<FDiscretePoint>(ProtoMsg.discrete_point().values().data(), ProtoMsg.discrete_point().values_size());
+			CopyIntoPoint<FDiscretePoint>(ProtoMsg.discrete_point().values(), OutPoint);
+			break;
+		default:
 			break;
 	}
 }
 
 void ProtobufDeserializer::Deserialize(const Schola::DictPoint& ProtoMsg, FDictPoint& OutPoint)
 {
-	for (const Schola::FundamentalPoint& FundPoint : ProtoMsg.values())
+	// Overwrite existing points in place, so an action deserialized every step keeps its buffers
+	OutPoint.Points.SetNum(ProtoMsg.values_size());
+	for (int i = 0; i < ProtoMsg.values_size(); i++)
 	{
-		switch (FundPoint.point_case())
-		{
-			case Schola::FundamentalPoint::kBinaryPoint:
-				OutPoint.Points.Emplace_GetRef(TInPlaceType<FBinaryPoint>(), FundPoint.binary_point().values().data(), FundPoint.binary_point().values_size());
-				break;
-			case Schola::FundamentalPoint::kBoxPoint:
-				OutPoint.Points.Emplace_GetRef(TInPlaceType<FBoxPoint>(), FundPoint.box_point().values().data(), FundPoint.box_point().values_size());
-				break;
-			case Schola::FundamentalPoint::kDiscretePoint:
-				OutPoint.Points.Emplace_GetRef(TInPlaceType<FDiscretePoint>(), FundPoint.discrete_point().values().data(), FundPoint.discrete_point().values_size());
-				break;
-		}
-
-		
+		Deserialize(ProtoMsg.values(i), OutPoint.Points[i]);
 	}
 }
 
 void ProtobufDeserializer::Deserialize(const Schola::EnvironmentStep& ProtoMsg, FEnvStep& OutEnvStep)
 {
+	RemoveStaleEntries(ProtoMsg.updates(), OutEnvStep.Actions);
 	for (auto& AgentUpdateTuple : ProtoMsg.updates())
 	{
-		FAction& Action = OutEnvStep.Actions.Add(AgentUpdateTuple.first);
+		FAction& Action = OutEnvStep.Actions.FindOrAdd(AgentUpdateTuple.first);
 		Deserialize(AgentUpdateTuple.second, Action);
 
 	}
@@ -54,17 +128,14 @@ void ProtobufDeserializer::Deserialize(const Schola::EnvironmentStep& ProtoMsg,
 
 void ProtobufDeserializer::Deserialize(const Schola::EnvironmentReset& ProtoMsg, FEnvReset& OutEnvReset)
 {
-
+	OutEnvReset.Options.Reset();
 	for (auto& Item : ProtoMsg.options())
 	{
 		OutEnvReset.Options.Add(UTF8_TO_TCHAR(Item.first.c_str()), UTF8_TO_TCHAR(Item.second.c_str()));
 	}
 	
-	if (ProtoMsg.has_seed())
-	{
-		OutEnvReset.Seed = ProtoMsg.seed();
-		OutEnvReset.bHasSeed = true;
-	}
+	OutEnvReset.bHasSeed = ProtoMsg.has_seed();
+	OutEnvReset.Seed = ProtoMsg.has_seed() ? ProtoMsg.seed() : 0;
 }
 
 void ProtobufDeserializer::Deserialize(const Schola::EnvironmentStateUpdate& ProtoMsg, FEnvUpdate& OutEnvUpdate)
@@ -73,11 +144,17 @@ void ProtobufDeserializer::Deserialize(const Schola::EnvironmentStateUpdate& Pro
 	{
 		//Can't make local variables here because of switch statement
 		case (Schola::EnvironmentStateUpdate::kReset):
-			OutEnvUpdate.Update.Emplace<FEnvReset>();
+			if (!OutEnvUpdate.IsReset())
+			{
+				OutEnvUpdate.Update.Emplace<FEnvReset>();
+			}
 			Deserialize(ProtoMsg.reset(), OutEnvUpdate.Update.Get<FEnvReset>());
 			break;
 		case (Schola::EnvironmentStateUpdate::kStep):
-			OutEnvUpdate.Update.Emplace<FEnvStep>();
+			if (!OutEnvUpdate.IsStep())
+			{
+				OutEnvUpdate.Update.Emplace<FEnvStep>();
+			}
 			Deserialize(ProtoMsg.step(), OutEnvUpdate.Update.Get<FEnvStep>());
 			break;
 		default:
@@ -88,9 +165,107 @@ void ProtobufDeserializer::Deserialize(const Schola::EnvironmentStateUpdate& Pro
 void ProtobufDeserializer::Deserialize(const Schola::TrainingStateUpdate& ProtoMsg, FTrainingStateUpdate& OutTrainingStateUpdate)
 {
 	OutTrainingStateUpdate.Status = static_cast<EConnectorStatusUpdate>(ProtoMsg.status());
+	DeserializeEnvSteps(ProtoMsg, OutTrainingStateUpdate);
+	RemoveStaleEntries(ProtoMsg.updates(), OutTrainingStateUpdate.EnvUpdates);
+	for (auto& EnvUpdateMsg : ProtoMsg.updates())
+	{
+		Deserialize(EnvUpdateMsg.second, OutTrainingStateUpdate.EnvUpdates.FindOrAdd(EnvUpdateMsg.first));
+	}
+}
+
+void ProtobufDeserializer::Deserialize(const Schola::TrainingStateUpdate& ProtoMsg, FTrainingStateUpdate& OutTrainingStateUpdate, TArrayView<const FDenseAgentGroup> DenseGroups)
+{
+	if (ProtoMsg.dense_actions_size() == 0)
+	{
+		Deserialize(ProtoMsg, OutTrainingStateUpdate);
+		return;
+	}
+
+	OutTrainingStateUpdate.Status = static_cast<EConnectorStatusUpdate>(ProtoMsg.status());
+	DeserializeEnvSteps(ProtoMsg, OutTrainingStateUpdate);
+
+	// Every agent given a dense action this step, keyed by env and agent id, so actions left over from previous steps can be dropped
+	TSet<uint64> DenseAgents;
+	TSet<int>	 DenseEnvs;
+	for (const Schola::DenseGroupActions& GroupMsg : ProtoMsg.dense_actions())
+	{
+		for (int i = 0; i < GroupMsg.env_ids_size(); i++)
+		{
+			DenseEnvs.Add(GroupMsg.env_ids(i));
+			DenseAgents.Add((uint64(uint32(GroupMsg.env_ids(i))) << 32) | uint32(GroupMsg.agent_ids(i)));
+		}
+	}
+
+	TArray<int> StaleEnvs;
+	for (const auto& Entry : OutTrainingStateUpdate.EnvUpdates)
+	{
+		if (!ProtoMsg.updates().contains(Entry.Key) && !DenseEnvs.Contains(Entry.Key))
+		{
+			StaleEnvs.Add(Entry.Key);
+		}
+	}
+	for (int EnvId : StaleEnvs)
+	{
+		OutTrainingStateUpdate.EnvUpdates.Remove(EnvId);
+	}
+
 	for (auto& EnvUpdateMsg : ProtoMsg.updates())
 	{
-		Deserialize(EnvUpdateMsg.second, OutTrainingStateUpdate.EnvUpdates.Add(EnvUpdateMsg.first));
+		Deserialize(EnvUpdateMsg.second, OutTrainingStateUpdate.EnvUpdates.FindOrAdd(EnvUpdateMsg.first));
+	}
+
+	for (const Schola::DenseGroupActions& GroupMsg : ProtoMsg.dense_actions())
+	{
+		if (!DenseGroups.IsValidIndex(GroupMsg.group_id()) || DenseGroups[GroupMsg.group_id()].PolicyDefinition == nullptr)
+		{
+			UE_LOG(LogSchola, Warning, TEXT("Received dense actions for unknown group %d"), GroupMsg.group_id());
+			continue;
+		}
+
+		const FDictSpace& ActionSpace = DenseGroups[GroupMsg.group_id()].PolicyDefinition->ActionSpaceDefn;
+		const int		  ActionDims = DenseGroups[GroupMsg.group_id()].GetActionDimensions();
+		const int		  NumAgents = FMath::Min(GroupMsg.env_ids_size(), GroupMsg.agent_ids_size());
+		if (GroupMsg.actions().size() != NumAgents * ActionDims * sizeof(float))
+		{
+			UE_LOG(LogSchola, Warning, TEXT("Dense actions for group %d have %d bytes, expected %d"), GroupMsg.group_id(), int(GroupMsg.actions().size()), int(NumAgents * ActionDims * sizeof(float)));
+			continue;
+		}
+
+		const float* Rows = reinterpret_cast<const float*>(GroupMsg.actions().data());
+		for (int i = 0; i < NumAgents; i++)
+		{
+			FEnvUpdate& EnvUpdate = OutTrainingStateUpdate.EnvUpdates.FindOrAdd(GroupMsg.env_ids(i));
+			if (!EnvUpdate.IsStep())
+			{
+				EnvUpdate.Update.Emplace<FEnvStep>();
+			}
+			FAction& Action = EnvUpdate.Update.Get<FEnvStep>().Actions.FindOrAdd(GroupMsg.agent_ids(i));
+			ActionSpace.UnpackDimensions(Rows + i * ActionDims, Action.Values);
+		}
+	}
+
+	// Drop actions from previous steps, for agents in dense envs that weren't sent anything this step
+	for (int EnvId : DenseEnvs)
+	{
+		FEnvUpdate* EnvUpdate = OutTrainingStateUpdate.EnvUpdates.Find(EnvId);
+		if (!EnvUpdate || !EnvUpdate->IsStep() || ProtoMsg.updates().contains(EnvId))
+		{
+			continue;
+		}
+
+		TSortedMap<int, FAction>& Actions = EnvUpdate->Update.Get<FEnvStep>().Actions;
+		TArray<int>				  StaleAgents;
+		for (const auto& Entry : Actions)
+		{
+			if (!DenseAgents.Contains((uint64(uint32(EnvId)) << 32) | uint32(Entry.Key)))
+			{
+				StaleAgents.Add(Entry.Key);
+			}
+		}
+		for (int AgentId : StaleAgents)
+		{
+			Actions.Remove(AgentId);
+		}
 	}
 }
 
@@ -0,0 +1,260 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#include "Communicator/SharedMemoryTransport.h"
+#include "HAL/PlatformProcess.h"
+
+/** The number of times in a row Backoff spins or yields, before it starts sleeping */
+static constexpr int32 BusyWaitAttempts = 2048;
+
+/**
+ * @brief Wait a little longer each time we find nothing to do. Spins first, so a message that arrives right away is picked up without giving up the core
+ * @param[in] Attempt How many times in a row we have waited
+ */
+static void Backoff(int32 Attempt)
+{
+	if (Attempt < 1024)
+	{
+		FPlatformProcess::Yield();
+	}
+	else if (Attempt < BusyWaitAttempts)
+	{
+		FPlatformProcess::YieldThread();
+	}
+	else
+	{
+		FPlatformProcess::SleepNoStats(0.0001f);
+	}
+}
+
+FSharedMemoryRing::FSharedMemoryRing(uint8* Base, uint32 Capacity)
+	: WritePos(reinterpret_cast<std::atomic<uint64>*>(Base)), ReadPos(reinterpret_cast<std::atomic<uint64>*>(Base + ControlSize / 2)), Data(Base + ControlSize), Capacity(Capacity)
+{
+}
+
+bool FSharedMemoryRing::Write(uint32 Method, uint32 Size, TFunctionRef<void(uint8*)> Fill, const std::atomic<bool>& bStop)
+{
+	const uint32 RecordSize = GetRecordSize(Size);
+	if (RecordSize > this->Capacity)
+	{
+		UE_LOG(LogScholaCommunicator, Error, TEXT("Message of %u bytes doesn't fit in a shared memory ring of %u bytes"), Size, this->Capacity);
+		return false;
+	}
+
+	uint64 Pos = this->WritePos->load(std::memory_order_relaxed);
+	// Wait until Needed bytes after Pos are free
+	auto WaitForSpace = [this, &Pos, &bStop](uint64 Needed) {
+		for (int32 Attempt = 0; Pos + Needed - this->ReadPos->load(std::memory_order_acquire) > this->Capacity; Attempt++)
+		{
+			if (bStop.load(std::memory_order_relaxed))
+			{
+				return false;
+			}
+			Backoff(Attempt);
+		}
+		return true;
+	};
+
+	uint32 Offset = Pos % this->Capacity;
+	const uint32 Tail = this->Capacity - Offset;
+	if (RecordSize > Tail)
+	{
+		// Skip the rest of the ring so the record can be contiguous
+		if (!WaitForSpace(Tail))
+		{
+			return false;
+		}
+		uint32* Header = reinterpret_cast<uint32*>(this->Data + Offset);
+		Header[0] = 0;
+		Header[1] = WrapMarker;
+		Pos += Tail;
+		this->WritePos->store(Pos, std::memory_order_release);
+		Offset = 0;
+	}
+
+	if (!WaitForSpace(RecordSize))
+	{
+		return false;
+	}
+	uint32* Header = reinterpret_cast<uint32*>(this->Data + Offset);
+	Header[0] = Size;
+	Header[1] = Method;
+	Fill(this->Data + Offset + RecordHeaderSize);
+	this->WritePos->store(Pos + RecordSize, std::memory_order_release);
+	return true;
+}
+
+ESharedMemoryReadResult FSharedMemoryRing::TryRead(TFunctionRef<void(uint32, const uint8*, uint32)> Read)
+{
+	uint64 Pos = this->ReadPos->load(std::memory_order_relaxed);
+	uint64 End = this->WritePos->load(std::memory_order_acquire);
+	while (Pos != End)
+	{
+		// The other side writes the positions and headers, so check everything against the ring before using it
+		const uint64 Available = End - Pos;
+		const uint32 Offset = Pos % this->Capacity;
+		const uint32 Tail = this->Capacity - Offset;
+		if (Available > this->Capacity || Tail < RecordHeaderSize || Available < RecordHeaderSize)
+		{
+			return ESharedMemoryReadResult::Corrupt;
+		}
+
+		// Copy the header out, so it can't change between being checked and used
+		const uint32* Header = reinterpret_cast<const uint32*>(this->Data + Offset);
+		const uint32  Size = Header[0];
+		const uint32  Method = Header[1];
+		if (Method == WrapMarker)
+		{
+			if (Tail > Available)
+			{
+				return ESharedMemoryReadResult::Corrupt;
+			}
+			Pos += Tail;
+			this->ReadPos->store(Pos, std::memory_order_release);
+			End = this->WritePos->load(std::memory_order_acquire);
+			continue;
+		}
+
+		// Records never wrap, so the whole record has to fit before the end of the ring, as well as within what has been written
+		const uint64 RecordSize = Align(uint64(RecordHeaderSize) + Size, 8);
+		if (RecordSize > Tail || RecordSize > Available)
+		{
+			return ESharedMemoryReadResult::Corrupt;
+		}
+
+		Read(Method, this->Data + Offset + RecordHeaderSize, Size);
+		this->ReadPos->store(Pos + RecordSize, std::memory_order_release);
+		return ESharedMemoryReadResult::Read;
+	}
+	return ESharedMemoryReadResult::Empty;
+}
+
+FSharedMemoryTransport::FSharedMemoryTransport(const FString& Name, uint32 RingCapacity)
+	: Name(Name), StopEvent(FPlatformProcess::GetSynchEventFromPool(true))
+{
+	RingCapacity = Align(RingCapacity, 64);
+	const SIZE_T RingSize = FSharedMemoryRing::ControlSize + RingCapacity;
+	const uint32 AccessMode = static_cast<uint32>(FPlatformMemory::ESharedMemoryAccess::Read) | static_cast<uint32>(FPlatformMemory::ESharedMemoryAccess::Write);
+
+	this->Region = FPlatformMemory::MapNamedSharedMemoryRegion(Name, true, AccessMode, HeaderSize + 2 * RingSize);
+	if (this->Region == nullptr)
+	{
+		UE_LOG(LogScholaCommunicator, Error, TEXT("Could not create shared memory region %s"), *Name);
+		return;
+	}
+
+	uint8* Base = static_cast<uint8*>(this->Region->GetAddress());
+	FMemory::Memzero(Base, HeaderSize + 2 * RingSize);
+	this->ToUnreal = FSharedMemoryRing(Base + HeaderSize, RingCapacity);
+	this->FromUnreal = FSharedMemoryRing(Base + HeaderSize + RingSize, RingCapacity);
+
+	// Write the magic number last, so a client never sees a partially set up block
+	uint32* Header = reinterpret_cast<uint32*>(Base);
+	Header[1] = Version;
+	Header[2] = RingCapacity;
+	reinterpret_cast<std::atomic<uint32>*>(Header)->store(Magic, std::memory_order_release);
+	UE_LOG(LogScholaCommunicator, Log, TEXT("Created shared memory region %s with %u byte rings"), *Name, RingCapacity);
+}
+
+FSharedMemoryTransport::~FSharedMemoryTransport()
+{
+	this->Shutdown();
+	delete this->Thread;
+	FPlatformProcess::ReturnSynchEventToPool(this->StopEvent);
+	if (this->Region != nullptr)
+	{
+		FPlatformMemory::UnmapNamedSharedMemoryRegion(this->Region);
+	}
+}
+
+void FSharedMemoryTransport::RegisterHandler(ESharedMemoryMethod Method, FMessageHandler&& Handler)
+{
+	this->Handlers.Add(static_cast<uint32>(Method), MoveTemp(Handler));
+}
+
+bool FSharedMemoryTransport::Send(ESharedMemoryMethod Method, const google::protobuf::Message& Msg)
+{
+	if (!this->IsValid())
+	{
+		return false;
+	}
+	FScopeLock Lock(&this->WriteLock);
+	const uint32 Size = static_cast<uint32>(Msg.ByteSizeLong());
+	return this->FromUnreal.Write(static_cast<uint32>(Method), Size, [&Msg](uint8* Out) { Msg.SerializeWithCachedSizesToArray(Out); }, this->bStopping);
+}
+
+void FSharedMemoryTransport::Start()
+{
+	if (this->IsValid() && this->Thread == nullptr)
+	{
+		this->Thread = FRunnableThread::Create(this, TEXT("SharedMemoryTransport"), 0, TPri_Normal);
+	}
+}
+
+void FSharedMemoryTransport::Shutdown()
+{
+	this->Stop();
+	if (this->Thread != nullptr)
+	{
+		this->Thread->WaitForCompletion();
+	}
+}
+
+bool FSharedMemoryTransport::Init()
+{
+	return true;
+}
+
+uint32 FSharedMemoryTransport::Run()
+{
+	int32 Attempt = 0;
+	while (!this->bStopping.load(std::memory_order_relaxed))
+	{
+		const ESharedMemoryReadResult Result = this->ToUnreal.TryRead([this](uint32 Method, const uint8* Payload, uint32 Size) {
+			if (FMessageHandler* Handler = this->Handlers.Find(Method))
+			{
+				(*Handler)(Payload, Size);
+			}
+			else
+			{
+				UE_LOG(LogScholaCommunicator, Warning, TEXT("No handler for message with method %u on %s"), Method, *this->Name);
+			}
+		});
+		if (Result == ESharedMemoryReadResult::Corrupt)
+		{
+			UE_LOG(LogScholaCommunicator, Error, TEXT("Found a record that doesn't fit in the ring on %s. Closing the shared memory transport"), *this->Name);
+			this->bFailed = true;
+			break;
+		}
+
+		if (Result == ESharedMemoryReadResult::Read)
+		{
+			Attempt = 0;
+			continue;
+		}
+
+		// Stop counting once the wait is at it's longest, so a long idle can't overflow
+		Attempt = FMath::Min(Attempt + 1, BusyWaitAttempts + static_cast<int32>(FMath::FloorLog2(MaxIdleWaitMs)));
+		if (Attempt < BusyWaitAttempts)
+		{
+			Backoff(Attempt);
+		}
+		else
+		{
+			// The client has gone quiet (e.g. while it trains), so block between polls, twice as long each time up to a cap. Stopping wakes us right away
+			this->StopEvent->Wait(1u << (Attempt - BusyWaitAttempts));
+		}
+	}
+	UE_LOG(LogScholaCommunicator, Verbose, TEXT("Shared memory reader for %s stopped"), *this->Name);
+	return 0;
+}
+
+void FSharedMemoryTransport::Stop()
+{
+	this->bStopping = true;
+	this->StopEvent->Trigger();
+}
+
+void FSharedMemoryTransport::Exit()
+{
+	// Called on Completion so do nothing
+}
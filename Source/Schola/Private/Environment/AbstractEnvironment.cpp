@@ -1,12 +1,128 @@
 // Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
 
 #include "Environment/AbstractEnvironment.h"
+#include "Subsystem/ScholaRegistrySubsystem.h"
+
+int AAbstractScholaEnvironment::AddAgent(AAbstractTrainer* Agent)
+{
+	const int AgentId = this->FreeAgentIds.Num() > 0 ? this->FreeAgentIds.Last() : this->MaxId;
+	if (!Agent->Initialize(this->EnvId, AgentId))
+	{
+		return INDEX_NONE;
+	}
+
+	// Only claim the id once the agent has initialized, so a failed agent doesn't use one up
+	if (this->FreeAgentIds.Num() > 0)
+	{
+		this->FreeAgentIds.Pop(false);
+	}
+	else
+	{
+		this->MaxId++;
+	}
+
+	this->Trainers.Add(AgentId, Agent);
+	Agent->Environment = this;
+	for (UAbstractEnvironmentUtilityComponent* Component : UtilityComponents)
+	{
+		Component->OnAgentRegister(AgentId);
+	}
+	return AgentId;
+}
+
+int AAbstractScholaEnvironment::RemoveAgent(AAbstractTrainer* Agent)
+{
+	const int* AgentId = this->Trainers.FindKey(Agent);
+	if (AgentId == nullptr)
+	{
+		return INDEX_NONE;
+	}
+
+	const int RemovedId = *AgentId;
+	this->Trainers.Remove(RemovedId);
+	// Hand out the longest freed ids first, so actions still in flight for an agent that just left are unlikely to reach it's replacement
+	this->FreeAgentIds.Insert(RemovedId, 0);
+	Agent->Environment = nullptr;
+	return RemovedId;
+}
 
-// Not used in this file to UtilityComponents Events to initialize before MaxId is incremented.
 void AAbstractScholaEnvironment::RegisterAgent(AAbstractTrainer* Agent)
 {
-	this->Trainers.Add(MaxId, Agent);
-	MaxId++;
+	if (Agent == nullptr)
+	{
+		return;
+	}
+
+	if (this->bIteratingAgents)
+	{
+		// Joining again before a deferred leave is applied just cancels the leave
+		if (this->PendingLeaves.Remove(Agent) == 0 && Agent->Environment != this)
+		{
+			this->PendingJoins.AddUnique(Agent);
+		}
+		return;
+	}
+
+	if (Agent->Environment == this)
+	{
+		return;
+	}
+	else if (Agent->Environment != nullptr)
+	{
+		Agent->Environment->DeregisterAgent(Agent);
+	}
+
+	const int AgentId = this->AddAgent(Agent);
+	if (AgentId == INDEX_NONE)
+	{
+		UE_LOG(LogSchola, Warning, TEXT("Initializing Agent %s Failed in Environment %s. Skipping."), *Agent->GetName(), *this->GetName());
+		return;
+	}
+
+	UE_LOG(LogSchola, Verbose, TEXT("Agent %s Joined Environment %s as Agent %d"), *Agent->GetName(), *this->GetName(), AgentId);
+	this->OnAgentAdded.Broadcast(this, AgentId);
+}
+
+void AAbstractScholaEnvironment::DeregisterAgent(AAbstractTrainer* Agent)
+{
+	if (this->bIteratingAgents)
+	{
+		// An agent that was waiting to join never joined, so there is nothing to remove
+		if (this->PendingJoins.Remove(Agent) == 0)
+		{
+			this->PendingLeaves.AddUnique(Agent);
+		}
+		return;
+	}
+
+	const int AgentId = this->RemoveAgent(Agent);
+	if (AgentId != INDEX_NONE)
+	{
+		UE_LOG(LogSchola, Verbose, TEXT("Agent %s Left Environment %s, freeing Agent %d"), *Agent->GetName(), *this->GetName(), AgentId);
+		this->OnAgentRemoved.Broadcast(this, AgentId);
+	}
+}
+
+void AAbstractScholaEnvironment::ApplyPendingMembershipChanges()
+{
+	// Leaves first, so their ids can go straight to the agents joining
+	TArray<AAbstractTrainer*> Leaves = MoveTemp(this->PendingLeaves);
+	for (AAbstractTrainer* Agent : Leaves)
+	{
+		this->DeregisterAgent(Agent);
+	}
+
+	TArray<AAbstractTrainer*> Joins = MoveTemp(this->PendingJoins);
+	for (AAbstractTrainer* Agent : Joins)
+	{
+		this->RegisterAgent(Agent);
+	}
+}
+
+AAbstractTrainer* AAbstractScholaEnvironment::GetAgent(int AgentId) const
+{
+	AAbstractTrainer* const* Agent = this->Trainers.Find(AgentId);
+	return Agent ? *Agent : nullptr;
 }
 
 void AAbstractScholaEnvironment::Initialize()
@@ -30,17 +146,7 @@ void AAbstractScholaEnvironment::Initialize()
 			{
 				UE_LOG(LogSchola, Warning, TEXT("Pawn %s is Not Controlled by a valid Agent in Environment %s. Skipping."), *ControlledPawn->GetName(), *this->GetName());
 			}
-			else if (Agent->Initialize(this->EnvId, MaxId))
-			{
-				Trainers.Add(MaxId, Agent);
-				for (UAbstractEnvironmentUtilityComponent* Component : UtilityComponents)
-				{
-					Component->OnAgentRegister(MaxId);
-				}
-				// Increment so it is always largets value+1, that way RegisterAgent never clobbers
-				MaxId++;
-			}
-			else
+			else if (this->AddAgent(Agent) == INDEX_NONE)
 			{
 				UE_LOG(LogSchola, Warning, TEXT("Initializing Agent for Pawn %s Failed in Environment %s. Skipping."), *ControlledPawn->GetName(), *this->GetName());
 			}
@@ -92,11 +198,14 @@ FVector AAbstractScholaEnvironment::GetEnvironmentCenterPoint()
 void AAbstractScholaEnvironment::Reset()
 {
 	ResetEnvironment();
+	this->bIteratingAgents = true;
 	for (auto& IdAgentPair : Trainers)
 	{
 		AAbstractTrainer* Trainer = IdAgentPair.Value;
 		Trainer->Reset();
 	}
+	this->bIteratingAgents = false;
+	this->ApplyPendingMembershipChanges();
 
 	for (UAbstractEnvironmentUtilityComponent* Component : UtilityComponents)
 	{
@@ -109,13 +218,16 @@ void AAbstractScholaEnvironment::MarkCompleted()
 	this->EnvironmentStatus = EEnvironmentStatus::Completed;
 }
 
-void AAbstractScholaEnvironment::AllAgentsThink()
+bool AAbstractScholaEnvironment::AllAgentsThink(bool bAccumulateRewards)
 {
 	bool AllDone = true;
+	bool bAnyFinished = false;
 
+	this->bIteratingAgents = true;
 	for (auto& IdAgentPair : Trainers)
 	{
-		FTrainerState State = IdAgentPair.Value->Think();
+		FTrainerState State = IdAgentPair.Value->Think(bAccumulateRewards);
+		bAnyFinished |= State.TrainingMsgStatus == ETrainingMsgStatus::LastMsgPending;
 
 		// Pass agent state to Utility Components for calculations.
 		for (UAbstractEnvironmentUtilityComponent* Component : UtilityComponents)
@@ -134,20 +246,29 @@ void AAbstractScholaEnvironment::AllAgentsThink()
 		this->EnvironmentStatus = EEnvironmentStatus::Completed;
 	}
 
+	this->bIteratingAgents = false;
+	this->ApplyPendingMembershipChanges();
+
 	// If all agents are done, mark the environment as completed
+	return bAnyFinished;
 }
 
 void AAbstractScholaEnvironment::AllAgentsAct(const FEnvStep& EnvUpdate)
 {
+	this->bIteratingAgents = true;
 	for (const TTuple<int, FAction>& IdActionPair : EnvUpdate.Actions)
 	{
+		// Actions can arrive for agents that left after their last state was sent
+		AAbstractTrainer** Trainer = Trainers.Find(IdActionPair.Key);
 		// We only act if we are running
-		if (Trainers[IdActionPair.Key]->State.TrainingStatus != EAgentTrainingStatus::Running)
+		if (Trainer == nullptr || (*Trainer)->State.TrainingStatus != EAgentTrainingStatus::Running)
 		{
 			continue;
 		}
-		Trainers[IdActionPair.Key]->Act(IdActionPair.Value);
+		(*Trainer)->Act(IdActionPair.Value);
 	}
+	this->bIteratingAgents = false;
+	this->ApplyPendingMembershipChanges();
 }
 
 void AAbstractScholaEnvironment::SetEnvId(int EnvironmentId)
@@ -164,3 +285,21 @@ EEnvironmentStatus AAbstractScholaEnvironment::GetStatus()
 {
 	return this->EnvironmentStatus;
 }
+
+void AAbstractScholaEnvironment::BeginPlay()
+{
+	Super::BeginPlay();
+	if (UScholaRegistrySubsystem* Registry = UScholaRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterEnvironment(this);
+	}
+}
+
+void AAbstractScholaEnvironment::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UScholaRegistrySubsystem* Registry = UScholaRegistrySubsystem::Get(this))
+	{
+		Registry->DeregisterEnvironment(this);
+	}
+	Super::EndPlay(EndPlayReason);
+}
@@ -0,0 +1,159 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#include "Environment/EnvironmentSpawner.h"
+#include "Engine/World.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Pawn.h"
+#include "Serialization/ArchiveReplaceObjectRef.h"
+
+void AEnvironmentSpawner::GatherTemplateActors(TArray<AActor*>& OutTemplateActors) const
+{
+	OutTemplateActors.Add(this->TemplateEnvironment);
+
+	// The environment doesn't own its pawns, so ask it which ones it will register, and take their trainers along with them
+	TArray<APawn*> TemplatePawns;
+	this->TemplateEnvironment->RegisterAgents(TemplatePawns);
+	for (APawn* Pawn : TemplatePawns)
+	{
+		if (Pawn == nullptr)
+		{
+			continue;
+		}
+		OutTemplateActors.AddUnique(Pawn);
+		if (AController* Controller = Pawn->GetController())
+		{
+			OutTemplateActors.AddUnique(Controller);
+		}
+	}
+
+	for (AActor* Actor : this->AdditionalActors)
+	{
+		if (Actor != nullptr)
+		{
+			OutTemplateActors.AddUnique(Actor);
+		}
+	}
+}
+
+FVector2D AEnvironmentSpawner::ComputeSpacing(const TArray<AActor*>& TemplateActors) const
+{
+	FBox Bounds(ForceInit);
+	for (AActor* Actor : TemplateActors)
+	{
+		FVector Origin;
+		FVector Extent;
+		Actor->GetActorBounds(true, Origin, Extent, true);
+		if (!Extent.IsNearlyZero())
+		{
+			Bounds += FBox::BuildAABB(Origin, Extent);
+		}
+	}
+
+	const FVector Size = Bounds.IsValid ? Bounds.GetSize() : FVector::ZeroVector;
+	return FVector2D(
+		this->Spacing.X > 0.0f ? this->Spacing.X : Size.X + this->Padding,
+		this->Spacing.Y > 0.0f ? this->Spacing.Y : Size.Y + this->Padding);
+}
+
+AAbstractScholaEnvironment* AEnvironmentSpawner::SpawnInstance(const TArray<AActor*>& TemplateActors, const FVector& Offset) const
+{
+	UWorld*					 World = this->GetWorld();
+	TMap<UObject*, UObject*> Clones;
+
+	for (AActor* Template : TemplateActors)
+	{
+		FActorSpawnParameters Parameters;
+		Parameters.Template = Template;
+		Parameters.Owner = Template->GetOwner();
+		Parameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		FTransform Transform = Template->GetActorTransform();
+		Transform.AddToTranslation(Offset);
+		AActor* Clone = World->SpawnActor(Template->GetClass(), &Transform, Parameters);
+		if (Clone == nullptr)
+		{
+			UE_LOG(LogSchola, Warning, TEXT("Failed to Spawn a Copy of %s for Environment %s."), *Template->GetName(), *this->TemplateEnvironment->GetName());
+			continue;
+		}
+		Clones.Add(Template, Clone);
+	}
+
+	// Clones start out possessed by whatever the template was, or by a default controller spawned along with them. Clear both so they can be possessed by their own trainers below
+	for (const TTuple<UObject*, UObject*>& Entry : Clones)
+	{
+		if (APawn* ClonePawn = Cast<APawn>(Entry.Value))
+		{
+			AController* Controller = ClonePawn->GetController();
+			if (Controller != nullptr && Controller != Cast<APawn>(Entry.Key)->GetController())
+			{
+				Controller->UnPossess();
+				Controller->Destroy();
+			}
+			ClonePawn->Controller = nullptr;
+		}
+		else if (AController* CloneController = Cast<AController>(Entry.Value))
+		{
+			CloneController->SetPawn(nullptr);
+		}
+	}
+
+	// Point every reference a clone holds to the template actors, including those held by its components, at the matching clone
+	for (const TTuple<UObject*, UObject*>& Entry : Clones)
+	{
+		FArchiveReplaceObjectRef<UObject> ReplaceRefs(Entry.Value, Clones);
+	}
+
+	for (const TTuple<UObject*, UObject*>& Entry : Clones)
+	{
+		APawn* TemplatePawn = Cast<APawn>(Entry.Key);
+		if (TemplatePawn == nullptr || TemplatePawn->GetController() == nullptr)
+		{
+			continue;
+		}
+		if (UObject** CloneController = Clones.Find(TemplatePawn->GetController()))
+		{
+			CastChecked<AController>(*CloneController)->Possess(CastChecked<APawn>(Entry.Value));
+		}
+	}
+
+	UObject** CloneEnvironment = Clones.Find(this->TemplateEnvironment);
+	return CloneEnvironment ? Cast<AAbstractScholaEnvironment>(*CloneEnvironment) : nullptr;
+}
+
+int AEnvironmentSpawner::SpawnEnvironments()
+{
+	if (this->bSpawned)
+	{
+		return 0;
+	}
+	this->bSpawned = true;
+
+	if (this->TemplateEnvironment == nullptr)
+	{
+		UE_LOG(LogSchola, Warning, TEXT("Environment Spawner %s has No Template Environment. Skipping."), *this->GetName());
+		return 0;
+	}
+
+	int Count = this->NumEnvironments;
+	FParse::Value(FCommandLine::Get(), TEXT("ScholaNumEnvs="), Count);
+	Count = FMath::Max(Count, 1);
+
+	TArray<AActor*> TemplateActors;
+	this->GatherTemplateActors(TemplateActors);
+	const FVector2D CellSize = this->ComputeSpacing(TemplateActors);
+	const int		Columns = this->NumColumns > 0 ? this->NumColumns : FMath::CeilToInt(FMath::Sqrt(float(Count)));
+
+	int NumSpawned = 0;
+	// The template sits in the first cell of the grid
+	for (int Index = 1; Index < Count; Index++)
+	{
+		const FVector Offset(CellSize.X * (Index / Columns), CellSize.Y * (Index % Columns), 0.0f);
+		if (this->SpawnInstance(TemplateActors, Offset) != nullptr)
+		{
+			NumSpawned++;
+		}
+	}
+
+	UE_LOG(LogSchola, Log, TEXT("Spawned %d Copies of Environment %s, %.0f x %.0f apart"), NumSpawned, *this->TemplateEnvironment->GetName(), CellSize.X, CellSize.Y);
+	return NumSpawned;
+}
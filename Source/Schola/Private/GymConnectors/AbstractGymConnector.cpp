@@ -1,6 +1,7 @@
 // Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
 
 #include "GymConnectors/AbstractGymConnector.h"
+#include "Subsystem/ScholaRegistrySubsystem.h"
 
 UAbstractGymConnector::UAbstractGymConnector()
 {
@@ -12,6 +13,21 @@ void UAbstractGymConnector::Init()
 {
 	this->Status = EConnectorStatus::NotStarted;
 	this->CollectEnvironments();
+	this->InitEnvironments();
+}
+
+void UAbstractGymConnector::InitWithEnvironments(const TArray<AAbstractScholaEnvironment*>& InEnvironments)
+{
+	this->Status = EConnectorStatus::NotStarted;
+	for (AAbstractScholaEnvironment* Environment : InEnvironments)
+	{
+		this->RegisterEnvironment(Environment);
+	}
+	this->InitEnvironments();
+}
+
+void UAbstractGymConnector::InitEnvironments()
+{
 	// Add a bunch of defaulted values
 	this->SharedTrainingState.EnvironmentStates.AddDefaulted(Environments.Num());
 	this->SharedTrainingDefinition.EnvironmentDefinitions.AddDefaulted(Environments.Num());
@@ -21,11 +37,28 @@ void UAbstractGymConnector::Init()
 		Environments[i]->Initialize();
 		Environments[i]->PopulateAgentDefinitionPointers(SharedTrainingDefinition.EnvironmentDefinitions[i]);
 		Environments[i]->PopulateAgentStatePointers(SharedTrainingState.EnvironmentStates[i]);
+		Environments[i]->OnAgentAdded.AddUObject(this, &UAbstractGymConnector::OnAgentAdded);
+		Environments[i]->OnAgentRemoved.AddUObject(this, &UAbstractGymConnector::OnAgentRemoved);
 	}
 
 	this->Init(this->SharedTrainingDefinition);
 }
 
+void UAbstractGymConnector::OnAgentAdded(AAbstractScholaEnvironment* Environment, int AgentId)
+{
+	AAbstractTrainer* Agent = Environment->GetAgent(AgentId);
+	const int		  EnvId = Environment->GetEnvId();
+	this->SharedTrainingState.EnvironmentStates[EnvId].AddSharedAgentState(AgentId, &Agent->State);
+	this->SharedTrainingDefinition.AddAgent(EnvId, AgentId, &Agent->TrainerDefn);
+}
+
+void UAbstractGymConnector::OnAgentRemoved(AAbstractScholaEnvironment* Environment, int AgentId)
+{
+	const int EnvId = Environment->GetEnvId();
+	this->SharedTrainingState.EnvironmentStates[EnvId].RemoveSharedAgentState(AgentId);
+	this->SharedTrainingDefinition.RemoveAgent(EnvId, AgentId);
+}
+
 void UAbstractGymConnector::ResetCompletedEnvironments()
 {
 
@@ -56,23 +89,47 @@ void UAbstractGymConnector::ResetCompletedEnvironments()
 	}
 }
 
-void UAbstractGymConnector::CollectEnvironments()
+TArray<int> UAbstractGymConnector::ResetCompletedEnvironmentsWithoutSubmitting(const TBitArray<>* IncludedEnvs)
 {
+	TArray<int> ResetEnvs;
+	for (int EnvId = 0; EnvId < this->Environments.Num(); EnvId++)
+	{
+		AAbstractScholaEnvironment* Environment = this->Environments[EnvId];
+		if ((IncludedEnvs == nullptr || (*IncludedEnvs)[EnvId]) && Environment->GetStatus() == EEnvironmentStatus::Completed)
+		{
+			Environment->Reset();
+			Environment->UpdateStatus(EEnvironmentStatus::Running);
+			ResetEnvs.Add(EnvId);
+		}
+	}
 
-	TArray<AActor*> TempEnvArray;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AAbstractScholaEnvironment::StaticClass(), TempEnvArray);
+	if (ResetEnvs.Num() > 0)
+	{
+		UE_LOG(LogSchola, Verbose, TEXT("Reset %d Environments"), ResetEnvs.Num());
+	}
+	return ResetEnvs;
+}
+
+void UAbstractGymConnector::CollectEnvironments()
+{
+	UScholaRegistrySubsystem* Registry = UScholaRegistrySubsystem::Get(this);
+	if (Registry == nullptr)
+	{
+		return;
+	}
 
-	for (AActor* Actor : TempEnvArray)
+	TArray<AAbstractScholaEnvironment*> RegisteredEnvironments;
+	Registry->GetEnvironments().GetAll(RegisteredEnvironments);
+	for (AAbstractScholaEnvironment* Environment : RegisteredEnvironments)
 	{
-		this->RegisterEnvironment(Cast<AAbstractScholaEnvironment>(Actor));
+		this->RegisterEnvironment(Environment);
 	}
 }
 
 void UAbstractGymConnector::RegisterEnvironment(AAbstractScholaEnvironment* Environment)
 {
 	UE_LOG(LogSchola, Log, TEXT("Environment Registered"))
-	// Since Environments can not be deregistered we can just use the length of this list as an ever increasing ID
-	// If we allow Environments to be deregistered we need to change how we handle EnvIds
+	// These ids index the training definition sent to the client, so they stay fixed once training starts. The registry's ids are the ones that get recycled
 	int Id = this->Environments.Num();
 	this->Environments.Add(Environment);
 	Environment->SetEnvId(Id);
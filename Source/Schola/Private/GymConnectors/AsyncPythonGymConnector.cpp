@@ -0,0 +1,199 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#include "GymConnectors/AsyncPythonGymConnector.h"
+
+void UAsyncPythonGymConnector::Init(const FSharedTrainingDefinition& AgentDefns)
+{
+	Super::Init(AgentDefns);
+	this->EnvSteps.Init(0, this->Environments.Num());
+	this->SteppedEnvs.Init(false, this->Environments.Num());
+	this->CurrentStateUpdate = &this->MergedUpdate;
+	UE_LOG(LogSchola, Log, TEXT("Stepping %d Environments asynchronously"), this->Environments.Num());
+}
+
+void UAsyncPythonGymConnector::MergeUpdate(const FTrainingStateUpdate& Update)
+{
+	if (Update.Status != EConnectorStatusUpdate::NONE)
+	{
+		this->MergedUpdate.Status = Update.Status;
+	}
+
+	for (const TTuple<int, FEnvUpdate>& Entry : Update.EnvUpdates)
+	{
+		// Any later step for the same environment answers the same state, so the first one wins. A reset replaces whatever came before it
+		if (this->MergedUpdate.EnvUpdates.Contains(Entry.Key) && !Entry.Value.IsReset())
+		{
+			continue;
+		}
+
+		this->MergedUpdate.EnvUpdates.Add(Entry.Key, Entry.Value);
+		if (const int* Step = Update.EnvSteps.Find(Entry.Key))
+		{
+			this->MergedUpdate.EnvSteps.Add(Entry.Key, *Step);
+		}
+		else
+		{
+			this->MergedUpdate.EnvSteps.Remove(Entry.Key);
+		}
+	}
+}
+
+FTrainingStateUpdate* UAsyncPythonGymConnector::ResolveEnvironmentStateUpdate()
+{
+	this->MergedUpdate.EnvUpdates.Reset();
+	this->MergedUpdate.EnvSteps.Reset();
+	this->MergedUpdate.Status = EConnectorStatusUpdate::NONE;
+
+	if (!this->PendingUpdate.IsValid())
+	{
+		this->PendingUpdate = this->RequestStateUpdate();
+	}
+
+	if (this->bWaitForUpdates && !this->PendingUpdate.WaitFor(FTimespan(0, 0, this->Timeout)))
+	{ // Timed out so assume we aren't running anymore
+		UE_LOG(LogSchola, Warning, TEXT("Gym Connector Timed out. Marking as errored"));
+		this->Status = EConnectorStatus::Error;
+		this->PendingUpdate.Reset();
+		return nullptr;
+	}
+
+	// Take everything the client has sent since the last frame, without waiting for more
+	int NumReceived = 0;
+	while (this->PendingUpdate.IsReady())
+	{
+		// The message is recycled by the next request, so it has to be read first
+		this->MergeUpdate(*this->DeserializeStateUpdate(*this->PendingUpdate.Get()));
+		this->PendingUpdate = this->RequestStateUpdate();
+		NumReceived++;
+		if (this->MergedUpdate.Status != EConnectorStatusUpdate::NONE)
+		{
+			break;
+		}
+	}
+
+	UE_LOG(LogSchola, VeryVerbose, TEXT("Received %d Updates for %d Environments"), NumReceived, this->MergedUpdate.EnvUpdates.Num());
+	return &this->MergedUpdate;
+}
+
+void UAsyncPythonGymConnector::UpdateEnvironments(FTrainingStateUpdate& StateUpdate)
+{
+	TArray<int> StaleEnvs;
+	for (const TTuple<int, FEnvUpdate>& Entry : StateUpdate.EnvUpdates)
+	{
+		if (!this->Environments.IsValidIndex(Entry.Key))
+		{
+			UE_LOG(LogSchola, Warning, TEXT("Received an update for unknown Environment %d"), Entry.Key);
+			StaleEnvs.Add(Entry.Key);
+			continue;
+		}
+		else if (Entry.Value.IsReset())
+		{
+			continue;
+		}
+
+		// Steps that answer a state from before the environment's latest step or reset are dropped, since the client hadn't seen where the environment is now
+		const int* Step = StateUpdate.EnvSteps.Find(Entry.Key);
+		if (Step != nullptr && *Step != this->EnvSteps[Entry.Key])
+		{
+			StaleEnvs.Add(Entry.Key);
+		}
+		else
+		{
+			this->SteppedEnvs[Entry.Key] = true;
+		}
+	}
+
+	for (int EnvId : StaleEnvs)
+	{
+		StateUpdate.EnvUpdates.Remove(EnvId);
+	}
+	if (StaleEnvs.Num() > 0)
+	{
+		UE_LOG(LogSchola, Verbose, TEXT("Dropped Updates for %d Environments"), StaleEnvs.Num());
+	}
+
+	Super::UpdateEnvironments(StateUpdate);
+}
+
+void UAsyncPythonGymConnector::CountSteps(const TArray<int>& EnvIds, google::protobuf::Map<int32, int32>& OutEnvSteps)
+{
+	for (int EnvId : EnvIds)
+	{
+		OutEnvSteps[EnvId] = ++this->EnvSteps[EnvId];
+	}
+}
+
+void UAsyncPythonGymConnector::ResetCompletedEnvironments()
+{
+	// Finish the state held back by SubmitEnvironmentStates, now that it's completed environments can be reset. Environments reset here start another step, so the client's next actions for them answer their initial state rather than the terminal one
+	if (this->DeferredSends.Remove(INDEX_NONE) > 0)
+	{
+		TrainingState&		  StateMsg = *this->StepStreamMsg.mutable_state();
+		TArray<int>			  InBandResetEnvs = this->ApplyInBandResets(INDEX_NONE);
+		InitialTrainingState* InBandResetMsg = StateMsg.mutable_reset_state();
+		InBandResetMsg->clear_env_steps();
+		this->CountSteps(InBandResetEnvs, *InBandResetMsg->mutable_env_steps());
+		this->SendStateMsg(INDEX_NONE);
+		UE_LOG(LogSchola, VeryVerbose, TEXT("Sent States for %d Environments, Resetting %d of them"), StateMsg.env_steps_size(), InBandResetEnvs.Num());
+	}
+
+	// These were reset by the client, and it is waiting on their initial states
+	TArray<int> ResetEnvs = this->ResetCompletedEnvironmentsWithoutSubmitting();
+	if (ResetEnvs.Num() == 0)
+	{
+		return;
+	}
+
+	StepStreamResponse*	  ResetMsg = new StepStreamResponse();
+	InitialTrainingState* InitialStateMsg = ResetMsg->mutable_initial_state();
+	this->SharedTrainingState.ToResetProto(ResetEnvs, *InitialStateMsg);
+	this->CountSteps(ResetEnvs, *InitialStateMsg->mutable_env_steps());
+	if (this->SharedTrainingDefinition.HasMembershipChanges())
+	{
+		this->SharedTrainingDefinition.FillMembershipUpdate(InitialStateMsg->mutable_membership());
+	}
+	this->StepStreamService->Send(ResetMsg);
+}
+
+void UAsyncPythonGymConnector::CollectEnvironmentStates()
+{
+	for (TConstSetBitIterator<> It(this->SteppedEnvs); It; ++It)
+	{
+		AAbstractScholaEnvironment* Environment = this->Environments[It.GetIndex()];
+		if (Environment->GetStatus() != EEnvironmentStatus::Error)
+		{
+			Environment->AllAgentsThink();
+		}
+	}
+}
+
+void UAsyncPythonGymConnector::SubmitEnvironmentStates()
+{
+	TArray<int> StateEnvs;
+	for (TConstSetBitIterator<> It(this->SteppedEnvs); It; ++It)
+	{
+		StateEnvs.Add(It.GetIndex());
+	}
+	// Nothing was stepped, so the client is still waiting on every environment it sent actions for
+	if (StateEnvs.Num() == 0)
+	{
+		return;
+	}
+
+	TrainingState& StateMsg = *this->StepStreamMsg.mutable_state();
+	if (this->SharedTrainingDefinition.DenseGroups.Num() > 0)
+	{
+		this->SharedTrainingState.ToDenseProto(StateMsg, this->SharedTrainingDefinition.DenseGroups, &this->SteppedEnvs);
+	}
+	else
+	{
+		this->SharedTrainingState.ToProto(StateMsg, &this->SteppedEnvs);
+	}
+	StateMsg.clear_env_steps();
+	this->CountSteps(StateEnvs, *StateMsg.mutable_env_steps());
+
+	// Sent from the reset phase, once the environments that just completed have been reset and their initial states added
+	this->DeferInBandResets(INDEX_NONE, &this->SteppedEnvs);
+	this->DeferredSends.Add(INDEX_NONE);
+	this->SteppedEnvs.Init(false, this->Environments.Num());
+}
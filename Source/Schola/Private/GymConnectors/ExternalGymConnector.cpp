@@ -7,17 +7,197 @@ UExternalGymConnector::UExternalGymConnector()
 }
 
 
+void UExternalGymConnector::SetupPipeline(int NumCohorts)
+{
+	this->NumPipelineCohorts = FMath::Clamp(NumCohorts, 1, FMath::Max(this->Environments.Num(), 1));
+	this->CohortMasks.Reset();
+	if (this->NumPipelineCohorts <= 1)
+	{
+		return;
+	}
+
+	for (int Cohort = 0; Cohort < this->NumPipelineCohorts; Cohort++)
+	{
+		TBitArray<>& Mask = this->CohortMasks.Emplace_GetRef(false, this->Environments.Num());
+		for (int EnvId = Cohort; EnvId < this->Environments.Num(); EnvId += this->NumPipelineCohorts)
+		{
+			Mask[EnvId] = true;
+		}
+	}
+	this->UpdatedCohorts.Init(false, this->NumPipelineCohorts);
+	this->BufferedCohorts.Init(false, this->NumPipelineCohorts);
+	this->NextCohort = 0;
+	UE_LOG(LogSchola, Log, TEXT("Pipelining %d Environments across %d cohorts"), this->Environments.Num(), this->NumPipelineCohorts);
+}
+
+void UExternalGymConnector::SetupActionRepeat(int Repeat)
+{
+	this->ActionRepeat = FMath::Max(Repeat, 1);
+	this->RepeatFrame = 0;
+	this->bEndRepeat = false;
+	if (this->ActionRepeat > 1 && (this->IsPipelined() || this->ShardIndex != INDEX_NONE))
+	{
+		// Both of these step environments on frames that don't line up with the repeats
+		UE_LOG(LogSchola, Warning, TEXT("Action repeat can't be combined with pipelining or sharding. Ignoring it"));
+		this->ActionRepeat = 1;
+	}
+	else if (this->ActionRepeat > 1)
+	{
+		UE_LOG(LogSchola, Log, TEXT("Repeating each action for %d frames"), this->ActionRepeat);
+	}
+}
+
+bool UExternalGymConnector::SendNextBufferedState()
+{
+	for (int i = 0; i < this->NumPipelineCohorts; i++)
+	{
+		const int Cohort = (this->NextCohort + i) % this->NumPipelineCohorts;
+		if (this->BufferedCohorts[Cohort])
+		{
+			this->SendBufferedState(Cohort);
+			this->BufferedCohorts[Cohort] = false;
+			this->NextCohort = (Cohort + 1) % this->NumPipelineCohorts;
+			return true;
+		}
+	}
+	return false;
+}
+
+void UExternalGymConnector::UpdateEnvironments(FTrainingStateUpdate& StateUpdate)
+{
+	if (this->IsRepeatingActions())
+	{
+		if (this->RepeatFrame == 0)
+		{
+			// Resets are only applied once, and their initial states go out straight away, so the repeat ends with this frame
+			for (const TTuple<int, FEnvUpdate>& EnvUpdate : StateUpdate.EnvUpdates)
+			{
+				this->bEndRepeat |= EnvUpdate.Value.IsReset();
+			}
+			Super::UpdateEnvironments(StateUpdate);
+			return;
+		}
+
+		for (const TTuple<int, FEnvUpdate>& EnvUpdate : StateUpdate.EnvUpdates)
+		{
+			if (EnvUpdate.Value.IsStep() && this->Environments[EnvUpdate.Key]->GetStatus() == EEnvironmentStatus::Running)
+			{
+				this->Environments[EnvUpdate.Key]->AllAgentsAct(EnvUpdate.Value.GetStep());
+			}
+		}
+		return;
+	}
+	else if (!this->IsPipelined())
+	{
+		Super::UpdateEnvironments(StateUpdate);
+		return;
+	}
+
+	for (const TTuple<int, FEnvUpdate>& EnvUpdate : StateUpdate.EnvUpdates)
+	{
+		this->UpdatedCohorts[EnvUpdate.Key % this->NumPipelineCohorts] = true;
+	}
+	// Every update has to be answered with a state, so an update for no environments steps all of them
+	if (this->UpdatedCohorts.Find(true) == INDEX_NONE)
+	{
+		this->UpdatedCohorts.Init(true, this->NumPipelineCohorts);
+	}
+	// Any state still buffered for an updated cohort was skipped over by gym, and is out of date once the update is applied
+	for (int Cohort = 0; Cohort < this->NumPipelineCohorts; Cohort++)
+	{
+		if (this->UpdatedCohorts[Cohort])
+		{
+			this->BufferedCohorts[Cohort] = false;
+		}
+	}
+
+	// Answer with a cohort that is already done, so gym can work on it while we simulate this one. Only if we are still running, since closing answers the update itself
+	this->bAnsweredUpdate = this->IsRunning() && this->SendNextBufferedState();
+
+	Super::UpdateEnvironments(StateUpdate);
+}
+
+void UExternalGymConnector::CollectEnvironmentStates()
+{
+	if (this->IsRepeatingActions())
+	{
+		// Rewards are summed over the repeat. An agent that finishes has to have its terminal state sent before it thinks again, so it ends the repeat
+		for (AAbstractScholaEnvironment* Environment : this->Environments)
+		{
+			if (Environment->GetStatus() != EEnvironmentStatus::Error)
+			{
+				this->bEndRepeat |= Environment->AllAgentsThink(this->RepeatFrame > 0);
+			}
+		}
+		return;
+	}
+	else if (!this->IsPipelined())
+	{
+		Super::CollectEnvironmentStates();
+		return;
+	}
+
+	for (int EnvId = 0; EnvId < this->Environments.Num(); EnvId++)
+	{
+		AAbstractScholaEnvironment* Environment = this->Environments[EnvId];
+		if (this->UpdatedCohorts[EnvId % this->NumPipelineCohorts] && Environment->GetStatus() != EEnvironmentStatus::Error)
+		{
+			Environment->AllAgentsThink();
+		}
+	}
+}
+
 void UExternalGymConnector::SubmitEnvironmentStates()
 {
-	this->SendState(SharedTrainingState);
+	if (this->IsRepeatingActions())
+	{
+		if (!this->bEndRepeat && this->RepeatFrame + 1 < this->ActionRepeat)
+		{
+			this->RepeatFrame++;
+			return;
+		}
+		this->RepeatFrame = 0;
+		this->bEndRepeat = false;
+		this->SendState(SharedTrainingState);
+		return;
+	}
+	else if (!this->IsPipelined())
+	{
+		this->SendState(SharedTrainingState);
+		return;
+	}
+
+	for (int Cohort = 0; Cohort < this->NumPipelineCohorts; Cohort++)
+	{
+		if (this->UpdatedCohorts[Cohort])
+		{
+			this->BufferState(SharedTrainingState, this->CohortMasks[Cohort], Cohort);
+			this->BufferedCohorts[Cohort] = true;
+		}
+	}
+	this->UpdatedCohorts.Init(false, this->NumPipelineCohorts);
+
+	// Nothing was ready when the update arrived, e.g. right after a reset, so answer with a cohort we just stepped
+	if (!this->bAnsweredUpdate)
+	{
+		this->SendNextBufferedState();
+	}
+	this->bAnsweredUpdate = false;
 }
 
 FTrainingStateUpdate* UExternalGymConnector::ResolveEnvironmentStateUpdate()
 {
-	TFuture<FTrainingStateUpdate*> UpdateFuture = this->RequestStateUpdate();
+	// Gym hasn't been sent a state since the last update, so keep taking the same actions
+	if (this->RepeatFrame > 0)
+	{
+		return this->RepeatedUpdate;
+	}
+
+	TFuture<const Schola::TrainingStateUpdate*> UpdateFuture = this->RequestStateUpdate();
 	if (UpdateFuture.WaitFor(FTimespan(0, 0, Timeout)))
 	{
-		return UpdateFuture.Get();
+		this->RepeatedUpdate = this->DeserializeStateUpdate(*UpdateFuture.Get());
+		return this->RepeatedUpdate;
 	}
 	else
 	{ // Timed out so assume we aren't running anymore
@@ -6,21 +6,153 @@ UPythonGymConnector::UPythonGymConnector() {
 	this->CommunicationManager = NewObject<UCommunicationManager>();
 }
 
-TFuture<FTrainingStateUpdate*> UPythonGymConnector::RequestStateUpdate()
+TFuture<const TrainingStateUpdate*> UPythonGymConnector::RequestStateUpdate()
 {
-	return DecisionRequestService->ReceiveAndDeserialize<FTrainingStateUpdate>();
+	return this->StepStreamService != nullptr ? this->StepStreamService->Receive() : this->DecisionRequestService->Receive();
+}
+
+FTrainingStateUpdate* UPythonGymConnector::DeserializeStateUpdate(const TrainingStateUpdate& Message)
+{
+	// Deserialize in place into the persistent update, rather than allocating a new one each step
+	ProtobufDeserializer::Deserialize(Message, this->StateUpdate, this->SharedTrainingDefinition.DenseGroups);
+	return &this->StateUpdate;
+}
+
+TrainingState& UPythonGymConnector::GetStateMsg(int Slot)
+{
+	if (Slot != INDEX_NONE)
+	{
+		return *this->CohortStateMsgs[Slot].mutable_state();
+	}
+	return this->StepStreamService != nullptr ? *this->StepStreamMsg.mutable_state() : this->TrainingStateMsg;
+}
+
+void UPythonGymConnector::SendStateMsg(int Slot)
+{
+	// Includes agents that joined while the environments in this message were being reset, so the client knows about every agent in it
+	this->AddMembershipUpdate(this->GetStateMsg(Slot));
+	if (this->StepStreamService != nullptr)
+	{
+		this->StepStreamService->SendWithoutOwnership(Slot != INDEX_NONE ? this->CohortStateMsgs[Slot] : this->StepStreamMsg);
+	}
+	else
+	{
+		DecisionRequestService->RespondWithoutOwnership(this->GetStateMsg(Slot));
+	}
 }
 
 void UPythonGymConnector::SendState(const FTrainingState& State)
 {
-	Schola::TrainingState* TrainingStateMsg = State.ToProto();
-	DecisionRequestService->Respond(TrainingStateMsg);
+	TrainingState& StateMsg = this->GetStateMsg(INDEX_NONE);
+	if (this->SharedTrainingDefinition.DenseGroups.Num() > 0)
+	{
+		State.ToDenseProto(StateMsg, this->SharedTrainingDefinition.DenseGroups);
+	}
+	else
+	{
+		State.ToProto(StateMsg);
+	}
+
+	// The message needs the initial states of any environment that just completed, which aren't there until the reset phase
+	if (this->DeferInBandResets(INDEX_NONE, nullptr))
+	{
+		this->DeferredSends.Add(INDEX_NONE);
+	}
+	else
+	{
+		this->SendStateMsg(INDEX_NONE);
+	}
 }
 
-void UPythonGymConnector::SubmitPostResetState(const FTrainingState& States)
+void UPythonGymConnector::BufferState(const FTrainingState& State, const TBitArray<>& IncludedEnvs, int Slot)
 {
-	Schola::InitialTrainingState* PostResetMessage = new Schola::InitialTrainingState();
+	TrainingState& StateMsg = this->GetStateMsg(Slot);
+	if (this->SharedTrainingDefinition.DenseGroups.Num() > 0)
+	{
+		State.ToDenseProto(StateMsg, this->SharedTrainingDefinition.DenseGroups, &IncludedEnvs);
+	}
+	else
+	{
+		State.ToProto(StateMsg, &IncludedEnvs);
+	}
+	this->DeferInBandResets(Slot, &IncludedEnvs);
+}
 
+void UPythonGymConnector::AddMembershipUpdate(TrainingState& StateMsg)
+{
+	StateMsg.clear_membership();
+	if (this->SharedTrainingDefinition.HasMembershipChanges())
+	{
+		this->SharedTrainingDefinition.FillMembershipUpdate(StateMsg.mutable_membership());
+	}
+}
+
+bool UPythonGymConnector::DeferInBandResets(int Slot, const TBitArray<>* IncludedEnvs)
+{
+	if (!this->bUseInBandReset)
+	{
+		return false;
+	}
+
+	this->GetStateMsg(Slot).mutable_reset_state()->clear_environment_states();
+	for (int EnvId = 0; EnvId < this->Environments.Num(); EnvId++)
+	{
+		if ((IncludedEnvs == nullptr || (*IncludedEnvs)[EnvId]) && this->Environments[EnvId]->GetStatus() == EEnvironmentStatus::Completed)
+		{
+			this->PendingInBandResets.Add(Slot, IncludedEnvs != nullptr ? *IncludedEnvs : TBitArray<>(true, this->Environments.Num()));
+			return true;
+		}
+	}
+	return false;
+}
+
+TArray<int> UPythonGymConnector::ApplyInBandResets(int Slot)
+{
+	TArray<int>	ResetEnvs;
+	TBitArray<> IncludedEnvs;
+	if (this->PendingInBandResets.RemoveAndCopyValue(Slot, IncludedEnvs))
+	{
+		// The terminal states are already serialized, so the environments can be reset without losing them
+		ResetEnvs = this->ResetCompletedEnvironmentsWithoutSubmitting(&IncludedEnvs);
+		this->SharedTrainingState.ToResetProto(ResetEnvs, *this->GetStateMsg(Slot).mutable_reset_state());
+	}
+	return ResetEnvs;
+}
+
+void UPythonGymConnector::ResetCompletedEnvironments()
+{
+	TArray<int> PendingSlots;
+	this->PendingInBandResets.GetKeys(PendingSlots);
+	for (int Slot : PendingSlots)
+	{
+		this->ApplyInBandResets(Slot);
+	}
+
+	for (int Slot : this->DeferredSends)
+	{
+		this->SendStateMsg(Slot);
+	}
+	this->DeferredSends.Reset();
+
+	// Anything else that completed, e.g. because gym asked for it to be reset, goes out on it's own
+	Super::ResetCompletedEnvironments();
+}
+
+void UPythonGymConnector::SendBufferedState(int Slot)
+{
+	// Buffered states are normally sent on a later step, after their resets, but the state just buffered can be sent straight away
+	if (this->PendingInBandResets.Contains(Slot))
+	{
+		this->DeferredSends.Add(Slot);
+	}
+	else
+	{
+		this->SendStateMsg(Slot);
+	}
+}
+
+void UPythonGymConnector::SubmitPostResetState(const FTrainingState& States)
+{
 	TArray<int> EnvsToReset;
 	for (int i = 0; i < Environments.Num(); i++)
 	{
@@ -32,26 +164,48 @@ void UPythonGymConnector::SubmitPostResetState(const FTrainingState& States)
 
 	UE_LOG(LogSchola, Verbose, TEXT("Sending Messages for %d Environments"), EnvsToReset.Num());
 
-	PostResetStateService->SendProtobufMessage(States.ToResetProto(EnvsToReset));
+	InitialTrainingState* InitialStateMsg = States.ToResetProto(EnvsToReset);
+	if (this->SharedTrainingDefinition.HasMembershipChanges())
+	{
+		this->SharedTrainingDefinition.FillMembershipUpdate(InitialStateMsg->mutable_membership());
+	}
+
+	if (this->StepStreamService != nullptr)
+	{
+		StepStreamResponse* PostResetMessage = new StepStreamResponse();
+		PostResetMessage->set_allocated_initial_state(InitialStateMsg);
+		this->StepStreamService->Send(PostResetMessage);
+	}
+	else
+	{
+		PostResetStateService->SendProtobufMessage(InitialStateMsg);
+	}
 }
 
 void UPythonGymConnector::Init(const FSharedTrainingDefinition& AgentDefns)
 {
-	std::shared_ptr<GymService::AsyncService> Service = std::make_shared<GymService::AsyncService>();
-	const UScholaManagerSubsystemSettings*	  Settings = GetDefault<UScholaManagerSubsystemSettings>();
+	const UScholaManagerSubsystemSettings* Settings = GetDefault<UScholaManagerSubsystemSettings>();
 	this->Timeout = Settings->CommunicatorSettings.Timeout;
 
-	this->CommunicationManager->Initialize();
-
-	DecisionRequestService = this->CommunicationManager->CreateExchangeBackend<GymService::AsyncService, TrainingStateUpdate, TrainingState>(&GymService::AsyncService::RequestUpdateState, Service);
-
-	// Watch out for clobbering between Schola::AgentDefinition and the parameter
-
-	PostResetStateService = this->CommunicationManager->CreateProducerBackend<GymService::AsyncService, InitialTrainingStateRequest, InitialTrainingState>(&GymService::AsyncService::RequestRequestInitialTrainingState, Service);
+	if (Settings->CommunicatorSettings.bUseDenseStateFormat)
+	{
+		this->SharedTrainingDefinition.BuildDenseGroups();
+		UE_LOG(LogSchola, Log, TEXT("Using the dense state format with %d agent groups"), this->SharedTrainingDefinition.DenseGroups.Num());
+	}
 
-	AgentDefinitionService = CommunicationManager->CreateProducerBackend<GymService::AsyncService, TrainingDefinitionRequest, TrainingDefinition>(&GymService::AsyncService::RequestRequestTrainingDefinition, Service);
+	// States only come back for the environments that were stepped, so resets can't wait for the client to ask for them
+	this->bUseInBandReset = Settings->CommunicatorSettings.bUseInBandReset || this->IsAsynchronous();
+	this->SetupPipeline(this->IsAsynchronous() ? 1 : Settings->CommunicatorSettings.NumPipelineCohorts);
+	if (this->IsPipelined())
+	{
+		this->CohortStateMsgs.SetNum(this->NumPipelineCohorts);
+	}
+	this->SetupActionRepeat(this->IsAsynchronous() ? 1 : Settings->CommunicatorSettings.ActionRepeat);
 
-	StartRequestService = this->CommunicationManager->CreatePollingBackend<GymService::AsyncService, GymConnectorStartRequest, GymConnectorStartResponse>(&GymService::AsyncService::RequestStartGymConnector, Service);
+	if (!this->CreateSharedMemoryServices(Settings))
+	{
+		this->CreateGrpcServices(Settings);
+	}
 
 	// Call initialize
 	this->AgentDefinitionService->Initialize();
@@ -61,19 +215,100 @@ void UPythonGymConnector::Init(const FSharedTrainingDefinition& AgentDefns)
 
 	this->OnConnectorStarted.AddLambda(
 		[this]() {
-			this->AgentDefinitionService->SendProtobufMessage(this->SharedTrainingDefinition.ToProtobuf());
+			TrainingDefinition* DefinitionMsg = this->SharedTrainingDefinition.ToProtobuf();
+			DefinitionMsg->set_use_step_stream(this->StepStreamService != nullptr);
+			DefinitionMsg->set_num_pipeline_cohorts(this->NumPipelineCohorts);
+			DefinitionMsg->set_async_stepping(this->IsAsynchronous());
+			this->AgentDefinitionService->SendProtobufMessage(DefinitionMsg);
+			// The definition already holds every agent that joined or left before now
+			this->SharedTrainingDefinition.ClearMembershipChanges();
 		});
 
 	//Since we will have a msg with no response (the closed message, send one more to reset everything)
 	this->OnConnectorClosed.AddLambda([this]() {
-		this->DecisionRequestService->Respond(new Schola::TrainingState());
+		if (this->StepStreamService != nullptr)
+		{
+			StepStreamResponse* ClosedMessage = new StepStreamResponse();
+			ClosedMessage->mutable_state();
+			this->StepStreamService->Send(ClosedMessage);
+		}
+		else
+		{
+			this->DecisionRequestService->Respond(new Schola::TrainingState());
+		}
 	});
 
 }
 
+void UPythonGymConnector::CreateGrpcServices(const UScholaManagerSubsystemSettings* Settings)
+{
+	std::shared_ptr<GymService::AsyncService> Service = std::make_shared<GymService::AsyncService>();
+
+	this->CommunicationManager->Initialize(FMath::Max(this->ShardIndex, 0));
+
+	DecisionRequestService = this->CommunicationManager->CreateExchangeBackend<GymService::AsyncService, TrainingStateUpdate, TrainingState>(&GymService::AsyncService::RequestUpdateState, Service);
+
+	// Watch out for clobbering between Schola::AgentDefinition and the parameter
+
+	PostResetStateService = this->CommunicationManager->CreateProducerBackend<GymService::AsyncService, InitialTrainingStateRequest, InitialTrainingState>(&GymService::AsyncService::RequestRequestInitialTrainingState, Service);
+
+	AgentDefinitionService = CommunicationManager->CreateProducerBackend<GymService::AsyncService, TrainingDefinitionRequest, TrainingDefinition>(&GymService::AsyncService::RequestRequestTrainingDefinition, Service);
+
+	// Updates and states are no longer paired when stepping asynchronously, so they have to go over the stream
+	if (Settings->CommunicatorSettings.bUseStepStream || this->IsAsynchronous())
+	{
+		StepStreamService = this->CommunicationManager->CreateStreamBackend<GymService::AsyncService, TrainingStateUpdate, StepStreamResponse>(&GymService::AsyncService::RequestStepStream, Service);
+		StepStreamService->Initialize();
+		UE_LOG(LogSchola, Log, TEXT("Using the step stream for decisions and resets"));
+	}
+
+	StartRequestService = this->CommunicationManager->CreatePollingBackend<GymService::AsyncService, GymConnectorStartRequest, GymConnectorStartResponse>(&GymService::AsyncService::RequestStartGymConnector, Service);
+}
+
+bool UPythonGymConnector::CreateSharedMemoryServices(const UScholaManagerSubsystemSettings* Settings)
+{
+	FString SharedMemoryName = Settings->CommunicatorSettings.GetSharedMemoryName(this->ShardIndex);
+	if (SharedMemoryName.IsEmpty())
+	{
+		return false;
+	}
+	else if (this->IsAsynchronous())
+	{
+		UE_LOG(LogSchola, Warning, TEXT("Asynchronous stepping needs the step stream, which is only used with gRPC. Ignoring shared memory %s"), *SharedMemoryName);
+		return false;
+	}
+
+	this->SharedMemoryTransport = MakeUnique<FSharedMemoryTransport>(SharedMemoryName, Settings->CommunicatorSettings.SharedMemoryRingSizeKB * 1024);
+	if (!this->SharedMemoryTransport->IsValid())
+	{
+		UE_LOG(LogSchola, Warning, TEXT("Falling back to gRPC since shared memory %s could not be created"), *SharedMemoryName);
+		this->SharedMemoryTransport.Reset();
+		return false;
+	}
+
+	FSharedMemoryTransport* Transport = this->SharedMemoryTransport.Get();
+	DecisionRequestService = new SharedMemoryExchangeBackend<TrainingStateUpdate, TrainingState>(Transport, ESharedMemoryMethod::UpdateState);
+	PostResetStateService = new SharedMemoryProducerBackend<InitialTrainingState>(Transport, ESharedMemoryMethod::RequestInitialTrainingState);
+	AgentDefinitionService = new SharedMemoryProducerBackend<TrainingDefinition>(Transport, ESharedMemoryMethod::RequestTrainingDefinition);
+	StartRequestService = new SharedMemoryPollingBackend<GymConnectorStartRequest, GymConnectorStartResponse>(Transport, ESharedMemoryMethod::StartGymConnector);
+	if (Settings->CommunicatorSettings.bUseStepStream)
+	{
+		UE_LOG(LogSchola, Warning, TEXT("The step stream is only used with gRPC, ignoring it for shared memory"));
+	}
+	UE_LOG(LogSchola, Log, TEXT("Using shared memory %s instead of gRPC"), *SharedMemoryName);
+	return true;
+}
+
 void UPythonGymConnector::Enable()
 {
-	this->CommunicationManager->StartBackends();
+	if (this->SharedMemoryTransport.IsValid())
+	{
+		this->SharedMemoryTransport->Start();
+	}
+	else
+	{
+		this->CommunicationManager->StartBackends();
+	}
 }
 
 bool UPythonGymConnector::CheckForStart()
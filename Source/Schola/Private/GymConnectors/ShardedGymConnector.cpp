@@ -0,0 +1,191 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#include "GymConnectors/ShardedGymConnector.h"
+
+void UShardedGymConnector::Configure(TSubclassOf<UExternalGymConnector> InShardClass, int InNumShards, int InTimeout)
+{
+	this->ShardClass = InShardClass;
+	this->NumShards = InNumShards;
+	this->Timeout = InTimeout;
+}
+
+void UShardedGymConnector::InitEnvironments()
+{
+	// The environments were registered with global ids, which each shard replaces with its own
+	const int NumEnvironments = this->Environments.Num();
+	const int ShardCount = FMath::Clamp(this->NumShards, 1, FMath::Max(NumEnvironments, 1));
+
+	for (int ShardIndex = 0; ShardIndex < ShardCount; ShardIndex++)
+	{
+		// Give each shard a contiguous block, spreading the remainder over the first few
+		const int Start = ShardIndex * NumEnvironments / ShardCount;
+		const int End = (ShardIndex + 1) * NumEnvironments / ShardCount;
+		TArray<AAbstractScholaEnvironment*> ShardEnvironments(this->Environments.GetData() + Start, End - Start);
+
+		UExternalGymConnector* Shard = NewObject<UExternalGymConnector>(this, this->ShardClass, FName("GymConnectorShard", ShardIndex));
+		Shard->ShardIndex = ShardIndex;
+		Shard->InitWithEnvironments(ShardEnvironments);
+		this->Shards.Add(Shard);
+		UE_LOG(LogSchola, Log, TEXT("Shard %d has Environments %d to %d"), ShardIndex, Start, End - 1);
+	}
+
+	this->PendingUpdates.SetNum(this->Shards.Num());
+	this->ResolvedUpdates.Init(nullptr, this->Shards.Num());
+	this->CurrentStateUpdate = &this->CombinedUpdate;
+}
+
+void UShardedGymConnector::Enable()
+{
+	for (UExternalGymConnector* Shard : this->Shards)
+	{
+		Shard->Enable();
+	}
+}
+
+bool UShardedGymConnector::CheckForStart()
+{
+	bool bAnyRunning = false;
+	for (UExternalGymConnector* Shard : this->Shards)
+	{
+		if (!Shard->IsRunning())
+		{
+			Shard->CheckForStart();
+		}
+		bAnyRunning |= Shard->IsRunning();
+	}
+
+	if (bAnyRunning && !this->IsRunning())
+	{
+		this->SetStatus(EConnectorStatus::Running);
+	}
+	return this->IsRunning();
+}
+
+void UShardedGymConnector::RequestShardUpdates()
+{
+	for (int Index = 0; Index < this->Shards.Num(); Index++)
+	{
+		if (this->Shards[Index]->IsRunning() && !this->PendingUpdates[Index].IsValid())
+		{
+			this->PendingUpdates[Index] = this->Shards[Index]->RequestStateUpdate().Next([Event = this->UpdateEvent](const Schola::TrainingStateUpdate* Update) {
+				(*Event)->Trigger();
+				return Update;
+			});
+		}
+	}
+}
+
+bool UShardedGymConnector::IsStepping(int Index) const
+{
+	return this->ResolvedUpdates[Index] != nullptr && this->Shards[Index]->IsRunning();
+}
+
+FTrainingStateUpdate* UShardedGymConnector::ResolveEnvironmentStateUpdate()
+{
+	// Trainers can connect to their shard at any time, not just before the first step
+	this->CheckForStart();
+	this->RequestShardUpdates();
+
+	const FDateTime Deadline = FDateTime::UtcNow() + FTimespan(0, 0, this->Timeout);
+	int				NumResolved = 0;
+	while (true)
+	{
+		for (int Index = 0; Index < this->Shards.Num(); Index++)
+		{
+			TFuture<const Schola::TrainingStateUpdate*>& Pending = this->PendingUpdates[Index];
+			if (Pending.IsValid() && Pending.IsReady())
+			{
+				// Each shard deserializes into its own update, so they can all be resolved before any are stepped
+				this->ResolvedUpdates[Index] = this->Shards[Index]->DeserializeStateUpdate(*Pending.Get());
+				Pending.Reset();
+				NumResolved++;
+			}
+			else
+			{
+				this->ResolvedUpdates[Index] = nullptr;
+			}
+		}
+
+		const FTimespan Remaining = Deadline - FDateTime::UtcNow();
+		if (NumResolved > 0)
+		{
+			break;
+		}
+		else if (Remaining <= FTimespan::Zero() || !(*this->UpdateEvent)->Wait(Remaining))
+		{
+			UE_LOG(LogSchola, Warning, TEXT("No Gym Connector Shard responded in time. Marking as errored"));
+			this->Status = EConnectorStatus::Error;
+			return nullptr;
+		}
+	}
+
+	UE_LOG(LogSchola, VeryVerbose, TEXT("Stepping %d of %d Shards"), NumResolved, this->Shards.Num());
+
+	// Shards close or fail on their own. We only stop once none of them are left running
+	bool bAnyRunning = false;
+	bool bAnyError = false;
+	for (int Index = 0; Index < this->Shards.Num(); Index++)
+	{
+		UExternalGymConnector* Shard = this->Shards[Index];
+		if (this->ResolvedUpdates[Index] != nullptr)
+		{
+			Shard->UpdateConnectorStatus(*this->ResolvedUpdates[Index]);
+		}
+		bAnyRunning |= Shard->IsRunning();
+		bAnyError |= Shard->Status == EConnectorStatus::Error;
+	}
+
+	if (bAnyRunning)
+	{
+		this->CombinedUpdate.Status = EConnectorStatusUpdate::NONE;
+	}
+	else
+	{
+		this->CombinedUpdate.Status = bAnyError ? EConnectorStatusUpdate::ERRORED : EConnectorStatusUpdate::CLOSED;
+	}
+	return &this->CombinedUpdate;
+}
+
+void UShardedGymConnector::UpdateEnvironments(FTrainingStateUpdate& StateUpdate)
+{
+	for (int Index = 0; Index < this->Shards.Num(); Index++)
+	{
+		if (this->IsStepping(Index))
+		{
+			this->Shards[Index]->UpdateEnvironments(*this->ResolvedUpdates[Index]);
+		}
+	}
+}
+
+void UShardedGymConnector::ResetCompletedEnvironments()
+{
+	for (int Index = 0; Index < this->Shards.Num(); Index++)
+	{
+		if (this->IsStepping(Index))
+		{
+			this->Shards[Index]->ResetCompletedEnvironments();
+		}
+	}
+}
+
+void UShardedGymConnector::CollectEnvironmentStates()
+{
+	for (int Index = 0; Index < this->Shards.Num(); Index++)
+	{
+		if (this->IsStepping(Index))
+		{
+			this->Shards[Index]->CollectEnvironmentStates();
+		}
+	}
+}
+
+void UShardedGymConnector::SubmitEnvironmentStates()
+{
+	for (int Index = 0; Index < this->Shards.Num(); Index++)
+	{
+		if (this->IsStepping(Index))
+		{
+			this->Shards[Index]->SubmitEnvironmentStates();
+		}
+	}
+}
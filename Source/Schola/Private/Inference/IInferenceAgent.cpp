@@ -75,7 +75,7 @@ void IInferenceAgent::Think()
 	if (this->GetBrain()->IsDecisionStep() && this->GetStatus() == EAgentStatus::Running)
 	{
 		// Clear and then get the observations
-		FDictPoint& Obs = GetInteractionManager()->AggregateObservations();
+		FDictPoint& Obs = GetInteractionManager()->AggregateObservations(!this->GetPolicy()->NormalizesObservations());
 
 		bool bRequestSuceeded = this->GetBrain()->RequestDecision(Obs);
 
@@ -17,12 +17,23 @@ void UAbstractObserver::TestObserverValidity()
 
 void UBoxObserver::SetDebugObservations(TPoint& Temp)
 {
-	this->DebugBoxPoint = Temp.Get<FBoxPoint>().Values;
+	const FBoxPoint& TypedPoint = Temp.Get<FBoxPoint>();
+	this->DebugBoxPoint = TArray<float>(TypedPoint.GetData(), TypedPoint.Num());
 }
 
 void UBinaryObserver::SetDebugObservations(TPoint& Temp)
 {
-	this->DebugBinaryPoint = Temp.Get<FBinaryPoint>().Values;
+	const FBinaryPoint& TypedPoint = Temp.Get<FBinaryPoint>();
+	if (TypedPoint.bPacked)
+	{
+		this->DebugBinaryPoint.Reset(TypedPoint.Num());
+		for (int i = 0; i < TypedPoint.Num(); i++)
+		{
+			this->DebugBinaryPoint.Add(TypedPoint[i]);
+		}
+		return;
+	}
+	this->DebugBinaryPoint = TypedPoint.Values;
 }
 
 void UDiscreteObserver::SetDebugObservations(TPoint& Temp)
@@ -29,17 +29,17 @@ void UPositionObserver::CollectObservations(FBoxPoint& OutObservations)
 
 		if (bHasXDimensions)
 		{
-			OutObservations.Values.Add(ActorLocation.X);
+			OutObservations.Add(ActorLocation.X);
 		}
 
 		if (bHasYDimensions)
 		{
-			OutObservations.Values.Add(ActorLocation.Y);
+			OutObservations.Add(ActorLocation.Y);
 		}
 
 		if (bHasZDimensions)
 		{
-			OutObservations.Values.Add(ActorLocation.Z);
+			OutObservations.Add(ActorLocation.Z);
 		}
 	}
 }
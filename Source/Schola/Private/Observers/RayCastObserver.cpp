@@ -63,7 +63,7 @@ void URayCastObserver::AppendEmptyTags(FBoxPoint& OutObservations)
 {
 	for (FName& TrackedTag : TrackedTags)
 	{
-		OutObservations.Values.Emplace(0.0);
+		OutObservations.Add(0.0);
 	}
 }
 
@@ -71,8 +71,8 @@ void URayCastObserver::HandleRayMiss(FBoxPoint& OutObservations, FVector& Start,
 {
 	AppendEmptyTags(OutObservations);
 	// Tack on the did I hit and hit distance variables
-	OutObservations.Values.Emplace(0.0);
-	OutObservations.Values.Emplace(0.0);
+	OutObservations.Add(0.0);
+	OutObservations.Add(0.0);
 	if (bDrawDebugLines)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE_STR("Schola: RaySensor Debug Lines");
@@ -111,7 +111,7 @@ void URayCastObserver::HandleRayHit(FHitResult& InHitResult, FBoxPoint& OutObser
 				bIsTrackedTagFound = AttachedTags[i] == TrackedTag;
 			}
 
-			OutObservations.Values.Emplace(static_cast<float>(bIsTrackedTagFound));
+			OutObservations.Add(static_cast<float>(bIsTrackedTagFound));
 		}
 	}
 
@@ -139,8 +139,8 @@ void URayCastObserver::HandleRayHit(FHitResult& InHitResult, FBoxPoint& OutObser
 	// At this point we have a hit and it has some tags
 	// Loop through each tracked tag and check if we find some
 	// Always adds 0/1 to the OutObservations for each tag
-	OutObservations.Values.Emplace(1.0f);
-	OutObservations.Values.Emplace(InHitResult.Time);
+	OutObservations.Add(1.0f);
+	OutObservations.Add(InHitResult.Time);
 }
 
 void URayCastObserver::CollectObservations(FBoxPoint& OutObservations)
@@ -17,17 +17,17 @@ void URotationObserver::CollectObservations(FBoxPoint& OutObservations)
 
 		if (bHasPitch)
 		{
-			OutObservations.Values.Add(ActorRotation.Pitch);
+			OutObservations.Add(ActorRotation.Pitch);
 		}
 
 		if (bHasYaw)
 		{
-			OutObservations.Values.Add(ActorRotation.Yaw);
+			OutObservations.Add(ActorRotation.Yaw);
 		}
 
 		if (bHasRoll)
 		{
-			OutObservations.Values.Add(ActorRotation.Roll);
+			OutObservations.Add(ActorRotation.Roll);
 		}
 	}
 }
@@ -17,17 +17,17 @@ void UVelocityObserver::CollectObservations(FBoxPoint& OutObservations)
 
 		if (bHasXDimensions)
 		{
-			OutObservations.Values.Add(ActorVelocity.X);
+			OutObservations.Add(ActorVelocity.X);
 		}
 
 		if (bHasYDimensions)
 		{
-			OutObservations.Values.Add(ActorVelocity.Y);
+			OutObservations.Add(ActorVelocity.Y);
 		}
 
 		if (bHasZDimensions)
 		{
-			OutObservations.Values.Add(ActorVelocity.Z);
+			OutObservations.Add(ActorVelocity.Z);
 		}
 	}
 }
@@ -0,0 +1,342 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#include "Policies/InferenceBatchSubsystem.h"
+#include "Policies/InferencePolicy.h"
+#include "Subsystem/SubsystemSettings.h"
+#include "Async/Async.h"
+#include "Misc/IQueuedWork.h"
+#include "Misc/QueuedThreadPool.h"
+
+/**
+ * @brief A piece of inference work queued on the inference threads
+ */
+class FInferenceWork : public IQueuedWork
+{
+private:
+	TUniqueFunction<void()> Work;
+	TUniqueFunction<void()> OnAbandoned;
+
+public:
+	FInferenceWork(TUniqueFunction<void()> Work, TUniqueFunction<void()> OnAbandoned)
+		: Work(MoveTemp(Work)), OnAbandoned(MoveTemp(OnAbandoned))
+	{
+	}
+
+	void DoThreadedWork() override
+	{
+		this->Work();
+		delete this;
+	}
+
+	void Abandon() override
+	{
+		this->OnAbandoned();
+		delete this;
+	}
+};
+
+/**
+ * @brief Split the rows of a batch into runs of consecutive rows, so each run can be processed at once
+ * @param[in] Spaces The space of each row
+ * @param[in] IsSameRun Checks if the spaces of two rows can be in the same run
+ * @param[in] Func Called with the space, first row and number of rows of each run
+ */
+static void ForEachRun(const TArray<TSharedPtr<const FDictSpace>>& Spaces, TFunctionRef<bool(const FDictSpace&, const FDictSpace&)> IsSameRun, TFunctionRef<void(const FDictSpace&, int, int)> Func)
+{
+	int RunStart = 0;
+	for (int Row = 1; Row <= Spaces.Num(); Row++)
+	{
+		if (Row == Spaces.Num() || !IsSameRun(*Spaces[Row], *Spaces[RunStart]))
+		{
+			Func(*Spaces[RunStart], RunStart, Row - RunStart);
+			RunStart = Row;
+		}
+	}
+}
+
+/**
+ * @brief Split the rows of a batch into runs of consecutive rows whose spaces share a layout, so each run can be flattened or unflattened at once
+ * @param[in] Spaces The space of each row
+ * @param[in] Func Called with the space, first row and number of rows of each run
+ */
+static void ForEachLayoutRun(const TArray<TSharedPtr<const FDictSpace>>& Spaces, TFunctionRef<void(const FDictSpace&, int, int)> Func)
+{
+	ForEachRun(Spaces, [](const FDictSpace& Space, const FDictSpace& Other) { return Space.HasSameLayout(Other); }, Func);
+}
+
+/**
+ * @brief Split the rows of a batch into runs of consecutive rows from the same policy. Only these are sure to share bounds, as well as a layout
+ * @param[in] Spaces The space of each row
+ * @param[in] Func Called with the space, first row and number of rows of each run
+ */
+static void ForEachPolicyRun(const TArray<TSharedPtr<const FDictSpace>>& Spaces, TFunctionRef<void(const FDictSpace&, int, int)> Func)
+{
+	ForEachRun(Spaces, [](const FDictSpace& Space, const FDictSpace& Other) { return &Space == &Other; }, Func);
+}
+
+bool FInferenceBatchModel::Run(TArray<float>& Observations, TArray<float>& Actions, int NumRows)
+{
+	TSharedPtr<FModelInstancePool> Pool = this->InstancePool.Pin();
+	if (!Pool.IsValid())
+	{
+		return false;
+	}
+
+	FPooledModelInstance* PooledInstance = Pool->Acquire();
+	bool				  bSucceeded = true;
+
+	if (Pool->SupportsDynamicBatch())
+	{
+		TArray<FGenericTensorBinding> InputBindings = { { Observations.GetData(), NumRows * this->ObservationSize * sizeof(float) } };
+		TArray<FGenericTensorBinding> OutputBindings = { { Actions.GetData(), NumRows * this->ActionSize * sizeof(float) } };
+		bSucceeded = PooledInstance->SetBatchSize(NumRows) && (int)PooledInstance->Instance->RunSync(InputBindings, OutputBindings) == 0;
+	}
+	else
+	{
+		// The model was exported with a fixed batch size of 1, so run it once per row, still on a single task
+		bSucceeded = PooledInstance->SetBatchSize(1);
+		for (int Row = 0; bSucceeded && Row < NumRows; Row++)
+		{
+			TArray<FGenericTensorBinding> InputBindings = { { Observations.GetData() + Row * this->ObservationSize, this->ObservationSize * sizeof(float) } };
+			TArray<FGenericTensorBinding> OutputBindings = { { Actions.GetData() + Row * this->ActionSize, this->ActionSize * sizeof(float) } };
+			bSucceeded = (int)PooledInstance->Instance->RunSync(InputBindings, OutputBindings) == 0;
+		}
+	}
+
+	Pool->Release(PooledInstance);
+	return bSucceeded;
+}
+
+void UInferenceBatchSubsystem::RemoveExpiredEntries()
+{
+	for (auto It = this->Models.CreateIterator(); It; ++It)
+	{
+		if (!It->Value->InstancePool.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	for (auto It = this->PendingBatches.CreateIterator(); It; ++It)
+	{
+		if (!It->Value.Model.IsValid() || !It->Value.Model->InstancePool.IsValid())
+		{
+			for (TSharedPtr<TPromise<FPolicyDecision*>>& Promise : It->Value.Promises)
+			{
+				Promise->EmplaceValue(FPolicyDecision::PolicyError());
+			}
+			It.RemoveCurrent();
+		}
+	}
+}
+
+TSharedPtr<FInferenceBatchModel> UInferenceBatchSubsystem::FindOrCreateModel(const UInferencePolicy& Policy)
+{
+	TSharedPtr<FModelInstancePool> InstancePool = Policy.GetInstancePool();
+	if (!InstancePool.IsValid() || !InstancePool->IsValid())
+	{
+		return nullptr;
+	}
+
+	if (TSharedPtr<FInferenceBatchModel>* ExistingModel = this->Models.Find(InstancePool.Get()))
+	{
+		// A new pool can be created where an old one was freed, so check it's really the same pool
+		if ((*ExistingModel)->InstancePool.Pin() == InstancePool)
+		{
+			return *ExistingModel;
+		}
+	}
+
+	this->RemoveExpiredEntries();
+	TSharedPtr<FInferenceBatchModel> Model = MakeShared<FInferenceBatchModel>();
+	Model->InstancePool = InstancePool;
+	Model->ObservationSize = InstancePool->GetObservationSize();
+	Model->ActionSize = InstancePool->GetActionSize();
+
+	if (!InstancePool->SupportsDynamicBatch())
+	{
+		UE_LOG(LogSchola, Log, TEXT("Model %s has a Fixed Batch Size. Requests will be Run One at a Time"), *GetNameSafe(Policy.ModelData.Get()));
+	}
+
+	this->Models.Add(InstancePool.Get(), Model);
+	return Model;
+}
+
+TFuture<FPolicyDecision*> UInferenceBatchSubsystem::RequestDecision(const UInferencePolicy& Policy, const FDictPoint& Observations)
+{
+	TSharedPtr<TPromise<FPolicyDecision*>> DecisionPromise = MakeShared<TPromise<FPolicyDecision*>>();
+	TFuture<FPolicyDecision*>			   FutureDecision = DecisionPromise->GetFuture();
+
+	TSharedPtr<FInferenceBatchModel> Model = this->FindOrCreateModel(Policy);
+	if (!Model.IsValid())
+	{
+		DecisionPromise->EmplaceValue(FPolicyDecision::PolicyError());
+		return FutureDecision;
+	}
+
+	FInferenceBatch& Batch = this->PendingBatches.FindOrAdd(Policy.GetInstancePool().Get());
+	Batch.Model = Model;
+	FDictPoint& Row = Batch.Observations.Emplace_GetRef();
+	if (Observations.GetBufferSize() == Model->ObservationSize)
+	{
+		// Only the arena is read when flattening, so share it. The agent moves to a new one if it collects observations before the batch runs
+		Row.Buffer = Observations.Buffer;
+	}
+	else
+	{
+		Row = Observations;
+	}
+	Batch.ObservationSpaces.Add(Policy.GetSharedObservationSpaceDefn());
+	Batch.NormalizeObservations.Add(Policy.NormalizesObservations());
+	Batch.Promises.Add(DecisionPromise);
+	Batch.ActionSpaces.Add(Policy.GetSharedActionSpaceDefn());
+
+	return FutureDecision;
+}
+
+int UInferenceBatchSubsystem::Flush()
+{
+	int NumLaunched = 0;
+	for (TPair<FModelInstancePool*, FInferenceBatch>& Entry : this->PendingBatches)
+	{
+		FInferenceBatch& Batch = Entry.Value;
+		if (Batch.Promises.Num() == 0)
+		{
+			continue;
+		}
+
+		TArray<TSharedPtr<TPromise<FPolicyDecision*>>> AbandonedPromises = Batch.Promises;
+		this->LaunchInference([Model = Batch.Model, Observations = MoveTemp(Batch.Observations), ObservationSpaces = MoveTemp(Batch.ObservationSpaces), NormalizeObservations = MoveTemp(Batch.NormalizeObservations), Promises = MoveTemp(Batch.Promises), ActionSpaces = MoveTemp(Batch.ActionSpaces)]() mutable {
+			TRACE_CPUPROFILER_EVENT_SCOPE_STR("Schola: Running Inference Batch");
+			const int	  NumRows = Promises.Num();
+			TArray<float> FlatObservations;
+			FlatObservations.SetNumUninitialized(NumRows * Model->ObservationSize);
+			ForEachLayoutRun(ObservationSpaces, [&](const FDictSpace& Space, int Start, int Num) {
+				Space.FlattenBatch(MakeArrayView(Observations.GetData() + Start, Num), MakeArrayView(FlatObservations.GetData() + Start * Model->ObservationSize, Num * Model->ObservationSize));
+			});
+			// Hand the agents' arenas back before running the model
+			Observations.Empty();
+
+			ForEachPolicyRun(ObservationSpaces, [&](const FDictSpace& Space, int Start, int Num) {
+				if (NormalizeObservations[Start])
+				{
+					Space.NormalizeFlattenedBatch(FlatObservations.GetData() + Start * Model->ObservationSize, Num);
+				}
+			});
+
+			TArray<float> Actions;
+			Actions.SetNumUninitialized(NumRows * Model->ActionSize);
+
+			if (!Model->Run(FlatObservations, Actions, NumRows))
+			{
+				UE_LOG(LogSchola, Error, TEXT("Failed to run the model on a batch of %d"), NumRows);
+				for (TSharedPtr<TPromise<FPolicyDecision*>>& Promise : Promises)
+				{
+					Promise->EmplaceValue(FPolicyDecision::PolicyError());
+				}
+				return;
+			}
+
+			TArray<FPolicyDecision*> Decisions;
+			TArray<FDictPoint*>		 DecisionActions;
+			Decisions.Reserve(NumRows);
+			DecisionActions.Reserve(NumRows);
+			for (int Row = 0; Row < NumRows; Row++)
+			{
+				FPolicyDecision* Decision = Decisions.Add_GetRef(new FPolicyDecision(EDecisionType::ACTION));
+				DecisionActions.Add(&Decision->Action.Values);
+			}
+
+			// Keep continuous actions within the bounds the actuators declared, as the trainers do
+			ForEachPolicyRun(ActionSpaces, [&](const FDictSpace& Space, int Start, int Num) {
+				Space.ClampFlattenedBatch(Actions.GetData() + Start * Model->ActionSize, Num);
+			});
+
+			ForEachLayoutRun(ActionSpaces, [&](const FDictSpace& Space, int Start, int Num) {
+				Space.UnflattenBatch(MakeArrayView(Actions.GetData() + Start * Model->ActionSize, Num * Model->ActionSize), MakeArrayView(DecisionActions.GetData() + Start, Num));
+			});
+
+			for (int Row = 0; Row < NumRows; Row++)
+			{
+				Promises[Row]->EmplaceValue(Decisions[Row]);
+			}
+		}, [AbandonedPromises]() {
+			for (const TSharedPtr<TPromise<FPolicyDecision*>>& Promise : AbandonedPromises)
+			{
+				Promise->EmplaceValue(FPolicyDecision::PolicyError());
+			}
+		});
+
+		Batch.Observations.Reset();
+		Batch.ObservationSpaces.Reset();
+		Batch.NormalizeObservations.Reset();
+		Batch.Promises.Reset();
+		Batch.ActionSpaces.Reset();
+		NumLaunched++;
+	}
+	return NumLaunched;
+}
+
+void UInferenceBatchSubsystem::LaunchInference(TUniqueFunction<void()> Work, TUniqueFunction<void()> OnAbandoned)
+{
+	if (this->InferenceThreadPool)
+	{
+		this->InferenceThreadPool->AddQueuedWork(new FInferenceWork(MoveTemp(Work), MoveTemp(OnAbandoned)));
+	}
+	else
+	{
+		AsyncTask(ENamedThreads::AnyNormalThreadNormalTask, MoveTemp(Work));
+	}
+}
+
+int UInferenceBatchSubsystem::GetNumPendingRequests() const
+{
+	int NumPending = 0;
+	for (const TPair<FModelInstancePool*, FInferenceBatch>& Entry : this->PendingBatches)
+	{
+		NumPending += Entry.Value.Promises.Num();
+	}
+	return NumPending;
+}
+
+void UInferenceBatchSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const int NumThreads = GetDefault<UScholaManagerSubsystemSettings>()->InferenceSettings.GetNumInferenceThreads();
+	this->InferenceThreadPool = FQueuedThreadPool::Allocate();
+	if (!this->InferenceThreadPool->Create(NumThreads, 128 * 1024, TPri_Normal, TEXT("ScholaInferenceThreadPool")))
+	{
+		UE_LOG(LogSchola, Warning, TEXT("Failed to Create %d Inference Threads. Inference will run on the Task Graph"), NumThreads);
+		delete this->InferenceThreadPool;
+		this->InferenceThreadPool = nullptr;
+	}
+}
+
+void UInferenceBatchSubsystem::Tick(float DeltaTime)
+{
+	// Catches requests made outside of the manager's think phase, e.g. by agents driven from blueprints
+	this->Flush();
+}
+
+//Pipe the UObject GetStatID to the abstract method GetStatId in UTickableWorldSubsystem
+TStatId UInferenceBatchSubsystem::GetStatId() const
+{
+	return this->GetStatID();
+}
+
+void UInferenceBatchSubsystem::Deinitialize()
+{
+	// Don't leave anyone waiting on a request that will never run
+	this->Flush();
+	this->PendingBatches.Empty();
+	this->Models.Empty();
+
+	// Waits for running work to finish, and abandons anything still queued
+	if (this->InferenceThreadPool)
+	{
+		this->InferenceThreadPool->Destroy();
+		delete this->InferenceThreadPool;
+		this->InferenceThreadPool = nullptr;
+	}
+	Super::Deinitialize();
+}
@@ -1,6 +1,10 @@
 // Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
 
 #include "Policies/InferencePolicy.h"
+#include "Policies/InferenceBatchSubsystem.h"
+#include "Policies/ModelRegistrySubsystem.h"
+#include "Subsystem/SubsystemSettings.h"
+#include "Engine/World.h"
 
 int ConvertFromOneHot(TArray<int> OneHotVector)
 {
@@ -39,97 +43,222 @@ IRuntimeInterface* UInferencePolicy::GetRuntime(const FString& SelectedRuntimeNa
 	return nullptr;
 }
 
-TFuture<FPolicyDecision*> UInferencePolicy::RequestDecision(const FDictPoint& Observations)
+bool FPooledModelInstance::SetBatchSize(int NumRows)
 {
-	TPromise<FPolicyDecision*>* DecisionPromisePtr = new TPromise<FPolicyDecision*>();
-	// Get our future before it can potentially be cleaned up
-	TFuture<FPolicyDecision*> FutureDecision = DecisionPromisePtr->GetFuture();
-	
+	if (this->BatchSize == NumRows)
+	{
+		return true;
+	}
 
-	if (!this->bNetworkLoaded)
+	// Any symbolic dimension other than the leading one is run at size 1
+	TArray<uint32>		   Dims;
+	TConstArrayView<int32> SymbolicDims = this->Instance->GetInputTensorDescs()[0].GetShape().GetData();
+	for (int i = 0; i < SymbolicDims.Num(); i++)
 	{
-		DecisionPromisePtr->EmplaceValue(FPolicyDecision::PolicyError());
-		delete DecisionPromisePtr;
+		Dims.Add(i == 0 && SymbolicDims[i] < 0 ? NumRows : FMath::Max(SymbolicDims[i], 1));
 	}
-	else
+
+	if ((int)this->Instance->SetInputTensorShapes({ UE::NNE::FTensorShape::Make(Dims) }) != 0)
 	{
-		AsyncTask(ENamedThreads::AnyNormalThreadNormalTask, [this, Observations, DecisionPromisePtr]() {
-			FPolicyDecision* Decision = new FPolicyDecision(EDecisionType::ACTION);
+		UE_LOG(LogSchola, Error, TEXT("Failed to Shape the Model Input for a Batch of %d"), NumRows);
+		this->BatchSize = 0;
+		return false;
+	}
+	this->BatchSize = NumRows;
+	return true;
+}
 
-			TArray<FGenericTensorBinding> InputBindings;
-			TArray<FGenericTensorBinding> OutputBindings;
+FModelInstancePool::FModelInstancePool(TSharedPtr<IModelInterface> Model, int MaxInstances, int ObservationSize, int ActionSize)
+	: Model(Model), MaxInstances(FMath::Max(MaxInstances, 1)), ObservationSize(ObservationSize), ActionSize(ActionSize)
+{
+	this->InstanceReleased = FPlatformProcess::GetSynchEventFromPool(false);
 
-			InputBindings.Add(this->ObservationSpaceDefn.CreateTensorBinding(this->ObservationBuffer, Observations));
-			OutputBindings.Add(this->ActionSpaceDefn.CreateTensorBinding(this->ActionBuffer));
-			
-			if ((int)this->ModelInstance->RunSync(InputBindings, OutputBindings) != 0)
-			{
-				DecisionPromisePtr->EmplaceValue(FPolicyDecision::PolicyError());
-				UE_LOG(LogSchola, Error, TEXT("Failed to run the model"));
-			}
-			else
-			{
-				// Copy 2 and 3, maybe this does a move but I'm not sure
-				Decision->Action.Values = this->ActionSpaceDefn.UnflattenPoint(this->ActionBuffer);
+	FScopeLock ScopeLock(&this->Lock);
+	if (FPooledModelInstance* FirstInstance = this->CreateInstance())
+	{
+		TConstArrayView<int32> InputDims = FirstInstance->Instance->GetInputTensorDescs()[0].GetShape().GetData();
+		this->bDynamicBatch = InputDims.Num() > 0 && InputDims[0] < 0;
+		this->FreeInstances.Add(FirstInstance);
+	}
+}
 
-				// TODO cut down on the number of copy operations
-				//  acann, ~11/1/2023
-				DecisionPromisePtr->EmplaceValue(Decision);
-			}
-			
-			delete DecisionPromisePtr;
-		});
+FModelInstancePool::~FModelInstancePool()
+{
+	FPlatformProcess::ReturnSynchEventToPool(this->InstanceReleased);
+}
+
+FPooledModelInstance* FModelInstancePool::CreateInstance()
+{
+	if (!this->Model.IsValid())
+	{
+		return nullptr;
 	}
-	return FutureDecision;
+
+	TUniquePtr<IModelInstanceInterface> NewInstance = this->Model->CreateModelInstance();
+	if (!NewInstance.IsValid())
+	{
+		UE_LOG(LogSchola, Error, TEXT("Failed to create the model instance"));
+		return nullptr;
+	}
+
+	FPooledModelInstance* PooledInstance = this->Instances.Add_GetRef(MakeUnique<FPooledModelInstance>()).Get();
+	PooledInstance->Instance = TSharedPtr<IModelInstanceInterface>(NewInstance.Release());
+	PooledInstance->ActionBuffer.SetNumZeroed(this->ActionSize);
+	return PooledInstance;
 }
 
-void UInferencePolicy::Init(const FInteractionDefinition& PolicyDefinition)
+FPooledModelInstance* FModelInstancePool::Acquire()
 {
-	Step = 0;
-	ActionSpaceDefn = PolicyDefinition.ActionSpaceDefn;
-	ObservationSpaceDefn = PolicyDefinition.ObsSpaceDefn;
-	this->ActionBuffer.SetNumZeroed(ActionSpaceDefn.GetFlattenedSize());
-	this->ObservationBuffer.SetNumZeroed( ObservationSpaceDefn.GetFlattenedSize());
-	
-	if (ModelData)
+	while (true)
 	{
-		TUniquePtr<IRuntimeInterface> Runtime = TUniquePtr<IRuntimeInterface>(this->GetRuntime(this->RuntimeName));
-		if (Runtime.IsValid())
 		{
-			TUniquePtr<IModelInterface> TempModelPtr = Runtime->CreateModel(ModelData);
-			if (TempModelPtr.IsValid())
+			FScopeLock ScopeLock(&this->Lock);
+			if (this->FreeInstances.Num() > 0)
 			{
-				ModelInstance = TSharedPtr<IModelInstanceInterface>(TempModelPtr->CreateModelInstance().Release());
-				if (ModelInstance.IsValid())
-				{
-					ModelInstance->SetInputTensorShapes({ UE::NNE::FTensorShape::MakeFromSymbolic(ModelInstance->GetInputTensorDescs()[0].GetShape()) });
-					bNetworkLoaded = true;
-
-				}
-				else
-				{
-					UE_LOG(LogSchola, Error, TEXT("Failed to create the model instance"));
-					bNetworkLoaded = false;
-				}
+				return this->FreeInstances.Pop(false);
 			}
-			else
+			if (this->Instances.Num() < this->MaxInstances)
 			{
-				UE_LOG(LogSchola, Warning, TEXT("Failed to Create the Model"));
-				// Invalid Runtime
-				bNetworkLoaded = false;
+				if (FPooledModelInstance* NewInstance = this->CreateInstance())
+				{
+					return NewInstance;
+				}
+				// Creating more instances failed, so stop trying and make do with the ones we have
+				this->MaxInstances = this->Instances.Num();
 			}
 		}
-		else
+		this->InstanceReleased->Wait();
+	}
+}
+
+void FModelInstancePool::Release(FPooledModelInstance* PooledInstance)
+{
+	{
+		FScopeLock ScopeLock(&this->Lock);
+		this->FreeInstances.Push(PooledInstance);
+	}
+	this->InstanceReleased->Trigger();
+}
+
+TFuture<FPolicyDecision*> UInferencePolicy::RequestDecision(const FDictPoint& Observations)
+{
+	UWorld*					  World = this->GetWorld();
+	UInferenceBatchSubsystem* InferenceSubsystem = World ? World->GetSubsystem<UInferenceBatchSubsystem>() : nullptr;
+	if (this->bNetworkLoaded && this->bBatchRequests && InferenceSubsystem)
+	{
+		return InferenceSubsystem->RequestDecision(*this, Observations);
+	}
+
+	TSharedPtr<TPromise<FPolicyDecision*>> DecisionPromise = MakeShared<TPromise<FPolicyDecision*>>();
+	// Get our future before it can potentially be cleaned up
+	TFuture<FPolicyDecision*> FutureDecision = DecisionPromise->GetFuture();
+
+	if (!this->bNetworkLoaded)
+	{
+		DecisionPromise->EmplaceValue(FPolicyDecision::PolicyError());
+		return FutureDecision;
+	}
+
+	// The agent's arena is bound as is. Holding onto it makes the agent move to a new one if it collects observations before the request runs
+	TSharedPtr<TArray<float>> FlatObservations = Observations.Buffer;
+	if (this->bNormalizeObservations || Observations.GetBufferSize() != this->ObservationSpaceDefn.GetFlattenedSize())
+	{
+		// Normalizing in place would change the agent's observations, so it works on a copy
+		FlatObservations = MakeShared<TArray<float>>();
+		FlatObservations->SetNumUninitialized(this->ObservationSpaceDefn.GetFlattenedSize());
+		this->ObservationSpaceDefn.FlattenInto(MakeArrayView(*FlatObservations), Observations);
+		if (this->bNormalizeObservations)
+		{
+			this->ObservationSpaceDefn.NormalizeFlattenedBatch(FlatObservations->GetData(), 1);
+		}
+	}
+
+	// Nothing here refers back to the policy, since it can be destroyed before the request runs
+	TUniqueFunction<void()> Inference = [Pool = this->InstancePool, ActionSpace = this->SharedActionSpaceDefn, Observations = MoveTemp(FlatObservations), DecisionPromise]() mutable {
+		FPooledModelInstance* PooledInstance = Pool->Acquire();
+
+		TArray<FGenericTensorBinding> InputBindings = { { Observations->GetData(), Observations->Num() * sizeof(float) } };
+		TArray<FGenericTensorBinding> OutputBindings = { ActionSpace->CreateTensorBinding(PooledInstance->ActionBuffer) };
+
+		const bool bSucceeded = PooledInstance->SetBatchSize(1) && (int)PooledInstance->Instance->RunSync(InputBindings, OutputBindings) == 0;
+		// Let go of the arena as soon as the model is done with it, so the agent can keep writing to it in place
+		Observations.Reset();
+
+		if (!bSucceeded)
 		{
-			UE_LOG(LogSchola, Error, TEXT("Cannot find runtime %s, please enable the corresponding plugin"), *this->RuntimeName);
-			// Invalid Runtime
-			bNetworkLoaded = false;
+			Pool->Release(PooledInstance);
+			DecisionPromise->EmplaceValue(FPolicyDecision::PolicyError());
+			UE_LOG(LogSchola, Error, TEXT("Failed to run the model"));
+			return;
 		}
+
+		FPolicyDecision* Decision = new FPolicyDecision(EDecisionType::ACTION);
+		ActionSpace->ClampFlattenedBatch(PooledInstance->ActionBuffer.GetData(), 1);
+		ActionSpace->UnflattenInto(PooledInstance->ActionBuffer.GetData(), Decision->Action.Values);
+		Pool->Release(PooledInstance);
+		DecisionPromise->EmplaceValue(Decision);
+	};
+
+	if (InferenceSubsystem)
+	{
+		InferenceSubsystem->LaunchInference(MoveTemp(Inference), [DecisionPromise]() { DecisionPromise->EmplaceValue(FPolicyDecision::PolicyError()); });
 	}
 	else
+	{
+		AsyncTask(ENamedThreads::AnyNormalThreadNormalTask, MoveTemp(Inference));
+	}
+	return FutureDecision;
+}
+
+void UInferencePolicy::Init(const FInteractionDefinition& PolicyDefinition)
+{
+	Step = 0;
+	ActionSpaceDefn = PolicyDefinition.ActionSpaceDefn;
+	ObservationSpaceDefn = PolicyDefinition.ObsSpaceDefn;
+	ActionSpaceDefn.BuildLayout();
+	ObservationSpaceDefn.BuildLayout();
+	this->bNormalizeObservations = PolicyDefinition.bNormalizeObservations;
+	this->SharedActionSpaceDefn = MakeShared<const FDictSpace>(this->ActionSpaceDefn);
+	this->SharedObservationSpaceDefn = MakeShared<const FDictSpace>(this->ObservationSpaceDefn);
+
+	this->InstancePool.Reset();
+	if (UModelRegistrySubsystem* ModelRegistry = UModelRegistrySubsystem::Get(this))
+	{
+		// Agents sharing model data share one loaded model, and one pool of instances
+		this->InstancePool = ModelRegistry->FindOrCreateInstancePool(*this);
+	}
+	else if (TSharedPtr<IModelInterface> Model = this->CreateModel())
+	{
+		this->InstancePool = this->CreateInstancePool(Model);
+	}
+	bNetworkLoaded = this->InstancePool.IsValid() && this->InstancePool->IsValid();
+}
+
+TSharedPtr<IModelInterface> UInferencePolicy::CreateModel() const
+{
+	if (!ModelData)
 	{
 		UE_LOG(LogSchola, Warning, TEXT("Failed to Create Network Due to Invalid Model Data"));
-		// Invalid Model Data
-		bNetworkLoaded = false;
+		return nullptr;
+	}
+
+	TUniquePtr<IRuntimeInterface> Runtime = TUniquePtr<IRuntimeInterface>(this->GetRuntime(this->RuntimeName));
+	if (!Runtime.IsValid())
+	{
+		UE_LOG(LogSchola, Error, TEXT("Cannot find runtime %s, please enable the corresponding plugin"), *this->RuntimeName);
+		return nullptr;
+	}
+
+	TSharedPtr<IModelInterface> Model = TSharedPtr<IModelInterface>(Runtime->CreateModel(ModelData).Release());
+	if (!Model.IsValid())
+	{
+		UE_LOG(LogSchola, Warning, TEXT("Failed to Create the Model"));
 	}
-}
\ No newline at end of file
+	return Model;
+}
+
+TSharedPtr<FModelInstancePool> UInferencePolicy::CreateInstancePool(TSharedPtr<IModelInterface> Model) const
+{
+	const int MaxInstances = GetDefault<UScholaManagerSubsystemSettings>()->InferenceSettings.GetMaxInstancesPerModel();
+	return MakeShared<FModelInstancePool>(Model, MaxInstances, this->ObservationSpaceDefn.GetFlattenedSize(), this->ActionSpaceDefn.GetFlattenedSize());
+}
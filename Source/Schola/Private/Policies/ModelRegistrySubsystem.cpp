@@ -0,0 +1,97 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#include "Policies/ModelRegistrySubsystem.h"
+#include "Policies/InferencePolicy.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+UModelRegistrySubsystem* UModelRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? UGameInstance::GetSubsystem<UModelRegistrySubsystem>(World->GetGameInstance()) : nullptr;
+}
+
+void UModelRegistrySubsystem::RemoveExpiredEntries()
+{
+	for (auto It = this->Models.CreateIterator(); It; ++It)
+	{
+		if (!It->Value.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	for (auto It = this->InstancePools.CreateIterator(); It; ++It)
+	{
+		if (!It->Value.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+TSharedPtr<IModelInterface> UModelRegistrySubsystem::FindOrCreateModel(const UInferencePolicy& Policy)
+{
+	const TPair<UNNEModelData*, FString> Key(Policy.ModelData.Get(), Policy.RuntimeName);
+	if (TWeakPtr<IModelInterface>* ExistingModel = this->Models.Find(Key))
+	{
+		if (TSharedPtr<IModelInterface> Model = ExistingModel->Pin())
+		{
+			return Model;
+		}
+	}
+
+	this->RemoveExpiredEntries();
+	TSharedPtr<IModelInterface> Model = Policy.CreateModel();
+	if (Model.IsValid())
+	{
+		this->Models.Add(Key, Model);
+		UE_LOG(LogSchola, Log, TEXT("Loaded Model %s on Runtime %s"), *GetNameSafe(Policy.ModelData.Get()), *Policy.RuntimeName);
+	}
+	return Model;
+}
+
+TSharedPtr<FModelInstancePool> UModelRegistrySubsystem::FindOrCreateInstancePool(const UInferencePolicy& Policy)
+{
+	const int ObservationSize = Policy.ObservationSpaceDefn.GetFlattenedSize();
+	const int ActionSize = Policy.ActionSpaceDefn.GetFlattenedSize();
+
+	const TTuple<UNNEModelData*, FString, int, int> Key(Policy.ModelData.Get(), Policy.RuntimeName, ObservationSize, ActionSize);
+	if (TWeakPtr<FModelInstancePool>* ExistingPool = this->InstancePools.Find(Key))
+	{
+		if (TSharedPtr<FModelInstancePool> InstancePool = ExistingPool->Pin())
+		{
+			return InstancePool;
+		}
+	}
+
+	TSharedPtr<IModelInterface> Model = this->FindOrCreateModel(Policy);
+	if (!Model.IsValid())
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FModelInstancePool> InstancePool = Policy.CreateInstancePool(Model);
+	if (InstancePool->IsValid())
+	{
+		this->InstancePools.Add(Key, InstancePool);
+	}
+	return InstancePool;
+}
+
+int UModelRegistrySubsystem::GetNumLoadedModels() const
+{
+	int NumLoaded = 0;
+	for (const TPair<TPair<UNNEModelData*, FString>, TWeakPtr<IModelInterface>>& Entry : this->Models)
+	{
+		NumLoaded += Entry.Value.IsValid() ? 1 : 0;
+	}
+	return NumLoaded;
+}
+
+void UModelRegistrySubsystem::Deinitialize()
+{
+	// Policies still holding models keep them alive, this just stops handing them out
+	this->Models.Empty();
+	this->InstancePools.Empty();
+	Super::Deinitialize();
+}
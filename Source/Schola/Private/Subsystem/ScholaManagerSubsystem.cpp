@@ -1,6 +1,10 @@
 // Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
 
 #include "Subsystem/ScholaManagerSubsystem.h"
+#include "Subsystem/ScholaRegistrySubsystem.h"
+#include "Policies/InferenceBatchSubsystem.h"
+#include "Misc/App.h"
+#include "Engine/GameViewportClient.h"
 
 void UScholaManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -10,15 +14,134 @@ void UScholaManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UScholaManagerSubsystem::Deinitialize()
 {
+	this->RestoreSimulation();
+	Super::Deinitialize();
+}
+
+void UScholaManagerSubsystem::SetupSimulation(const FSimulationSettings& Settings)
+{
+	this->WorldRenderInterval = Settings.WorldRenderInterval;
+	FParse::Value(FCommandLine::Get(), TEXT("ScholaWorldRenderInterval="), this->WorldRenderInterval);
+	this->WorldRenderInterval = FMath::Max(this->WorldRenderInterval, 1);
+
+	// Frames that don't draw the world take less time, so the world has to advance by a fixed delta to behave the same in every frame
+	if (Settings.bUseFixedTimeStep || this->WorldRenderInterval > 1)
+	{
+		this->StepDeltaTime = FMath::Max(Settings.FixedDeltaTime, KINDA_SMALL_NUMBER);
+		if (!this->bOverrodeTimeStep)
+		{
+			this->bPreviousUseFixedTimeStep = FApp::UseFixedTimeStep();
+			this->PreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+			this->bOverrodeTimeStep = true;
+		}
+		FApp::SetUseFixedTimeStep(true);
+		FApp::SetFixedDeltaTime(this->StepDeltaTime);
+		UE_LOG(LogSchola, Log, TEXT("Stepping by %f seconds per Frame, and Drawing the World every %d Frames"), this->StepDeltaTime, this->WorldRenderInterval);
+	}
+
+	if (this->WorldRenderInterval > 1 && !this->WorldTickStartHandle.IsValid())
+	{
+		this->FramesSinceRender = 0;
+		this->WorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddUObject(this, &UScholaManagerSubsystem::OnWorldTickStart);
+	}
+
+	if (this->bOverrodeTimeStep && !this->WorldTearDownHandle.IsValid())
+	{
+		this->WorldTearDownHandle = FWorldDelegates::OnWorldBeginTearDown.AddUObject(this, &UScholaManagerSubsystem::OnWorldBeginTearDown);
+	}
+}
+
+void UScholaManagerSubsystem::RestoreSimulation()
+{
+	if (this->WorldTickStartHandle.IsValid())
+	{
+		FWorldDelegates::OnWorldTickStart.Remove(this->WorldTickStartHandle);
+		this->WorldTickStartHandle.Reset();
+	}
+	if (this->WorldTearDownHandle.IsValid())
+	{
+		FWorldDelegates::OnWorldBeginTearDown.Remove(this->WorldTearDownHandle);
+		this->WorldTearDownHandle.Reset();
+	}
+
+	if (this->bDisabledWorldRendering)
+	{
+		UWorld* World = GetWorld();
+		if (UGameViewportClient* Viewport = World ? World->GetGameViewport() : nullptr)
+		{
+			Viewport->bDisableWorldRendering = false;
+		}
+		this->bDisabledWorldRendering = false;
+	}
+
+	// The time step is global to the engine, so put it back for anything that runs after us, e.g. the editor after play in editor
+	if (this->bOverrodeTimeStep)
+	{
+		FApp::SetUseFixedTimeStep(this->bPreviousUseFixedTimeStep);
+		FApp::SetFixedDeltaTime(this->PreviousFixedDeltaTime);
+		this->bOverrodeTimeStep = false;
+	}
+}
+
+void UScholaManagerSubsystem::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	UGameViewportClient* Viewport = World->GetGameViewport();
+	if (Viewport == nullptr)
+	{
+		// Nothing is drawn anyway, e.g. a dedicated server
+		return;
+	}
+
+	// Keep drawing while paused, so the viewport doesn't freeze on a stale image
+	if (World->IsPaused())
+	{
+		Viewport->bDisableWorldRendering = false;
+	}
+	else
+	{
+		this->FramesSinceRender = (this->FramesSinceRender + 1) % this->WorldRenderInterval;
+		Viewport->bDisableWorldRendering = this->FramesSinceRender != 0;
+	}
+	this->bDisabledWorldRendering = Viewport->bDisableWorldRendering;
+}
+
+void UScholaManagerSubsystem::OnWorldBeginTearDown(UWorld* World)
+{
+	if (World == GetWorld())
+	{
+		this->RestoreSimulation();
+	}
+}
+
+void UScholaManagerSubsystem::SetupDecisionScheduling(const FInferenceSettings& Settings)
+{
+	this->bStaggerDecisions = Settings.bStaggerDecisions;
+	this->MaxDecisionsPerFrame = FMath::Max(Settings.MaxDecisionsPerFrame, 0);
+	this->MaxDecisionTimePerFrame = FMath::Max(Settings.MaxDecisionTimePerFrame, 0.0f) / 1000.0;
+}
+
+void UScholaManagerSubsystem::ResetDecisionBudget()
+{
+	this->NumFrameDecisions = 0;
+	this->DecisionDeadline = 0.0;
+	this->bDecisionBudgetSpent = false;
+	this->NumDeferredDecisions = 0;
 }
 
 void UScholaManagerSubsystem::Tick(float DeltaTime)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR("Schola: Subsystem Tick");
 
+	// Every step is an engine frame of it's own, so each one gets a fresh budget
+	this->ResetDecisionBudget();
+
 	if (this->GymConnector && this->GymConnector->IsNotStarted())
 	{
-		bFirstStep = true;
 		bool bStarted = this->GymConnector->CheckForStart();
 
 		if (bStarted)
@@ -63,13 +186,11 @@ void UScholaManagerSubsystem::Tick(float DeltaTime)
 		this->InferenceAgentsThink();
 	}
 
-	// self-Reset Phase if we have already run for 1+ steps
-	if (this->GymConnector && !bFirstStep && this->GymConnector->IsRunning())
+	// self-Reset Phase. Runs on the first step too, since a state waiting on in band resets is only sent from here
+	if (this->GymConnector && this->GymConnector->IsRunning())
 	{
 		this->GymConnector->ResetCompletedEnvironments();
 	}
-
-	bFirstStep = false;
 }
 
 ETickableTickType UScholaManagerSubsystem::GetTickableTickType() const
@@ -85,11 +206,40 @@ TStatId UScholaManagerSubsystem::GetStatId() const
 
 void UScholaManagerSubsystem::RegisterInferenceAgent(UObject* InferenceAgent)
 {
+	if (this->InferenceAgentIndices.Contains(InferenceAgent))
+	{
+		return;
+	}
+
 	UE_LOG(LogSchola, Log, TEXT("Inference Agent Registered"))
+	this->InferenceAgentIndices.Add(InferenceAgent, this->InferenceAgents.Num());
 	TScriptInterface<IInferenceAgent>& InterfaceRef = this->InferenceAgents.Emplace_GetRef();
 	InterfaceRef.SetObject(InferenceAgent);
 	InterfaceRef.SetInterface(Cast<IInferenceAgent>(InferenceAgent));
 
+	// Consecutive agents get consecutive phases, so agents sharing a decision frequency are spread evenly over it
+	if (this->bStaggerDecisions && InterfaceRef->GetBrain())
+	{
+		InterfaceRef->GetBrain()->SetDecisionPhase(this->NextDecisionPhase++);
+	}
+
+}
+
+void UScholaManagerSubsystem::DeregisterInferenceAgent(UObject* InferenceAgent)
+{
+	int Index = INDEX_NONE;
+	if (!this->InferenceAgentIndices.RemoveAndCopyValue(InferenceAgent, Index))
+	{
+		return;
+	}
+
+	// Swap the last agent into the gap, so removing doesn't shift every agent after it
+	this->InferenceAgents.RemoveAtSwap(Index, 1, false);
+	if (this->InferenceAgents.IsValidIndex(Index))
+	{
+		this->InferenceAgentIndices[this->InferenceAgents[Index].GetObject()] = Index;
+	}
+	UE_LOG(LogSchola, Log, TEXT("Inference Agent Deregistered"))
 }
 
 void UScholaManagerSubsystem::PrepareSubsystem()
@@ -97,14 +247,37 @@ void UScholaManagerSubsystem::PrepareSubsystem()
 
 	const UScholaManagerSubsystemSettings* ScholaSettings = GetDefault<UScholaManagerSubsystemSettings>();
 
+	// Copies of environments need to exist before the gym connector goes looking for environments to register
+	TArray<AActor*> Spawners;
+	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AEnvironmentSpawner::StaticClass(), Spawners);
+	for (AActor* Spawner : Spawners)
+	{
+		Cast<AEnvironmentSpawner>(Spawner)->SpawnEnvironments();
+	}
+
+	int NumShards = ScholaSettings->CommunicatorSettings.NumShards;
+	FParse::Value(FCommandLine::Get(), TEXT("ScholaShards="), NumShards);
+
 	// Don't generate a new gym connector if it doesn't exist
-	if (*ScholaSettings->GymConnectorClass != nullptr)
+	if (*ScholaSettings->GymConnectorClass != nullptr && NumShards > 1 && ScholaSettings->GymConnectorClass->IsChildOf(UExternalGymConnector::StaticClass()))
 	{
+		UShardedGymConnector* ShardedConnector = NewObject<UShardedGymConnector>(this, FName("GymConnector"));
+		ShardedConnector->Configure(ScholaSettings->GymConnectorClass.Get(), NumShards, ScholaSettings->CommunicatorSettings.Timeout);
+		this->GymConnector = ShardedConnector;
+		this->GymConnector->Init();
+	}
+	else if (*ScholaSettings->GymConnectorClass != nullptr)
+	{
+		if (NumShards > 1)
+		{
+			UE_LOG(LogSchola, Warning, TEXT("Only external gym connectors can be sharded. Serving every environment from one connector"));
+		}
 		this->GymConnector = NewObject<UAbstractGymConnector>(this, ScholaSettings->GymConnectorClass, FName("GymConnector"));
 		this->GymConnector->Init();
 	}
 
 	// Setup the inferencing agents
+	this->SetupDecisionScheduling(ScholaSettings->InferenceSettings);
 	CollectInferenceAgents();
 	InitializeInferenceAgents();
 
@@ -125,13 +298,24 @@ void UScholaManagerSubsystem::PrepareSubsystem()
 		UE_LOG(LogSchola, Warning, TEXT("Backend Started"));
 		// Make the tick start doing it's thing
 		bSubsystemPrepared = true;
-		bFirstStep = true;
+		this->SetupSimulation(ScholaSettings->SimulationSettings);
 
 		// Use the config setting, but we can override the config value by passing ScholaDisableScript on the command line
 		if (ScholaSettings->bRunScriptOnPlay && !FParse::Param(FCommandLine::Get(), TEXT("ScholaDisableScript")))
 		{
-			FLaunchableScript TrainingScript = ScholaSettings->GetScript();
-			TrainingScript.LaunchScript();
+			// One trainer per shard, each on its shard's port or shared memory block
+			UShardedGymConnector* ShardedConnector = Cast<UShardedGymConnector>(this->GymConnector);
+			if (ShardedConnector)
+			{
+				for (int ShardIndex = 0; ShardIndex < ShardedConnector->GetNumShards(); ShardIndex++)
+				{
+					ScholaSettings->GetScript(ShardIndex).LaunchScript();
+				}
+			}
+			else
+			{
+				ScholaSettings->GetScript().LaunchScript();
+			}
 		}
 	}
 	else if (NumAgents == 0)
@@ -141,27 +325,57 @@ void UScholaManagerSubsystem::PrepareSubsystem()
 }
 
 //TODO make this work when the Agent is Stored as a component
+bool UScholaManagerSubsystem::IsValidInferenceAgent(UObject* Object) const
+{
+	IInferenceAgent* Agent = Cast<IInferenceAgent>(Object);
+	return Agent && Agent->GetBrain() && Agent->GetPolicy() && Agent->GetControlledPawn();
+}
+
 void UScholaManagerSubsystem::CollectInferenceAgents()
 {
-	int Count = 0;
-	for (UObject* Object : TObjectRange<UObject>())
+	UScholaRegistrySubsystem* Registry = UScholaRegistrySubsystem::Get(this);
+	if (Registry == nullptr)
 	{
-		Count++;
-		//Object is in the same world as us and is an Agent
-		if (Object->GetWorld() == GetWorld() && Object->GetClass()->ImplementsInterface(UInferenceAgent::StaticClass()))
-		{
-			IInferenceAgent* Agent = Cast<IInferenceAgent>(Object);
+		return;
+	}
 
-			if (Agent->GetBrain() && Agent->GetPolicy() && Agent->GetControlledPawn())
-			{
-				this->RegisterInferenceAgent(Object);
-			}
-			else
-			{
-				UE_LOG(LogSchola, Warning, TEXT("Skipping Registering InferenceAgent %s due to invalid setup"), *Object->GetName());
-			}
+	TArray<UObject*> RegisteredAgents;
+	Registry->GetInferenceAgents().GetAll(RegisteredAgents);
+	for (UObject* Object : RegisteredAgents)
+	{
+		if (this->IsValidInferenceAgent(Object))
+		{
+			this->RegisterInferenceAgent(Object);
+		}
+		else
+		{
+			UE_LOG(LogSchola, Warning, TEXT("Skipping Registering InferenceAgent %s due to invalid setup"), *Object->GetName());
 		}
 	}
+
+	// Agents spawned or destroyed from now on join or leave as they come and go
+	if (!this->AgentRegisteredHandle.IsValid())
+	{
+		this->AgentRegisteredHandle = Registry->OnInferenceAgentRegistered.AddUObject(this, &UScholaManagerSubsystem::OnInferenceAgentRegistered);
+		this->AgentDeregisteredHandle = Registry->OnInferenceAgentDeregistered.AddUObject(this, &UScholaManagerSubsystem::OnInferenceAgentDeregistered);
+	}
+}
+
+void UScholaManagerSubsystem::OnInferenceAgentRegistered(UObject* Object, int Id)
+{
+	if (!this->IsValidInferenceAgent(Object))
+	{
+		UE_LOG(LogSchola, Warning, TEXT("Skipping Registering InferenceAgent %s due to invalid setup"), *Object->GetName());
+		return;
+	}
+
+	this->RegisterInferenceAgent(Object);
+	Cast<IInferenceAgent>(Object)->Initialize();
+}
+
+void UScholaManagerSubsystem::OnInferenceAgentDeregistered(UObject* Object, int Id)
+{
+	this->DeregisterInferenceAgent(Object);
 }
 
 bool UScholaManagerSubsystem::IsTickable() const
@@ -171,24 +385,70 @@ bool UScholaManagerSubsystem::IsTickable() const
 
 void UScholaManagerSubsystem::InferenceAgentsThink()
 {
-	for (TScriptInterface<IInferenceAgent> Agent : InferenceAgents)
+	if (this->MaxDecisionTimePerFrame > 0.0 && this->DecisionDeadline == 0.0)
 	{
-		// Check for agent status
-		if (Agent->GetStatus() != EAgentStatus::Error)
+		this->DecisionDeadline = FPlatformTime::Seconds() + this->MaxDecisionTimePerFrame;
+	}
+
+	// Agents can deregister, or spawn others, while thinking, so work from the agents there were when we started
+	const TArray<TScriptInterface<IInferenceAgent>> Agents = this->InferenceAgents;
+
+	// Start from the first agent deferred last frame, wrapping around, so every agent gets a turn at the front of the budget
+	const int NumAgents = Agents.Num();
+	const int StartIndex = NumAgents > 0 ? this->NextThinkIndex % NumAgents : 0;
+	for (int Offset = 0; Offset < NumAgents; Offset++)
+	{
+		const int						  Index = (StartIndex + Offset) % NumAgents;
+		TScriptInterface<IInferenceAgent> Agent = Agents[Index];
+		if (!this->InferenceAgentIndices.Contains(Agent.GetObject()))
 		{
-			Agent->Think();
+			continue;
 		}
-		else
+
+		// Check for agent status
+		if (Agent->GetStatus() == EAgentStatus::Error)
 		{
 			UE_LOG(LogSchola, Warning, TEXT("Agent %s has errored out during think"), *Agent->GetAgentName());
+			continue;
+		}
+
+		if (Agent->GetStatus() == EAgentStatus::Running && Agent->GetBrain()->IsDecisionStep())
+		{
+			if (!this->bDecisionBudgetSpent && ((this->MaxDecisionsPerFrame > 0 && this->NumFrameDecisions >= this->MaxDecisionsPerFrame) || (this->DecisionDeadline > 0.0 && FPlatformTime::Seconds() >= this->DecisionDeadline)))
+			{
+				this->bDecisionBudgetSpent = true;
+				this->NextThinkIndex = Index;
+			}
+
+			if (this->bDecisionBudgetSpent)
+			{
+				Agent->GetBrain()->DeferDecision();
+				this->NumDeferredDecisions++;
+				continue;
+			}
+			this->NumFrameDecisions++;
 		}
+		Agent->Think();
+	}
+
+	// Every agent has made it's request, so run each shared model once on all of them
+	if (UInferenceBatchSubsystem* Batcher = this->GetWorld()->GetSubsystem<UInferenceBatchSubsystem>())
+	{
+		Batcher->Flush();
 	}
 }
 
 void UScholaManagerSubsystem::InferenceAgentsAct()
 {
-	for (TScriptInterface<IInferenceAgent> Agent : InferenceAgents)
+	// Agents can deregister while acting, e.g. by destroying their pawn, so work from the agents there were when we started
+	const TArray<TScriptInterface<IInferenceAgent>> Agents = this->InferenceAgents;
+	for (const TScriptInterface<IInferenceAgent>& Agent : Agents)
 	{
+		if (!this->InferenceAgentIndices.Contains(Agent.GetObject()))
+		{
+			continue;
+		}
+
 		// Check for agent status
 		// If error, log and remove this agent
 		if (Agent->GetStatus() != EAgentStatus::Error)
@@ -209,4 +469,4 @@ void UScholaManagerSubsystem::InitializeInferenceAgents()
 	{
 		Agent->Initialize();
 	}
-}
\ No newline at end of file
+}
@@ -0,0 +1,63 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#include "Subsystem/ScholaRegistrySubsystem.h"
+#include "Environment/AbstractEnvironment.h"
+#include "Training/AbstractTrainer.h"
+#include "Engine/World.h"
+
+UScholaRegistrySubsystem* UScholaRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UScholaRegistrySubsystem>() : nullptr;
+}
+
+void UScholaRegistrySubsystem::RegisterEnvironment(AAbstractScholaEnvironment* Environment)
+{
+	if (this->Environments.Find(Environment) == INDEX_NONE)
+	{
+		this->OnEnvironmentRegistered.Broadcast(Environment, this->Environments.Add(Environment));
+	}
+}
+
+void UScholaRegistrySubsystem::DeregisterEnvironment(AAbstractScholaEnvironment* Environment)
+{
+	const int Id = this->Environments.Remove(Environment);
+	if (Id != INDEX_NONE)
+	{
+		this->OnEnvironmentDeregistered.Broadcast(Environment, Id);
+	}
+}
+
+void UScholaRegistrySubsystem::RegisterTrainer(AAbstractTrainer* Trainer)
+{
+	if (this->Trainers.Find(Trainer) == INDEX_NONE)
+	{
+		this->OnTrainerRegistered.Broadcast(Trainer, this->Trainers.Add(Trainer));
+	}
+}
+
+void UScholaRegistrySubsystem::DeregisterTrainer(AAbstractTrainer* Trainer)
+{
+	const int Id = this->Trainers.Remove(Trainer);
+	if (Id != INDEX_NONE)
+	{
+		this->OnTrainerDeregistered.Broadcast(Trainer, Id);
+	}
+}
+
+void UScholaRegistrySubsystem::RegisterInferenceAgent(UObject* InferenceAgent)
+{
+	if (this->InferenceAgents.Find(InferenceAgent) == INDEX_NONE)
+	{
+		this->OnInferenceAgentRegistered.Broadcast(InferenceAgent, this->InferenceAgents.Add(InferenceAgent));
+	}
+}
+
+void UScholaRegistrySubsystem::DeregisterInferenceAgent(UObject* InferenceAgent)
+{
+	const int Id = this->InferenceAgents.Remove(InferenceAgent);
+	if (Id != INDEX_NONE)
+	{
+		this->OnInferenceAgentDeregistered.Broadcast(InferenceAgent, Id);
+	}
+}
@@ -11,14 +11,45 @@ UScholaManagerSubsystemSettings::UScholaManagerSubsystemSettings()
 {
 }
 
-FLaunchableScript UScholaManagerSubsystemSettings::GetScript() const
+FLaunchableScript UScholaManagerSubsystemSettings::GetScript(int ShardIndex) const
 {
 	FLaunchableScript Script = this->ScriptSettings.GetLaunchableScript();
-	FString			  TrainingArgs = this->ScriptSettings.GetTrainingArgs(this->CommunicatorSettings.Port);
+	FString			  TrainingArgs = this->ScriptSettings.GetTrainingArgs(this->CommunicatorSettings.Port + FMath::Max(ShardIndex, 0));
+
+	// Point the trainer at the same block the connector for this shard opens
+	FString SharedMemoryName = this->CommunicatorSettings.GetSharedMemoryName(ShardIndex);
+	if (!SharedMemoryName.IsEmpty() && this->ScriptSettings.ScriptType == EScriptType::Python)
+	{
+		TrainingArgs += FScriptArgBuilder().AddStringArg(TEXT("shared-memory"), SharedMemoryName).Build();
+	}
+
 	Script.AppendArgs(TrainingArgs);
 	return Script;
 }
 
+FString FCommunicatorSettings::GetSharedMemoryName(int ShardIndex) const
+{
+	FString Name = this->SharedMemoryName;
+	FParse::Value(FCommandLine::Get(), TEXT("ScholaSharedMemory="), Name);
+	if (!Name.IsEmpty() && ShardIndex != INDEX_NONE)
+	{
+		Name += FString::Printf(TEXT("_%d"), ShardIndex);
+	}
+	return Name;
+}
+
+int FInferenceSettings::GetNumInferenceThreads() const
+{
+	int NumThreads = this->NumInferenceThreads > 0 ? this->NumInferenceThreads : FPlatformMisc::NumberOfCores();
+	FParse::Value(FCommandLine::Get(), TEXT("ScholaInferenceThreads="), NumThreads);
+	return FMath::Max(NumThreads, 1);
+}
+
+int FInferenceSettings::GetMaxInstancesPerModel() const
+{
+	return this->MaxInstancesPerModel > 0 ? this->MaxInstancesPerModel : this->GetNumInferenceThreads();
+}
+
 void FRLlibTrainingSettings::GenerateTrainingArgs(int Port, FScriptArgBuilder& ArgBuilder) const
 {
 	ArgBuilder.AddIntArg(TEXT("port"), Port);
@@ -0,0 +1,145 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Common/Points.h"
+#include "Communicator/ProtobufSerializer.h"
+#include "Communicator/ProtobufDeserializer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Spans three words, with the last one only partly used */
+static const int NumTestBits = 130;
+
+/** The bits set in the test points. Either side of each word boundary, and the last bit */
+static const TArray<int> TestSetBits = { 0, 63, 64, 129 };
+
+/**
+ * @brief Make a packed binary point with TestSetBits set
+ * @return The point
+ */
+static FBinaryPoint MakePackedTestPoint()
+{
+	FBinaryPoint Point;
+	Point.InitPacked(NumTestBits);
+	for (int Bit : TestSetBits)
+	{
+		Point.SetBit(Bit, true);
+	}
+	return Point;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScholaPackedBinaryPointTest, "Schola.Points.PackedBinary", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FScholaPackedBinaryPointTest::RunTest(const FString& Parameters)
+{
+	FBinaryPoint Point = MakePackedTestPoint();
+	TestEqual(TEXT("Num"), Point.Num(), NumTestBits);
+	TestEqual(TEXT("Number of words"), Point.PackedWords.Num(), 3);
+	TestEqual(TEXT("Set bits"), Point.CountSetBits(), TestSetBits.Num());
+	TestTrue(TEXT("Clean padding"), Point.HasCleanPadding());
+
+	TArray<float> Flattened;
+	Flattened.Init(-1.0f, NumTestBits);
+	Point.FlattenTo(Flattened.GetData());
+	for (int Bit = 0; Bit < NumTestBits; Bit++)
+	{
+		const bool bExpected = TestSetBits.Contains(Bit);
+		if (Point[Bit] != bExpected || Flattened[Bit] != static_cast<float>(bExpected))
+		{
+			AddError(FString::Printf(TEXT("Bit %d should be %d"), Bit, bExpected));
+		}
+	}
+
+	Point.SetBit(64, false);
+	TestEqual(TEXT("Set bits after clearing one"), Point.CountSetBits(), TestSetBits.Num() - 1);
+
+	// Bits past the end would be counted by validation, so they have to stay clear
+	Point.PackedWords.Last() |= uint64(1) << 10;
+	TestFalse(TEXT("Dirty padding"), Point.HasCleanPadding());
+
+	Point.Reset();
+	TestEqual(TEXT("Num after reset"), Point.Num(), NumTestBits);
+	TestEqual(TEXT("Set bits after reset"), Point.CountSetBits(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScholaPackedBinaryPointProtobufTest, "Schola.Points.PackedBinaryProtobufRoundTrip", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FScholaPackedBinaryPointProtobufTest::RunTest(const FString& Parameters)
+{
+	TArray<bool> UnpackedValues = { true, false, true };
+	FDictPoint	 Point;
+	Point.Add().Emplace<FBinaryPoint>(MakePackedTestPoint());
+	Point.Add().Emplace<FBinaryPoint>(UnpackedValues);
+
+	Schola::DictPoint  Msg;
+	ProtobufSerializer Serializer(&Msg);
+	Point.Accept(Serializer);
+
+	const Schola::BinaryPoint& PackedMsg = Msg.values(0).binary_point();
+	TestEqual(TEXT("Packed bytes"), static_cast<int>(PackedMsg.packed_values().size()), (NumTestBits + 7) / 8);
+	TestEqual(TEXT("Packed count"), PackedMsg.num_packed_values(), NumTestBits);
+	TestEqual(TEXT("Packed repeated values"), PackedMsg.values_size(), 0);
+	TestEqual(TEXT("Unpacked count"), Msg.values(1).binary_point().values_size(), UnpackedValues.Num());
+
+	// Deserialize into points of the opposite representation, which must be replaced rather than reused
+	FDictPoint Deserialized;
+	Deserialized.Add().Emplace<FBinaryPoint>(UnpackedValues);
+	Deserialized.Add().Emplace<FBinaryPoint>(MakePackedTestPoint());
+	ProtobufDeserializer::Deserialize(Msg, Deserialized);
+
+	const FBinaryPoint& PackedOut = Deserialized[0].Get<FBinaryPoint>();
+	TestTrue(TEXT("First point is packed"), PackedOut.bPacked);
+	TestEqual(TEXT("First point size"), PackedOut.Num(), NumTestBits);
+	TestEqual(TEXT("First point words"), PackedOut.PackedWords, Point[0].Get<FBinaryPoint>().PackedWords);
+
+	const FBinaryPoint& UnpackedOut = Deserialized[1].Get<FBinaryPoint>();
+	TestFalse(TEXT("Second point is unpacked"), UnpackedOut.bPacked);
+	TestEqual(TEXT("Second point values"), UnpackedOut.Values, UnpackedValues);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScholaPackedBinaryPointAddTest, "Schola.Points.PackedBinaryAdd", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FScholaPackedBinaryPointAddTest::RunTest(const FString& Parameters)
+{
+	// Adding to a packed point crosses into a new word on the 65th bit
+	FBinaryPoint Point;
+	Point.InitPacked(63);
+	Point.Add(false);
+	Point.Add(true);
+
+	TestTrue(TEXT("Point is still packed"), Point.bPacked);
+	TestEqual(TEXT("Num"), Point.Num(), 65);
+	TestEqual(TEXT("Number of words"), Point.PackedWords.Num(), 2);
+	TestFalse(TEXT("Bit 63"), Point[63]);
+	TestTrue(TEXT("Bit 64"), Point[64]);
+	TestEqual(TEXT("Set bits"), Point.CountSetBits(), 1);
+	TestTrue(TEXT("Clean padding"), Point.HasCleanPadding());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScholaPackedBinaryPointTruncatedTest, "Schola.Points.PackedBinaryTruncated", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FScholaPackedBinaryPointTruncatedTest::RunTest(const FString& Parameters)
+{
+	AddExpectedError(TEXT("Skipping a binary point"), EAutomationExpectedErrorFlags::Contains, 2);
+
+	TArray<bool> UnpackedValues = { true, false, true };
+	TPoint		 Point = TPoint(TInPlaceType<FBinaryPoint>(), UnpackedValues);
+
+	// Too few bytes for the number of bits, which would read past the end of the message
+	Schola::FundamentalPoint Msg;
+	Msg.mutable_binary_point()->set_packed_values(std::string(3, '\xff'));
+	Msg.mutable_binary_point()->set_num_packed_values(NumTestBits);
+	ProtobufDeserializer::Deserialize(Msg, Point);
+	TestFalse(TEXT("Truncated point is skipped"), Point.Get<FBinaryPoint>().bPacked);
+	TestEqual(TEXT("Values after a truncated point"), Point.Get<FBinaryPoint>().Values, UnpackedValues);
+
+	Msg.mutable_binary_point()->set_num_packed_values(-1);
+	ProtobufDeserializer::Deserialize(Msg, Point);
+	TestEqual(TEXT("Values after a negative count"), Point.Get<FBinaryPoint>().Values, UnpackedValues);
+	return true;
+}
+
+#endif
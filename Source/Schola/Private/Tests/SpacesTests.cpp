@@ -0,0 +1,303 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Common/Spaces.h"
+#include "Common/Points.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * @brief Make a space with one subspace of each type. Flattens to 3 box values, 3 + 2 one-hot discrete values and 4 binary values
+ * @return The space, with it's layout built
+ */
+static FDictSpace MakeMixedSpace()
+{
+	FDictSpace	   Space;
+	FBoxSpace	   Box;
+	FDiscreteSpace Discrete;
+	FBinarySpace   Binary = FBinarySpace(4);
+
+	Box.Add(-1.0f, 1.0f);
+	Box.Add(0.0f, 10.0f);
+	Box.Add(0.0f, 1.0f);
+	Discrete.Add(3);
+	Discrete.Add(2);
+
+	Space.Add(TEXT("Box"), Box);
+	Space.Add(TEXT("Discrete"), Discrete);
+	Space.Add(TEXT("Binary"), Binary);
+	Space.BuildLayout();
+	return Space;
+}
+
+/**
+ * @brief Make a point in the space from MakeMixedSpace
+ * @param[in] BoxValues The 3 box values
+ * @param[in] DiscreteValues The index chosen in each of the 2 branches
+ * @param[in] BinaryValues The 4 binary values
+ * @return The point
+ */
+static FDictPoint MakeMixedPoint(TArray<float> BoxValues, TArray<int> DiscreteValues, TArray<bool> BinaryValues)
+{
+	FDictPoint Point;
+	Point.Add().Emplace<FBoxPoint>(BoxValues.GetData(), BoxValues.Num());
+	Point.Add().Emplace<FDiscretePoint>(DiscreteValues);
+	Point.Add().Emplace<FBinaryPoint>(BinaryValues);
+	return Point;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScholaDictSpaceFlattenRoundTripTest, "Schola.Spaces.FlattenRoundTrip", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FScholaDictSpaceFlattenRoundTripTest::RunTest(const FString& Parameters)
+{
+	const FDictSpace Space = MakeMixedSpace();
+	const int		 RowSize = Space.GetFlattenedSize();
+	TestEqual(TEXT("Flattened size"), RowSize, 12);
+
+	TArray<FDictPoint> Points = {
+		MakeMixedPoint({ 0.5f, 7.0f, 0.25f }, { 2, 0 }, { true, false, false, true }),
+		MakeMixedPoint({ -1.0f, 0.0f, 1.0f }, { 0, 1 }, { false, true, true, false })
+	};
+
+	// Rows are written side by side into one [N, D] buffer, as they are for a batch of requests
+	TArray<float> Buffer;
+	Buffer.Init(-1.0f, Points.Num() * RowSize);
+	Space.FlattenBatch(Points, Buffer);
+
+	const TArray<float> ExpectedFirstRow = { 0.5f, 7.0f, 0.25f, 0, 0, 1, 1, 0, 1, 0, 0, 1 };
+	TestEqual(TEXT("First row"), TArray<float>(Buffer.GetData(), RowSize), ExpectedFirstRow);
+
+	TArray<FDictPoint>	Unflattened;
+	TArray<FDictPoint*> UnflattenedPtrs;
+	Unflattened.SetNum(Points.Num());
+	for (FDictPoint& Point : Unflattened)
+	{
+		UnflattenedPtrs.Add(&Point);
+	}
+	Space.UnflattenBatch(Buffer, UnflattenedPtrs);
+
+	for (int Row = 0; Row < Points.Num(); Row++)
+	{
+		TestEqual(FString::Printf(TEXT("Row %d box"), Row), Unflattened[Row][0].Get<FBoxPoint>().Values, Points[Row][0].Get<FBoxPoint>().Values);
+		TestEqual(FString::Printf(TEXT("Row %d discrete"), Row), Unflattened[Row][1].Get<FDiscretePoint>().Values, Points[Row][1].Get<FDiscretePoint>().Values);
+		TestEqual(FString::Printf(TEXT("Row %d binary"), Row), Unflattened[Row][2].Get<FBinaryPoint>().Values, Points[Row][2].Get<FBinaryPoint>().Values);
+	}
+
+	// The batch subsystem reads a row with any space laid out the same way
+	FDictSpace Relabelled = MakeMixedSpace();
+	Relabelled.Labels[0] = TEXT("Other");
+	Relabelled.BuildLayout();
+	TestTrue(TEXT("Relabelled space has the same layout"), Space.HasSameLayout(Relabelled));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScholaDictSpaceNormalizeAndClampBatchTest, "Schola.Spaces.NormalizeAndClampBatch", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FScholaDictSpaceNormalizeAndClampBatchTest::RunTest(const FString& Parameters)
+{
+	const FDictSpace Space = MakeMixedSpace();
+	const int		 RowSize = Space.GetFlattenedSize();
+
+	TArray<FDictPoint> Points = {
+		MakeMixedPoint({ 0.5f, 7.0f, 0.25f }, { 2, 0 }, { true, false, false, true }),
+		MakeMixedPoint({ -1.0f, 0.0f, 1.0f }, { 0, 1 }, { false, true, true, false })
+	};
+	TArray<float> Buffer;
+	Buffer.SetNumUninitialized(Points.Num() * RowSize);
+	Space.FlattenBatch(Points, Buffer);
+	const TArray<float> Flattened = Buffer;
+
+	// Only the box values of each row change
+	Space.NormalizeFlattenedBatch(Buffer.GetData(), Points.Num());
+	const float ExpectedNormalized[2][3] = { { 0.75f, 0.7f, 0.25f }, { 0.0f, 0.0f, 1.0f } };
+	for (int Row = 0; Row < Points.Num(); Row++)
+	{
+		for (int Dim = 0; Dim < 3; Dim++)
+		{
+			TestEqual(FString::Printf(TEXT("Row %d normalized box value %d"), Row, Dim), Buffer[Row * RowSize + Dim], ExpectedNormalized[Row][Dim]);
+		}
+		TestEqual(FString::Printf(TEXT("Row %d rest"), Row), TArray<float>(Buffer.GetData() + Row * RowSize + 3, RowSize - 3), TArray<float>(Flattened.GetData() + Row * RowSize + 3, RowSize - 3));
+	}
+
+	// Model outputs can be anywhere, so box values are pulled back into bounds
+	TArray<float> Actions = { -3.0f, 11.0f, 0.5f, 0.1f, 0.2f, 0.3f, 0.1f, 0.7f, 1.0f, 0.0f, 1.0f, 0.0f };
+	Space.ClampFlattenedBatch(Actions.GetData(), 1);
+	TestEqual(TEXT("Clamped actions"), Actions, TArray<float>({ -1.0f, 10.0f, 0.5f, 0.1f, 0.2f, 0.3f, 0.1f, 0.7f, 1.0f, 0.0f, 1.0f, 0.0f }));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScholaDictSpaceNormalizeZeroRangeTest, "Schola.Spaces.NormalizeZeroRange", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FScholaDictSpaceNormalizeZeroRangeTest::RunTest(const FString& Parameters)
+{
+	// The second dimension can only hold one value, so it normalizes to 0 instead of dividing by zero
+	FDictSpace Space;
+	FBoxSpace  Box;
+	Box.Add(-1.0f, 1.0f);
+	Box.Add(5.0f, 5.0f);
+	Space.Add(TEXT("Box"), Box);
+
+	const TArray<float> Values = { 0.5f, 5.0f };
+	FDictPoint			Unplanned;
+	Unplanned.Add().Emplace<FBoxPoint>(Values.GetData(), Values.Num());
+	Space.NormalizeObservation(Unplanned);
+	TestEqual(TEXT("Normalized without a layout"), Unplanned[0].Get<FBoxPoint>().Values, TArray<float>({ 0.75f, 0.0f }));
+
+	// The layout's kernels have to agree with the per dimension path
+	Space.BuildLayout();
+	FDictPoint Planned;
+	Planned.Add().Emplace<FBoxPoint>(Values.GetData(), Values.Num());
+	Space.NormalizeObservation(Planned);
+	TestEqual(TEXT("Normalized with a layout"), Planned[0].Get<FBoxPoint>().Values, TArray<float>({ 0.75f, 0.0f }));
+
+	TArray<float> Batch = { 0.5f, 5.0f, -1.0f, 5.0f };
+	Space.NormalizeFlattenedBatch(Batch.GetData(), 2);
+	TestEqual(TEXT("Normalized batch"), Batch, TArray<float>({ 0.75f, 0.0f, 0.0f, 0.0f }));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScholaDictSpaceUnflattenArgmaxTest, "Schola.Spaces.UnflattenArgmax", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FScholaDictSpaceUnflattenArgmaxTest::RunTest(const FString& Parameters)
+{
+	const FDictSpace Space = MakeMixedSpace();
+
+	// Model outputs aren't one-hot, so each branch takes the index of it's largest value
+	const TArray<float> Actions = { 0.1f, 0.2f, 0.3f, 0.1f, 0.7f, 0.2f, 0.9f, 0.3f, 1.0f, 0.0f, 1.0f, 0.0f };
+	FDictPoint			Unflattened;
+	Space.UnflattenInto(Actions.GetData(), Unflattened);
+
+	TestEqual(TEXT("Discrete branches"), Unflattened[1].Get<FDiscretePoint>().Values, TArray<int>({ 1, 0 }));
+	TestEqual(TEXT("Binary values"), Unflattened[2].Get<FBinaryPoint>().Values, TArray<bool>({ true, false, true, false }));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScholaDictSpaceFlattenPadsShortBoxTest, "Schola.Spaces.FlattenPadsShortBox", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FScholaDictSpaceFlattenPadsShortBoxTest::RunTest(const FString& Parameters)
+{
+	const FDictSpace Space = MakeMixedSpace();
+	const FDictPoint Point = MakeMixedPoint({ 0.5f }, { 0, 0 }, { false, false, false, false });
+
+	// A reused buffer still holds the previous row, which mustn't leak into the missing box values
+	TArray<float> Buffer;
+	Buffer.Init(9.0f, Space.GetFlattenedSize());
+	Space.FlattenInto(Buffer, Point);
+
+	TestEqual(TEXT("Given box value"), Buffer[0], 0.5f);
+	TestEqual(TEXT("Missing box values"), TArray<float>(Buffer.GetData() + 1, 2), TArray<float>({ 0.0f, 0.0f }));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScholaDictSpaceUnflattenPackedBinaryTest, "Schola.Spaces.UnflattenIntoPackedBinary", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FScholaDictSpaceUnflattenPackedBinaryTest::RunTest(const FString& Parameters)
+{
+	const FDictSpace Space = MakeMixedSpace();
+
+	// The point being reused last held a packed binary point, whose words would otherwise shadow the new values
+	FDictPoint Unflattened = MakeMixedPoint({ 0, 0, 0 }, { 0, 0 }, {});
+	FBinaryPoint& Packed = Unflattened[2].Get<FBinaryPoint>();
+	Packed.InitPacked(4);
+	Packed.SetBit(0, true);
+	Packed.SetBit(1, true);
+
+	const TArray<float> Actions = { 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1 };
+	Space.UnflattenInto(Actions.GetData(), Unflattened);
+
+	const FBinaryPoint& Binary = Unflattened[2].Get<FBinaryPoint>();
+	TestFalse(TEXT("Binary point is unpacked"), Binary.bPacked);
+	TestEqual(TEXT("Binary values"), Binary.Values, TArray<bool>({ false, false, true, true }));
+	TestTrue(TEXT("Indexed binary value"), Binary[3]);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScholaDictSpacePackDimensionsRoundTripTest, "Schola.Spaces.PackDimensionsRoundTrip", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FScholaDictSpacePackDimensionsRoundTripTest::RunTest(const FString& Parameters)
+{
+	const FDictSpace Space = MakeMixedSpace();
+	const int		 RowSize = Space.GetLayout()->TotalDimensions;
+	TestEqual(TEXT("Dense row size"), RowSize, 9);
+
+	// Observers can hand over packed binary points, which are written as 0s and 1s all the same
+	FDictPoint	  Point = MakeMixedPoint({ 0.5f, 7.0f, 0.25f }, { 2, 0 }, {});
+	FBinaryPoint& Binary = Point[2].Get<FBinaryPoint>();
+	Binary.InitPacked(4);
+	Binary.SetBit(0, true);
+	Binary.SetBit(3, true);
+
+	TArray<float> Row;
+	Row.SetNumUninitialized(RowSize);
+	Space.PackDimensions(Point, Row.GetData());
+	TestEqual(TEXT("Dense row"), Row, TArray<float>({ 0.5f, 7.0f, 0.25f, 2, 0, 1, 0, 0, 1 }));
+
+	FDictPoint Unpacked;
+	Space.UnpackDimensions(Row.GetData(), Unpacked);
+	TestEqual(TEXT("Box"), Unpacked[0].Get<FBoxPoint>().Values, Point[0].Get<FBoxPoint>().Values);
+	TestEqual(TEXT("Discrete"), Unpacked[1].Get<FDiscretePoint>().Values, Point[1].Get<FDiscretePoint>().Values);
+	TestEqual(TEXT("Binary"), Unpacked[2].Get<FBinaryPoint>().Values, TArray<bool>({ true, false, false, true }));
+
+	// Short points are padded with zeros instead of being read past their end
+	const FDictPoint Short = MakeMixedPoint({ 0.5f }, { 1 }, { true });
+	Row.Init(9.0f, RowSize);
+	Space.PackDimensions(Short, Row.GetData());
+	TestEqual(TEXT("Padded dense row"), Row, TArray<float>({ 0.5f, 0, 0, 1, 0, 1, 0, 0, 0 }));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScholaDictPointArenaTest, "Schola.Spaces.DictPointArena", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FScholaDictPointArenaTest::RunTest(const FString& Parameters)
+{
+	FDictSpace Space = MakeMixedSpace();
+	FDictPoint Point;
+	Space.InitializeEmptyDictPoint(Point);
+	TestEqual(TEXT("Arena size"), Point.GetBufferSize(), Space.GetFlattenedSize());
+
+	// Observers write box values straight into the arena
+	FBoxPoint& Box = Point[0].Get<FBoxPoint>();
+	Box.Reset();
+	Box.Add(0.5f);
+	Box.Add(7.0f);
+	Box.Add(0.25f);
+	TestTrue(TEXT("Box is a view into the arena"), Box.bBound && Box.GetData() == Point.GetView(0).GetData());
+	Point[1].Get<FDiscretePoint>().Values = { 2, 0 };
+	Point[2].Get<FBinaryPoint>().Values = { true, false, false, true };
+
+	Space.FlattenDictPoint(Point);
+	TestEqual(TEXT("Flattened arena"), *Point.Buffer, TArray<float>({ 0.5f, 7.0f, 0.25f, 0, 0, 1, 1, 0, 1, 0, 0, 1 }));
+
+	TArray<float>		  Unused;
+	FGenericTensorBinding Binding = Space.CreateTensorBinding(Unused, Point);
+	TestTrue(TEXT("Arena is bound without a copy"), Binding.Data == Point.Buffer->GetData());
+
+	// A request still reading the arena keeps it, and the point moves on to a copy
+	TSharedPtr<TArray<float>> Held = Point.Buffer;
+	Point.UnshareBuffer();
+	TestTrue(TEXT("Point has a new arena"), Point.Buffer != Held);
+	TestTrue(TEXT("Box follows the new arena"), Box.GetData() == Point.GetView(0).GetData());
+	Box.Reset();
+	Box.Add(-1.0f);
+	TestEqual(TEXT("Held arena is unchanged"), (*Held)[0], 0.5f);
+
+	FDictPoint Copy = Point;
+	const FBoxPoint& CopiedBox = Copy[0].Get<FBoxPoint>();
+	TestTrue(TEXT("Copy has it's own arena"), Copy.Buffer != Point.Buffer && CopiedBox.GetData() == Copy.GetView(0).GetData());
+	TestEqual(TEXT("Copied box value"), CopiedBox[0], -1.0f);
+
+	// Too many values to fit spills out of the arena, until the next reset
+	for (int i = 0; i < 3; i++)
+	{
+		Box.Add(0.0f);
+	}
+	TestFalse(TEXT("Box spilled"), Box.bBound);
+	TestEqual(TEXT("Spilled box size"), Box.Num(), 4);
+	TestEqual(TEXT("Spilled box keeps it's values"), Box[0], -1.0f);
+	TestTrue(TEXT("Spilled box fails validation"), Space.ValidateFromLayout(0, Point[0]) == ESpaceValidationResult::WrongDimensions);
+	Box.Reset();
+	TestTrue(TEXT("Box is bound again after a reset"), Box.bBound);
+	return true;
+}
+
+#endif
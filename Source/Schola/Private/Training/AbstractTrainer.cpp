@@ -4,7 +4,9 @@
 #include "Subsystem/ScholaManagerSubsystem.h"
 #include "Agent/AgentComponents/SensorComponent.h"
 #include "Observers/AbstractObservers.h"
+#include "Subsystem/ScholaRegistrySubsystem.h"
 #include "Subsystem/ScholaManagerSubsystem.h"
+#include "Environment/AbstractEnvironment.h"
 
 const FString AGENT_ACTION_ID = FString("__AGENT__");
 
@@ -24,6 +26,18 @@ bool AAbstractTrainer::Initialize(int EnvId, int AgentId)
 
 	UE_LOG(LogSchola, Log, TEXT("Agent is Controlling Pawn %s "), *this->GetPawn()->GetName());
 
+	// Agents that rejoin an environment are initialized again, so drop whatever was collected from the components of their last pawn
+	if (this->NumConfiguredObservers == INDEX_NONE)
+	{
+		this->NumConfiguredObservers = this->Observers.Num();
+		this->NumConfiguredActuators = this->Actuators.Num();
+	}
+	else
+	{
+		this->Observers.SetNum(this->NumConfiguredObservers);
+		this->Actuators.SetNum(this->NumConfiguredActuators);
+	}
+
 	// Collect all the observers and actuators
 	TArray<UActuatorComponent*> ActuatorsTemp;
 	this->GetPawn()->GetComponents(ActuatorsTemp);
@@ -77,14 +91,14 @@ bool AAbstractTrainer::Initialize(int EnvId, int AgentId)
 	return true;
 }
 
-FTrainerState AAbstractTrainer::Think()
+FTrainerState AAbstractTrainer::Think(bool bAccumulateReward)
 {
 
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR("Schola: Agent Thinking");
 	// Always test if we are done.
 	State.TrainingStatus = this->ComputeStatus();
 	// Set the reward.
-	State.Reward = this->ComputeReward();
+	State.Reward = (bAccumulateReward ? State.Reward : 0.0f) + this->ComputeReward();
 	//Update the info field
 	this->State.Info.Reset();
 	this->GetInfo(this->State.Info);
@@ -171,4 +185,35 @@ bool AAbstractTrainer::IsDecisionStep(int StepToCheck)
 bool AAbstractTrainer::IsDecisionStep()
 {
 	return this->IsDecisionStep(this->Step);
-}
\ No newline at end of file
+}
+
+void AAbstractTrainer::BeginPlay()
+{
+	Super::BeginPlay();
+	if (UScholaRegistrySubsystem* Registry = UScholaRegistrySubsystem::Get(this))
+	{
+		Registry->RegisterTrainer(this);
+	}
+}
+
+void AAbstractTrainer::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (this->Environment != nullptr)
+	{
+		this->Environment->DeregisterAgent(this);
+	}
+	if (UScholaRegistrySubsystem* Registry = UScholaRegistrySubsystem::Get(this))
+	{
+		Registry->DeregisterTrainer(this);
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+void AAbstractTrainer::OnUnPossess()
+{
+	if (this->Environment != nullptr)
+	{
+		this->Environment->DeregisterAgent(this);
+	}
+	Super::OnUnPossess();
+}
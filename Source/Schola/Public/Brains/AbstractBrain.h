@@ -46,6 +46,10 @@ public:
 	UPROPERTY(EditAnywhere, meta = (EditCondition = "bAbstractSettingsVisibility", EditConditionHides, HideEditConditionToggle), Category = "Brain Settings")
 	int DecisionRequestFrequency = 5;
 
+	/** Offsets which steps are decision steps, so that agents with the same frequency can decide on different steps. Assigned by the subsystem */
+	UPROPERTY(VisibleAnywhere, Category = "Brain Settings")
+	int DecisionPhase = 0;
+
 	/** Toggle for whether the user can see the settings for this class. Use to hide in subclass if they aren't relevant */
 	UPROPERTY()
 	bool bAbstractSettingsVisibility = true;
@@ -57,7 +61,7 @@ public:
 	/**
 	 * @brief Increment the current agent step
 	 */
-	void IncrementStep();
+	virtual void IncrementStep();
 
 	/**
 	 * @brief Set the current agent step
@@ -70,6 +74,18 @@ public:
 	 */
 	void ResetStep();
 
+	/**
+	 * @brief Set the offset of this brain's decision steps
+	 * @param[in] NewPhase The number of steps to offset decision steps by. Wrapped to the decision frequency
+	 */
+	void SetDecisionPhase(int NewPhase);
+
+	/**
+	 * @brief Push the current decision back by one step, keeping the same decision frequency after it
+	 * @note Used by the subsystem when an agent doesn't fit in the frame's decision budget
+	 */
+	void DeferDecision();
+
 	/**
 	 * @brief Check if this brain is active (e.g. Not closed or errored out)
 	 * @return true iff this brain is functional (e.g. Not closed or errored out)
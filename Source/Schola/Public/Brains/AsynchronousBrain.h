@@ -0,0 +1,85 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Brains/AbstractBrain.h"
+#include "Common/LogSchola.h"
+#include "CoreMinimal.h"
+#include "AsynchronousBrain.generated.h"
+
+/**
+ * @brief A brain that never waits on it's policy. Each action step it takes the latest decision if one has arrived, and otherwise keeps acting on the last one it got.
+ * How out of date the current action is, is tracked as it's staleness: the number of steps since the observations it was decided from were gathered.
+ * @note A new decision is only requested once the previous one has arrived, so a slow policy lowers the decision rate instead of building up a queue.
+ */
+UCLASS(Blueprintable)
+class SCHOLA_API UAsynchronousBrain : public UAbstractBrain
+{
+	GENERATED_BODY()
+
+private:
+	/** The latest decision that has arrived */
+	FPolicyDecision* Decision = nullptr;
+
+	/** The decision currently being made by the policy */
+	TFuture<FPolicyDecision*> InProgressActionRequest = TFuture<FPolicyDecision*>();
+	bool					  bHasInProgressAction = false;
+
+	/** The number of steps taken since the brain was created. Unlike the agent's step it isn't reset with the agent, and counts every step simulated in a frame */
+	uint64 NumSteps = 0;
+
+	/** The step the in progress decision's observations were gathered on */
+	uint64 InProgressRequestStep = 0;
+
+	/** The step the current decision's observations were gathered on */
+	uint64 DecisionRequestStep = 0;
+
+	/** The number of action steps that have contributed to AverageStaleness */
+	int NumStalenessSamples = 0;
+
+	/**
+	 * @brief Record the staleness of the action about to be taken
+	 */
+	void UpdateStalenessStats();
+
+public:
+	/** Give up, erroring out the agent, if the current action gets more than MaxStaleness steps old while waiting on a new decision */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = "1", EditCondition = "bUseMaxStaleness"), Category = "Brain Settings")
+	int MaxStaleness = 300;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (InlineEditConditionToggle), Category = "Brain Settings")
+	bool bUseMaxStaleness = true;
+
+	/** The staleness of the action taken on the last action step. 0 if the decision arrived in time for the step after it was requested */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Brain Stats")
+	int CurrentStaleness = 0;
+
+	/** The highest staleness of any action taken since the stats were last reset */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Brain Stats")
+	int MaxObservedStaleness = 0;
+
+	/** The mean staleness of the actions taken since the stats were last reset */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Brain Stats")
+	float AverageStaleness = 0.0f;
+
+	/** The number of action steps where a new decision was still in progress, so an older action was taken instead */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Brain Stats")
+	int NumStaleActions = 0;
+
+	UAsynchronousBrain();
+	~UAsynchronousBrain();
+
+	/**
+	 * @brief Clear the staleness stats
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Brain Stats")
+	void ResetStalenessStats();
+
+	void	 BeginDestroy() override;
+	void	 IncrementStep() override;
+	bool	 RequestDecision(const FDictPoint& Observations) override;
+	void	 Reset() override;
+	FAction* GetAction() override;
+	bool	 HasAction() override;
+	void	 ResolveDecision() override;
+};
@@ -0,0 +1,95 @@
+// Copyright (c) 2024 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Vectorized kernels for operating on box(continuous) points, over structure of arrays bounds (e.g. those packed in an FDictSpaceLayout).
+ * @details Built on Unreal's VectorRegister abstraction, so they compile to SSE or NEON depending on the platform, with a scalar fallback
+ * where neither is available. The batched versions operate on a row-major [NumRows, Num] block, where consecutive rows are RowStride floats apart.
+ */
+namespace BoxKernels
+{
+	/**
+	 * @brief Normalize values in place to be in the range [0, 1]. Computes (Value - Low) * Scale
+	 * @param[in,out] Values The values to normalize
+	 * @param[in] Low The lower bound of each dimension
+	 * @param[in] Scale The inverse range (1 / (High - Low)) of each dimension
+	 * @param[in] Num The number of dimensions
+	 */
+	SCHOLA_API void Normalize(float* Values, const float* Low, const float* Scale, int Num);
+
+	/**
+	 * @brief Rescale normalized values in place to be within the bounds. Computes Value * (High - Low) + Low
+	 * @param[in,out] Values The values to rescale
+	 * @param[in] Low The lower bound of each dimension
+	 * @param[in] High The upper bound of each dimension
+	 * @param[in] Num The number of dimensions
+	 */
+	SCHOLA_API void Rescale(float* Values, const float* Low, const float* High, int Num);
+
+	/**
+	 * @brief Clamp values in place to be within the bounds
+	 * @param[in,out] Values The values to clamp
+	 * @param[in] Low The lower bound of each dimension
+	 * @param[in] High The upper bound of each dimension
+	 * @param[in] Num The number of dimensions
+	 */
+	SCHOLA_API void Clamp(float* Values, const float* Low, const float* High, int Num);
+
+	/**
+	 * @brief Check if all values are within the bounds
+	 * @param[in] Values The values to check
+	 * @param[in] Low The lower bound of each dimension
+	 * @param[in] High The upper bound of each dimension
+	 * @param[in] Num The number of dimensions
+	 * @return True if every value is in [Low, High], false otherwise
+	 */
+	SCHOLA_API bool AllInBounds(const float* Values, const float* Low, const float* High, int Num);
+
+	/**
+	 * @brief Normalize a batch of rows in place, sharing one set of bounds
+	 * @param[in,out] Values The first value of the first row
+	 * @param[in] NumRows The number of rows (e.g. agents) in the batch
+	 * @param[in] RowStride The distance in floats between the start of consecutive rows
+	 * @param[in] Low The lower bound of each dimension
+	 * @param[in] Scale The inverse range of each dimension
+	 * @param[in] Num The number of dimensions in each row
+	 */
+	SCHOLA_API void NormalizeBatch(float* Values, int NumRows, int RowStride, const float* Low, const float* Scale, int Num);
+
+	/**
+	 * @brief Rescale a batch of rows in place, sharing one set of bounds
+	 * @param[in,out] Values The first value of the first row
+	 * @param[in] NumRows The number of rows (e.g. agents) in the batch
+	 * @param[in] RowStride The distance in floats between the start of consecutive rows
+	 * @param[in] Low The lower bound of each dimension
+	 * @param[in] High The upper bound of each dimension
+	 * @param[in] Num The number of dimensions in each row
+	 */
+	SCHOLA_API void RescaleBatch(float* Values, int NumRows, int RowStride, const float* Low, const float* High, int Num);
+
+	/**
+	 * @brief Clamp a batch of rows in place, sharing one set of bounds
+	 * @param[in,out] Values The first value of the first row
+	 * @param[in] NumRows The number of rows (e.g. agents) in the batch
+	 * @param[in] RowStride The distance in floats between the start of consecutive rows
+	 * @param[in] Low The lower bound of each dimension
+	 * @param[in] High The upper bound of each dimension
+	 * @param[in] Num The number of dimensions in each row
+	 */
+	SCHOLA_API void ClampBatch(float* Values, int NumRows, int RowStride, const float* Low, const float* High, int Num);
+
+	/**
+	 * @brief Check if every row in a batch is within the bounds
+	 * @param[in] Values The first value of the first row
+	 * @param[in] NumRows The number of rows (e.g. agents) in the batch
+	 * @param[in] RowStride The distance in floats between the start of consecutive rows
+	 * @param[in] Low The lower bound of each dimension
+	 * @param[in] High The upper bound of each dimension
+	 * @param[in] Num The number of dimensions in each row
+	 * @return True if every value of every row is in [Low, High], false otherwise
+	 */
+	SCHOLA_API bool AllInBoundsBatch(const float* Values, int NumRows, int RowStride, const float* Low, const float* High, int Num);
+} // namespace BoxKernels
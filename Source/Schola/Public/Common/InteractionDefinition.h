@@ -40,6 +40,15 @@ struct SCHOLA_API FInteractionDefinition
 
 	}
 
+	/**
+	 * @brief Precompute the layouts of the observation and action spaces. Call once both spaces are fully populated
+	 */
+	void Finalize()
+	{
+		ObsSpaceDefn.BuildLayout();
+		ActionSpaceDefn.BuildLayout();
+	}
+
 };
 
 
@@ -93,7 +93,8 @@ public:
 
 	/**
 	 * @brief Collect Observations from the observers
+	 * @param[in] bNormalize Should the observations be normalized, if the interaction definition asks for it. Policies that normalize observations themselves turn this off
 	 * @return The aggregated observations as DictPoint
 	 */
-	FDictPoint& AggregateObservations();
+	FDictPoint& AggregateObservations(bool bNormalize = true);
 };
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "Common/CommonInterfaces.h"
 #include "Containers/Array.h"
+#include "Containers/ArrayView.h"
 #include "Containers/SortedMap.h"
 #include "NNE.h"
 #include "NNERuntimeCPU.h"
@@ -61,16 +62,26 @@ public:
 
 /**
  * @brief A point in a box(continuous) space. Conceptually a floating point vector
+ * @note A point can be bound to external storage, usually a slice of it's FDictPoint's arena. While bound, the values live in that storage rather than in Values
  */
 USTRUCT(BlueprintType)
 struct SCHOLA_API FBoxPoint : public FPoint
 {
 	GENERATED_BODY()
 
-	/** the values of this point */
+	/** the values of this point, when it isn't bound. Values written here while bound are moved into the storage by MoveValuesToStorage */
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere)
 	TArray<float> Values;
 
+	/** The storage this point is bound to. Empty if the point has never been bound */
+	TArrayView<float> Storage;
+
+	/** The number of values written to Storage */
+	int NumStored = 0;
+
+	/** Is this point reading and writing Storage instead of Values */
+	bool bBound = false;
+
 	/**
 	 * @brief Construct an empty BoxPoint
 	 */
@@ -89,6 +100,28 @@ struct SCHOLA_API FBoxPoint : public FPoint
 	{
 	}
 
+	/**
+	 * @brief Copy a BoxPoint. The copy always owns it's values, since the storage belongs to whoever bound the original
+	 * @param[in] Other The point to copy
+	 */
+	FBoxPoint(const FBoxPoint& Other)
+		: Values(Other.GetData(), Other.Num())
+	{
+	}
+
+	/**
+	 * @brief Move a BoxPoint. Like a copy, the new point owns it's values
+	 * @param[in] Other The point to move
+	 */
+	FBoxPoint(FBoxPoint&& Other)
+	{
+		*this = MoveTemp(Other);
+	}
+
+	FBoxPoint& operator=(const FBoxPoint& Other);
+
+	FBoxPoint& operator=(FBoxPoint&& Other);
+
 	/**
 	 * @brief Get the value of the BoxPoint at the given index or dimension
 	 * @param Index The dimension to get the value at
@@ -96,7 +129,8 @@ struct SCHOLA_API FBoxPoint : public FPoint
 	 */
 	float operator[](int Index) const
 	{
-		return this->Values[Index];
+		checkSlow(Index >= 0 && Index < this->Num());
+		return this->GetData()[Index];
 	}
 
 	virtual ~FBoxPoint()
@@ -104,26 +138,91 @@ struct SCHOLA_API FBoxPoint : public FPoint
 
 	}
 
+	/**
+	 * @brief Get the number of dimensions in this point, regardless of where the values are stored
+	 * @return The number of dimensions
+	 */
+	int Num() const
+	{
+		return this->bBound ? this->NumStored : this->Values.Num();
+	}
+
+	/**
+	 * @brief Get a ptr to the values of this point, regardless of where they are stored
+	 * @return A ptr to the first of Num() contiguous values
+	 */
+	float* GetData()
+	{
+		return this->bBound ? this->Storage.GetData() : this->Values.GetData();
+	}
+
+	/**
+	 * @brief Get a ptr to the values of this point, regardless of where they are stored
+	 * @return A const ptr to the first of Num() contiguous values
+	 */
+	const float* GetData() const
+	{
+		return this->bBound ? this->Storage.GetData() : this->Values.GetData();
+	}
+
 	/**
 	 * @brief Add a value to the BoxPoint. Adds a new dimension to the point
 	 * @param[in] Value The value to add
+	 * @note A bound point that runs out of storage moves all of it's values into Values, and stays unbound until it's next Reset
 	 */
 	void Add(float Value)
 	{
+		if (this->bBound)
+		{
+			if (this->NumStored < this->Storage.Num())
+			{
+				this->Storage[this->NumStored++] = Value;
+				return;
+			}
+			this->Unbind();
+		}
 		this->Values.Add(Value);
 	}
+
+	/**
+	 * @brief Add several values to the BoxPoint
+	 * @param[in] Data The values to add
+	 * @param[in] Count The number of values to add
+	 */
+	void Append(const float* Data, int Count);
+
+	/**
+	 * @brief Bind this point to external storage, moving any values it holds into it
+	 * @param[in] InStorage The storage to bind to. Must outlive the point, or be rebound before it's freed
+	 * @note If the point holds more values than fit, it stays unbound until it's next Reset
+	 */
+	void Bind(TArrayView<float> InStorage);
+
+	/**
+	 * @brief Move values written straight into Values, e.g. by a blueprint, into the storage of a bound point
+	 */
+	void MoveValuesToStorage();
+
 	/** 
 	 * @brief Reset the values of the BoxPoint. Clears the current values
-	 * @note This is doesn't reset the size of the array so subsequent calls to Add will not reallocate memory
+	 * @note This is doesn't reset the size of the array so subsequent calls to Add will not reallocate memory. A point with storage is bound to it again
 	 */
 	void Reset() override
 	{
 		this->Values.Reset(this->Values.Num());
+		this->NumStored = 0;
+		this->bBound = this->Storage.Num() > 0;
 	};
 
 	void Accept(PointVisitor& Visitor) override;
 
 	void Accept(ConstPointVisitor& Visitor) const override;
+
+private:
+	/**
+	 * @brief Copy the stored values into Values, and stop using the storage
+	 */
+	void Unbind();
 };
 
 USTRUCT(BlueprintType)
@@ -133,6 +232,16 @@ struct SCHOLA_API FBinaryPoint : public FPoint
 	/** the values of this point */
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere)
 	TArray<bool> Values;
+
+	/** Bit-packed storage, used instead of Values when the point is packed. Bit i is stored in PackedWords[i / 64] at position i % 64 */
+	TArray<uint64> PackedWords;
+
+	/** The number of bits held in PackedWords */
+	int NumPackedBits = 0;
+
+	/** Is this point using the bit-packed representation */
+	bool bPacked = false;
+
 	/**
 	 * @brief Construct an empty BinaryPoint
 	 */
@@ -141,6 +250,14 @@ struct SCHOLA_API FBinaryPoint : public FPoint
 
 	}
 
+	/**
+	 * @brief Construct a bit-packed BinaryPoint from raw bytes
+	 * @param[in] Bytes The packed bits, with bit i stored in byte i / 8 at position i % 8
+	 * @param[in] NumBytes The number of bytes readable from Bytes. Must be at least (NumBits + 7) / 8
+	 * @param[in] NumBits The number of bits in the point. Must not be negative
+	 */
+	FBinaryPoint(const uint8* Bytes, int64 NumBytes, int NumBits);
+
 	/**
 	 * @brief Construct a BinaryPoint from a TArray of bools
 	 * @param[in] InitialValues An Array of Bools to initialize the BinaryPoint with
@@ -171,24 +288,88 @@ struct SCHOLA_API FBinaryPoint : public FPoint
 	 */
 	bool operator[](int Index) const
 	{
+		if (this->bPacked)
+		{
+			return (this->PackedWords[Index >> 6] >> (Index & 63)) & 1;
+		}
 		return this->Values[Index];
 	}
 
+	/**
+	 * @brief Get the number of dimensions in this point, regardless of representation
+	 * @return The number of dimensions
+	 */
+	int Num() const
+	{
+		return this->bPacked ? this->NumPackedBits : this->Values.Num();
+	}
+
 	/**
 	 * @brief Add a value to the BinaryPoint. Adds a new dimension to the point
 	 * @param[in] Value The value to add
+	 * @note Packed points gain a bit, and a word whenever the last one is full
 	 */
 	void Add(bool Value)
 	{
+		if (this->bPacked)
+		{
+			if ((this->NumPackedBits & 63) == 0)
+			{
+				this->PackedWords.Add(0);
+			}
+			this->SetBit(this->NumPackedBits++, Value);
+			return;
+		}
 		this->Values.Add(Value);
 	}
 
+	/**
+	 * @brief Switch this point to the bit-packed representation, with all bits cleared
+	 * @param[in] NumBits The number of bits the point holds
+	 */
+	void InitPacked(int NumBits);
+
+	/**
+	 * @brief Set a bit in a packed point
+	 * @param[in] Index The dimension to set
+	 * @param[in] Value The value to set it to
+	 */
+	void SetBit(int Index, bool Value)
+	{
+		const uint64 Mask = uint64(1) << (Index & 63);
+		uint64&		 Word = this->PackedWords[Index >> 6];
+		Word = Value ? (Word | Mask) : (Word & ~Mask);
+	}
+
+	/**
+	 * @brief Count the number of bits set in the point
+	 * @return The number of true values
+	 */
+	int CountSetBits() const;
+
+	/**
+	 * @brief Check that no bits past NumPackedBits are set in a packed point
+	 * @return True if the unused bits of the last word are all clear
+	 */
+	bool HasCleanPadding() const;
+
+	/**
+	 * @brief Write the point into a float buffer as 0s and 1s. Packed points are converted a word at a time
+	 * @param[out] Out The buffer to write into. Must hold at least Num() values
+	 */
+	void FlattenTo(float* Out) const;
+
 	/**
 	 * @brief Reset the values of the BinaryPoint. Clears the current values
-	 * @note This is doesn't reset the size of the array so subsequent calls to Add will not reallocate memory
+	 * @note This is doesn't reset the size of the array so subsequent calls to Add will not reallocate memory. Packed points keep their size and have all bits cleared.
 	 */
 	void Reset() override
 	{
+		if (this->bPacked)
+		{
+			FMemory::Memzero(this->PackedWords.GetData(), this->PackedWords.Num() * sizeof(uint64));
+			return;
+		}
 		this->Values.Reset(Values.Num());
 	}
 	
@@ -253,6 +434,15 @@ struct SCHOLA_API FDiscretePoint : public FPoint
 		return this->Values[Index];
 	}
 
+	/**
+	 * @brief Get the number of branches in this point
+	 * @return The number of branches
+	 */
+	int Num() const
+	{
+		return this->Values.Num();
+	}
+
 	/** 
 	 * @brief Reset the values of the DiscretePoint. Clears the current values
 	 * @note This is doesn't reset the size of the array so subsequent calls to Add will not reallocate memory
@@ -286,8 +476,18 @@ struct FDictPoint
 	/** The points in the dictionary */
 	TArray<TPoint> Points;
 
+	/** One contiguous arena holding the whole point, flattened. Box points are bound to their slice of it, and the other points are written into it by FDictSpace::FlattenDictPoint. Shared so an inference request can keep reading it after the point moves on */
+	TSharedPtr<TArray<float>> Buffer;
+
+	/** The offset of each point's slice of the Buffer */
+	TArray<int> Offsets;
+
+	/** The size of each point's slice of the Buffer */
+	TArray<int> Sizes;
+
 	/**
 	 * @brief Reset all the points in the dictionary
+	 * @note Points backed by the Buffer are reset in place, so they stay bound to it
 	 */
 	void Reset();
 
@@ -300,6 +500,75 @@ struct FDictPoint
 
 	}
 
+	/**
+	 * @brief Copy a dictionary of points, giving the copy it's own Buffer and binding the copied box points to it
+	 * @param[in] Other The point to copy
+	 */
+	FDictPoint(const FDictPoint& Other)
+	{
+		*this = Other;
+	}
+
+	FDictPoint(FDictPoint&& Other) = default;
+
+	FDictPoint& operator=(const FDictPoint& Other);
+
+	FDictPoint& operator=(FDictPoint&& Other) = default;
+
+	/**
+	 * @brief Allocate the Buffer, with a contiguous slice for each point
+	 * @param[in] InSizes The flattened size of each point
+	 */
+	void InitializeBuffer(const TArray<int>& InSizes);
+
+	/**
+	 * @brief Bind every box point to it's slice of the Buffer
+	 */
+	void BindPoints();
+
+	/**
+	 * @brief Give this point a Buffer of it's own, if anything else still holds the current one. Should be called before writing to the points
+	 */
+	void UnshareBuffer();
+
+	/**
+	 * @brief Does this point have a Buffer laid out by InitializeBuffer
+	 * @return True if the Buffer has been allocated
+	 */
+	bool HasBuffer() const
+	{
+		return this->Buffer.IsValid();
+	}
+
+	/**
+	 * @brief Get the number of values in the Buffer
+	 * @return The size of the Buffer, or 0 if there isn't one
+	 */
+	int GetBufferSize() const
+	{
+		return this->Buffer.IsValid() ? this->Buffer->Num() : 0;
+	}
+
+	/**
+	 * @brief Get the slice of the Buffer belonging to a point
+	 * @param[in] Index The index of the point
+	 * @return A view of the point's slice
+	 */
+	TArrayView<float> GetView(int Index)
+	{
+		return MakeArrayView(this->Buffer->GetData() + this->Offsets[Index], this->Sizes[Index]);
+	}
+
+	/**
+	 * @brief Get the slice of the Buffer belonging to a point, in a const context
+	 * @param[in] Index The index of the point
+	 * @return A const view of the point's slice
+	 */
+	TArrayView<const float> GetView(int Index) const
+	{
+		return MakeArrayView(this->Buffer->GetData() + this->Offsets[Index], this->Sizes[Index]);
+	}
+
 	/**
 	 * @brief Add a point to the dictionary, by emplacing it, and returning it to the caller for initialization
 	 * @return a reference to the newly added point
@@ -346,7 +615,7 @@ struct FDictPoint
 
 	void Accept(ConstPointVisitor& Visitor) const
 	{
-		for (TPoint Point : this->Points)
+		for (const TPoint& Point : this->Points)
 		{
 			Visit([&Visitor](const auto& PointArg) { PointArg.Accept(Visitor); }, Point);
 		}
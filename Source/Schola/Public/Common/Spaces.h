@@ -156,7 +156,7 @@ struct SCHOLA_API FBoxSpaceDimension
 	/**
 	 * @brief Normalize a value from this space to be in the range [0, 1]
 	 * @param[in] Value The value to normalize
-	 * @return The normalized value
+	 * @return The normalized value. 0 if High == Low, since the dimension can only hold one value
 	 */
 	float NormalizeValue(float Value) const;
 };
@@ -384,6 +384,14 @@ public:
 	 */
 	int GetMaxValue(const TArray<float>& Vector) const;
 
+	/**
+	 * @brief Get the index of the maximum value in a raw buffer, without copying it. Ties resolve to the lowest index
+	 * @param[in] Values A ptr to the first value
+	 * @param[in] Num The number of values to search
+	 * @return The index of the maximum value, or 0 if Num is 0
+	 */
+	static int GetMaxIndex(const float* Values, int Num);
+
 	// FSpace API
 
 	void FillProtobuf(FundamentalSpace* Msg) const override;
@@ -418,6 +426,50 @@ enum class ESpaceType
 };
 
 
+/**
+ * @brief An immutable, precomputed description of how the subspaces of a DictSpace are laid out.
+ * @details Built once by FDictSpace::BuildLayout and shared between copies of the space. Per dimension data (bounds, branch sizes) is packed
+ * into contiguous arrays indexed through DimensionOffsets, so per step work doesn't need to visit or copy each subspace.
+ */
+struct SCHOLA_API FDictSpaceLayout
+{
+	/** The type of each subspace */
+	TArray<ESpaceType> Types;
+
+	/** The offset of each subspace into the flattened representation */
+	TArray<int> Offsets;
+
+	/** The flattened size of each subspace */
+	TArray<int> Sizes;
+
+	/** The number of dimensions of each subspace */
+	TArray<int> NumDimensions;
+
+	/** The offset of each subspace into the packed per dimension arrays below */
+	TArray<int> DimensionOffsets;
+
+	/** The lower bound of every dimension. 0 for discrete and binary dimensions */
+	TArray<float> Low;
+
+	/** The upper bound of every dimension. The branch size for discrete dimensions and 1 for binary dimensions */
+	TArray<float> High;
+
+	/** 1 / (High - Low) for every box dimension, used to normalize without a divide, or 0 where High == Low. 1 for discrete and binary dimensions */
+	TArray<float> Scale;
+
+	/** The number of values in every discrete branch. 0 for box and binary dimensions */
+	TArray<int> BranchSizes;
+
+	/** Lookup from a label to the index of it's subspace */
+	TMap<FString, int> LabelIndex;
+
+	/** The total size of the flattened representation */
+	int FlattenedSize = 0;
+
+	/** The total number of dimensions across all subspaces */
+	int TotalDimensions = 0;
+};
+
 /**
  * @brief A struct representing a dictionary of possible observations or actions.
  */
@@ -432,6 +484,9 @@ struct SCHOLA_API FDictSpace
 	/** The spaces in this dictionary */
 	TArray<TSpace>	Spaces;
 
+	/** The precomputed layout of this space. Unset until BuildLayout is called, and cleared whenever a space is added */
+	TSharedPtr<const FDictSpaceLayout> Layout;
+
 	/**
 	 * @brief Construct an empty DictSpace
 	 */
@@ -450,6 +505,20 @@ struct SCHOLA_API FDictSpace
 	 */
 	int						   GetFlattenedSize() const;
 
+	/**
+	 * @brief Precompute the layout of this space. Should be called once all subspaces have been added
+	 */
+	void					   BuildLayout();
+
+	/**
+	 * @brief Get the precomputed layout of this space
+	 * @return A ptr to the layout, or nullptr if BuildLayout has not been called since the space was last modified
+	 */
+	const FDictSpaceLayout*	   GetLayout() const
+	{
+		return this->Layout.Get();
+	}
+
 	//Methods for working with Points in the Space
 	/** 
 	 * @brief Validate a point in this space, by checking if all of it's dimensions pass validation
@@ -461,8 +530,25 @@ struct SCHOLA_API FDictSpace
 	/**
 	 * @brief Normalize an observation in this space, by normalizing each of it's dimensions
 	 * @param[in,out] Observations The observation to normalize
+	 * @note Box dimensions with High == Low normalize to 0, rather than the NaN or infinity a divide by their range would give
 	 */
 	void					   NormalizeObservation(FDictPoint& Observations) const;
+
+	/**
+	 * @brief Normalize the continuous entries of a batch of already flattened observations in place
+	 * @param[in,out] Batch A row-major [NumRows, GetFlattenedSize()] buffer of flattened observations
+	 * @param[in] NumRows The number of observations in the batch
+	 * @note Requires BuildLayout to have been called, otherwise does nothing
+	 */
+	void					   NormalizeFlattenedBatch(float* Batch, int NumRows) const;
+
+	/**
+	 * @brief Clamp the continuous entries of a batch of already flattened points in place, so they are within the bounds of this space
+	 * @param[in,out] Batch A row-major [NumRows, GetFlattenedSize()] buffer of flattened points
+	 * @param[in] NumRows The number of points in the batch
+	 * @note Requires BuildLayout to have been called, otherwise does nothing
+	 */
+	void					   ClampFlattenedBatch(float* Batch, int NumRows) const;
 	void					   Reset();
 	
 	// Methods for adding things to the Space. Note that items are added in order here
@@ -517,11 +603,45 @@ struct SCHOLA_API FDictSpace
 	 */
 	void	   FillProtobuf(DictSpace* Msg) const;
 	/**
-	 * @brief Configure an empty DictPoint with the correct entries corresponding to this space
+	 * @brief Configure an empty DictPoint with the correct entries corresponding to this space, backed by a single arena laid out like the flattened point
 	 * @param[in,out] EmptyPoint The point to initialize
+	 * @note Box entries are bound to their slice of the arena, so observers write straight into it
 	 */ 
 	void InitializeEmptyDictPoint(FDictPoint& EmptyPoint);
 
+	/**
+	 * @brief Complete the arena of a point from InitializeEmptyDictPoint, so it holds the flattened point
+	 * @param[in,out] Point The point to flatten
+	 * @note Bound box entries are already in place, so only discrete and binary entries, and box entries that outgrew their slice, are written
+	 */
+	void FlattenDictPoint(FDictPoint& Point) const;
+
+	/**
+	 * @brief Write every entry of a DictPoint into an external buffer
+	 * @param[in,out] Buffer The buffer to flatten into. Must hold at least GetFlattenedSize() values
+	 * @param[in] Point The point to flatten
+	 * @note A point with an arena of the right size is copied with a single memcpy, so FlattenDictPoint must have been called since it was last changed
+	 */
+	void FlattenInto(TArrayView<float> Buffer, const FDictPoint& Point) const;
+
+	/**
+	 * @brief Write a single entry of a DictPoint into it's flattened segment, using the precomputed layout
+	 * @param[in] Index The index of the subspace the entry belongs to
+	 * @param[in] Point The entry to write
+	 * @param[out] Out The start of the entry's segment
+	 * @note Requires BuildLayout to have been called
+	 */
+	void FlattenEntryInto(int Index, const TPoint& Point, float* Out) const;
+
+	/**
+	 * @brief Validate a single entry of a DictPoint using the precomputed layout
+	 * @param[in] Index The index of the subspace to validate against
+	 * @param[in] Point The point to validate
+	 * @return An enum indicating the result of the validation
+	 * @note Requires BuildLayout to have been called
+	 */
+	ESpaceValidationResult ValidateFromLayout(int Index, const TPoint& Point) const;
+
 	/**
 	 * @brief Create an empty DictPoint from a flattened point
 	 * @param[in] FlattenedPoint The flattened point buffer to unflatten
@@ -529,6 +649,53 @@ struct SCHOLA_API FDictSpace
 	 */
 	FDictPoint				   UnflattenPoint(TArray<float>& FlattenedPoint);
 
+	/**
+	 * @brief Unflatten a point into an existing DictPoint, reusing the storage of it's entries
+	 * @param[in] FlattenedPoint A ptr to the start of the flattened point
+	 * @param[in,out] OutPoint The point to write into
+	 * @note Requires BuildLayout to have been called
+	 */
+	void UnflattenInto(const float* FlattenedPoint, FDictPoint& OutPoint) const;
+
+	/**
+	 * @brief Flatten a batch of points from this space into a row-major [N, D] buffer, where D is GetFlattenedSize()
+	 * @param[in] Points The N points to flatten
+	 * @param[out] OutBatch The buffer to write into. Must hold at least N * D values
+	 */
+	void FlattenBatch(TArrayView<const FDictPoint> Points, TArrayView<float> OutBatch) const;
+
+	/**
+	 * @brief Unflatten a row-major [N, D] buffer into N existing points, in a single pass with no per element allocations
+	 * @param[in] Batch The flattened batch, e.g. the output tensor of a batched model
+	 * @param[in,out] OutPoints The N points to write into
+	 * @note Requires BuildLayout to have been called
+	 */
+	void UnflattenBatch(TArrayView<const float> Batch, TArrayView<FDictPoint* const> OutPoints) const;
+
+	/**
+	 * @brief Check if another space lays out it's flattened points the same way, so a batch flattened with one can be read with the other
+	 * @param[in] Other The space to compare with
+	 * @return True if both spaces have the same subspace types, sizes and branch sizes
+	 * @note Requires BuildLayout to have been called on both spaces
+	 */
+	bool HasSameLayout(const FDictSpace& Other) const;
+
+	/**
+	 * @brief Write a point as one float per dimension (TotalDimensions values), rather than it's flattened one-hot representation
+	 * @param[in] Point The point to pack
+	 * @param[out] OutRow The buffer to write into. Must hold at least TotalDimensions values
+	 * @note Discrete branches are written as their index, and binary dimensions as 0 or 1. Requires BuildLayout to have been called
+	 */
+	void PackDimensions(const FDictPoint& Point, float* OutRow) const;
+
+	/**
+	 * @brief Read a point written by PackDimensions into an existing DictPoint, reusing the storage of it's entries
+	 * @param[in] Row A ptr to the TotalDimensions values of the packed point
+	 * @param[in,out] OutPoint The point to write into
+	 * @note Requires BuildLayout to have been called
+	 */
+	void UnpackDimensions(const float* Row, FDictPoint& OutPoint) const;
+
 	/**
 	 * @brief Create an empty Tensor Binding with correct size to hold a point from this DictSpace
 	 * @param[in] Buffer The buffer that will contain the memory in the tensor binding
@@ -541,6 +708,7 @@ struct SCHOLA_API FDictSpace
 	 * @param[in,out] Buffer The buffer that will contain the memory in the tensor binding
 	 * @param[in] Point The point to create a tensor from
 	 * @return The tensor binding
+	 * @note A point with an arena is bound directly, without copying, and Buffer is left untouched. The point must outlive the binding
 	 */
 	FGenericTensorBinding CreateTensorBinding(TArray<float>& Buffer, const FDictPoint& Point) const;
 
@@ -561,6 +729,10 @@ struct SCHOLA_API FDictSpace
 	 */
 	TSpace& operator[](const FString& Label)
 	{
+		if (this->Layout.IsValid())
+		{
+			return this->Spaces[this->Layout->LabelIndex.FindChecked(Label)];
+		}
 		return this->Spaces[this->Labels.IndexOfByKey(Label)];
 	};
 
@@ -6,6 +6,7 @@
 #include <grpcpp/grpcpp.h>
 #include <grpcpp/server.h>
 #include <grpcpp/server_context.h>
+#include <optional>
 
 using grpc::Server;
 using grpc::ServerAsyncResponseWriter;
@@ -35,6 +36,9 @@ protected:
 		ServerCompletionQueue*										 notification_cq,
 		void*														 tag);
 
+	/** Storage for the Context, so that it can be rebuilt for each RPC without going through the heap */
+	std::optional<ServerContext> ContextStorage;
+
 	/** The Context of the Server that this CallData is associated with */
 	ServerContext* SContext;
 
@@ -47,6 +51,12 @@ protected:
 	/** The outgoing response message to the client */
 	ResponseType* Response = nullptr;
 
+	/** Whether this CallData owns Response, and is responsible for deleting it */
+	bool bOwnsResponse = true;
+
+	/** An owned response kept from a previous RPC, that is cleared and reused instead of allocating a new one */
+	ResponseType* SpareResponse = nullptr;
+
 	/** A method ptr to the type of Requests this CallData will be servicing */
 	AsyncAPIHandler TargetRPC;
 
@@ -83,7 +93,7 @@ public:
 	 * @param[in] bAutoCreate Whether this CallData should automatically create itself, or it should happen later via Create()
 	 */
 	CallData(ServiceType* Service, ServerCompletionQueue* CQueue, AsyncAPIHandler TargetRPC, bool bReusable = false, bool bAutoCreate = true)
-		: SContext(new ServerContext()), Responder(SContext), CallDataStatus(CREATE), bReusable(bReusable)
+		: ContextStorage(std::in_place), SContext(&*ContextStorage), Responder(SContext), CallDataStatus(CREATE), bReusable(bReusable)
 	{
 		this->TargetRPC = TargetRPC;
 		this->CQueue = CQueue;
@@ -94,6 +104,15 @@ public:
 		}
 	}
 
+	~CallData()
+	{
+		if (Response != nullptr && bOwnsResponse)
+		{
+			delete this->Response;
+		}
+		delete this->SpareResponse;
+	}
+
 	/**
 	 * @brief Create/setup the calldata instance. This registers the calldata as the tag to return when the TargetRPC is called.
 	 */
@@ -119,7 +138,7 @@ public:
 		// create a default message if none has been set
 		if (Response == nullptr)
 		{
-			Response = new ResponseType();
+			this->GetMutableResponse();
 		}
 		// UE_LOG(LogScholaCommunicator, VeryVerbose, TEXT("Submitted Message %d %s"), this->Id, *FString(Response->DebugString().c_str()));
 		Responder.Finish(*Response, Status::OK, this);
@@ -132,21 +151,39 @@ public:
 	{
 		GPR_ASSERT(CallDataStatus == FINISH);
 		UE_LOG(LogScholaCommunicator, VeryVerbose, TEXT("Resetting CallData"));
-		if (Response != nullptr)
+		this->Recycle();
+		// Add ourselves back into the queue
+		this->Create();
+	}
+
+	/**
+	 * @brief Return this CallData to the state it was constructed in, keeping its messages allocated. Create() has to be called before it serves another RPC.
+	 */
+	void Recycle()
+	{
+		if (Response != nullptr && bOwnsResponse)
 		{
-			delete this->Response;
+			if (this->SpareResponse == nullptr)
+			{
+				this->Response->Clear();
+				this->SpareResponse = this->Response;
+			}
+			else
+			{
+				delete this->Response;
+			}
 		}
 		this->Response = nullptr;
-		// clean up the ServerContext
+		this->bOwnsResponse = true;
+		// Rebuild the ServerContext in place
 		// This is imperative since it can't be reused between RPC calls
-		delete this->SContext;
-		this->SContext = new ServerContext();
+		this->ContextStorage.emplace();
+		this->SContext = &*this->ContextStorage;
 		// Reset the responder since it is only good for one response
 		this->Responder = ServerAsyncResponseWriter<ResponseType>(this->SContext);
 		Request.Clear();
-		// Add ourselves back into the queue
+		this->Id = 0;
 		CallDataStatus = CREATE;
-		this->Create();
 	}
 
 	/**
@@ -165,12 +202,6 @@ public:
 	void CleanUp()
 	{
 		// Only use when draining the queue
-		if (Response != nullptr)
-		{
-			delete this->Response;
-		}
-
-		delete this->SContext;
 		delete this;
 	}
 
@@ -189,7 +220,13 @@ public:
 	 */
 	ResponseType* GetMutableResponse()
 	{
-		this->Response = new ResponseType();
+		if (this->Response != nullptr && this->bOwnsResponse)
+		{
+			delete this->Response;
+		}
+		this->Response = this->SpareResponse != nullptr ? this->SpareResponse : new ResponseType();
+		this->SpareResponse = nullptr;
+		this->bOwnsResponse = true;
 		return this->Response;
 	}
 
@@ -200,11 +237,27 @@ public:
 	 */
 	void SetResponse(ResponseType* NewResponse)
 	{
-		if (this->Response == nullptr)
+		if (this->Response != nullptr && this->bOwnsResponse)
+		{
+			delete this->Response;
+		}
+		this->Response = NewResponse;
+		this->bOwnsResponse = true;
+	}
+
+	/**
+	 * @brief Set the response message, without taking ownership of it.
+	 * @param[in] NewResponse The new Response message to associate with this call.
+	 * @note The message is serialized when Submit is called, so the caller can reuse it as soon as Submit returns
+	 */
+	void SetBorrowedResponse(ResponseType* NewResponse)
+	{
+		if (this->Response != nullptr && this->bOwnsResponse)
 		{
 			delete this->Response;
 		}
 		this->Response = NewResponse;
+		this->bOwnsResponse = false;
 	}
 
 	/**
@@ -225,6 +278,15 @@ public:
 		return CallDataStatus == CallStatus::PROCESS;
 	}
 
+	/**
+	 * @brief Returns whether the RPC has been completed, and this CallData is waiting to be finished or reset
+	 * @returns true iff this RPC has submitted its response
+	 */
+	inline bool IsFinished()
+	{
+		return CallDataStatus == CallStatus::FINISH;
+	}
+
 	/**
 	 * @brief Progress the state of the RPC. Call this on a child process to handle automatically setting up and completing gRPC calls.
 	 */
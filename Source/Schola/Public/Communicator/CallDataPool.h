@@ -0,0 +1,116 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LockFreeList.h"
+#include <atomic>
+
+/**
+ * @brief A snapshot of the counters of a CallDataPool
+ */
+struct FCallDataPoolStats
+{
+	/** The number of times a call was taken from the pool instead of being allocated */
+	uint64 Hits = 0;
+	/** The number of times the pool was empty and a call had to be allocated */
+	uint64 Misses = 0;
+	/** The number of times a finished call was deleted because the pool was already full */
+	uint64 Overflows = 0;
+	/** The number of calls currently waiting in the pool */
+	int32 NumPooled = 0;
+	/** The maximum number of calls the pool will hold */
+	int32 Capacity = 0;
+};
+
+/**
+ * @brief A bounded, lock-free free list of finished CallData objects, so that backends can reuse calls (and the messages inside them) instead of allocating one per RPC.
+ * Calls are acquired on the game thread and released on the backend's worker thread.
+ * @tparam CallDataType The type of CallData being pooled. Must have a Recycle() method that returns it to the state it had right after construction
+ */
+template <typename CallDataType>
+class CallDataPool
+{
+private:
+	TLockFreePointerListUnordered<CallDataType, PLATFORM_CACHE_LINE_SIZE> FreeList;
+
+	int32 Capacity;
+
+	std::atomic<int32>	NumPooled{ 0 };
+	std::atomic<uint64> Hits{ 0 };
+	std::atomic<uint64> Misses{ 0 };
+	std::atomic<uint64> Overflows{ 0 };
+
+public:
+	/** The capacity used by the backends unless they are given one */
+	static constexpr int32 DefaultCapacity = 16;
+
+	/**
+	 * @brief Create an empty pool
+	 * @param[in] Capacity The maximum number of calls to keep. Calls released beyond this are deleted
+	 */
+	CallDataPool(int32 Capacity = DefaultCapacity)
+		: Capacity(Capacity)
+	{
+	}
+
+	~CallDataPool()
+	{
+		while (CallDataType* Item = this->FreeList.Pop())
+		{
+			delete Item;
+		}
+	}
+
+	/**
+	 * @brief Take a recycled call from the pool
+	 * @return A call ready to be created, or nullptr if the pool is empty and the caller needs to allocate one
+	 */
+	CallDataType* Acquire()
+	{
+		CallDataType* Item = this->FreeList.Pop();
+		if (Item != nullptr)
+		{
+			this->NumPooled.fetch_sub(1, std::memory_order_relaxed);
+			this->Hits.fetch_add(1, std::memory_order_relaxed);
+		}
+		else
+		{
+			this->Misses.fetch_add(1, std::memory_order_relaxed);
+		}
+		return Item;
+	}
+
+	/**
+	 * @brief Recycle a finished call and return it to the pool
+	 * @param[in] Item The call to return
+	 * @return True if the pool took the call. If false the caller still owns it and should clean it up
+	 */
+	bool Release(CallDataType* Item)
+	{
+		if (this->NumPooled.fetch_add(1, std::memory_order_relaxed) >= this->Capacity)
+		{
+			this->NumPooled.fetch_sub(1, std::memory_order_relaxed);
+			this->Overflows.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		Item->Recycle();
+		this->FreeList.Push(Item);
+		return true;
+	}
+
+	/**
+	 * @brief Get the current counters of this pool
+	 * @return A snapshot of the counters
+	 */
+	FCallDataPoolStats GetStats() const
+	{
+		FCallDataPoolStats Stats;
+		Stats.Hits = this->Hits.load(std::memory_order_relaxed);
+		Stats.Misses = this->Misses.load(std::memory_order_relaxed);
+		Stats.Overflows = this->Overflows.load(std::memory_order_relaxed);
+		Stats.NumPooled = this->NumPooled.load(std::memory_order_relaxed);
+		Stats.Capacity = this->Capacity;
+		return Stats;
+	}
+};
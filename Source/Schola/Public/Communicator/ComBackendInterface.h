@@ -7,6 +7,7 @@
 #include "Async/Future.h"
 #include "Common/CommonInterfaces.h"
 #include "Communicator/ProtobufDeserializer.h"
+#include "Communicator/CallDataPool.h"
 
 /**
  * @brief An abstracted communication backend that can send string/byte messages and can either be polled for responses or do exchanges when it sends messages.
@@ -43,6 +44,15 @@ public:
 	virtual void Restart() = 0;
 
 	virtual void Start() = 0;
+
+	/**
+	 * @brief Get the counters of the pool this backend reuses its calls from
+	 * @return The counters of the pool. All zero if this backend doesn't pool its calls
+	 */
+	virtual FCallDataPoolStats GetPoolStats() const
+	{
+		return FCallDataPoolStats();
+	}
 };
 
 /**
@@ -127,6 +137,12 @@ public:
 	 */
 	virtual void Respond(Out* Response) = 0;
 
+	/**
+	 * @brief Respond to a message from the client, with a message the caller keeps ownership of
+	 * @param[in] Response The message to send to the client. It is serialized before this returns, so the caller can clear and refill it for the next exchange
+	 */
+	virtual void RespondWithoutOwnership(Out& Response) = 0;
+
 	/**
 	 * @brief Do an exchange before converting the protomessage into the specified type
 	 * @tparam T The type to deserialize the message into
@@ -149,4 +165,32 @@ public:
 
 		return FutureDeserializedAction;
 	}
-};
\ No newline at end of file
+};
+
+/**
+ * @brief A Generic Interface for any service that holds a single long lived stream open, receiving messages of type In and sending messages of type Out over it in order
+ * @tparam In The type of message that will be input to this interface
+ * @tparam Out The type of message that will be output by this interface
+ */
+template <typename In, typename Out>
+class IStreamBackendInterface : public IComBackendInterface
+{
+public:
+	/**
+	 * @brief Wait for the next message from the client on the stream.
+	 * @return A future that will be fulfilled with the next message. The value ptr from the future is valid until the next time Receive is called.
+	 */
+	virtual TFuture<const In*> Receive() = 0;
+
+	/**
+	 * @brief Write a message to the client on the stream
+	 * @param[in] Msg The message to send to the client. The backend takes ownership of it
+	 */
+	virtual void Send(Out* Msg) = 0;
+
+	/**
+	 * @brief Write a message to the client on the stream, with a message the caller keeps ownership of
+	 * @param[in] Msg The message to send to the client. The caller can clear and refill it as soon as this returns
+	 */
+	virtual void SendWithoutOwnership(Out& Msg) = 0;
+};
@@ -17,6 +17,7 @@
 #include "Communicator/ExchangeRPCBackend.h"
 #include "Communicator/PollingRPCBackend.h"
 #include "Communicator/ProducerRPCBackend.h"
+#include "Communicator/StreamingRPCBackend.h"
 #include "CommunicationManager.generated.h"
 
 DECLARE_MULTICAST_DELEGATE(FOnServerStartSignature);
@@ -73,6 +74,19 @@ private:
 		grpc::CompletionQueue*										  new_call_cq,
 		ServerCompletionQueue*										  notification_cq,
 		void*														  tag);
+
+	/**
+	 * @brief  A type representing an Async Bidirectional Streaming RPC Handle
+	 * @tparam ServiceType The type of the service
+	 * @tparam In The type of the messages read from the stream
+	 * @tparam Out The type of the messages written to the stream
+	*/
+	template <typename ServiceType, typename In, typename Out>
+	using AsyncStreamRPCHandle = void (ServiceType::*)(grpc::ServerContext* context,
+		ServerAsyncReaderWriter<Out, In>*										stream,
+		grpc::CompletionQueue*													new_call_cq,
+		ServerCompletionQueue*													notification_cq,
+		void*																	tag);
 	
 
 public:
@@ -159,6 +173,25 @@ public:
 		return Backend;
 	}
 
+	/**
+	 * @brief Create a new Stream Backend, where Unreal holds a single stream open, receiving messages of type In and sending messages of type Out
+	 * @tparam ServiceType The type of the service
+	 * @tparam In The type of the messages read from the stream
+	 * @tparam Out The type of the messages written to the stream
+	 * @param TargetRPC The streaming RPC method to wrap
+	 * @param Service The service to attach the backend to
+	 */
+	template <typename ServiceType, typename In, typename Out>
+	IStreamBackendInterface<In, Out>* CreateStreamBackend(AsyncStreamRPCHandle<ServiceType, In, Out> TargetRPC, std::shared_ptr<ServiceType> Service)
+	{
+		this->RegisterService(Service);
+		std::unique_ptr<ServerCompletionQueue> CompQueue = this->GetCompletionQueue();
+		IStreamBackendInterface<In, Out>*	   Backend = new StreamingRPCBackend<ServiceType, In, Out>(TargetRPC, Service, std::move(CompQueue));
+		this->OnServerStartDelegate.AddRaw(Backend, &IComBackendInterface::Start);
+		this->OnServerShutdownDelegate.AddRaw(Backend, &IComBackendInterface::Shutdown);
+		return Backend;
+	}
+
 	/**
 	 * @brief Shutdown the Communication manager. Triggers OnServerShutdownDelegate
 	 */
@@ -173,6 +206,7 @@ public:
 
 	/**
 	 * @brief Initialize the Communication Manager. Sets the Port and URL for the server from the Settings Panel
+	 * @param[in] PortOffset Added to the configured port, so that several servers can run side by side
 	 */
-	void Initialize();
+	void Initialize(int PortOffset = 0);
 };
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "./CallData.h"
+#include "./CallDataPool.h"
 #include "./AbstractRPCBackend.h"
 #include "./ComBackendInterface.h"
 #include "Common/CommonInterfaces.h"
@@ -25,6 +26,16 @@ public:
 		// Note we disable autocreate here so that we can do some work first before creating the new calldata objects
 	}
 
+	/**
+	 * @brief Return this exchange to the state it was constructed in, with a fresh promise for the next request
+	 */
+	void Recycle()
+	{
+		CallData::Recycle();
+		this->RequestPromise = TPromise<const RequestType*>();
+		this->bHasRequest = false;
+	}
+
 	/**
 	 * @brief Get a future representing an eventual request from a client
 	 * @return A Future that will be fulfilled once a RPC is initiated
@@ -83,6 +94,8 @@ private:
 	typedef ExchangeCallData<ServiceType, RequestType, ResponseType> _ExchCallData;
 	// CQueue owned by this workers parent
 	ServerCompletionQueue* CQueue;
+	// Pool owned by this workers parent, that finished exchanges are returned to
+	CallDataPool<_ExchCallData>* Pool;
 	// The ID of this worker
 	int LocalID;
 
@@ -90,10 +103,11 @@ public:
 	// The thread object this worker runs on
 	FRunnableThread* Thread = nullptr;
 
-	ExchangeRPCWorker(ServerCompletionQueue* CQueue, int ID)
+	ExchangeRPCWorker(ServerCompletionQueue* CQueue, CallDataPool<_ExchCallData>* Pool, int ID)
 	{
 		LocalID = ID;
 		this->CQueue = CQueue;
+		this->Pool = Pool;
 	}
 
 	~ExchangeRPCWorker()
@@ -165,8 +179,9 @@ public:
 					CallData->FulfillRequestPromise();
 					CallData->bHasRequest = true;
 				}
-				else
+				else if (!(CallData->IsFinished() && Pool->Release(CallData)))
 				{
+					// Finished exchanges only get cleaned up here if the pool is full
 					CallData->DoWork();
 				}
 			}
@@ -214,6 +229,8 @@ private:
 	// Note these are inverted since we are sending response, before the request arrives from gRPC perspective
 	_ExchCallData*											   CurrExchange = nullptr;
 	ExchangeRPCWorker<ServiceType, RequestType, ResponseType>* Worker;
+	// Finished exchanges, reused by Receive
+	CallDataPool<_ExchCallData>								   Pool;
 	int														   MsgID = 0;
 	using RPCBackend = RPCBackend<ServiceType, RequestType, ResponseType>;
 
@@ -222,7 +239,7 @@ public:
 		: RPCBackend(TargetRPC, Service, std::move(CQueue))
 	{
 		LocalID = ExchangeID++;
-		this->Worker = new ExchangeRPCWorker<ServiceType, RequestType, ResponseType>(RPCBackend::_CQueue.get(), LocalID);
+		this->Worker = new ExchangeRPCWorker<ServiceType, RequestType, ResponseType>(RPCBackend::_CQueue.get(), &this->Pool, LocalID);
 	}
 
 	~ExchangeRPCBackend()
@@ -237,7 +254,11 @@ public:
 		int TempId = MsgID++;
 		// New CallData goes on a pending queue see: https://github.com/grpc/grpc/blob/v1.47.4/src/core/lib/surface/server.cc#L413
 		checkf(CurrExchange == nullptr, TEXT("Existing Exchange needs to be completed before a new exchange can be started"));
-		_ExchCallData* CallDataPtr = new _ExchCallData(this->Service.get(), this->_CQueue.get(), this->TargetRPC);
+		_ExchCallData* CallDataPtr = this->Pool.Acquire();
+		if (CallDataPtr == nullptr)
+		{
+			CallDataPtr = new _ExchCallData(this->Service.get(), this->_CQueue.get(), this->TargetRPC);
+		}
 		CurrExchange = CallDataPtr;
 		CallDataPtr->Id = TempId;
 		CallDataPtr->Create();
@@ -256,6 +277,15 @@ public:
 		CurrExchange = nullptr;
 	}
 
+	void RespondWithoutOwnership(ResponseType& Response) override
+	{
+		checkf(CurrExchange != nullptr, TEXT("No Existing Exchange to Complete."));
+		UE_LOG(LogScholaCommunicator, VeryVerbose, TEXT("Msg MId:%d QId:%d : %s"), CurrExchange->Id, LocalID, *FString(Response.DebugString().c_str()));
+		CurrExchange->SetBorrowedResponse(&Response);
+		CurrExchange->Submit();
+		CurrExchange = nullptr;
+	}
+
 	virtual void Initialize() {};
 
 	virtual void Start()
@@ -269,7 +299,14 @@ public:
 	{
 		this->Worker->Stop();
 		this->CurrExchange = nullptr;
+		FCallDataPoolStats Stats = this->Pool.GetStats();
+		UE_LOG(LogScholaCommunicator, Verbose, TEXT("Exchange %d CallData Pool: %llu hits, %llu misses, %llu overflows"), LocalID, Stats.Hits, Stats.Misses, Stats.Overflows);
 	};
 
+	virtual FCallDataPoolStats GetPoolStats() const override
+	{
+		return this->Pool.GetStats();
+	}
+
 	virtual void Restart() {};
 };
\ No newline at end of file
@@ -0,0 +1,137 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
+
+/**
+ * @brief An ordered hand off of incoming messages from a transport's thread to a consumer, that reuses the messages once they've been consumed.
+ * Messages are delivered on one thread and received on another. A receive that comes before a delivery waits on a future.
+ * @tparam MessageType The type of protobuf message being handed off
+ */
+template <typename MessageType>
+class MessageMailbox
+{
+private:
+	FCriticalSection Lock;
+
+	/** Messages that have been delivered but not yet received, in the order they were delivered */
+	TArray<MessageType*> Delivered;
+	/** Consumed messages that can be filled again */
+	TArray<MessageType*> FreeMessages;
+	/** The message handed out by the last Receive. Recycled on the next one */
+	MessageType* Current = nullptr;
+	/** Set while a Receive is waiting on a message that hasn't been delivered yet */
+	TPromise<const MessageType*>* PendingPromise = nullptr;
+
+	/**
+	 * @brief Hand a message to the waiting receiver
+	 * @param[in] Promise The promise of the waiting receiver, which is freed
+	 * @param[in] Msg The message to fulfill it with
+	 */
+	static void Fulfill(TPromise<const MessageType*>* Promise, const MessageType* Msg)
+	{
+		Promise->SetValue(Msg);
+		delete Promise;
+	}
+
+public:
+	~MessageMailbox()
+	{
+		delete this->Current;
+		delete this->PendingPromise;
+		for (MessageType* Msg : this->Delivered)
+		{
+			delete Msg;
+		}
+		for (MessageType* Msg : this->FreeMessages)
+		{
+			delete Msg;
+		}
+	}
+
+	/**
+	 * @brief Get an empty message to fill and deliver, reusing a consumed one if possible
+	 * @return A message that the caller owns until it is delivered
+	 */
+	MessageType* Acquire()
+	{
+		FScopeLock ScopeLock(&this->Lock);
+		return this->FreeMessages.Num() > 0 ? this->FreeMessages.Pop(false) : new MessageType();
+	}
+
+	/**
+	 * @brief Deliver a message to the consumer. Fulfills a waiting Receive on this thread, so should not be called with other locks held
+	 * @param[in] Msg A message from Acquire, which the mailbox takes back ownership of
+	 */
+	void Deliver(MessageType* Msg)
+	{
+		TPromise<const MessageType*>* Promise = nullptr;
+		{
+			FScopeLock ScopeLock(&this->Lock);
+			if (this->PendingPromise != nullptr)
+			{
+				this->Current = Msg;
+				Swap(Promise, this->PendingPromise);
+			}
+			else
+			{
+				this->Delivered.Add(Msg);
+			}
+		}
+
+		if (Promise != nullptr)
+		{
+			Fulfill(Promise, Msg);
+		}
+	}
+
+	/**
+	 * @brief Wake up a waiting Receive with an empty message, e.g. because the sender disconnected. Does nothing if no Receive is waiting
+	 */
+	void Interrupt()
+	{
+		MessageType* Empty = this->Acquire();
+		TPromise<const MessageType*>* Promise = nullptr;
+		{
+			FScopeLock ScopeLock(&this->Lock);
+			if (this->PendingPromise == nullptr)
+			{
+				this->FreeMessages.Add(Empty);
+				return;
+			}
+			this->Current = Empty;
+			Swap(Promise, this->PendingPromise);
+		}
+		Fulfill(Promise, Empty);
+	}
+
+	/**
+	 * @brief Get the next message, recycling the one from the previous call
+	 * @return A future that will be fulfilled with the next message. The value ptr from the future is valid until the next time Receive is called.
+	 */
+	TFuture<const MessageType*> Receive()
+	{
+		FScopeLock ScopeLock(&this->Lock);
+		checkf(this->PendingPromise == nullptr, TEXT("Existing Receive needs to be completed before a new one can be started"));
+		if (this->Current != nullptr)
+		{
+			this->Current->Clear();
+			this->FreeMessages.Add(this->Current);
+			this->Current = nullptr;
+		}
+
+		if (this->Delivered.Num() > 0)
+		{
+			this->Current = this->Delivered[0];
+			this->Delivered.RemoveAt(0, 1, false);
+			return MakeFulfilledPromise<const MessageType*>(this->Current).GetFuture();
+		}
+
+		this->PendingPromise = new TPromise<const MessageType*>();
+		return this->PendingPromise->GetFuture();
+	}
+};
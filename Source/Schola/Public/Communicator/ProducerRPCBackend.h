@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "./CallData.h"
+#include "./CallDataPool.h"
 #include "./AbstractRPCBackend.h"
 #include "./ComBackendInterface.h"
 #include "Common/CommonInterfaces.h"
@@ -18,6 +19,8 @@ private:
 	typedef CallData<ServiceType, RequestType, ResponseType> _CallData;
 	// CQueue owned by this workers parent
 	ServerCompletionQueue* CQueue;
+	// Pool owned by this workers parent, that finished calls are returned to
+	CallDataPool<_CallData>* Pool;
 	// The ID of this worker
 	int LocalID;
 
@@ -25,10 +28,11 @@ public:
 	// The thread object this worker runs on
 	FRunnableThread* Thread = nullptr;
 
-	ProducerRPCWorker(ServerCompletionQueue* CQueue, int ID)
+	ProducerRPCWorker(ServerCompletionQueue* CQueue, CallDataPool<_CallData>* Pool, int ID)
 	{
 		LocalID = ID;
 		this->CQueue = CQueue;
+		this->Pool = Pool;
 	}
 
 	~ProducerRPCWorker()
@@ -80,7 +84,10 @@ public:
 			else
 			{
 				_CallData* CallData = static_cast<_CallData*>(tag);
-				CallData->DoWork();
+				if (!(CallData->IsFinished() && Pool->Release(CallData)))
+				{
+					CallData->DoWork();
+				}
 			}
 		}
 	}
@@ -126,6 +133,8 @@ private:
 	typedef CallData<ServiceType, RequestType, ResponseType> _CallData;
 	// Note these are inverted since we are sending response, before the request arrives from gRPC perspective
 	ProducerRPCWorker<ServiceType, RequestType, ResponseType>* Worker;
+	// Finished calls, reused by SendProtobufMessage
+	CallDataPool<_CallData>									   Pool;
 	using RPCBackend = RPCBackend<ServiceType, RequestType, ResponseType>;
 
 public:
@@ -133,7 +142,7 @@ public:
 		: RPCBackend(TargetRPC, Service, std::move(CQueue))
 	{
 		LocalID = ExchangeID++;
-		this->Worker = new ProducerRPCWorker<ServiceType, RequestType, ResponseType>(RPCBackend::_CQueue.get(), LocalID);
+		this->Worker = new ProducerRPCWorker<ServiceType, RequestType, ResponseType>(RPCBackend::_CQueue.get(), &this->Pool, LocalID);
 	}
 
 	~ProducerRPCBackend()
@@ -145,7 +154,11 @@ public:
 
 	void SendProtobufMessage(ResponseType* Response) override
 	{
-		_CallData* CallDataPtr = new _CallData(this->Service.get(), this->_CQueue.get(), this->TargetRPC, false, false);
+		_CallData* CallDataPtr = this->Pool.Acquire();
+		if (CallDataPtr == nullptr)
+		{
+			CallDataPtr = new _CallData(this->Service.get(), this->_CQueue.get(), this->TargetRPC, false, false);
+		}
 		CallDataPtr->SetResponse(Response);
 		int TempID = MsgID++;
 		// UE_LOG(LogScholaCommunicator, VeryVerbose, TEXT("Adding Message %d to producer queue %d \n %s"), TempID, LocalID, *FString(Response->DebugString().c_str()));
@@ -165,7 +178,14 @@ public:
 	virtual void Shutdown() override
 	{
 		this->Worker->Stop();
+		FCallDataPoolStats Stats = this->Pool.GetStats();
+		UE_LOG(LogScholaCommunicator, Verbose, TEXT("Producer %d CallData Pool: %llu hits, %llu misses, %llu overflows"), LocalID, Stats.Hits, Stats.Misses, Stats.Overflows);
 	};
 
+	virtual FCallDataPoolStats GetPoolStats() const override
+	{
+		return this->Pool.GetStats();
+	}
+
 	virtual void Restart() {};
 };
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "../Common/Points.h"
 #include "../Training/TrainingStateUpdateStructs.h"
+#include "../Training/TrainingDefinitionStructs.h"
 THIRD_PARTY_INCLUDES_START
 #include "../Generated/GymConnector.pb.h"
 #include "../Generated/Spaces.pb.h"
@@ -57,6 +58,14 @@ namespace ProtobufDeserializer
 	 */
 	void Deserialize(const Schola::TrainingStateUpdate& ProtoMsg, FTrainingStateUpdate& OutTrainingStateUpdate);
 
+	/**
+	 * @brief Deserialize a protobuf message (Schola::TrainingStateUpdate) that may carry dense group actions, into an object of type FTrainingStateUpdate
+	 * @param[in] ProtoMsg The protobuf message to deserialize
+	 * @param[out] OutTrainingStateUpdate The type of the Unreal object to deserialize into
+	 * @param[in] DenseGroups The groups the dense actions refer to, indexed by group id
+	 */
+	void Deserialize(const Schola::TrainingStateUpdate& ProtoMsg, FTrainingStateUpdate& OutTrainingStateUpdate, TArrayView<const FDenseAgentGroup> DenseGroups);
+
 	/**
 	 * @brief Deserialize a protobuf message (Schola::AgentStateUpdate) into a new object of type FAction
 	 * @param[in] ProtoMsg The protobuf message to deserialize
@@ -18,37 +18,82 @@ class ProtobufSerializer : public ConstPointVisitor
 
 	DictPoint* PointContainer;
 
+	/** The index of the next entry in PointContainer to fill */
+	int NextIndex = 0;
+
+	/**
+	 * @brief Get the next entry to fill, reusing an existing entry in the container if there is one
+	 * @return A ptr to the entry
+	 */
+	Schola::FundamentalPoint* NextValue()
+	{
+		if (NextIndex < PointContainer->values_size())
+		{
+			return PointContainer->mutable_values(NextIndex++);
+		}
+		NextIndex++;
+		return PointContainer->add_values();
+	}
+
+	/**
+	 * @brief Copy an array of point values into a repeated field with a single memcpy
+	 * @param[out] Out The repeated field to fill. Should be empty
+	 * @param[in] Values A ptr to the values to copy
+	 * @param[in] Num The number of values to copy
+	 */
+	template <typename ProtoValueType, typename ValueType>
+	static void CopyValues(google::protobuf::RepeatedField<ProtoValueType>* Out, const ValueType* Values, int Num)
+	{
+		static_assert(sizeof(ProtoValueType) == sizeof(ValueType), "Point and protobuf value types must have the same size");
+		if (Num > 0)
+		{
+			Out->Resize(Num, ProtoValueType());
+			FMemory::Memcpy(Out->mutable_data(), Values, Num * sizeof(ValueType));
+		}
+	}
+
 public:
 	// Takes as argument the protobuf object that should be filled when traversing the datastructure
+	// Existing entries in the container are overwritten in place, so a message can be reused between steps
 	ProtobufSerializer(DictPoint* InitialPoint)
 		: PointContainer(InitialPoint){};
 
+	/**
+	 * @brief Remove any entries in the container left over from a previous fill that weren't overwritten
+	 */
+	void Truncate()
+	{
+		if (PointContainer->values_size() > NextIndex)
+		{
+			PointContainer->mutable_values()->DeleteSubrange(NextIndex, PointContainer->values_size() - NextIndex);
+		}
+	}
+
 	void Visit(const FBinaryPoint& Point) override
 	{
-		BinaryPoint* PointMsg = PointContainer->add_values()->mutable_binary_point();
-		for (auto& PointValue : Point.Values)
+		BinaryPoint* PointMsg = NextValue()->mutable_binary_point();
+		PointMsg->Clear();
+		if (Point.bPacked)
 		{
-			PointMsg->add_values(PointValue);
+			PointMsg->set_packed_values(Point.PackedWords.GetData(), (Point.NumPackedBits + 7) / 8);
+			PointMsg->set_num_packed_values(Point.NumPackedBits);
+			return;
 		}
+		CopyValues(PointMsg->mutable_values(), Point.Values.GetData(), Point.Values.Num());
 	};
 
 	void Visit(const FDiscretePoint& Point) override
 	{
-		DiscretePoint* PointMsg = PointContainer->add_values()->mutable_discrete_point();
-		// PointMsg->mutable_values()->Add(Point.Values.begin(), Point.Values.end()); leads to a compile error here
-		for (auto& PointValue : Point.Values)
-		{
-			PointMsg->add_values(PointValue);
-		}
+		DiscretePoint* PointMsg = NextValue()->mutable_discrete_point();
+		PointMsg->Clear();
+		CopyValues(PointMsg->mutable_values(), Point.Values.GetData(), Point.Values.Num());
 	};
 
 	void Visit(const FBoxPoint& Point) override
 	{
-		BoxPoint* PointMsg = PointContainer->add_values()->mutable_box_point();
-		for (auto& PointValue : Point.Values)
-		{
-			PointMsg->add_values(PointValue);
-		}
+		BoxPoint* PointMsg = NextValue()->mutable_box_point();
+		PointMsg->Clear();
+		CopyValues(PointMsg->mutable_values(), Point.GetData(), Point.Num());
 	};
 
 	DictPoint* GetDictPoint()
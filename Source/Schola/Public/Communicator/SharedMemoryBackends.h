@@ -0,0 +1,134 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "./ComBackendInterface.h"
+#include "./MessageMailbox.h"
+#include "./SharedMemoryTransport.h"
+
+/**
+ * @brief An exchange over a shared memory transport. Requests are read off the transport's thread as they arrive, and responses are written straight to the client.
+ * @tparam RequestType The type of message sent by the client
+ * @tparam ResponseType The type of message sent back to the client
+ */
+template <typename RequestType, typename ResponseType>
+class SharedMemoryExchangeBackend : public IExchangeBackendInterface<RequestType, ResponseType>
+{
+private:
+	FSharedMemoryTransport*		Transport;
+	ESharedMemoryMethod			Method;
+	MessageMailbox<RequestType> Mailbox;
+
+public:
+	SharedMemoryExchangeBackend(FSharedMemoryTransport* Transport, ESharedMemoryMethod Method)
+		: Transport(Transport), Method(Method)
+	{
+		Transport->RegisterHandler(Method, [this](const uint8* Payload, uint32 Size) {
+			RequestType* Request = this->Mailbox.Acquire();
+			Request->ParseFromArray(Payload, Size);
+			this->Mailbox.Deliver(Request);
+		});
+	}
+
+	TFuture<const RequestType*> Receive() override
+	{
+		return this->Mailbox.Receive();
+	}
+
+	void Respond(ResponseType* Response) override
+	{
+		this->Transport->Send(this->Method, *Response);
+		delete Response;
+	}
+
+	void RespondWithoutOwnership(ResponseType& Response) override
+	{
+		this->Transport->Send(this->Method, Response);
+	}
+
+	virtual void Initialize() override {};
+	virtual void Start() override {};
+	virtual void Establish() override {};
+
+	virtual void Shutdown() override
+	{
+		// Wake up anyone still waiting on the client
+		this->Mailbox.Interrupt();
+	};
+
+	virtual void Restart() override {};
+};
+
+/**
+ * @brief A producer over a shared memory transport. Messages are written to the client as soon as they are sent, and the client reads them when it asks for them.
+ * @tparam ResponseType The type of message sent to the client
+ */
+template <typename ResponseType>
+class SharedMemoryProducerBackend : public IProducerBackendInterface<ResponseType>
+{
+private:
+	FSharedMemoryTransport* Transport;
+	ESharedMemoryMethod		Method;
+
+public:
+	SharedMemoryProducerBackend(FSharedMemoryTransport* Transport, ESharedMemoryMethod Method)
+		: Transport(Transport), Method(Method)
+	{
+	}
+
+	void SendProtobufMessage(ResponseType* Msg) override
+	{
+		this->Transport->Send(this->Method, *Msg);
+		delete Msg;
+	}
+
+	virtual void Initialize() override {};
+	virtual void Start() override {};
+	virtual void Establish() override {};
+	virtual void Shutdown() override {};
+	virtual void Restart() override {};
+};
+
+/**
+ * @brief A polling service over a shared memory transport. Each request is queued for Poll, and acknowledged with an empty response when it arrives.
+ * @tparam RequestType The type of message sent by the client
+ * @tparam ResponseType The type of the acknowledgement sent back to the client
+ */
+template <typename RequestType, typename ResponseType>
+class SharedMemoryPollingBackend : public IPollingBackendInterface<RequestType>
+{
+private:
+	FSharedMemoryTransport* Transport;
+	ESharedMemoryMethod		Method;
+	TQueue<RequestType>		Requests;
+
+public:
+	SharedMemoryPollingBackend(FSharedMemoryTransport* Transport, ESharedMemoryMethod Method)
+		: Transport(Transport), Method(Method)
+	{
+		Transport->RegisterHandler(Method, [this](const uint8* Payload, uint32 Size) {
+			RequestType Request;
+			Request.ParseFromArray(Payload, Size);
+			this->Requests.Enqueue(MoveTemp(Request));
+			this->Transport->Send(this->Method, ResponseType());
+		});
+	}
+
+	TOptional<const RequestType*> Poll() override
+	{
+		RequestType Request;
+		if (this->Requests.Dequeue(Request))
+		{
+			return TOptional<const RequestType*>(new RequestType(MoveTemp(Request)));
+		}
+		return TOptional<const RequestType*>();
+	}
+
+	virtual void Initialize() override {};
+	virtual void Start() override {};
+	virtual void Establish() override {};
+	virtual void Shutdown() override {};
+	virtual void Restart() override {};
+};
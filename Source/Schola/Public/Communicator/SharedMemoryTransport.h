@@ -0,0 +1,179 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Event.h"
+#include <atomic>
+#include <google/protobuf/message.h>
+#include "Common/LogSchola.h"
+
+/**
+ * @brief The messages that can be sent over a shared memory transport. These mirror the methods of GymService, and must match schola/core/shared_memory.py
+ */
+enum class ESharedMemoryMethod : uint32
+{
+	StartGymConnector = 1,
+	RequestTrainingDefinition = 2,
+	UpdateState = 3,
+	RequestInitialTrainingState = 4,
+};
+
+/**
+ * @brief The outcome of trying to read a record from a shared memory ring
+ */
+enum class ESharedMemoryReadResult : uint8
+{
+	/** There were no records waiting */
+	Empty,
+	/** A record was read */
+	Read,
+	/** The next record doesn't fit within the ring or the bytes written so far, so nothing after it can be trusted */
+	Corrupt,
+};
+
+/**
+ * @brief A single producer, single consumer ring of length prefixed records, laid out in a block of shared memory.
+ * Each record is a 8 byte header (payload size, method) followed by the payload, padded to 8 bytes. A record never wraps around the end of the ring, so the payload can always be read and written in place.
+ */
+class SCHOLA_API FSharedMemoryRing
+{
+public:
+	/** The bytes taken by the read and write positions at the start of each ring. Each position gets its own cache line */
+	static constexpr SIZE_T ControlSize = 128;
+	/** The bytes taken by the header of each record */
+	static constexpr uint32 RecordHeaderSize = 8;
+	/** The method of a record that only marks the rest of the ring as unused, so the next record starts at the beginning */
+	static constexpr uint32 WrapMarker = 0xFFFFFFFF;
+
+	/**
+	 * @brief Create a view of a ring in already mapped memory
+	 * @param[in] Base The start of the ring's control block, followed by Capacity bytes of data
+	 * @param[in] Capacity The size of the data area in bytes. Must be a multiple of 8
+	 */
+	FSharedMemoryRing(uint8* Base, uint32 Capacity);
+
+	FSharedMemoryRing() = default;
+
+	/**
+	 * @brief Reserve space for a record, and let the caller write its payload in place
+	 * @param[in] Method The method to tag the record with
+	 * @param[in] Size The size of the payload in bytes
+	 * @param[in] Fill Called with the address to write the payload to
+	 * @param[in] bStop Checked while waiting for space, to give up if the transport is shutting down
+	 * @return false if the record can't fit in the ring even once it's empty, or bStop was set while waiting. Waits for space otherwise
+	 */
+	bool Write(uint32 Method, uint32 Size, TFunctionRef<void(uint8*)> Fill, const std::atomic<bool>& bStop);
+
+	/**
+	 * @brief Read the next record if one is available. The header of the record is checked against the ring before the payload is touched
+	 * @param[in] Read Called with the method and payload of the record. The payload is only valid during the call
+	 * @return Whether a record was read, or the ring is corrupt. Nothing is read from a corrupt ring
+	 */
+	ESharedMemoryReadResult TryRead(TFunctionRef<void(uint32, const uint8*, uint32)> Read);
+
+	/**
+	 * @brief Get the number of bytes a record with the given payload takes up in the ring
+	 * @param[in] Size The size of the payload
+	 * @return The size of the record, including the header and padding
+	 */
+	static uint32 GetRecordSize(uint32 Size)
+	{
+		return Align(RecordHeaderSize + Size, 8);
+	}
+
+private:
+	std::atomic<uint64>* WritePos = nullptr;
+	std::atomic<uint64>* ReadPos = nullptr;
+	uint8*				 Data = nullptr;
+	uint32				 Capacity = 0;
+};
+
+/**
+ * @brief A transport between Unreal and a client on the same machine, over two rings in a named block of shared memory. One carries messages to Unreal, and the other messages from Unreal.
+ * A reader thread picks up incoming messages and hands them to the handler registered for their method. If the client writes a record that doesn't fit in the ring, the transport fails and stops reading.
+ * @note Waiting is done by spinning, then yielding, on both sides, so that a busy training loop never makes a system call to pass a message. Once the ring has been idle for a while, the reader blocks for a growing but capped interval between polls instead.
+ */
+class SCHOLA_API FSharedMemoryTransport : public FRunnable
+{
+public:
+	/** Identifies the block as belonging to this transport */
+	static constexpr uint32 Magic = 0x4D485353; // 'SSHM'
+	/** Bumped whenever the layout changes */
+	static constexpr uint32 Version = 1;
+	/** The bytes taken by the header at the start of the block */
+	static constexpr SIZE_T HeaderSize = 64;
+
+	/** Called on the reader thread with the payload of each message for a method */
+	using FMessageHandler = TFunction<void(const uint8*, uint32)>;
+
+	/**
+	 * @brief Create and map the named block of shared memory
+	 * @param[in] Name The name of the block, which the client opens by the same name
+	 * @param[in] RingCapacity The size of each ring in bytes
+	 */
+	FSharedMemoryTransport(const FString& Name, uint32 RingCapacity);
+
+	~FSharedMemoryTransport();
+
+	/** The longest the reader blocks between polls of an idle ring, in milliseconds */
+	static constexpr uint32 MaxIdleWaitMs = 8;
+
+	/**
+	 * @brief Is the block of shared memory mapped, and still usable
+	 * @return true iff the transport was created successfully, and hasn't read a corrupt record since
+	 */
+	bool IsValid() const
+	{
+		return this->Region != nullptr && !this->bFailed.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Register the handler for messages of a method. Must be done before Start
+	 * @param[in] Method The method to handle
+	 * @param[in] Handler The handler, called on the reader thread
+	 */
+	void RegisterHandler(ESharedMemoryMethod Method, FMessageHandler&& Handler);
+
+	/**
+	 * @brief Serialize a message directly into the ring to the client
+	 * @param[in] Method The method to tag the message with
+	 * @param[in] Msg The message to send
+	 * @return true iff the message was written
+	 */
+	bool Send(ESharedMemoryMethod Method, const google::protobuf::Message& Msg);
+
+	/**
+	 * @brief Start the reader thread
+	 */
+	void Start();
+
+	/**
+	 * @brief Stop the reader thread. Safe to call more than once
+	 */
+	void Shutdown();
+
+	virtual bool   Init() override;
+	virtual uint32 Run() override;
+	virtual void   Stop() override;
+	virtual void   Exit() override;
+
+private:
+	FString						   Name;
+	FPlatformMemory::FSharedMemoryRegion* Region = nullptr;
+	FSharedMemoryRing			   ToUnreal;
+	FSharedMemoryRing			   FromUnreal;
+	TMap<uint32, FMessageHandler>  Handlers;
+	FRunnableThread*			   Thread = nullptr;
+	std::atomic<bool>			   bStopping{ false };
+	/** Set once a corrupt record is read. Nothing more is read or written after that */
+	std::atomic<bool>			   bFailed{ false };
+	/** Triggered when the transport is stopped, to wake the reader if it's blocked on an idle ring */
+	FEvent*						   StopEvent = nullptr;
+	/** Serializes writers, since messages can be sent from both the game thread and the reader thread */
+	FCriticalSection			   WriteLock;
+};
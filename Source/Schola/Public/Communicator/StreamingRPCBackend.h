@@ -0,0 +1,411 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
+#include "./CallData.h"
+#include "./ComBackendInterface.h"
+#include "./MessageMailbox.h"
+#include "Common/CommonInterfaces.h"
+
+using grpc::ServerAsyncReaderWriter;
+
+// A debug int for tracking logs across Streams. Inline so that every translation unit shares one counter
+inline int StreamID = 0;
+
+/**
+ * @brief The events that can come back on a stream's completion queue. The address of one of these is used as the tag for each operation.
+ */
+enum class EStreamEvent
+{
+	Connect,
+	Read,
+	Write,
+	Finish
+};
+
+template <typename BackendType>
+class StreamingRPCWorker : public FRunnable
+{
+private:
+	// CQueue owned by this workers parent
+	ServerCompletionQueue* CQueue;
+	// The backend that handles the events from the queue
+	BackendType* Backend;
+	// The ID of this worker
+	int LocalID;
+
+public:
+	// The thread object this worker runs on
+	FRunnableThread* Thread = nullptr;
+
+	StreamingRPCWorker(ServerCompletionQueue* CQueue, BackendType* Backend, int ID)
+	{
+		LocalID = ID;
+		this->CQueue = CQueue;
+		this->Backend = Backend;
+	}
+
+	~StreamingRPCWorker()
+	{
+		delete Thread;
+	}
+
+	/**
+	 * @brief Initialize the worker
+	 * @return True. Since initialization cannot fail
+	 */
+	virtual bool Init()
+	{
+		// Do Nothing here
+		return true;
+	}
+
+	/**
+	 * @brief This workers main method
+	 * @return A status code representing the result
+	 */
+	virtual uint32 Run()
+	{
+		void* tag = nullptr;
+		bool  ok = true;
+		while (true)
+		{
+			bool Status = CQueue->Next(&tag, &ok);
+			if (!Status)
+			{
+				// Queue drained so we can exit
+				UE_LOG(LogScholaCommunicator, Verbose, TEXT("Stream Queue %d Drained and Shutdown"), LocalID);
+				return -1;
+			}
+			else if (tag == nullptr)
+			{
+				UE_LOG(LogScholaCommunicator, Warning, TEXT("Empty Event in Stream Queue %d."), LocalID);
+			}
+			else
+			{
+				Backend->HandleEvent(*static_cast<EStreamEvent*>(tag), ok);
+			}
+		}
+	}
+
+	/**
+	 * @brief Start the worker
+	 */
+	void Start()
+	{
+		UE_LOG(LogScholaCommunicator, Verbose, TEXT("Starting Stream Worker %d"), LocalID);
+		Thread = FRunnableThread::Create(this, TEXT("StreamingRPCWorker"), 0, TPri_Normal);
+	}
+
+	/**
+	 * @brief Shutdown the worker and it's associated completion queue
+	 */
+	virtual void Stop()
+	{
+		UE_LOG(LogScholaCommunicator, Verbose, TEXT("Shutting Down Stream Queue %d"), LocalID);
+		CQueue->Shutdown();
+		// Wait for the CQueue to drain
+		if (Thread != nullptr)
+		{
+			Thread->WaitForCompletion();
+		}
+	}
+
+	/**
+	 * @brief Unused. Called when the thread completes
+	 */
+	virtual void Exit()
+	{
+		// Called on Completion so do nothing
+	}
+};
+
+/**
+ * @brief A backend that serves a single bidirectional stream, which the client keeps open for as long as it is connected.
+ * Incoming messages are read continuously and queued in order, and outgoing messages are written one at a time in the order they were sent.
+ * @tparam ServiceType The type of the service that the streaming RPC belongs to
+ * @tparam RequestType The type of message that is read from the stream, this is an incoming message to Unreal
+ * @tparam ResponseType The type of message that is written to the stream, this is an outgoing message from Unreal
+ * @note If the client closes the stream, any pending Receive is fulfilled with an empty message and the backend waits for a new stream.
+ */
+template <class ServiceType, typename RequestType, typename ResponseType>
+class StreamingRPCBackend : public IStreamBackendInterface<RequestType, ResponseType>
+{
+public:
+	/** The signature of the handler for an asynchronous bidirectional streaming RPC */
+	using AsyncStreamHandle = void (ServiceType::*)(grpc::ServerContext* context,
+		ServerAsyncReaderWriter<ResponseType, RequestType>*						stream,
+		grpc::CompletionQueue*													new_call_cq,
+		ServerCompletionQueue*													notification_cq,
+		void*																	tag);
+
+private:
+	typedef StreamingRPCBackend<ServiceType, RequestType, ResponseType> _StreamBackend;
+
+	int											  LocalID = 0;
+	std::unique_ptr<ServerCompletionQueue>		  CQueue;
+	std::shared_ptr<ServiceType>				  Service;
+	AsyncStreamHandle							  TargetRPC;
+	StreamingRPCWorker<_StreamBackend>*			  Worker;
+
+	/** The context and reader/writer of the current stream. Both are replaced each time a new stream is requested */
+	ServerContext*									   SContext = nullptr;
+	ServerAsyncReaderWriter<ResponseType, RequestType>* Stream = nullptr;
+
+	/** Tags for each kind of event on the queue. There is at most one of each outstanding at a time */
+	EStreamEvent ConnectTag = EStreamEvent::Connect;
+	EStreamEvent ReadTag = EStreamEvent::Read;
+	EStreamEvent WriteTag = EStreamEvent::Write;
+	EStreamEvent FinishTag = EStreamEvent::Finish;
+
+	/** Guards everything below, which is shared between the worker thread and the caller */
+	FCriticalSection Lock;
+
+	bool bConnected = false;
+	bool bWriting = false;
+	bool bFinishPending = false;
+	bool bShuttingDown = false;
+
+	/** The message the outstanding read is filling. Kept when a stream closes, for the next stream's first read */
+	RequestType* ReadTarget = nullptr;
+
+	/** Messages that have been read, waiting to be received */
+	MessageMailbox<RequestType> Mailbox;
+
+	/** Messages waiting for the outstanding write to complete, in the order they were sent */
+	TArray<ResponseType*> WriteQueue;
+
+	/**
+	 * @brief Start waiting for a client to open the stream
+	 */
+	void RequestStream()
+	{
+		this->SContext = new ServerContext();
+		this->Stream = new ServerAsyncReaderWriter<ResponseType, RequestType>(this->SContext);
+		std::invoke(this->TargetRPC, this->Service.get(), this->SContext, this->Stream, this->CQueue.get(), this->CQueue.get(), &this->ConnectTag);
+	}
+
+	/**
+	 * @brief Free the context and reader/writer of the current stream
+	 */
+	void ReleaseStream()
+	{
+		delete this->Stream;
+		this->Stream = nullptr;
+		delete this->SContext;
+		this->SContext = nullptr;
+	}
+
+	/**
+	 * @brief Write a message to the stream. Must be called with the lock held, and no write outstanding.
+	 * @param[in] Msg The message to write. It is serialized before this returns, so it can be freed or reused immediately afterwards
+	 */
+	void WriteLocked(const ResponseType& Msg)
+	{
+		this->bWriting = true;
+		this->Stream->Write(Msg, &this->WriteTag);
+	}
+
+	/**
+	 * @brief Write the next queued message if the stream is free. Must be called with the lock held
+	 */
+	void PumpWritesLocked()
+	{
+		if (this->bConnected && !this->bWriting && this->WriteQueue.Num() > 0)
+		{
+			ResponseType* Next = this->WriteQueue[0];
+			this->WriteQueue.RemoveAt(0, 1, false);
+			this->WriteLocked(*Next);
+			delete Next;
+		}
+	}
+
+	/**
+	 * @brief Close the current stream once no write is outstanding. Must be called with the lock held
+	 */
+	void FinishLocked()
+	{
+		if (this->bWriting)
+		{
+			this->bFinishPending = true;
+		}
+		else
+		{
+			this->bFinishPending = false;
+			this->Stream->Finish(Status::OK, &this->FinishTag);
+		}
+	}
+
+public:
+	StreamingRPCBackend(AsyncStreamHandle TargetRPC, std::shared_ptr<ServiceType> Service, std::unique_ptr<ServerCompletionQueue> CQueue)
+		: CQueue(std::move(CQueue)), Service(Service), TargetRPC(TargetRPC)
+	{
+		LocalID = StreamID++;
+		this->Worker = new StreamingRPCWorker<_StreamBackend>(this->CQueue.get(), this, LocalID);
+	}
+
+	~StreamingRPCBackend()
+	{
+		UE_LOG(LogScholaCommunicator, Warning, TEXT("Manually Deleting StreamingRPC Backend %d"), LocalID);
+		Shutdown();
+		delete this->Worker;
+		this->ReleaseStream();
+		delete this->ReadTarget;
+		for (ResponseType* Msg : this->WriteQueue)
+		{
+			delete Msg;
+		}
+	}
+
+	/**
+	 * @brief Progress the stream in response to an event from the completion queue. Called from the worker thread
+	 * @param[in] Event The operation that completed
+	 * @param[in] bOk Whether the operation succeeded
+	 */
+	void HandleEvent(EStreamEvent Event, bool bOk)
+	{
+		RequestType* ReadMessage = nullptr;
+		bool		 bClosed = false;
+		{
+			FScopeLock ScopeLock(&this->Lock);
+			switch (Event)
+			{
+				case EStreamEvent::Connect:
+					if (bOk)
+					{
+						UE_LOG(LogScholaCommunicator, Verbose, TEXT("Client connected to Stream %d"), LocalID);
+						this->bConnected = true;
+						// A previous stream leaves behind the message it's last, failed, read was filling, which can be reused
+						if (this->ReadTarget == nullptr)
+						{
+							this->ReadTarget = this->Mailbox.Acquire();
+						}
+						else
+						{
+							this->ReadTarget->Clear();
+						}
+						this->Stream->Read(this->ReadTarget, &this->ReadTag);
+						this->PumpWritesLocked();
+					}
+					break;
+
+				case EStreamEvent::Read:
+					if (bOk)
+					{
+						UE_LOG(LogScholaCommunicator, VeryVerbose, TEXT("Message in Stream %d: %s"), LocalID, *FString(this->ReadTarget->DebugString().c_str()));
+						ReadMessage = this->ReadTarget;
+						this->ReadTarget = this->Mailbox.Acquire();
+						this->Stream->Read(this->ReadTarget, &this->ReadTag);
+					}
+					else
+					{
+						// The client closed its side of the stream, so close ours. Anything we hadn't written is dropped
+						UE_LOG(LogScholaCommunicator, Verbose, TEXT("Client closed Stream %d"), LocalID);
+						this->bConnected = false;
+						for (ResponseType* Msg : this->WriteQueue)
+						{
+							delete Msg;
+						}
+						this->WriteQueue.Reset();
+						bClosed = true;
+						if (!this->bShuttingDown)
+						{
+							this->FinishLocked();
+						}
+					}
+					break;
+
+				case EStreamEvent::Write:
+					this->bWriting = false;
+					if (this->bFinishPending && !this->bShuttingDown)
+					{
+						this->FinishLocked();
+					}
+					else if (bOk)
+					{
+						this->PumpWritesLocked();
+					}
+					break;
+
+				case EStreamEvent::Finish:
+					// The stream is done, so wait for the client to open a new one
+					this->ReleaseStream();
+					if (!this->bShuttingDown)
+					{
+						this->RequestStream();
+					}
+					break;
+			}
+		}
+
+		// Deliver outside the lock, since continuations run on this thread and may call back into the backend
+		if (ReadMessage != nullptr)
+		{
+			this->Mailbox.Deliver(ReadMessage);
+		}
+		else if (bClosed)
+		{
+			this->Mailbox.Interrupt();
+		}
+	}
+
+	TFuture<const RequestType*> Receive() override
+	{
+		return this->Mailbox.Receive();
+	}
+
+	void Send(ResponseType* Msg) override
+	{
+		FScopeLock ScopeLock(&this->Lock);
+		UE_LOG(LogScholaCommunicator, VeryVerbose, TEXT("Msg QId:%d : %s"), LocalID, *FString(Msg->DebugString().c_str()));
+		if (this->bConnected && !this->bWriting)
+		{
+			this->WriteLocked(*Msg);
+			delete Msg;
+		}
+		else
+		{
+			this->WriteQueue.Add(Msg);
+		}
+	}
+
+	void SendWithoutOwnership(ResponseType& Msg) override
+	{
+		FScopeLock ScopeLock(&this->Lock);
+		UE_LOG(LogScholaCommunicator, VeryVerbose, TEXT("Msg QId:%d : %s"), LocalID, *FString(Msg.DebugString().c_str()));
+		if (this->bConnected && !this->bWriting)
+		{
+			this->WriteLocked(Msg);
+		}
+		else
+		{
+			// Only copy when we actually have to wait for the stream
+			this->WriteQueue.Add(new ResponseType(Msg));
+		}
+	}
+
+	virtual void Initialize() {};
+
+	virtual void Start()
+	{
+		this->RequestStream();
+		Worker->Start();
+	}
+
+	virtual void Establish() {};
+
+	virtual void Shutdown() override
+	{
+		{
+			FScopeLock ScopeLock(&this->Lock);
+			this->bShuttingDown = true;
+			this->bConnected = false;
+		}
+		this->Worker->Stop();
+	};
+
+	virtual void Restart() {};
+};
@@ -26,6 +26,10 @@ enum class EEnvironmentStatus : uint8
 	Error	  UMETA(DisplayName = "Error")
 };
 
+class AAbstractScholaEnvironment;
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FScholaAgentMembershipDelegate, AAbstractScholaEnvironment* /* Environment */, int /* AgentId */);
+
 /**
  * An abstract class representing an environment.
  */
@@ -43,6 +47,19 @@ protected:
 	UPROPERTY()
 	int MaxId = 0;
 
+	/** Ids freed by agents that have left the environment, most recently freed first. Handed out again, from the back, before MaxId grows */
+	UPROPERTY()
+	TArray<int> FreeAgentIds;
+
+	/** Agents that joined or left while the agents were being iterated over, applied once the iteration is done */
+	UPROPERTY()
+	TArray<AAbstractTrainer*> PendingJoins;
+	UPROPERTY()
+	TArray<AAbstractTrainer*> PendingLeaves;
+
+	/** Are the agents currently being iterated over. Agents can't join or leave until it's done */
+	bool bIteratingAgents = false;
+
 	/** The Id of the environment. Set at runtime. */
 	UPROPERTY()
 	int EnvId;
@@ -51,14 +68,55 @@ protected:
 	UPROPERTY()
 	EEnvironmentStatus EnvironmentStatus = EEnvironmentStatus::Running;
 
+	/**
+	 * @brief Initialize an agent and add it to the environment under a free id
+	 * @param[in] Agent The agent to add
+	 * @return The id of the agent, or INDEX_NONE if it failed to initialize
+	 */
+	int AddAgent(AAbstractTrainer* Agent);
+
+	/**
+	 * @brief Remove an agent from the environment and free it's id
+	 * @param[in] Agent The agent to remove
+	 * @return The id the agent had, or INDEX_NONE if it wasn't in the environment
+	 */
+	int RemoveAgent(AAbstractTrainer* Agent);
+
+	/**
+	 * @brief Apply any joins and leaves that were deferred while the agents were being iterated over
+	 */
+	void ApplyPendingMembershipChanges();
+
 public:
+	/** Broadcast whenever an agent joins the environment after it is initialized */
+	FScholaAgentMembershipDelegate OnAgentAdded;
+
+	/** Broadcast whenever an agent leaves the environment. The id may be handed to another agent afterwards */
+	FScholaAgentMembershipDelegate OnAgentRemoved;
+
 	/**
-	 * @brief Register an individual agent with the environment. Called after the environment is initialized.
-	 * @param Agent The agent to register
+	 * @brief Register an individual agent with the environment, e.g. one spawned during an episode. Called after the environment is initialized.
+	 * @param Agent The agent to register. It must already possess it's pawn
+	 * @note Agents registered while the environment is stepping it's agents join once the step is done
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Reinforcement Learning")
 	void RegisterAgent(AAbstractTrainer* Agent);
 
+	/**
+	 * @brief Remove an individual agent from the environment, e.g. when it's pawn is destroyed. It's id is reused by the next agent to join.
+	 * @param Agent The agent to deregister
+	 * @note Agents deregister themselves when they unpossess their pawn or are destroyed, so this only needs calling to remove an agent that is still alive
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Reinforcement Learning")
+	void DeregisterAgent(AAbstractTrainer* Agent);
+
+	/**
+	 * @brief Get the agent with a given id
+	 * @param[in] AgentId The id of the agent in this environment
+	 * @return The agent, or nullptr if no agent has that id
+	 */
+	AAbstractTrainer* GetAgent(int AgentId) const;
+
 	/**
 	 * @brief Register a list of agents with the environment, from a list of pawns with associated agents. Called after the environment is initialized.
 	 * @param OutAgentControlledPawnArray An array of pawns in the environment that are controlled by agents
@@ -128,8 +186,10 @@ public:
 
 	/**
 	 * @brief Perform a think step for all agents in the environment. Collects observations and sends them to the agents.
+	 * @param[in] bAccumulateRewards Add each agent's reward to the one from its previous think instead of replacing it
+	 * @return true iff any agent finished during this think
 	 */
-	void AllAgentsThink();
+	bool AllAgentsThink(bool bAccumulateRewards = false);
 
 	/**
 	 * @brief Perform an act step for all agents in the environment. Acts on any decisions from the brains
@@ -143,6 +203,12 @@ public:
 	 */
 	void SetEnvId(int EnvironmentId);
 
+	/**
+	 * @brief Get the Id of this environment.
+	 * @return The Id of the environment
+	 */
+	int GetEnvId() const { return this->EnvId; };
+
 	/**
 	 * @brief Set the status of this environment to the given status.
 	 * @param[in] NewStatus The new status of the environment
@@ -156,6 +222,17 @@ public:
 	 */
 	EEnvironmentStatus GetStatus();
 
+	/**
+	 * @brief Register this environment with the world's registry, so it can be found by the gym connector.
+	 */
+	virtual void BeginPlay() override;
+
+	/**
+	 * @brief Deregister this environment from the world's registry.
+	 * @param[in] EndPlayReason Why play ended for this environment
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/**
 	* @brief Configure this environment based on arbitrary Options from the GymConnector. Called immediately before the environment is reset, if the gym connector has Options.
 	* @param[in] Options A map of options to configure the environment with
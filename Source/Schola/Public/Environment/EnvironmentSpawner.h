@@ -0,0 +1,77 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Environment/AbstractEnvironment.h"
+#include "EnvironmentSpawner.generated.h"
+
+/**
+ * @brief An actor that fills the level with copies of a template environment when play begins, so one hand built environment can be trained on many times over.
+ * Each copy clones the environment, the pawns it registers, their trainers and any additional actors, and has its references to the originals pointed at its own clones.
+ * Copies are laid out on a grid, in cells sized from the bounds of the template so that no two copies overlap.
+ * @note The template itself is the first copy. Copies are spawned before the gym connector collects its environments, so they are registered like any other environment.
+ */
+UCLASS()
+class SCHOLA_API AEnvironmentSpawner : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	/** The environment to copy */
+	UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category = "Environment Spawner")
+	AAbstractScholaEnvironment* TemplateEnvironment = nullptr;
+
+	/** Other actors that make up the environment, e.g. its floor, walls or goals, that should be copied along with it */
+	UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category = "Environment Spawner")
+	TArray<AActor*> AdditionalActors;
+
+	/** The total number of environments, including the template. Can be overridden with -ScholaNumEnvs=<Count> */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = 1), Category = "Environment Spawner")
+	int NumEnvironments = 1;
+
+	/** The number of environments in each row of the grid. 0 lays them out in a square */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = 0), Category = "Environment Spawner")
+	int NumColumns = 0;
+
+	/** The distance between neighbouring environments along X and Y. Axes left at 0 are sized to fit the template's bounds */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = 0.0, Units = "cm"), Category = "Environment Spawner")
+	FVector2D Spacing = FVector2D::ZeroVector;
+
+	/** Extra space left between environments whose spacing is sized from the template's bounds, for agents that wander outside of them */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = 0.0, Units = "cm"), Category = "Environment Spawner")
+	float Padding = 500.0f;
+
+private:
+	/** Have the copies already been spawned */
+	bool bSpawned = false;
+
+	/**
+	 * @brief Collect the template environment and every actor that is copied along with it
+	 * @param[out] OutTemplateActors The actors to copy. The environment comes first
+	 */
+	void GatherTemplateActors(TArray<AActor*>& OutTemplateActors) const;
+
+	/**
+	 * @brief Get the distance between neighbouring environments
+	 * @param[in] TemplateActors The actors making up one environment
+	 * @return The spacing along X and Y
+	 */
+	FVector2D ComputeSpacing(const TArray<AActor*>& TemplateActors) const;
+
+	/**
+	 * @brief Spawn one copy of the template actors
+	 * @param[in] TemplateActors The actors to copy
+	 * @param[in] Offset How far the copy is moved from the template
+	 * @return The copied environment, or nullptr if it couldn't be spawned
+	 */
+	AAbstractScholaEnvironment* SpawnInstance(const TArray<AActor*>& TemplateActors, const FVector& Offset) const;
+
+public:
+	/**
+	 * @brief Spawn copies of the template environment until there are NumEnvironments of them. Called by the subsystem before it registers environments
+	 * @return The number of copies spawned
+	 */
+	int SpawnEnvironments();
+};
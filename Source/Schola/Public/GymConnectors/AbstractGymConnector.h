@@ -83,11 +83,25 @@ public:
 	 */
 	void						  Init();
 
+	/**
+	 * @brief Initialize this gym connector with a given set of environments, instead of collecting every environment in the world
+	 * @param[in] InEnvironments The environments this connector is responsible for. They are given ids in the order they are passed
+	 * @note Calls the other Init function with the SharedTrainingDefinition
+	 */
+	void						  InitWithEnvironments(const TArray<AAbstractScholaEnvironment*>& InEnvironments);
+
 	/**
 	 * @brief Reset all the environments that have completed
 	 */
 	virtual void				  ResetCompletedEnvironments() override;
 
+	/**
+	 * @brief Reset all the environments that have completed, leaving it to the caller to send their post reset states
+	 * @param[in] IncludedEnvs Only reset environments in this mask, or every environment if nullptr
+	 * @return The ids of the environments that were reset
+	 */
+	TArray<int>					  ResetCompletedEnvironmentsWithoutSubmitting(const TBitArray<>* IncludedEnvs = nullptr);
+
 	/**
 	 * @brief Update the environments with the new state update
 	 * @param[in] StateUpdate The new state update
@@ -168,7 +182,7 @@ public:
 	bool IsNotStarted() { return Status == EConnectorStatus::NotStarted || Status == EConnectorStatus::Closed; };
 	
 	/**
-	 * @brief Collect all the EnvironmentManagers in the simulation
+	 * @brief Collect all the environments registered with the world's registry, in order of their registry ids
 	 */
 	void CollectEnvironments() override;
 
@@ -177,4 +191,24 @@ public:
 	 * @param[in] Env A ptr to the environment to be registered.
 	 */
 	void RegisterEnvironment(AAbstractScholaEnvironment* Env);
+
+protected:
+	/**
+	 * @brief Initialize the registered environments, and collect their definitions and states
+	 */
+	virtual void InitEnvironments();
+
+	/**
+	 * @brief Start sharing the state and definition of an agent that joined an environment during training
+	 * @param[in] Environment The environment the agent joined
+	 * @param[in] AgentId The id of the agent in the environment
+	 */
+	void OnAgentAdded(AAbstractScholaEnvironment* Environment, int AgentId);
+
+	/**
+	 * @brief Stop sharing the state and definition of an agent that left an environment during training
+	 * @param[in] Environment The environment the agent left
+	 * @param[in] AgentId The id the agent had in the environment
+	 */
+	void OnAgentRemoved(AAbstractScholaEnvironment* Environment, int AgentId);
 };
\ No newline at end of file
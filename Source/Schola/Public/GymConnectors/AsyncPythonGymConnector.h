@@ -0,0 +1,60 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "./PythonGymConnector.h"
+#include "AsyncPythonGymConnector.generated.h"
+
+/**
+ * @brief A python gym connector that steps environments asynchronously, instead of in lock step.
+ * Each frame steps whichever environments have received actions, and streams their states back as soon as they are collected, so environments that are slow or resetting don't hold up the rest.
+ * @note Every state carries a per environment step count, which the client echoes with its actions so that actions answering an outdated state are dropped.
+ */
+UCLASS()
+class SCHOLA_API UAsyncPythonGymConnector : public UPythonGymConnector
+{
+	GENERATED_BODY()
+
+public:
+	/** Should each frame wait for at least one update before stepping. Disable to let the world run in real time while the client catches up */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Gym Connector Settings")
+	bool bWaitForUpdates = true;
+
+private:
+	/** The number of states sent for each environment, counting its resets. Identifies the state each update answers */
+	TArray<int> EnvSteps;
+
+	/** The environments that received an update this frame, and will think and be sent at the end of it */
+	TBitArray<> SteppedEnvs;
+
+	/** The update being received, which stays pending across frames until the client sends something */
+	TFuture<const TrainingStateUpdate*> PendingUpdate;
+
+	/** Every update received this frame, merged together */
+	FTrainingStateUpdate MergedUpdate;
+
+	/**
+	 * @brief Merge an update into the updates received this frame
+	 * @param[in] Update The update to merge. Only valid until the next update is requested
+	 */
+	void MergeUpdate(const FTrainingStateUpdate& Update);
+
+	/**
+	 * @brief Count a step for each of a set of environments, and record their new step counts in a message
+	 * @param[in] EnvIds The environments to count a step for
+	 * @param[out] OutEnvSteps The env_steps field to fill
+	 */
+	void CountSteps(const TArray<int>& EnvIds, google::protobuf::Map<int32, int32>& OutEnvSteps);
+
+protected:
+	bool IsAsynchronous() const override { return true; };
+
+public:
+	void				  Init(const FSharedTrainingDefinition& AgentDefns) override;
+	FTrainingStateUpdate* ResolveEnvironmentStateUpdate() override;
+	void				  UpdateEnvironments(FTrainingStateUpdate& StateUpdate) override;
+	void				  ResetCompletedEnvironments() override;
+	void				  CollectEnvironmentStates() override;
+	void				  SubmitEnvironmentStates() override;
+};
@@ -5,6 +5,11 @@
 #include "Agent/AgentAction.h"
 #include "ExternalGymConnector.generated.h"
 
+namespace Schola
+{
+	class TrainingStateUpdate;
+}
+
 /**
  * @brief An abstract class for connectors that communicate with gym using futures.
  */
@@ -23,17 +28,95 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (InlineEditConditionToggle), Category = "Gym Connector Settings")
 	bool bUseTimeout = true;
 
-	
+	/** How many cohorts to split the environments into. With more than one, each update is answered with the buffered state of the next cohort before the current one is simulated */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = "1"), Category = "Gym Connector Settings")
+	int NumPipelineCohorts = 1;
+
+	/** How many frames to repeat each action for before sending the next state. Rewards are summed over the repeated frames, and the state is sent early if any agent finishes */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = "1"), Category = "Gym Connector Settings")
+	int ActionRepeat = 1;
+
+	/** Which shard of the environments this connector serves, when they are split across several trainers. INDEX_NONE if it serves every environment */
+	UPROPERTY(BlueprintReadOnly, Category = "Gym Connector Settings")
+	int ShardIndex = INDEX_NONE;
+
+private:
+	/** The environments in each cohort. Environment i belongs to cohort i % NumPipelineCohorts */
+	TArray<TBitArray<>> CohortMasks;
+
+	/** The cohorts that received an update this step, and will think and be buffered at the end of it */
+	TBitArray<> UpdatedCohorts;
+
+	/** The cohorts with a buffered state that hasn't been sent yet */
+	TBitArray<> BufferedCohorts;
+
+	/** The cohort to send first, so that cohorts are answered in a fixed rotation */
+	int NextCohort = 0;
+
+	/** Has the current update already been answered with a buffered state */
+	bool bAnsweredUpdate = false;
+
+	/** How many frames the current action has been repeated for. 0 on frames that receive a new update */
+	int RepeatFrame = 0;
+
+	/** Should the current repeat end this frame, because an agent finished or an environment was reset */
+	bool bEndRepeat = false;
+
+	/** The update being repeated. Stays valid until the next update is requested */
+	FTrainingStateUpdate* RepeatedUpdate = nullptr;
+
+	/**
+	 * @brief Send the next buffered cohort state in the rotation, if there is one
+	 * @return true iff a state was sent
+	 */
+	bool SendNextBufferedState();
+
+public:
 	UExternalGymConnector();
 
+	/**
+	 * @brief Split the environments into cohorts that are stepped one at a time, overlapping the simulation of one cohort with the policy of another
+	 * @param[in] NumCohorts The number of cohorts. Pipelining is disabled if this is 1 or there is only one environment
+	 * @note Each cohort takes a step every NumCohorts frames, using actions chosen from its state of the previous step
+	 */
+	void SetupPipeline(int NumCohorts);
+
+	/**
+	 * @brief Is stepping pipelined across cohorts
+	 * @return true iff there is more than one cohort
+	 */
+	bool IsPipelined() const { return this->CohortMasks.Num() > 1; };
+
+	/**
+	 * @brief Repeat each action for several frames, without going back to gym in between
+	 * @param[in] Repeat The number of frames to take each action for. Disabled if this is 1, or when pipelining or sharding
+	 * @note Must be called after SetupPipeline
+	 */
+	void SetupActionRepeat(int Repeat);
+
+	/**
+	 * @brief Is each action repeated for several frames
+	 * @return true iff the action repeat is more than 1
+	 */
+	bool IsRepeatingActions() const { return this->ActionRepeat > 1; };
+
 	/**
 	 * @brief Request a decision from gym using the current state of the agents from environments
-	 * @return A future that will eventually contain decision for all agents in all environments
-	 * @note This function is asynchronous and will return immediately
+	 * @return A future that will eventually contain the raw decision message for all agents in all environments. The message is valid until the next request
+	 * @note This function is asynchronous and will return immediately. The future can be fulfilled on any thread, so the message is only read by DeserializeStateUpdate once it has been waited on
 	 * @note This function should be implemented by any derived classes
 	 */
-	virtual TFuture<FTrainingStateUpdate*> RequestStateUpdate()
-		PURE_VIRTUAL(UExternalGymConnector::RequestBatchedDecision, return TFuture<FTrainingStateUpdate*>(););
+	virtual TFuture<const Schola::TrainingStateUpdate*> RequestStateUpdate()
+		PURE_VIRTUAL(UExternalGymConnector::RequestBatchedDecision, return TFuture<const Schola::TrainingStateUpdate*>(););
+
+	/**
+	 * @brief Convert a decision message received from gym into an update. Called on the game thread
+	 * @param[in] Message The message from RequestStateUpdate
+	 * @return The update, which is valid until the next call
+	 * @note This function should be implemented by any derived classes
+	 */
+	virtual FTrainingStateUpdate* DeserializeStateUpdate(const Schola::TrainingStateUpdate& Message)
+		PURE_VIRTUAL(UExternalGymConnector::DeserializeStateUpdate, return nullptr;);
 
 	/**
 	 * @brief Send the state of the environment to gym
@@ -42,6 +125,26 @@ public:
 	 */
 	virtual void SendState(const FTrainingState& Value) PURE_VIRTUAL(UExternalGymConnector::SendState, return; );
 
+	/**
+	 * @brief Copy the state of a subset of environments into a buffer, to be sent later with SendBufferedState
+	 * @param[in] Value The state of all environments
+	 * @param[in] IncludedEnvs The environments to copy
+	 * @param[in] Slot The buffer to copy into. One per cohort
+	 * @note This function should be implemented by any derived classes that support pipelining
+	 */
+	virtual void BufferState(const FTrainingState& Value, const TBitArray<>& IncludedEnvs, int Slot) PURE_VIRTUAL(UExternalGymConnector::BufferState, return; );
+
+	/**
+	 * @brief Send a state copied by BufferState to gym
+	 * @param[in] Slot The buffer to send
+	 * @note This function should be implemented by any derived classes that support pipelining
+	 */
+	virtual void SendBufferedState(int Slot) PURE_VIRTUAL(UExternalGymConnector::SendBufferedState, return; );
+
+	void UpdateEnvironments(FTrainingStateUpdate& StateUpdate) override;
+
+	void CollectEnvironmentStates() override;
+
 	void SubmitEnvironmentStates() override;
 
 	FTrainingStateUpdate* ResolveEnvironmentStateUpdate() override;
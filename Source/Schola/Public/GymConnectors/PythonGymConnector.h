@@ -11,6 +11,8 @@
 #include "Communicator/CommunicationManager.h"
 #include "Communicator/ExchangeRPCBackend.h"
 #include "Communicator/PollingRPCBackend.h"
+#include "Communicator/StreamingRPCBackend.h"
+#include "Communicator/SharedMemoryBackends.h"
 #include "Communicator/ComBackendInterface.h"
 #include "PythonGymConnector.generated.h"
 
@@ -20,6 +22,7 @@ using Schola::InitialTrainingStateRequest;
 using Schola::GymService;
 using Schola::GymConnectorStartRequest;
 using Schola::GymConnectorStartResponse;
+using Schola::StepStreamResponse;
 using Schola::TrainingDefinition;
 using Schola::TrainingDefinitionRequest;
 using Schola::TrainingState;
@@ -75,6 +78,8 @@ private:
 	typedef IProducerBackendInterface<TrainingDefinition>*					ADSType;
 	/** A type for a producer interface that publishes InitialTrainingStates after each reset */
 	typedef IProducerBackendInterface<InitialTrainingState>*				PRSType;
+	/** A type for a stream interface that carries both the step loop and the post reset states */
+	typedef IStreamBackendInterface<TrainingStateUpdate, StepStreamResponse>* SSSType;
 	/** A type for a consumer interface that collects an initial GymConnectorStartRequest */
 	IPollingBackendInterface<GymConnectorStartRequest>*						StartRequestService;
 
@@ -85,11 +90,92 @@ private:
 	/** The service that will handle publishing the state after each reset */
 	PRSType PostResetStateService;
 
+	/** The state message sent each step. Kept between steps and refilled in place, so it's nested messages and repeated fields are only allocated once */
+	TrainingState TrainingStateMsg;
+
+	/** The state of each cohort when pipelining, filled when the cohort is stepped and sent in answer to a later update. The state is held in a stream message so that it can be sent over either the stream or the exchange without a copy */
+	TArray<StepStreamResponse> CohortStateMsgs;
+
+	/** The decision received each step. Refilled in place, so the actions of each agent are only allocated once */
+	FTrainingStateUpdate StateUpdate;
+
+	/** The shared memory transport used in place of the gRPC server when one is configured */
+	TUniquePtr<FSharedMemoryTransport> SharedMemoryTransport;
+
+	/**
+	 * @brief Create the services on a shared memory transport, if one is set in the settings or on the command line
+	 * @param[in] Settings The settings to read the shared memory name and size from
+	 * @return true iff the services were created, false if gRPC should be used instead
+	 */
+	bool CreateSharedMemoryServices(const UScholaManagerSubsystemSettings* Settings);
+
+	/**
+	 * @brief Create the services on the gRPC server run by the communication manager
+	 * @param[in] Settings The settings to read the gRPC options from
+	 */
+	void CreateGrpcServices(const UScholaManagerSubsystemSettings* Settings);
+
 	/** The communication manager that will handle the gRPC server */
 	UPROPERTY()
 	UCommunicationManager* CommunicationManager;
 	//Initialized in Constructor for now
 
+protected:
+	/** The service that will handle the step loop and resets when the step stream is enabled, in place of DecisionRequestService and PostResetStateService */
+	SSSType StepStreamService = nullptr;
+
+	/** The stream message sent each step when the step stream is enabled. Kept between steps like TrainingStateMsg */
+	StepStreamResponse StepStreamMsg;
+
+	/** Should completed environments be reset in the step their terminal state is collected, with their initial states sent in the same message */
+	bool bUseInBandReset = false;
+
+	/** The environments to reset in band for each message waiting on it's resets, keyed by the cohort of the message, or INDEX_NONE for the message sent by SendState */
+	TMap<int, TBitArray<>> PendingInBandResets;
+
+	/** The messages that have been sent, but are held back until the reset phase adds their in band resets. Keyed the same as PendingInBandResets */
+	TArray<int> DeferredSends;
+
+	/**
+	 * @brief Get the state message for a cohort, or the one sent by SendState
+	 * @param[in] Slot The cohort, or INDEX_NONE
+	 * @return The message
+	 */
+	TrainingState& GetStateMsg(int Slot);
+
+	/**
+	 * @brief Add any membership changes to a state message and send it
+	 * @param[in] Slot The cohort of the message, or INDEX_NONE
+	 */
+	void SendStateMsg(int Slot);
+
+	/**
+	 * @brief Record that the completed environments in a state message should be reset in band, once the reset phase comes around. Does nothing unless in band resets are enabled
+	 * @param[in] Slot The cohort of the message, or INDEX_NONE. The message must already hold the terminal states
+	 * @param[in] IncludedEnvs Only reset environments in this mask, or every environment if nullptr
+	 * @return true iff any of the environments have completed, so the message has to wait for their resets
+	 */
+	bool DeferInBandResets(int Slot, const TBitArray<>* IncludedEnvs);
+
+	/**
+	 * @brief Reset the environments recorded for a state message by DeferInBandResets, and add their initial states to it
+	 * @param[in] Slot The cohort of the message, or INDEX_NONE
+	 * @return The environments that were reset
+	 */
+	TArray<int> ApplyInBandResets(int Slot);
+
+	/**
+	 * @brief Tell the client about any agents that joined or left environments since the last message, by adding them to a state message
+	 * @param[in,out] StateMsg The message to add the changes to. Any changes from a previous use of the message are cleared
+	 */
+	void AddMembershipUpdate(TrainingState& StateMsg);
+
+	/**
+	 * @brief Does this connector step environments asynchronously. If so it always uses the step stream and in band resets, and never pipelines
+	 * @return true iff environments are stepped asynchronously
+	 */
+	virtual bool IsAsynchronous() const { return false; };
+
 public:
 	/**
 	 * @brief Create a new UPythonGymConnector
@@ -98,12 +184,16 @@ public:
 
 	/**
 	 * @brief Request a decision from gym using the current state of the agents from environments
-	 * @return A future that will eventually contain decision for all agents in all environments
+	 * @return A future that will eventually contain the decision message for all agents in all environments
 	 * @note This function is asynchronous and will return immediately
 	 */
-	TFuture<FTrainingStateUpdate*> RequestStateUpdate() override;
+	TFuture<const TrainingStateUpdate*> RequestStateUpdate() override;
+	FTrainingStateUpdate*		   DeserializeStateUpdate(const TrainingStateUpdate& Message) override;
 	void						   SendState(const FTrainingState& Value) override;
+	void						   BufferState(const FTrainingState& Value, const TBitArray<>& IncludedEnvs, int Slot) override;
+	void						   SendBufferedState(int Slot) override;
 
+	void						   ResetCompletedEnvironments() override;
 	void						   SubmitPostResetState(const FTrainingState& Value) override;
 	void						   Init(const FSharedTrainingDefinition& AgentDefns) override;
 	void						   Enable() override;
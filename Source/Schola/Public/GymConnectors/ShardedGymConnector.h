@@ -0,0 +1,91 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Event.h"
+#include "./AbstractGymConnector.h"
+#include "./ExternalGymConnector.h"
+#include "ShardedGymConnector.generated.h"
+
+/**
+ * @brief A connector that splits the environments into shards, each served to a separate trainer by its own external gym connector.
+ * Each step only waits until at least one shard has an update, and steps just the shards that do, so trainers run independently of each other.
+ * @note Environments have ids local to their shard, so each trainer sees its shard as a complete set of environments.
+ */
+UCLASS(NotBlueprintable)
+class SCHOLA_API UShardedGymConnector : public UAbstractGymConnector
+{
+	GENERATED_BODY()
+
+private:
+	/** The connectors serving each shard */
+	UPROPERTY()
+	TArray<UExternalGymConnector*> Shards;
+
+	/** The class of connector to create for each shard */
+	UPROPERTY()
+	TSubclassOf<UExternalGymConnector> ShardClass;
+
+	/** The number of shards requested. Limited to the number of environments */
+	int NumShards = 1;
+
+	/** How long to wait for any shard to send an update before assuming they have all failed */
+	int Timeout = 30;
+
+	/** The update message each shard is working on. Invalid if no update has been requested from the shard */
+	TArray<TFuture<const Schola::TrainingStateUpdate*>> PendingUpdates;
+
+	/** The updates resolved this step, or nullptr for shards that aren't being stepped */
+	TArray<FTrainingStateUpdate*> ResolvedUpdates;
+
+	/** The update handed back to the subsystem, which only carries the status of the shards as a whole */
+	FTrainingStateUpdate CombinedUpdate;
+
+	/** Triggered whenever any shard's update arrives. Shared with the continuations, since they can run after we are gone */
+	TSharedRef<FEventRef, ESPMode::ThreadSafe> UpdateEvent = MakeShared<FEventRef, ESPMode::ThreadSafe>();
+
+	/**
+	 * @brief Request an update from every running shard that doesn't already have one pending
+	 */
+	void RequestShardUpdates();
+
+	/**
+	 * @brief Is a shard being stepped this step
+	 * @param[in] Index The index of the shard
+	 * @return true iff the shard resolved an update this step and is still running
+	 */
+	bool IsStepping(int Index) const;
+
+protected:
+	void InitEnvironments() override;
+
+public:
+	/**
+	 * @brief Set how the environments should be sharded. Must be called before Init
+	 * @param[in] InShardClass The class of connector to create for each shard
+	 * @param[in] InNumShards The number of shards to split the environments into
+	 * @param[in] InTimeout How long to wait for an update from any shard, in seconds
+	 */
+	void Configure(TSubclassOf<UExternalGymConnector> InShardClass, int InNumShards, int InTimeout);
+
+	/**
+	 * @brief Get the number of shards the environments were split into
+	 * @return The number of shards
+	 */
+	int GetNumShards() const { return this->Shards.Num(); };
+
+	void				  Enable() override;
+	bool				  CheckForStart() override;
+	FTrainingStateUpdate* ResolveEnvironmentStateUpdate() override;
+	void				  UpdateEnvironments(FTrainingStateUpdate& StateUpdate) override;
+	void				  ResetCompletedEnvironments() override;
+	void				  CollectEnvironmentStates() override;
+	void				  SubmitEnvironmentStates() override;
+
+	/**
+	 * @brief Unused, since each shard submits the post reset states of its own environments
+	 * @param[in] States The states to submit
+	 */
+	void SubmitPostResetState(const FTrainingState& States) override {};
+};
@@ -6,6 +6,7 @@
 #include <Kismet/GameplayStatics.h>
 #include "Common/LogSchola.h"
 #include "./IInferenceAgent.h"
+#include "Subsystem/ScholaRegistrySubsystem.h"
 #include "InferenceController.generated.h"
 
 /**
@@ -103,4 +104,32 @@ public:
 	{
 		Status = NewStatus;
 	}
+
+	// Controllers often begin play before they possess anything, so they are only registered while they have a pawn to control
+	virtual void OnPossess(APawn* InPawn) override
+	{
+		Super::OnPossess(InPawn);
+		if (UScholaRegistrySubsystem* Registry = UScholaRegistrySubsystem::Get(this))
+		{
+			Registry->RegisterInferenceAgent(this);
+		}
+	}
+
+	virtual void OnUnPossess() override
+	{
+		if (UScholaRegistrySubsystem* Registry = UScholaRegistrySubsystem::Get(this))
+		{
+			Registry->DeregisterInferenceAgent(this);
+		}
+		Super::OnUnPossess();
+	}
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override
+	{
+		if (UScholaRegistrySubsystem* Registry = UScholaRegistrySubsystem::Get(this))
+		{
+			Registry->DeregisterInferenceAgent(this);
+		}
+		Super::EndPlay(EndPlayReason);
+	}
 };
\ No newline at end of file
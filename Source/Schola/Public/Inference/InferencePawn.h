@@ -6,6 +6,7 @@
 #include <Kismet/GameplayStatics.h>
 #include "Common/LogSchola.h"
 #include "./IInferenceAgent.h"
+#include "Subsystem/ScholaRegistrySubsystem.h"
 #include "InferencePawn.generated.h"
 
 /**
@@ -81,4 +82,22 @@ public:
 	{
 		Status = NewStatus;
 	}
+
+	virtual void BeginPlay() override
+	{
+		Super::BeginPlay();
+		if (UScholaRegistrySubsystem* Registry = UScholaRegistrySubsystem::Get(this))
+		{
+			Registry->RegisterInferenceAgent(this);
+		}
+	}
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override
+	{
+		if (UScholaRegistrySubsystem* Registry = UScholaRegistrySubsystem::Get(this))
+		{
+			Registry->DeregisterInferenceAgent(this);
+		}
+		Super::EndPlay(EndPlayReason);
+	}
 };
\ No newline at end of file
@@ -109,8 +109,16 @@ public:
 
 	void CollectObservations(TPoint& OutObservations) override
 	{
-		OutObservations.Emplace<FBoxPoint>();
-		this->CollectObservations(OutObservations.Get<FBoxPoint>());
+		// Reuse the existing point where possible so it's storage survives between steps
+		if (!OutObservations.IsType<FBoxPoint>())
+		{
+			OutObservations.Emplace<FBoxPoint>();
+		}
+		FBoxPoint& TypedObservations = OutObservations.Get<FBoxPoint>();
+		TypedObservations.Reset();
+		this->CollectObservations(TypedObservations);
+		// Blueprints can only write to Values, so pick up anything they wrote there
+		TypedObservations.MoveValuesToStorage();
 		#if WITH_EDITOR
 				this->SetDebugObservations(OutObservations);
 		#endif
@@ -184,8 +192,13 @@ public:
 	void CollectObservations(TPoint& OutObservations)
 	{
 		
-		OutObservations.Emplace<FBinaryPoint>();
-		this->CollectObservations(OutObservations.Get<FBinaryPoint>());
+		if (!OutObservations.IsType<FBinaryPoint>())
+		{
+			OutObservations.Emplace<FBinaryPoint>();
+		}
+		FBinaryPoint& TypedObservations = OutObservations.Get<FBinaryPoint>();
+		TypedObservations.Reset();
+		this->CollectObservations(TypedObservations);
 		#if WITH_EDITOR
 			this->SetDebugObservations(OutObservations);
 		#endif
@@ -259,8 +272,13 @@ public:
 
 	void CollectObservations(TPoint& OutObservations)
 	{
-		OutObservations.Emplace<FDiscretePoint>();
-		this->CollectObservations(OutObservations.Get<FDiscretePoint>());
+		if (!OutObservations.IsType<FDiscretePoint>())
+		{
+			OutObservations.Emplace<FDiscretePoint>();
+		}
+		FDiscretePoint& TypedObservations = OutObservations.Get<FDiscretePoint>();
+		TypedObservations.Reset();
+		this->CollectObservations(TypedObservations);
 		#if WITH_EDITOR
 				this->SetDebugObservations(OutObservations);
 		#endif
@@ -29,4 +29,10 @@ public:
 	 * @param[in] PolicyDefinition An object defining the policy's I/O shapes and other parameters
 	 */
 	virtual void Init(const FInteractionDefinition& PolicyDefinition) PURE_VIRTUAL(UAbstractPolicy::Init, return; );
+
+	/**
+	 * @brief Does the policy normalize observations itself (e.g. a whole batch at once), rather than needing them normalized before they are requested on
+	 * @return true iff observations should be handed to the policy as they were collected
+	 */
+	virtual bool NormalizesObservations() const { return false; };
 };
\ No newline at end of file
@@ -0,0 +1,128 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Common/Spaces.h"
+#include "Policies/PolicyDecision.h"
+#include "InferenceBatchSubsystem.generated.h"
+
+class UInferencePolicy;
+class FModelInstancePool;
+class FQueuedThreadPool;
+
+/**
+ * @brief The model shared by every decision request on one pool of model instances.
+ * @note Shared with the tasks running the batches, so that it outlives the subsystem if play ends while a batch is running.
+ */
+struct FInferenceBatchModel
+{
+	/** The instances batches for this model are run on. Batches from consecutive frames can run at once, each on their own instance. Held weakly, so the pool goes away with the last policy using it */
+	TWeakPtr<FModelInstancePool> InstancePool;
+
+	/** The number of values in a flattened observation */
+	int ObservationSize = 0;
+
+	/** The number of values in a flattened action */
+	int ActionSize = 0;
+
+	/**
+	 * @brief Run the model on a batch of observations
+	 * @param[in] Observations The row-major [NumRows, ObservationSize] observations
+	 * @param[out] Actions The row-major [NumRows, ActionSize] actions. Must already be sized
+	 * @param[in] NumRows The number of observations in the batch
+	 * @return true iff the model ran successfully. Fails if every policy using the pool is gone
+	 */
+	bool Run(TArray<float>& Observations, TArray<float>& Actions, int NumRows);
+};
+
+/**
+ * @brief The decision requests gathered for one model during a frame.
+ */
+struct FInferenceBatch
+{
+	/** The model the batch will be run on */
+	TSharedPtr<FInferenceBatchModel> Model;
+
+	/** The observations of every request, one row per request. Observations with an arena only share it, rather than being copied */
+	TArray<FDictPoint> Observations;
+
+	/** The observation space to flatten each row with, in the same order as the rows */
+	TArray<TSharedPtr<const FDictSpace>> ObservationSpaces;
+
+	/** Should each row's continuous observations be normalized once flattened, in the same order as the rows */
+	TArray<bool> NormalizeObservations;
+
+	/** The promises to fulfil with each request's decision, in the same order as the rows */
+	TArray<TSharedPtr<TPromise<FPolicyDecision*>>> Promises;
+
+	/** The action space to unflatten each row's actions into, in the same order as the rows. Policies sharing a pool only have to agree on the size of their spaces, not their layout */
+	TArray<TSharedPtr<const FDictSpace>> ActionSpaces;
+};
+
+/**
+ * @brief A subsystem that gathers the decision requests of inference policies sharing a model, and runs each model once per frame on all of them.
+ * Requests are batched by the pool of instances their policy runs on, which the model registry shares between policies with the same model, runtime and space sizes.
+ * Observations are flattened into one [N, Observations] tensor with FDictSpace::FlattenBatch when the batch runs, and normalized there if their policy asks for it. The [N, Actions] output is clamped to each action space's bounds, and scattered back into one decision per request with FDictSpace::UnflattenBatch.
+ * @note Requests are run when Flush is called, which the manager subsystem does once every inference agent has thought. Anything left over is flushed when this subsystem ticks.
+ * All inference, batched or not, runs on a dedicated pool of threads owned by this subsystem, sized by the inference settings, so that it doesn't compete with the engine's task graph.
+ */
+UCLASS()
+class SCHOLA_API UInferenceBatchSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+	/** The threads inference runs on */
+	FQueuedThreadPool* InferenceThreadPool = nullptr;
+
+	/** The model for each pool of instances. Only the address of the pool is used as the key, so entries are checked against the model's pool before use */
+	TMap<FModelInstancePool*, TSharedPtr<FInferenceBatchModel>> Models;
+
+	/** The requests waiting to be run, for each pool of instances */
+	TMap<FModelInstancePool*, FInferenceBatch> PendingBatches;
+
+	/** Forget every model, and batch, whose pool no policy holds anymore. Requests still waiting in those batches fail */
+	void RemoveExpiredEntries();
+
+	/**
+	 * @brief Get the shared model for a policy, loading it on first use
+	 * @param[in] Policy The policy whose model to get
+	 * @return The shared model, or nullptr if it couldn't be loaded
+	 */
+	TSharedPtr<FInferenceBatchModel> FindOrCreateModel(const UInferencePolicy& Policy);
+
+public:
+	/**
+	 * @brief Add a decision request to the batch for the policy's model
+	 * @param[in] Policy The policy requesting the decision
+	 * @param[in] Observations The observations to decide on. Their arena is shared and anything else is copied, so they can change once this returns
+	 * @return A future that will contain the decision once the batch has been flushed and run
+	 */
+	TFuture<FPolicyDecision*> RequestDecision(const UInferencePolicy& Policy, const FDictPoint& Observations);
+
+	/**
+	 * @brief Run every batch of requests gathered since the last flush, each on a background thread
+	 * @return The number of batches launched
+	 */
+	int Flush();
+
+	/**
+	 * @brief Run a piece of inference work on the inference threads
+	 * @param[in] Work The work to run
+	 * @param[in] OnAbandoned Called instead of the work if the thread pool is shut down before the work starts, to fail anything waiting on it
+	 */
+	void LaunchInference(TUniqueFunction<void()> Work, TUniqueFunction<void()> OnAbandoned);
+
+	/**
+	 * @brief Get the number of decision requests waiting for the next flush
+	 * @return The number of waiting requests
+	 */
+	int GetNumPendingRequests() const;
+
+	virtual void	Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void	Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual void	Deinitialize() override;
+};
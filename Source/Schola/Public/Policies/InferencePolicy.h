@@ -180,6 +180,130 @@ public:
 	};
 };
 
+/**
+ * @brief A model instance checked out of a pool, along with an output buffer that only the request holding it touches
+ */
+struct SCHOLA_API FPooledModelInstance
+{
+	/** The instantiated model */
+	TSharedPtr<IModelInstanceInterface> Instance;
+
+	/** The flattened actions of a single request */
+	TArray<float> ActionBuffer;
+
+	/** The number of rows the input is currently shaped for. 0 until SetBatchSize is first called */
+	int BatchSize = 0;
+
+	/**
+	 * @brief Shape the model's input for a batch of observations, if it isn't already
+	 * @param[in] NumRows The number of observations in the batch. Must be 1 unless the model's leading input dimension is symbolic
+	 * @return true iff the input was shaped successfully
+	 */
+	bool SetBatchSize(int NumRows);
+};
+
+/**
+ * @brief A bounded pool of instances of a model, so requests can run the model concurrently without sharing an instance or buffers.
+ * Instances are created as they are needed, up to a maximum, after which requests wait for an instance to be released.
+ */
+class SCHOLA_API FModelInstancePool
+{
+private:
+	/** The model instances are created from */
+	TSharedPtr<IModelInterface> Model;
+
+	/** The most instances that can be created */
+	int MaxInstances;
+
+	/** The size of the observations the model is run on */
+	int ObservationSize;
+
+	/** The size of each instance's action buffer */
+	int ActionSize;
+
+	/** Does the model's input have a symbolic leading dimension, so it can run a whole batch at once */
+	bool bDynamicBatch = false;
+
+	/** Guards the instances and the free list */
+	FCriticalSection Lock;
+
+	/** Every instance that has been created */
+	TArray<TUniquePtr<FPooledModelInstance>> Instances;
+
+	/** The instances not currently checked out */
+	TArray<FPooledModelInstance*> FreeInstances;
+
+	/** Triggered whenever an instance is released */
+	FEvent* InstanceReleased;
+
+	/**
+	 * @brief Create a new instance and it's buffer. Must be called while holding the lock
+	 * @return The new instance, or nullptr if the model couldn't be instantiated
+	 */
+	FPooledModelInstance* CreateInstance();
+
+public:
+	/**
+	 * @brief Create a pool, along with it's first instance
+	 * @param[in] Model The model to create instances of
+	 * @param[in] MaxInstances The most instances that can be created
+	 * @param[in] ObservationSize The size of a flattened observation
+	 * @param[in] ActionSize The size of a flattened action
+	 */
+	FModelInstancePool(TSharedPtr<IModelInterface> Model, int MaxInstances, int ObservationSize, int ActionSize);
+
+	~FModelInstancePool();
+
+	/**
+	 * @brief Check if the pool's first instance was created successfully
+	 * @return true iff the pool can hand out instances
+	 */
+	bool IsValid() const { return this->Instances.Num() > 0; };
+
+	/**
+	 * @brief Get the model instances are created from
+	 * @return The model
+	 */
+	TSharedPtr<IModelInterface> GetModel() const { return this->Model; };
+
+	/**
+	 * @brief Get the most instances the pool will create
+	 * @return The maximum number of instances
+	 */
+	int GetMaxInstances() const { return this->MaxInstances; };
+
+	/**
+	 * @brief Get the size of the observations the pool's instances are sized for
+	 * @return The size of a flattened observation
+	 */
+	int GetObservationSize() const { return this->ObservationSize; };
+
+	/**
+	 * @brief Get the size of the actions the pool's instances are sized for
+	 * @return The size of a flattened action
+	 */
+	int GetActionSize() const { return this->ActionSize; };
+
+	/**
+	 * @brief Check if the model can run a batch of observations at once
+	 * @return true iff the model's leading input dimension is symbolic
+	 */
+	bool SupportsDynamicBatch() const { return this->bDynamicBatch; };
+
+	/**
+	 * @brief Check out an instance, creating one if none are free, or waiting for one to be released if the pool is full
+	 * @return An instance that only the caller will use until it is released
+	 * @note Blocks, so only call this from a worker thread
+	 */
+	FPooledModelInstance* Acquire();
+
+	/**
+	 * @brief Return an instance to the pool
+	 * @param[in] PooledInstance An instance checked out with Acquire
+	 */
+	void Release(FPooledModelInstance* PooledInstance);
+};
+
 /**
  * @brief Enum for the different types of runtimes
  */
@@ -235,6 +359,47 @@ public:
 	 */
 	IRuntimeInterface* GetRuntime(const FString& SelectedRuntimeName) const;
 
+	/** Should decision requests be batched with those of every other policy using the same model and runtime, and run once per frame. Otherwise each request runs the model on it's own */
+	UPROPERTY(EditAnywhere)
+	bool bBatchRequests = true;
+
+	/**
+	 * @brief Load the model data on the selected runtime
+	 * @return The model, or nullptr if the model data or runtime was invalid
+	 */
+	TSharedPtr<IModelInterface> CreateModel() const;
+
+	/**
+	 * @brief Create a pool of instances of a model, sized for this policy's spaces
+	 * @param[in] Model The model to create instances of
+	 * @return The new pool. Invalid if the model couldn't be instantiated
+	 */
+	TSharedPtr<FModelInstancePool> CreateInstancePool(TSharedPtr<IModelInterface> Model) const;
+
+	/**
+	 * @brief Get the pool of model instances this policy runs on
+	 * @return The pool, or nullptr if the network failed to load
+	 */
+	TSharedPtr<FModelInstancePool> GetInstancePool() const { return this->InstancePool; };
+
+	/**
+	 * @brief Get a copy of the action space that decisions can be unflattened with off the game thread
+	 * @return The shared action space, or nullptr if Init hasn't been called
+	 */
+	TSharedPtr<const FDictSpace> GetSharedActionSpaceDefn() const { return this->SharedActionSpaceDefn; };
+
+	/**
+	 * @brief Get a copy of the observation space that observations can be flattened with off the game thread
+	 * @return The shared observation space, or nullptr if Init hasn't been called
+	 */
+	TSharedPtr<const FDictSpace> GetSharedObservationSpaceDefn() const { return this->SharedObservationSpaceDefn; };
+
+	/**
+	 * @brief Observations are normalized once they are flattened, a whole batch at a time when requests are batched
+	 * @return true iff the policy's definition asked for normalized observations
+	 */
+	virtual bool NormalizesObservations() const override { return this->bNormalizeObservations; };
+
 	/** Variable tracking if the network loaded correctly?*/
 	UPROPERTY(VisibleAnywhere)
 	bool bNetworkLoaded = false;
@@ -243,13 +408,16 @@ public:
 
 	void Init(const FInteractionDefinition& PolicyDefinition);
 
-	UPROPERTY(BlueprintReadOnly, VisibleAnywhere)
-	TArray<float> ActionBuffer;
+private:
+	/** The instances of the model, each with their own buffers, so that overlapping requests don't race */
+	TSharedPtr<FModelInstancePool> InstancePool;
 
-	UPROPERTY(BlueprintReadOnly,VisibleAnywhere)
-	TArray<float> ObservationBuffer;
+	/** A copy of the action space, with it's layout built, that requests running off the game thread unflatten their actions with */
+	TSharedPtr<const FDictSpace> SharedActionSpaceDefn;
 
-private:
-	/** The instantiated model */
-	TSharedPtr<IModelInstanceInterface> ModelInstance;
+	/** A copy of the observation space, with it's layout built, that batched requests are flattened with off the game thread */
+	TSharedPtr<const FDictSpace> SharedObservationSpaceDefn;
+
+	/** Should the continuous observations be normalized after they are flattened. Copied from the policy definition */
+	bool bNormalizeObservations = false;
 };
\ No newline at end of file
@@ -0,0 +1,64 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "NNEModelData.h"
+#include "ModelRegistrySubsystem.generated.h"
+
+class UInferencePolicy;
+class IModelInterface;
+class FModelInstancePool;
+
+/**
+ * @brief A subsystem that loads each model once per game, no matter how many inference policies use it.
+ * Models are cached by (Model Data, Runtime Name) and handed out as shared pointers, so a model is freed once the last policy using it is.
+ * Instance pools are also keyed by the size of the observations and actions, so policies using a model with different spaces share the model but get a pool sized for them.
+ * @note Scoped to the game instance rather than the world, so models stay loaded across level transitions as long as a policy still holds them.
+ */
+UCLASS()
+class SCHOLA_API UModelRegistrySubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+private:
+	/** The loaded models, for each (Model Data, Runtime Name) pair */
+	TMap<TPair<UNNEModelData*, FString>, TWeakPtr<IModelInterface>> Models;
+
+	/** The instance pools, for each (Model Data, Runtime Name, Observation Size, Action Size) */
+	TMap<TTuple<UNNEModelData*, FString, int, int>, TWeakPtr<FModelInstancePool>> InstancePools;
+
+	/** Forget every model and pool that no policy holds anymore */
+	void RemoveExpiredEntries();
+
+public:
+	/**
+	 * @brief Get the registry for the game an object is in
+	 * @param[in] WorldContextObject An object in the world
+	 * @return The registry, or nullptr if the object isn't in a world with a game instance
+	 */
+	static UModelRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * @brief Get the model a policy uses, loading it if no other policy holds it
+	 * @param[in] Policy The policy whose model data and runtime to use
+	 * @return The shared model, or nullptr if it couldn't be loaded
+	 */
+	TSharedPtr<IModelInterface> FindOrCreateModel(const UInferencePolicy& Policy);
+
+	/**
+	 * @brief Get the pool of instances a policy runs on, shared with every other policy using the same model with the same sized spaces. Instances are only created once requests need them
+	 * @param[in] Policy The policy whose model data, runtime and spaces to use
+	 * @return The shared pool, or nullptr if the model couldn't be loaded
+	 */
+	TSharedPtr<FModelInstancePool> FindOrCreateInstancePool(const UInferencePolicy& Policy);
+
+	/**
+	 * @brief Get the number of models currently loaded
+	 * @return The number of models held by at least one policy
+	 */
+	int GetNumLoadedModels() const;
+
+	virtual void Deinitialize() override;
+};
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Environment/AbstractEnvironment.h"
+#include "Environment/EnvironmentSpawner.h"
 #include "Common/LogSchola.h"
 #include "CoreMinimal.h"
 #include "Communicator/CommunicationManager.h"
@@ -10,6 +11,7 @@
 #include "Training/AbstractTrainer.h"
 #include "Inference/IInferenceAgent.h"
 #include "GymConnectors/AbstractGymConnector.h"
+#include "GymConnectors/ShardedGymConnector.h"
 #include <Kismet/GameplayStatics.h>
 #include "Subsystem/SubsystemSettings.h"
 #include "ScholaManagerSubsystem.generated.h"
@@ -26,8 +28,117 @@ private:
 	/** Boolean variable tracking whether the subsystem has finished initializing, this is separate from the play button on the unreal editor */
 	bool bSubsystemPrepared = false;
 	
-	/** Boolean Variable tracking whether the subsystem has completed it's initial reset */
-	bool bFirstStep = true;
+	/** The world is drawn on one in every WorldRenderInterval frames */
+	int WorldRenderInterval = 1;
+
+	/** The time each frame advances the world by, when using a fixed time step */
+	float StepDeltaTime = 0.0f;
+
+	/** How many frames into the current WorldRenderInterval the world is */
+	int FramesSinceRender = 0;
+
+	/** Has rendering of the world been turned off for the current frame */
+	bool bDisabledWorldRendering = false;
+
+	/** The handles for deciding which frames draw the world as each one starts, and for undoing our changes to the engine when the world is torn down */
+	FDelegateHandle WorldTickStartHandle;
+	FDelegateHandle WorldTearDownHandle;
+
+	/** Has the engine's time step been replaced with a fixed one, and what it was before */
+	bool   bOverrodeTimeStep = false;
+	bool   bPreviousUseFixedTimeStep = false;
+	double PreviousFixedDeltaTime = 0.0;
+
+	/**
+	 * @brief Set up the fixed time step and how often the world is drawn from the simulation settings
+	 * @param[in] Settings The settings to read from
+	 */
+	void SetupSimulation(const FSimulationSettings& Settings);
+
+	/**
+	 * @brief Put back the engine's time step and world rendering, and stop watching the world tick. Safe to call more than once
+	 */
+	void RestoreSimulation();
+
+	/**
+	 * @brief Called as the engine starts ticking a world. Only draws the world on the last of every WorldRenderInterval frames
+	 * @param[in] World The world starting to tick
+	 * @param[in] TickType The kind of tick
+	 * @param[in] DeltaSeconds The time the world will be advanced by
+	 */
+	void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	/**
+	 * @brief Called as a world starts being torn down, e.g. when play in editor ends
+	 * @param[in] World The world being torn down
+	 */
+	void OnWorldBeginTearDown(UWorld* World);
+
+	/** Should inference agents be given spread out decision phases as they register */
+	bool bStaggerDecisions = false;
+
+	/** The phase handed to the next inference agent to register */
+	int NextDecisionPhase = 0;
+
+	/** The most inference agents that can request a decision each frame, or 0 for no limit */
+	int MaxDecisionsPerFrame = 0;
+
+	/** The most seconds that can be spent requesting decisions each frame, or 0 for no limit */
+	double MaxDecisionTimePerFrame = 0.0;
+
+	/** The agent to start thinking from next frame. The first agent deferred by the budget, so the same agents aren't deferred every frame */
+	int NextThinkIndex = 0;
+
+	/** The number of decisions deferred by the budget last frame */
+	int NumDeferredDecisions = 0;
+
+	/** The number of decisions requested so far this frame, across all of it's steps */
+	int NumFrameDecisions = 0;
+
+	/** When the time budget for this frame runs out, or 0 if it hasn't started yet */
+	double DecisionDeadline = 0.0;
+
+	/** Has this frame's budget run out. Any agent still to decide this frame is deferred */
+	bool bDecisionBudgetSpent = false;
+
+	/**
+	 * @brief Start a new decision budget. Called at the start of every engine frame
+	 */
+	void ResetDecisionBudget();
+
+	/**
+	 * @brief Set up staggering and budgeting of inference agent decisions from the inference settings
+	 * @param[in] Settings The settings to read from
+	 */
+	void SetupDecisionScheduling(const FInferenceSettings& Settings);
+
+	/** The index of each inference agent in InferenceAgents */
+	TMap<UObject*, int> InferenceAgentIndices;
+
+	/** The handles for following inference agents as they are registered and deregistered */
+	FDelegateHandle AgentRegisteredHandle;
+	FDelegateHandle AgentDeregisteredHandle;
+
+	/**
+	 * @brief Check that an inference agent is set up well enough to be controlled by the subsystem
+	 * @param[in] Object The inference agent to check
+	 * @return true iff the agent has a brain, a policy and a pawn to control
+	 */
+	bool IsValidInferenceAgent(UObject* Object) const;
+
+	/**
+	 * @brief Start controlling an inference agent that registered after the subsystem was prepared
+	 * @param[in] Object The inference agent
+	 * @param[in] Id The agent's id in the registry
+	 */
+	void OnInferenceAgentRegistered(UObject* Object, int Id);
+
+	/**
+	 * @brief Stop controlling an inference agent that deregistered
+	 * @param[in] Object The inference agent
+	 * @param[in] Id The id the agent had in the registry
+	 */
+	void OnInferenceAgentDeregistered(UObject* Object, int Id);
 
 protected:
 public:
@@ -57,13 +168,19 @@ public:
 	 */
 	void RegisterInferenceAgent(UObject* InferenceAgent);
 
+	/**
+	 * @brief Stop the subsystem from controlling an inferencing agent.
+	 * @param[in] InferenceAgent The inference agent to be deregistered.
+	 */
+	void DeregisterInferenceAgent(UObject* InferenceAgent);
+
 	/**
 	 * @brief Prepare the subsystem by doing post BeginPlay setup
 	 */
 	void PrepareSubsystem();
 
 	/**
-	 * @brief Collect all the inferencing agents in the simulation
+	 * @brief Collect all the inferencing agents registered with the world's registry, and follow any that register later
 	 */
 	void CollectInferenceAgents();
 
@@ -76,9 +193,16 @@ public:
 
 	/**
 	 * @brief Collect Observations and start decision making for all the inference agents in the simulation
+	 * @note Agents whose decision step doesn't fit in the frame's decision budget are deferred to their next step, and keep their previous action until then
 	 */
 	void InferenceAgentsThink();
 
+	/**
+	 * @brief Get the number of inference agent decisions that didn't fit in last frame's budget
+	 * @return The number of deferred decisions
+	 */
+	int GetNumDeferredDecisions() const { return this->NumDeferredDecisions; };
+
 	/**
 	 * @brief Initialize the inference agents in the simulation
 	 */
@@ -0,0 +1,213 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ScholaRegistrySubsystem.generated.h"
+
+class AAbstractScholaEnvironment;
+class AAbstractTrainer;
+
+/**
+ * @brief A set of objects, each with a compact integer id.
+ * Adding and removing are constant time, and the ids of removed objects are handed out again before any new ones, so ids stay dense even as objects come and go.
+ * @tparam ObjectType The type of object being registered
+ */
+template <typename ObjectType>
+class TScholaRegistry
+{
+private:
+	/** The registered objects, indexed by id. Ids that are free hold nullptr */
+	TArray<ObjectType*> Slots;
+
+	/** Ids that have been freed, and can be handed out again */
+	TArray<int> FreeIds;
+
+	/** The id of each registered object */
+	TMap<ObjectType*, int> Ids;
+
+public:
+	/**
+	 * @brief Add an object to the registry
+	 * @param[in] Object The object to add
+	 * @return The id of the object. The id it already had if it was registered before
+	 */
+	int Add(ObjectType* Object)
+	{
+		if (const int* ExistingId = this->Ids.Find(Object))
+		{
+			return *ExistingId;
+		}
+
+		int Id;
+		if (this->FreeIds.Num() > 0)
+		{
+			Id = this->FreeIds.Pop(false);
+			this->Slots[Id] = Object;
+		}
+		else
+		{
+			Id = this->Slots.Add(Object);
+		}
+		this->Ids.Add(Object, Id);
+		return Id;
+	}
+
+	/**
+	 * @brief Remove an object from the registry, freeing its id
+	 * @param[in] Object The object to remove
+	 * @return The id the object had, or INDEX_NONE if it wasn't registered
+	 */
+	int Remove(ObjectType* Object)
+	{
+		int Id = INDEX_NONE;
+		if (!this->Ids.RemoveAndCopyValue(Object, Id))
+		{
+			return INDEX_NONE;
+		}
+
+		this->Slots[Id] = nullptr;
+		this->FreeIds.Push(Id);
+		return Id;
+	}
+
+	/**
+	 * @brief Get the id of an object
+	 * @param[in] Object The object to find
+	 * @return The object's id, or INDEX_NONE if it isn't registered
+	 */
+	int Find(ObjectType* Object) const
+	{
+		const int* Id = this->Ids.Find(Object);
+		return Id ? *Id : INDEX_NONE;
+	}
+
+	/**
+	 * @brief Get the object with an id
+	 * @param[in] Id The id of the object
+	 * @return The object, or nullptr if no object has that id
+	 */
+	ObjectType* Get(int Id) const
+	{
+		return this->Slots.IsValidIndex(Id) ? this->Slots[Id] : nullptr;
+	}
+
+	/**
+	 * @brief Get the number of registered objects
+	 * @return The number of registered objects
+	 */
+	int Num() const { return this->Ids.Num(); };
+
+	/**
+	 * @brief Get every registered object
+	 * @param[out] OutObjects The registered objects, in order of id
+	 */
+	void GetAll(TArray<ObjectType*>& OutObjects) const
+	{
+		OutObjects.Reserve(OutObjects.Num() + this->Num());
+		for (ObjectType* Object : this->Slots)
+		{
+			if (Object != nullptr)
+			{
+				OutObjects.Add(Object);
+			}
+		}
+	}
+};
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FScholaRegistryChangedDelegate, UObject* /* Object */, int /* Id */);
+
+/**
+ * @brief A subsystem that keeps track of the environments, trainers and inference agents in the world.
+ * Each of them registers itself when it begins play and deregisters when it ends play, so anything spawned or destroyed during play is tracked without scanning the world.
+ */
+UCLASS()
+class SCHOLA_API UScholaRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+	/** The environments in the world */
+	TScholaRegistry<AAbstractScholaEnvironment> Environments;
+
+	/** The trainers in the world */
+	TScholaRegistry<AAbstractTrainer> Trainers;
+
+	/** The inference agents in the world. Held as UObjects since inference agents are any object implementing IInferenceAgent */
+	TScholaRegistry<UObject> InferenceAgents;
+
+public:
+	/** Broadcast whenever an environment is registered or deregistered */
+	FScholaRegistryChangedDelegate OnEnvironmentRegistered;
+	FScholaRegistryChangedDelegate OnEnvironmentDeregistered;
+
+	/** Broadcast whenever a trainer is registered or deregistered */
+	FScholaRegistryChangedDelegate OnTrainerRegistered;
+	FScholaRegistryChangedDelegate OnTrainerDeregistered;
+
+	/** Broadcast whenever an inference agent is registered or deregistered */
+	FScholaRegistryChangedDelegate OnInferenceAgentRegistered;
+	FScholaRegistryChangedDelegate OnInferenceAgentDeregistered;
+
+	/**
+	 * @brief Get the registry for the world an object is in
+	 * @param[in] WorldContextObject An object in the world
+	 * @return The registry, or nullptr if the object isn't in a world
+	 */
+	static UScholaRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * @brief Register an environment
+	 * @param[in] Environment The environment to register
+	 */
+	void RegisterEnvironment(AAbstractScholaEnvironment* Environment);
+
+	/**
+	 * @brief Deregister an environment, freeing its id
+	 * @param[in] Environment The environment to deregister
+	 */
+	void DeregisterEnvironment(AAbstractScholaEnvironment* Environment);
+
+	/**
+	 * @brief Register a trainer
+	 * @param[in] Trainer The trainer to register
+	 */
+	void RegisterTrainer(AAbstractTrainer* Trainer);
+
+	/**
+	 * @brief Deregister a trainer, freeing its id
+	 * @param[in] Trainer The trainer to deregister
+	 */
+	void DeregisterTrainer(AAbstractTrainer* Trainer);
+
+	/**
+	 * @brief Register an inference agent
+	 * @param[in] InferenceAgent The inference agent to register. Must implement IInferenceAgent
+	 */
+	void RegisterInferenceAgent(UObject* InferenceAgent);
+
+	/**
+	 * @brief Deregister an inference agent, freeing its id
+	 * @param[in] InferenceAgent The inference agent to deregister
+	 */
+	void DeregisterInferenceAgent(UObject* InferenceAgent);
+
+	/**
+	 * @brief Get the registered environments
+	 * @return The registry of environments
+	 */
+	const TScholaRegistry<AAbstractScholaEnvironment>& GetEnvironments() const { return this->Environments; };
+
+	/**
+	 * @brief Get the registered trainers
+	 * @return The registry of trainers
+	 */
+	const TScholaRegistry<AAbstractTrainer>& GetTrainers() const { return this->Trainers; };
+
+	/**
+	 * @brief Get the registered inference agents
+	 * @return The registry of inference agents
+	 */
+	const TScholaRegistry<UObject>& GetInferenceAgents() const { return this->InferenceAgents; };
+};
@@ -143,6 +143,111 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(ClampMin=1), Category = "Communicator Settings")
 	int Timeout = 30;
 
+	/** Exchange states and actions as one dense array per group of agents with identical definitions, instead of one message per agent */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Communicator Settings")
+	bool bUseDenseStateFormat = false;
+
+	/** Run the step loop and resets over one bidirectional stream held open by the client, instead of a unary call per step */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Communicator Settings")
+	bool bUseStepStream = false;
+
+	/** If set, talk to a client on the same machine through the shared memory block with this name instead of gRPC. Can be overridden with -ScholaSharedMemory=<Name> */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Communicator Settings")
+	FString SharedMemoryName = TEXT("");
+
+	/** The size of each direction of the shared memory transport in KB. Must fit the largest state or action message */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(ClampMin=64), Category = "Communicator Settings")
+	int SharedMemoryRingSizeKB = 16384;
+
+	/** Reset environments as soon as they complete, and send their initial states along with the terminal state of that step, instead of waiting for the client to request them */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Communicator Settings")
+	bool bUseInBandReset = false;
+
+	/** Split the environments into this many cohorts, and answer each update with the state of the next cohort while the current one is simulated. Trades a step of action delay for overlapping simulation with the policy. Needs a trainer that accepts states for a subset of environments, such as RLlib */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(ClampMin=1), Category = "Communicator Settings")
+	int NumPipelineCohorts = 1;
+
+	/** Take each action for this many frames before sending the next state, summing the rewards in between. The state is sent early if any agent finishes */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(ClampMin=1), Category = "Communicator Settings")
+	int ActionRepeat = 1;
+
+	/** Split the environments into this many shards, each served to its own trainer on Port + its index, or on SharedMemoryName_<index>. Can be overridden with -ScholaShards=<Count> */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta=(ClampMin=1), Category = "Communicator Settings")
+	int NumShards = 1;
+
+	/**
+	 * @brief Get the name of the shared memory block to talk to a client through, with the command line override applied
+	 * @param[in] ShardIndex The shard the block is for, or INDEX_NONE if the environments aren't sharded
+	 * @return The name, suffixed with _<ShardIndex> for a shard, or an empty string if shared memory isn't used
+	 */
+	FString GetSharedMemoryName(int ShardIndex = INDEX_NONE) const;
+};
+
+/**
+ * @brief A struct to hold settings relating to how the world is advanced while training
+ */
+USTRUCT(BlueprintType)
+struct SCHOLA_API FSimulationSettings
+{
+	GENERATED_BODY()
+
+public:
+	/** Advance the world by FixedDeltaTime each step, instead of by however long the last frame took. Always on if WorldRenderInterval is more than 1 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Simulation Settings")
+	bool bUseFixedTimeStep = false;
+
+	/** The time each step advances the world by when using a fixed time step */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = 0.0001, Units = "s"), Category = "Simulation Settings")
+	float FixedDeltaTime = 1.0f / 60.0f;
+
+	/**
+	 * Only draw the world on one in every WorldRenderInterval frames, to save the time spent drawing it while training. Every step is still a full engine frame,
+	 * so the UI, presenting, vsync and frame rate caps still run each step. Has no effect without a viewport, e.g. when running headless. Can be overridden with -ScholaWorldRenderInterval=<Count>
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = 1), Category = "Simulation Settings")
+	int WorldRenderInterval = 1;
+};
+
+/**
+ * @brief A struct to hold settings relating to how inference policies run their models
+ */
+USTRUCT(BlueprintType)
+struct SCHOLA_API FInferenceSettings
+{
+	GENERATED_BODY()
+
+public:
+	/** The number of threads that run inference. 0 uses one per core, leaving the rest of the engine's worker threads free. Can be overridden with -ScholaInferenceThreads=<Count> */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = 0), Category = "Inference Settings")
+	int NumInferenceThreads = 0;
+
+	/** The most instances of each model that can run at once, each with it's own input and output buffers. 0 creates up to one per inference thread */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = 0), Category = "Inference Settings")
+	int MaxInstancesPerModel = 0;
+
+	/** Spread the decision steps of inference agents across their decision period, so they don't all request decisions on the same step. Changes which steps each agent decides on */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Inference Settings")
+	bool bStaggerDecisions = false;
+
+	/** The most inference agents that can request a decision each frame, counting every step simulated in the frame. Agents over the budget keep their previous action and request on the next step instead. 0 is unlimited */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = 0), Category = "Inference Settings")
+	int MaxDecisionsPerFrame = 0;
+
+	/** The most time that can be spent gathering observations and requesting decisions each frame, counting every step simulated in the frame. Agents over the budget keep their previous action and request on the next step instead. 0 is unlimited */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = 0.0, Units = "ms"), Category = "Inference Settings")
+	float MaxDecisionTimePerFrame = 0.0f;
+
+	/**
+	 * @brief Get the number of inference threads to create
+	 * @return The number of threads, at least 1
+	 */
+	int GetNumInferenceThreads() const;
+
+	/**
+	 * @brief Get the most instances of a model that can be created
+	 * @return The number of instances, at least 1
+	 */
+	int GetMaxInstancesPerModel() const;
 };
 
 /**
@@ -870,5 +975,18 @@ public:
 	UPROPERTY(Config, EditAnywhere, meta = (ShowOnlyInnerProperties), Category = "Communicator Settings")
 	FCommunicatorSettings CommunicatorSettings;
 
-	FLaunchableScript GetScript() const;
+	/** The settings for advancing the world while training */
+	UPROPERTY(Config, EditAnywhere, meta = (ShowOnlyInnerProperties), Category = "Simulation Settings")
+	FSimulationSettings SimulationSettings;
+
+	/** The settings for running inference policies */
+	UPROPERTY(Config, EditAnywhere, meta = (ShowOnlyInnerProperties), Category = "Inference Settings")
+	FInferenceSettings InferenceSettings;
+
+	/**
+	 * @brief Get the training script to launch
+	 * @param[in] ShardIndex The shard to launch a trainer for, or INDEX_NONE if the environments aren't sharded. Picks the shard's port and shared memory block
+	 * @return The script, with the training arguments appended
+	 */
+	FLaunchableScript GetScript(int ShardIndex = INDEX_NONE) const;
 };
@@ -22,6 +22,8 @@
 #include "Agent/AgentComponents/ActuatorComponent.h"
 #include "AbstractTrainer.generated.h"
 
+class AAbstractScholaEnvironment;
+
 /**
  * @brief An abstract class representing a controller that trains an NPC using Reinforcement Learning.
  * @note This class is designed to be subclassed in C++ or Blueprint to implement the specific training logic for an NPC.
@@ -87,6 +89,10 @@ public:
 	UPROPERTY()
 	FTrainerDefinition TrainerDefn;
 
+	/** The environment this agent is in, or nullptr if it isn't in one. Set by the environment */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Reinforcement Learning")
+	AAbstractScholaEnvironment* Environment = nullptr;
+
 	/**
 	 * @brief Initialize this agent after play has begun.
 	 * @param[in] EnvId The ID of the environment this agent is in.
@@ -194,9 +200,10 @@ public:
 
 	/**
 	 * @brief Update the state of the agent. This checks if the agent is done, what it's reward should be and does any observation collection before requesting a decision
+	 * @param[in] bAccumulateReward Add the reward to the one from the previous think instead of replacing it, for when several steps are taken between states being sent
 	 * @return The state of the agent after the update
 	 */
-	FTrainerState Think();
+	FTrainerState Think(bool bAccumulateReward = false);
 
 	/**
 	 * @brief Check with brain if can act and set agent state accordingly
@@ -204,6 +211,26 @@ public:
 	 */
 	bool IsRunning();
 
+	/**
+	 * @brief Register this trainer with the world's registry.
+	 */
+	virtual void BeginPlay() override;
+
+	/**
+	 * @brief Deregister this trainer from the world's registry.
+	 * @param[in] EndPlayReason Why play ended for this trainer
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/**
+	 * @brief Leave the environment this agent is in, since it has nothing to act through without a pawn.
+	 */
+	virtual void OnUnPossess() override;
+
+private:
+	/** The number of observers and actuators set on the trainer itself, before Initialize adds those found on components. INDEX_NONE until the first Initialize */
+	int NumConfiguredObservers = INDEX_NONE;
+	int NumConfiguredActuators = INDEX_NONE;
 };
 
 /**
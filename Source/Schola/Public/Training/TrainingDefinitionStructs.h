@@ -167,6 +167,79 @@ struct SCHOLA_API FSharedEnvironmentDefinition
 		this->AgentDefinitions.Add(Key, SharedDefnPointer);
 	}
 
+	/**
+	 * @brief Remove a shared agent definition from the shared environment definition
+	 * @param[in] Key The key the agent definition was added under
+	 */
+	void RemoveSharedAgentDefn(int Key)
+	{
+		this->AgentDefinitions.Remove(Key);
+	}
+
+};
+
+/**
+ * @brief A group of agents with identical observation and action spaces, whose states and actions are exchanged as dense [NumAgents, Dimensions] arrays.
+ */
+struct SCHOLA_API FDenseAgentGroup
+{
+	/** The index of this group in the training definition */
+	int GroupId = 0;
+
+	/** The definition shared by every agent in the group, taken from one of it's members. nullptr once every member has left */
+	const FInteractionDefinition* PolicyDefinition = nullptr;
+
+	/** The agents in this group */
+	TArray<FAgentId> Members;
+
+	/**
+	 * @brief Get the number of values in a packed observation of an agent in this group
+	 * @return The number of observation dimensions
+	 */
+	int GetObsDimensions() const
+	{
+		return this->PolicyDefinition->ObsSpaceDefn.GetLayout()->TotalDimensions;
+	}
+
+	/**
+	 * @brief Get the number of values in a packed action of an agent in this group
+	 * @return The number of action dimensions
+	 */
+	int GetActionDimensions() const
+	{
+		return this->PolicyDefinition->ActionSpaceDefn.GetLayout()->TotalDimensions;
+	}
+
+	/**
+	 * @brief Fill a protobuf message (Schola::DenseGroupDefinition) with the contents of this object
+	 * @param[out] Msg The protobuf message to fill
+	 */
+	void ToProtobuf(Schola::DenseGroupDefinition* Msg) const
+	{
+		Msg->set_group_id(this->GroupId);
+		if (this->PolicyDefinition != nullptr)
+		{
+			Msg->set_obs_dim(this->GetObsDimensions());
+			Msg->set_action_dim(this->GetActionDimensions());
+		}
+		for (const FAgentId& Member : this->Members)
+		{
+			Msg->add_env_ids(Member.EnvId);
+			Msg->add_agent_ids(Member.AgentId);
+		}
+	}
+};
+
+/**
+ * @brief The agents that have joined or left an environment since the client was last told about it
+ */
+struct SCHOLA_API FEnvironmentMembershipChanges
+{
+	/** Agents that have joined, and whose definitions the client doesn't have yet */
+	TSet<int> Added;
+
+	/** Agents that have left, that the client still knows about */
+	TSet<int> Removed;
 };
 
 /**
@@ -180,6 +253,206 @@ struct SCHOLA_API FSharedTrainingDefinition
 	UPROPERTY()
 	TArray<FSharedEnvironmentDefinition> EnvironmentDefinitions;
 
+	/** Groups of agents with identical definitions. Empty unless BuildDenseGroups has been called */
+	TArray<FDenseAgentGroup> DenseGroups;
+
+	/** The serialized definition shared by the agents in each dense group, indexed by group id */
+	TArray<std::string> DenseGroupKeys;
+
+	/** Agents that have joined or left each environment since the last call to FillMembershipUpdate, by environment id */
+	TSortedMap<int, FEnvironmentMembershipChanges> MembershipChanges;
+
+	/** The ids of dense groups whose members have changed since the last call to FillMembershipUpdate */
+	TSet<int> ChangedDenseGroups;
+
+	/**
+	 * @brief Get the key that agents with identical definitions share
+	 * @param[in] AgentDefn The definition of the agent
+	 * @return The protobuf form of the agent's definition, without it's name
+	 */
+	static std::string GetDenseGroupKey(const FTrainerDefinition& AgentDefn)
+	{
+		Schola::AgentDefinition AgentDefnMessage;
+		AgentDefn.ToProtobuf(&AgentDefnMessage);
+		AgentDefnMessage.clear_name();
+		return AgentDefnMessage.SerializeAsString();
+	}
+
+	/**
+	 * @brief Add an agent to the dense group for it's definition, creating the group if there isn't one yet
+	 * @param[in] EnvId The id of the environment the agent is in
+	 * @param[in] AgentId The id of the agent in it's environment
+	 * @param[in] AgentDefn The definition of the agent
+	 * @return The id of the group the agent was added to
+	 */
+	int AddToDenseGroup(int EnvId, int AgentId, const FTrainerDefinition& AgentDefn)
+	{
+		const std::string Key = GetDenseGroupKey(AgentDefn);
+		int				  GroupIndex = this->DenseGroupKeys.IndexOfByKey(Key);
+		if (GroupIndex == INDEX_NONE)
+		{
+			GroupIndex = this->DenseGroupKeys.Add(Key);
+			FDenseAgentGroup& NewGroup = this->DenseGroups.AddDefaulted_GetRef();
+			NewGroup.GroupId = GroupIndex;
+		}
+
+		FDenseAgentGroup& Group = this->DenseGroups[GroupIndex];
+		if (Group.PolicyDefinition == nullptr)
+		{
+			Group.PolicyDefinition = AgentDefn.PolicyDefinition;
+		}
+		Group.Members.Emplace(AgentId, EnvId);
+		return GroupIndex;
+	}
+
+	/**
+	 * @brief Remove an agent from whichever dense group it is in. Groups are kept when their last member leaves, so group ids stay stable
+	 * @param[in] EnvId The id of the environment the agent is in
+	 * @param[in] AgentId The id of the agent in it's environment
+	 * @return The id of the group the agent was removed from, or INDEX_NONE if it wasn't in one
+	 */
+	int RemoveFromDenseGroup(int EnvId, int AgentId)
+	{
+		const FTrainerDefinition* const* LeavingDefn = this->EnvironmentDefinitions[EnvId].AgentDefinitions.Find(AgentId);
+
+		for (FDenseAgentGroup& Group : this->DenseGroups)
+		{
+			const int MemberIndex = Group.Members.IndexOfByPredicate([EnvId, AgentId](const FAgentId& Member) { return Member.EnvId == EnvId && Member.AgentId == AgentId; });
+			if (MemberIndex == INDEX_NONE)
+			{
+				continue;
+			}
+			Group.Members.RemoveAt(MemberIndex);
+
+			// The group's definition lives in one of it's members, so borrow another member's once that one leaves
+			if (LeavingDefn != nullptr && Group.PolicyDefinition == (*LeavingDefn)->PolicyDefinition)
+			{
+				Group.PolicyDefinition = nullptr;
+				for (const FAgentId& Member : Group.Members)
+				{
+					if (const FTrainerDefinition* const* MemberDefn = this->EnvironmentDefinitions[Member.EnvId].AgentDefinitions.Find(Member.AgentId))
+					{
+						Group.PolicyDefinition = (*MemberDefn)->PolicyDefinition;
+						break;
+					}
+				}
+			}
+			return Group.GroupId;
+		}
+		return INDEX_NONE;
+	}
+
+	/**
+	 * @brief Group every agent in the training session with the other agents that have an identical definition
+	 * @note Agents are compared by the protobuf form of their spaces and normalization settings, so separately configured but identical policies share a group
+	 */
+	void BuildDenseGroups()
+	{
+		this->DenseGroups.Reset();
+		this->DenseGroupKeys.Reset();
+
+		for (int EnvId = 0; EnvId < this->EnvironmentDefinitions.Num(); EnvId++)
+		{
+			for (const TTuple<int, FTrainerDefinition*>& IdToAgentDefn : this->EnvironmentDefinitions[EnvId].AgentDefinitions)
+			{
+				this->AddToDenseGroup(EnvId, IdToAgentDefn.Key, *IdToAgentDefn.Value);
+			}
+		}
+	}
+
+	/**
+	 * @brief Add an agent that has joined an environment after the training session was defined
+	 * @param[in] EnvId The id of the environment the agent joined
+	 * @param[in] AgentId The id of the agent in it's environment
+	 * @param[in] SharedDefnPointer The definition of the agent
+	 */
+	void AddAgent(int EnvId, int AgentId, FTrainerDefinition* SharedDefnPointer)
+	{
+		this->EnvironmentDefinitions[EnvId].AddSharedAgentDefn(AgentId, SharedDefnPointer);
+		if (this->DenseGroupKeys.Num() > 0)
+		{
+			this->ChangedDenseGroups.Add(this->AddToDenseGroup(EnvId, AgentId, *SharedDefnPointer));
+		}
+
+		FEnvironmentMembershipChanges& Changes = this->MembershipChanges.FindOrAdd(EnvId);
+		Changes.Added.Add(AgentId);
+	}
+
+	/**
+	 * @brief Remove an agent that has left an environment
+	 * @param[in] EnvId The id of the environment the agent left
+	 * @param[in] AgentId The id the agent had in it's environment
+	 */
+	void RemoveAgent(int EnvId, int AgentId)
+	{
+		if (this->DenseGroupKeys.Num() > 0)
+		{
+			const int GroupId = this->RemoveFromDenseGroup(EnvId, AgentId);
+			if (GroupId != INDEX_NONE)
+			{
+				this->ChangedDenseGroups.Add(GroupId);
+			}
+		}
+		this->EnvironmentDefinitions[EnvId].RemoveSharedAgentDefn(AgentId);
+
+		// An agent that leaves before the client heard that it joined was never seen by the client at all.
+		// Otherwise the client is told it left, even if it's slot has since been reused by an agent that joined after it
+		FEnvironmentMembershipChanges& Changes = this->MembershipChanges.FindOrAdd(EnvId);
+		if (Changes.Added.Remove(AgentId) == 0)
+		{
+			Changes.Removed.Add(AgentId);
+		}
+	}
+
+	/**
+	 * @brief Check if any agents have joined or left since the client was last told
+	 * @return true iff there are changes the client hasn't been sent
+	 */
+	bool HasMembershipChanges() const
+	{
+		return this->MembershipChanges.Num() > 0;
+	}
+
+	/**
+	 * @brief Forget every change in membership, e.g. once the whole definition has been sent to the client
+	 */
+	void ClearMembershipChanges()
+	{
+		this->MembershipChanges.Reset();
+		this->ChangedDenseGroups.Reset();
+	}
+
+	/**
+	 * @brief Fill a protobuf message (Schola::MembershipUpdate) with the agents that have joined or left since the last call, and then forget them
+	 * @param[out] Msg The protobuf message to fill
+	 * @note Removals are applied before additions by the client, so a slot that was freed and then reused appears in both
+	 */
+	void FillMembershipUpdate(Schola::MembershipUpdate* Msg)
+	{
+		for (const TTuple<int, FEnvironmentMembershipChanges>& EnvChanges : this->MembershipChanges)
+		{
+			Schola::EnvironmentMembershipUpdate& EnvMsg = (*Msg->mutable_environments())[EnvChanges.Key];
+			for (int AgentId : EnvChanges.Value.Removed)
+			{
+				EnvMsg.add_removed_agents(AgentId);
+			}
+			for (int AgentId : EnvChanges.Value.Added)
+			{
+				if (FTrainerDefinition* const* AgentDefn = this->EnvironmentDefinitions[EnvChanges.Key].AgentDefinitions.Find(AgentId))
+				{
+					(*AgentDefn)->ToProtobuf(&(*EnvMsg.mutable_added_agents())[AgentId]);
+				}
+			}
+		}
+
+		for (int GroupId : this->ChangedDenseGroups)
+		{
+			this->DenseGroups[GroupId].ToProtobuf(Msg->add_dense_groups());
+		}
+
+		this->ClearMembershipChanges();
+	}
+
 	/**
 	 * @brief Fill a protobuf message (Schola::TrainingDefinition) with the contents of this object
 	 * @return A new protobuf message containing the contents of this object
@@ -193,6 +466,11 @@ struct SCHOLA_API FSharedTrainingDefinition
 			EnvDefn.ToProtobuf(EnvDefnMessage);
 		}
 
+		for (const FDenseAgentGroup& Group : this->DenseGroups)
+		{
+			Group.ToProtobuf(Msg->add_dense_groups());
+		}
+
 		return Msg;
 	}
 };
\ No newline at end of file
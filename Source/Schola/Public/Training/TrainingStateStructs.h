@@ -10,6 +10,7 @@ THIRD_PARTY_INCLUDES_START
 #include "../Generated/GymConnector.pb.h"
 THIRD_PARTY_INCLUDES_END
 #include "Communicator/ProtobufSerializer.h"
+#include "Training/TrainingDefinitionStructs.h"
 #include "TrainingStateStructs.generated.h"
 
 /**
@@ -69,26 +70,32 @@ struct FTrainerState
 		ProtobufSerializer Serializer = ProtobufSerializer(OutState.mutable_observations());
 
 		Observations->Accept(Serializer);
-		
+		Serializer.Truncate();
+
+		OutState.mutable_info()->clear();
 		for (auto& InfoEntry : this->Info)
 		{
 			(*OutState.mutable_info())[TCHAR_TO_UTF8(*InfoEntry.Key)] = TCHAR_TO_UTF8(*InfoEntry.Value);
 		}
 
 		OutState.set_reward(this->Reward);
+		OutState.set_status(this->GetProtoStatus());
+	}
 
-		// convert from Unreal visible enum to gRPC enum
+	/**
+	 * @brief Convert the training status of the agent from the Unreal visible enum to the gRPC enum
+	 * @return The status as a protobuf enum
+	 */
+	Schola::Status GetProtoStatus() const
+	{
 		switch (this->TrainingStatus)
 		{
-			case EAgentTrainingStatus::Running:
-				OutState.set_status(Schola::RUNNING);
-				break;
 			case EAgentTrainingStatus::Completed:
-				OutState.set_status(Schola::COMPLETED);
-				break;
+				return Schola::COMPLETED;
 			case EAgentTrainingStatus::Truncated:
-				OutState.set_status(Schola::TRUNCATED);
-				break;
+				return Schola::TRUNCATED;
+			default:
+				return Schola::RUNNING;
 		}
 	}
 
@@ -166,26 +173,87 @@ struct FSharedEnvironmentState
 		this->AgentStates.Add(AgentId, SharedStatePointer);
 	}
 
+	/**
+	 * @brief Remove a shared agent state from the shared environment state, e.g. when it's agent leaves the environment
+	 * @param[in] AgentId The key the agent state was added under
+	 */
+	void RemoveSharedAgentState(int AgentId)
+	{
+		this->AgentStates.Remove(AgentId);
+	}
+
 	/**
 	 * @brief Fill a protobuf message (Schola::EnvironmentState) with the contents of this object
 	 * @param[out] OutMsg A reference to the protobuf message to fill
 	 */
 	void ToProto(Schola::EnvironmentState& OutMsg) const
 	{
+		auto& AgentStatesMsg = *OutMsg.mutable_agent_states();
+
+		// The message may be reused from a previous step, so drop entries for agents that are no longer in this environment
+		for (auto It = AgentStatesMsg.begin(); It != AgentStatesMsg.end();)
+		{
+			if (!AgentStates.Contains(It->first))
+			{
+				It = AgentStatesMsg.erase(It);
+			}
+			else
+			{
+				++It;
+			}
+		}
 
 		for (const TPair<int, FTrainerState*>& IdToSharedState : AgentStates)
 		{
 
 			if (IdToSharedState.Value->TrainingMsgStatus == ETrainingMsgStatus::LastMsgSent)
 			{
+				AgentStatesMsg.erase(IdToSharedState.Key);
 				continue;
 			}
 
-			Schola::AgentState& AgentStateMsg = (*OutMsg.mutable_agent_states())[IdToSharedState.Key];
+			Schola::AgentState& AgentStateMsg = AgentStatesMsg[IdToSharedState.Key];
 			IdToSharedState.Value->ToProto(AgentStateMsg);
 		}
 	}
 
+	/**
+	 * @brief Fill a protobuf message (Schola::EnvironmentState) with only the infos of each agent, for use alongside dense group states
+	 * @param[out] OutMsg A reference to the protobuf message to fill
+	 * @note Agents with no info are left out entirely, since their observations, rewards and statuses are sent in the dense groups
+	 */
+	void ToInfoProto(Schola::EnvironmentState& OutMsg) const
+	{
+		auto& AgentStatesMsg = *OutMsg.mutable_agent_states();
+		for (auto It = AgentStatesMsg.begin(); It != AgentStatesMsg.end();)
+		{
+			FTrainerState* const* AgentState = AgentStates.Find(It->first);
+			if (!AgentState || (*AgentState)->Info.Num() == 0 || (*AgentState)->TrainingMsgStatus == ETrainingMsgStatus::LastMsgSent)
+			{
+				It = AgentStatesMsg.erase(It);
+			}
+			else
+			{
+				++It;
+			}
+		}
+
+		for (const TPair<int, FTrainerState*>& IdToSharedState : AgentStates)
+		{
+			if (IdToSharedState.Value->Info.Num() == 0 || IdToSharedState.Value->TrainingMsgStatus == ETrainingMsgStatus::LastMsgSent)
+			{
+				continue;
+			}
+
+			auto& InfoMsg = *AgentStatesMsg[IdToSharedState.Key].mutable_info();
+			InfoMsg.clear();
+			for (auto& InfoEntry : IdToSharedState.Value->Info)
+			{
+				InfoMsg[TCHAR_TO_UTF8(*InfoEntry.Key)] = TCHAR_TO_UTF8(*InfoEntry.Value);
+			}
+		}
+	}
+
 	/**
 	 * @brief Fill a protobuf message (Schola::EnvironmentState) with the contents of this object
 	 * @param[out] OutMsg A pointer to the protobuf message to fill
@@ -239,13 +307,136 @@ struct FTrainingState
 	Schola::TrainingState* ToProto() const
 	{
 		Schola::TrainingState* TrainingStateMessage = new Schola::TrainingState();
-		for (const FSharedEnvironmentState& EnvState : EnvironmentStates)
+		this->ToProto(*TrainingStateMessage);
+		return TrainingStateMessage;
+	}
+
+	/**
+	 * @brief Check if an environment should be written to a message
+	 * @param[in] EnvId The id of the environment
+	 * @param[in] IncludedEnvs A mask of the environments to write, or nullptr to write all of them
+	 * @return true iff the environment is in the mask
+	 */
+	static bool IsIncluded(int EnvId, const TBitArray<>* IncludedEnvs)
+	{
+		return IncludedEnvs == nullptr || (*IncludedEnvs)[EnvId];
+	}
+
+	/**
+	 * @brief Fill a protobuf message (Schola::TrainingState) with the contents of this object, reusing any nested messages it already holds
+	 * @param[in,out] OutMsg The protobuf message to fill. Can be a message filled on a previous step, so that it's allocations are reused
+	 * @param[in] IncludedEnvs A mask of the environments to write, or nullptr to write all of them. Environments outside the mask are left with no agents, so ids still line up with positions
+	 */
+	void ToProto(Schola::TrainingState& OutMsg, const TBitArray<>* IncludedEnvs = nullptr) const
+	{
+		while (OutMsg.environment_states_size() > EnvironmentStates.Num())
 		{
-			// Fill the mappings
-			EnvState.ToProto((*TrainingStateMessage->add_environment_states()));
+			OutMsg.mutable_environment_states()->RemoveLast();
 		}
 
-		return TrainingStateMessage;
+		for (int i = 0; i < EnvironmentStates.Num(); i++)
+		{
+			Schola::EnvironmentState* EnvStateMsg = i < OutMsg.environment_states_size() ? OutMsg.mutable_environment_states(i) : OutMsg.add_environment_states();
+			if (IsIncluded(i, IncludedEnvs))
+			{
+				EnvironmentStates[i].ToProto(*EnvStateMsg);
+			}
+			else
+			{
+				EnvStateMsg->mutable_agent_states()->clear();
+			}
+		}
+	}
+
+	/**
+	 * @brief Fill a protobuf message (Schola::TrainingState) with one dense block of observations, rewards and statuses per group of agents
+	 * @param[in,out] OutMsg The protobuf message to fill. Can be a message filled on a previous step, so that it's allocations are reused
+	 * @param[in] Groups The groups of agents with identical definitions to pack together
+	 * @param[in] IncludedEnvs A mask of the environments to write, or nullptr to write all of them
+	 */
+	void ToDenseProto(Schola::TrainingState& OutMsg, TArrayView<const FDenseAgentGroup> Groups, const TBitArray<>* IncludedEnvs = nullptr) const
+	{
+		while (OutMsg.environment_states_size() > EnvironmentStates.Num())
+		{
+			OutMsg.mutable_environment_states()->RemoveLast();
+		}
+
+		for (int i = 0; i < EnvironmentStates.Num(); i++)
+		{
+			Schola::EnvironmentState* EnvStateMsg = i < OutMsg.environment_states_size() ? OutMsg.mutable_environment_states(i) : OutMsg.add_environment_states();
+			if (IsIncluded(i, IncludedEnvs))
+			{
+				EnvironmentStates[i].ToInfoProto(*EnvStateMsg);
+			}
+			else
+			{
+				EnvStateMsg->mutable_agent_states()->clear();
+			}
+		}
+
+		while (OutMsg.dense_groups_size() > Groups.Num())
+		{
+			OutMsg.mutable_dense_groups()->RemoveLast();
+		}
+
+		for (int GroupIndex = 0; GroupIndex < Groups.Num(); GroupIndex++)
+		{
+			const FDenseAgentGroup&	 Group = Groups[GroupIndex];
+			Schola::DenseGroupState* GroupMsg = GroupIndex < OutMsg.dense_groups_size() ? OutMsg.mutable_dense_groups(GroupIndex) : OutMsg.add_dense_groups();
+			GroupMsg->set_group_id(Group.GroupId);
+			GroupMsg->clear_env_ids();
+			GroupMsg->clear_agent_ids();
+
+			// Every member of this group has left, so there is nothing to pack
+			if (Group.PolicyDefinition == nullptr)
+			{
+				GroupMsg->clear_observations();
+				GroupMsg->clear_rewards();
+				GroupMsg->clear_statuses();
+				continue;
+			}
+
+			const FDictSpace& ObsSpace = Group.PolicyDefinition->ObsSpaceDefn;
+			const int		  ObsDims = Group.GetObsDimensions();
+
+			// Size every blob for the whole group up front, and trim to the number of agents actually written afterwards
+			std::string* Observations = GroupMsg->mutable_observations();
+			std::string* Rewards = GroupMsg->mutable_rewards();
+			std::string* Statuses = GroupMsg->mutable_statuses();
+			Observations->resize(Group.Members.Num() * ObsDims * sizeof(float));
+			Rewards->resize(Group.Members.Num() * sizeof(float));
+			Statuses->resize(Group.Members.Num());
+
+			float* ObsRows = reinterpret_cast<float*>(&(*Observations)[0]);
+			float* RewardValues = reinterpret_cast<float*>(&(*Rewards)[0]);
+			uint8* StatusValues = reinterpret_cast<uint8*>(&(*Statuses)[0]);
+
+			int NumAgents = 0;
+			for (const FAgentId& Member : Group.Members)
+			{
+				if (!IsIncluded(Member.EnvId, IncludedEnvs))
+				{
+					continue;
+				}
+
+				FTrainerState* const* AgentState = EnvironmentStates[Member.EnvId].AgentStates.Find(Member.AgentId);
+				if (!AgentState || (*AgentState)->TrainingMsgStatus == ETrainingMsgStatus::LastMsgSent)
+				{
+					continue;
+				}
+
+				ObsSpace.PackDimensions(*(*AgentState)->Observations, ObsRows + NumAgents * ObsDims);
+				RewardValues[NumAgents] = (*AgentState)->Reward;
+				StatusValues[NumAgents] = static_cast<uint8>((*AgentState)->GetProtoStatus());
+				GroupMsg->add_env_ids(Member.EnvId);
+				GroupMsg->add_agent_ids(Member.AgentId);
+				NumAgents++;
+			}
+
+			Observations->resize(NumAgents * ObsDims * sizeof(float));
+			Rewards->resize(NumAgents * sizeof(float));
+			Statuses->resize(NumAgents);
+		}
 	}
 
 	/**
@@ -256,13 +447,22 @@ struct FTrainingState
 	Schola::InitialTrainingState* ToResetProto(const TArray<int>& TargetEnvironments) const
 	{
 		Schola::InitialTrainingState* TrainingStateMessage = new Schola::InitialTrainingState();
+		this->ToResetProto(TargetEnvironments, *TrainingStateMessage);
+		return TrainingStateMessage;
+	}
+
+	/**
+	 * @brief Fill a protobuf message (Schola::InitialTrainingState) with the initial state of a subset of environments after a reset.
+	 * @param[in] TargetEnvironments The list of environment ids to include in the message
+	 * @param[out] OutMsg The protobuf message to add the environments to
+	 */
+	void ToResetProto(const TArray<int>& TargetEnvironments, Schola::InitialTrainingState& OutMsg) const
+	{
 		for (int EnvId : TargetEnvironments)
 		{
 			const FSharedEnvironmentState& EnvState = EnvironmentStates[EnvId];
 			// Fill the mappings
-			EnvState.ToResetProto((*TrainingStateMessage->mutable_environment_states())[EnvId]);
+			EnvState.ToResetProto((*OutMsg.mutable_environment_states())[EnvId]);
 		}
-
-		return TrainingStateMessage;
 	}
 };
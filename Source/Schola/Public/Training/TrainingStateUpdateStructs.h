@@ -138,6 +138,9 @@ struct SCHOLA_API FTrainingStateUpdate
 	/** Map from Environment Id, to Environment Update */
 	TSortedMap<int, FEnvUpdate> EnvUpdates;
 
+	/** Map from Environment Id, to the step of the state that its update answers. Only sent when stepping asynchronously */
+	TSortedMap<int, int> EnvSteps;
+
 	/** The status of the connector */
 	UPROPERTY()
 	EConnectorStatusUpdate Status = EConnectorStatusUpdate::NONE;
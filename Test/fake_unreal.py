@@ -0,0 +1,142 @@
+# Copyright (c) 2024 Advanced Micro Devices, Inc. All Rights Reserved.
+"""
+An in process stand-in for Unreal, so the client's decoding can be tested against hand built messages.
+"""
+
+from collections import deque
+from typing import Dict, List, Optional, Tuple
+from schola.core.unreal_connections import UnrealConnection
+import schola.generated.GymConnector_pb2 as gym_communication
+import schola.generated.Definitions_pb2 as env_definitions
+import schola.generated.State_pb2 as state
+import numpy as np
+
+class FakeFuture:
+    """
+    A finished future, standing in for the ones returned by a gRPC stub.
+    """
+    def __init__(self, result):
+        self._result = result
+
+    def result(self, timeout=None):
+        return self._result
+
+class FakeRpc:
+    """
+    A unary rpc that answers each call with the next queued response, or an empty message once they run out.
+
+    Parameters
+    ----------
+    response_type : type
+        The protobuf message type the rpc returns.
+
+    Attributes
+    ----------
+    requests : List
+        Every request the rpc was called with, in order.
+    responses : deque
+        The responses still to be returned.
+    """
+    def __init__(self, response_type):
+        self.response_type = response_type
+        self.requests = []
+        self.responses = deque()
+
+    def _respond(self, request):
+        self.requests.append(request)
+        return self.responses.popleft() if self.responses else self.response_type()
+
+    def __call__(self, request, **kwargs):
+        return self._respond(request)
+
+    def future(self, request, **kwargs):
+        return FakeFuture(self._respond(request))
+
+class FakeGymStub:
+    """
+    A stand-in for the GymService stub, answering from queued messages.
+    """
+    def __init__(self, training_definition : env_definitions.TrainingDefinition):
+        self.StartGymConnector = FakeRpc(gym_communication.GymConnectorStartResponse)
+        self.RequestTrainingDefinition = FakeRpc(env_definitions.TrainingDefinition)
+        self.RequestTrainingDefinition.responses.append(training_definition)
+        self.UpdateState = FakeRpc(state.TrainingState)
+        self.RequestInitialTrainingState = FakeRpc(state.InitialTrainingState)
+
+class FakeUnrealConnection(UnrealConnection):
+    """
+    A connection that hands out a FakeGymStub instead of connecting to Unreal.
+    """
+    def __init__(self, stub : FakeGymStub):
+        super().__init__("localhost", 8000)
+        self.stub = stub
+        self.active = False
+
+    def start(self) -> None:
+        self.active = True
+
+    def connect_stubs(self, *stubs):
+        return [self.stub for stub in stubs]
+
+    @property
+    def is_active(self) -> bool:
+        return self.active
+
+    def close(self) -> None:
+        self.active = False
+
+def add_box_space(space_msg, label : str, size : int) -> None:
+    """
+    Add a box subspace with bounds [-1, 1] in every dimension to a DictSpace message.
+    """
+    space_msg.labels.append(label)
+    dimensions = space_msg.values.add().box_space.dimensions
+    for _ in range(size):
+        dimension = dimensions.add()
+        dimension.low = -1.0
+        dimension.high = 1.0
+
+def add_discrete_space(space_msg, label : str, high : List[int]) -> None:
+    """
+    Add a discrete subspace with a branch of each size in high to a DictSpace message.
+    """
+    space_msg.labels.append(label)
+    space_msg.values.add().discrete_space.high.extend(high)
+
+def make_agent_definition(name : str, obs_size : int = 2, action_high : Tuple[int] = (3,)) -> env_definitions.AgentDefinition:
+    """
+    Make the definition of an agent observing a box of obs_size values, and acting with one discrete branch per entry in action_high.
+    """
+    definition = env_definitions.AgentDefinition(name=name)
+    add_box_space(definition.obs_space, "position", obs_size)
+    add_discrete_space(definition.action_space, "move", list(action_high))
+    return definition
+
+def make_training_definition(agents_per_env : List[int], **kwargs) -> env_definitions.TrainingDefinition:
+    """
+    Make a training definition with an environment for each entry in agents_per_env, holding that many agents made by make_agent_definition.
+    Extra keyword arguments are set on the message.
+    """
+    definition = env_definitions.TrainingDefinition(**kwargs)
+    for env_id, num_agents in enumerate(agents_per_env):
+        env_defn = definition.environment_definitions.add()
+        for agent_id in range(num_agents):
+            env_defn.agent_definitions[agent_id].CopyFrom(make_agent_definition(f"agent_{env_id}_{agent_id}"))
+    return definition
+
+def set_agent_state(env_state, agent_id : int, obs : List[float], reward : float = 0.0, status : int = state.Status.RUNNING, info : Optional[Dict[str,str]] = None) -> None:
+    """
+    Fill in the state of an agent observing a box, as made by make_agent_definition, in an EnvironmentState or InitialEnvironmentState message.
+    """
+    agent_state = env_state.agent_states[agent_id]
+    agent_state.observations.values.add().box_point.values.extend(obs)
+    if hasattr(agent_state, "reward"):
+        agent_state.reward = reward
+        agent_state.status = status
+    agent_state.info.update(info or {})
+
+def pack_floats(values) -> bytes:
+    """
+    Pack values the way Unreal writes dense arrays, as little-endian float32.
+    """
+    return np.asarray(values, dtype="<f4").tobytes()
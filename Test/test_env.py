@@ -0,0 +1,168 @@
+# Copyright (c) 2024 Advanced Micro Devices, Inc. All Rights Reserved.
+
+from schola.core.env import ScholaEnv
+from schola.core.error_manager import EnvironmentException
+from schola.gym.env import GymVectorEnv
+import schola.generated.State_pb2 as state
+from .fake_unreal import FakeGymStub, FakeUnrealConnection, make_training_definition, pack_floats, set_agent_state
+import numpy as np
+import pytest
+
+def make_env(training_definition):
+    stub = FakeGymStub(training_definition)
+    env = ScholaEnv(FakeUnrealConnection(stub))
+    return env, stub
+
+@pytest.fixture
+def dense_env():
+    definition = make_training_definition([2, 1])
+    definition.dense_groups.add(group_id=0, obs_dim=2, action_dim=1, env_ids=[0, 0, 1], agent_ids=[0, 1, 0])
+    env, stub = make_env(definition)
+    yield env, stub
+    env.close()
+
+def test_dense_state_is_split_per_agent(dense_env):
+    env, stub = dense_env
+    training_state = state.TrainingState()
+    group_state = training_state.dense_groups.add(group_id=0, env_ids=[0, 0, 1], agent_ids=[0, 1, 0])
+    group_state.observations = pack_floats([[0.1, 0.2], [0.3, 0.4], [0.5, 0.6]])
+    group_state.rewards = pack_floats([1.0, -1.0, 0.5])
+    group_state.statuses = bytes([state.Status.RUNNING, state.Status.COMPLETED, state.Status.TRUNCATED])
+    # only agents with an info are in the per agent states
+    training_state.environment_states.add().agent_states[1].info["score"] = "3"
+    training_state.environment_states.add()
+    stub.UpdateState.responses.append(training_state)
+
+    env.send_actions({0: {0: {"move": 0}, 1: {"move": 0}}, 1: {0: {"move": 0}}})
+    observations, rewards, terminateds, truncateds, infos = env.poll()
+
+    np.testing.assert_allclose(observations[0][0]["position"], [0.1, 0.2], rtol=1e-6)
+    np.testing.assert_allclose(observations[0][1]["position"], [0.3, 0.4], rtol=1e-6)
+    np.testing.assert_allclose(observations[1][0]["position"], [0.5, 0.6], rtol=1e-6)
+    assert rewards == {0: {0: 1.0, 1: -1.0}, 1: {0: 0.5}}
+    assert terminateds == {0: {0: False, 1: True}, 1: {0: False}}
+    assert truncateds == {0: {0: False, 1: False}, 1: {0: True}}
+    assert infos == {0: {0: {}, 1: {"score": "3"}}, 1: {0: {}}}
+
+def test_dense_actions_are_packed_per_group(dense_env):
+    env, stub = dense_env
+    env.send_actions({0: {0: {"move": 2}, 1: {"move": 0}}, 1: {0: {"move": 1}}})
+    # an empty state makes poll ask again, so answer the second time with a state to return
+    training_state = state.TrainingState()
+    training_state.dense_groups.add(group_id=0, env_ids=[0], agent_ids=[0], observations=pack_floats([0.0, 0.0]), rewards=pack_floats([0.0]), statuses=bytes(1))
+    stub.UpdateState.responses.extend([state.TrainingState(), training_state])
+    env.poll()
+
+    update = stub.UpdateState.requests[0]
+    assert len(update.updates) == 0
+    assert len(update.dense_actions) == 1
+    group_actions = update.dense_actions[0]
+    assert group_actions.group_id == 0
+    sent = {(env_id, agent_id): action for env_id, agent_id, action in zip(group_actions.env_ids, group_actions.agent_ids, np.frombuffer(group_actions.actions, dtype="<f4"))}
+    assert sent == {(0, 0): 2.0, (0, 1): 0.0, (1, 0): 1.0}
+
+@pytest.fixture
+def pipelined_env():
+    # environment i is in cohort i % 2
+    env, stub = make_env(make_training_definition([1, 1, 1, 1], num_pipeline_cohorts=2))
+    yield env, stub
+    env.close()
+
+def make_initial_state(env_ids):
+    initial_state = state.InitialTrainingState()
+    for env_id in env_ids:
+        set_agent_state(initial_state.environment_states[env_id], 0, [float(env_id), 0.0], info={"env": str(env_id)})
+    return initial_state
+
+def test_pipelined_reset_keeps_other_cohorts(pipelined_env):
+    env, stub = pipelined_env
+    assert env.num_pipeline_cohorts == 2
+    # one reset answers for every cohort
+    stub.RequestInitialTrainingState.responses.append(make_initial_state([0, 1, 2, 3]))
+
+    observations, infos = env.soft_reset([0, 2])
+    assert sorted(observations) == [0, 2]
+    assert infos[2][0] == {"env": "2"}
+
+    # the other cohort's states were kept, rather than asked for again
+    observations, infos = env.soft_reset([1, 3])
+    assert sorted(observations) == [1, 3]
+    np.testing.assert_allclose(observations[3][0]["position"], [3.0, 0.0])
+    assert len(stub.RequestInitialTrainingState.requests) == 1
+
+def test_pipelined_hard_reset_drops_kept_states(pipelined_env):
+    env, stub = pipelined_env
+    stub.RequestInitialTrainingState.responses.extend([make_initial_state([0, 1, 2, 3]), make_initial_state([0, 1, 2, 3])])
+    env.soft_reset([0, 2])
+
+    env.hard_reset()
+    assert len(stub.RequestInitialTrainingState.requests) == 2
+    assert env.pending_resets == ({}, {})
+
+def test_pipelined_poll_returns_one_cohort(pipelined_env):
+    env, stub = pipelined_env
+    training_state = state.TrainingState()
+    for env_id in range(4):
+        env_state = training_state.environment_states.add()
+        if env_id % 2 == 1:
+            set_agent_state(env_state, 0, [float(env_id), 1.0], reward=float(env_id))
+    stub.UpdateState.responses.append(training_state)
+
+    env.send_actions({0: {0: {"move": 1}}, 2: {0: {"move": 2}}})
+    observations, rewards, terminateds, truncateds, infos = env.poll()
+
+    assert sorted(observations) == [1, 3]
+    assert rewards == {1: {0: 1.0}, 3: {0: 3.0}}
+    # only the cohort that was sent actions is updated
+    assert sorted(stub.UpdateState.requests[0].updates) == [0, 2]
+
+def test_vector_env_rejects_pipelining():
+    stub = FakeGymStub(make_training_definition([1, 1], num_pipeline_cohorts=2))
+    with pytest.raises(EnvironmentException):
+        GymVectorEnv(FakeUnrealConnection(stub))
+
+@pytest.fixture
+def two_env():
+    env, stub = make_env(make_training_definition([1, 1]))
+    yield env, stub
+    env.close()
+
+def make_in_band_reset_state():
+    # environment 1 completed this step, and Unreal reset it straight away
+    training_state = state.TrainingState()
+    set_agent_state(training_state.environment_states.add(), 0, [0.1, 0.1], reward=0.0)
+    set_agent_state(training_state.environment_states.add(), 0, [0.9, 0.9], reward=1.0, status=state.Status.COMPLETED)
+    set_agent_state(training_state.reset_state.environment_states[1], 0, [0.5, -0.5], info={"episode": "2"})
+    return training_state
+
+def test_in_band_reset_is_used_by_soft_reset(two_env):
+    env, stub = two_env
+    stub.UpdateState.responses.append(make_in_band_reset_state())
+    env.send_actions({0: {0: {"move": 0}}, 1: {0: {"move": 0}}})
+    observations, rewards, terminateds, truncateds, infos = env.poll()
+
+    # the step still reports the terminal observation, not the one after the reset
+    np.testing.assert_allclose(observations[1][0]["position"], [0.9, 0.9], rtol=1e-6)
+    assert terminateds == {0: {0: False}, 1: {0: True}}
+
+    observations, infos = env.soft_reset([1])
+    np.testing.assert_allclose(observations[1][0]["position"], [0.5, -0.5])
+    assert infos == {1: {0: {"episode": "2"}}}
+    assert len(stub.RequestInitialTrainingState.requests) == 0
+    assert env.pending_resets == ({}, {})
+
+def test_in_band_reset_is_dropped_by_hard_reset(two_env):
+    env, stub = two_env
+    stub.UpdateState.responses.append(make_in_band_reset_state())
+    env.send_actions({0: {0: {"move": 0}}, 1: {0: {"move": 0}}})
+    env.poll()
+
+    # a hard reset resets the environment again, so the state from the step is out of date
+    reset_state = state.InitialTrainingState()
+    for env_id in range(2):
+        set_agent_state(reset_state.environment_states[env_id], 0, [0.0, float(env_id)])
+    stub.RequestInitialTrainingState.responses.append(reset_state)
+    observations, infos = env.hard_reset()
+
+    np.testing.assert_allclose(observations[1][0]["position"], [0.0, 1.0])
+    assert len(stub.RequestInitialTrainingState.requests) == 1
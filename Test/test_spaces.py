@@ -0,0 +1,62 @@
+# Copyright (c) 2024 Advanced Micro Devices, Inc. All Rights Reserved.
+
+from schola.core.spaces import DictSpace, BoxSpace, MultiDiscreteSpace, MultiBinarySpace
+import schola.generated.Points_pb2 as proto_points
+import numpy as np
+import pytest
+
+@pytest.fixture
+def bits():
+    # spans three of Unreal's 64 bit words, with the last one only partly used
+    values = np.zeros(130, dtype=bool)
+    values[[0, 63, 64, 129]] = True
+    return values
+
+def test_packed_binary_point_matches_unpacked(bits):
+    space = MultiBinarySpace(len(bits))
+
+    packed_msg = proto_points.FundamentalPoint()
+    # Unreal stores bit i in byte i // 8 at position i % 8
+    packed_msg.binary_point.packed_values = np.packbits(bits, bitorder="little").tobytes()
+    packed_msg.binary_point.num_packed_values = len(bits)
+
+    unpacked_msg = proto_points.FundamentalPoint()
+    space.fill_proto(unpacked_msg, bits.tolist())
+
+    np.testing.assert_array_equal(space.process_data(packed_msg), bits)
+    np.testing.assert_array_equal(space.process_data(unpacked_msg), bits)
+
+def test_packed_binary_point_ignores_padding(bits):
+    space = MultiBinarySpace(len(bits))
+    packed = bytearray(np.packbits(bits, bitorder="little").tobytes())
+    # the unused bits of the last byte are never read
+    packed[-1] |= 0b11111100
+
+    msg = proto_points.FundamentalPoint()
+    msg.binary_point.packed_values = bytes(packed)
+    msg.binary_point.num_packed_values = len(bits)
+
+    result = space.process_data(msg)
+    assert result.shape == (len(bits),)
+    np.testing.assert_array_equal(result, bits)
+
+def test_dense_batch_round_trip():
+    space = DictSpace({"position": BoxSpace([-1, -1], [1, 1]), "move": MultiDiscreteSpace([3, 2]), "mask": MultiBinarySpace(3)})
+    points = [
+        {"position": np.array([0.5, -0.25]), "move": np.array([2, 1]), "mask": np.array([True, False, True])},
+        {"position": np.array([-1.0, 1.0]), "move": np.array([0, 0]), "mask": np.array([False, False, False])},
+    ]
+
+    batch = space.fill_dense(points)
+    # one float per dimension, so discrete values are indices rather than one-hot
+    assert batch.shape == (len(points), space.dense_dim) == (2, 7)
+    assert batch.dtype == np.float32
+
+    # the client decodes what Unreal sends with np.frombuffer, so go through the wire format
+    decoded = space.process_dense_data(np.frombuffer(batch.astype("<f4").tobytes(), dtype="<f4").reshape(-1, space.dense_dim))
+    assert len(decoded) == len(points)
+    for point, decoded_point in zip(points, decoded):
+        np.testing.assert_allclose(decoded_point["position"], point["position"])
+        np.testing.assert_array_equal(decoded_point["move"], point["move"])
+        assert decoded_point["move"].dtype == np.int64
+        np.testing.assert_array_equal(decoded_point["mask"], point["mask"])